@@ -230,6 +230,15 @@ public:
    * is no Set accessor. */
   itkGetConstReferenceMacro(InverseDirection, DirectionType);
 
+  /** Get the matrices that map an index offset to a physical vector, and a
+   * physical vector to a continuous index offset. They combine the direction
+   * and the spacing, and are calculated automatically in SetDirection and
+   * SetSpacing. */
+  /** @ITKStartGrouping */
+  itkGetConstReferenceMacro(IndexToPhysicalPoint, DirectionType);
+  itkGetConstReferenceMacro(PhysicalPointToIndex, DirectionType);
+  /** @ITKEndGrouping */
+
   /** Get the spacing (size of a pixel) of the image. The
    * spacing is the geometric distance between image samples along
    * each dimension. The value returned is a Vector<double, VImageDimension>.
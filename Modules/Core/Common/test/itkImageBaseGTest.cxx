@@ -191,3 +191,33 @@ TEST(ImageBase, InvalidSpacingExceptions)
   CheckInvalidSpacingExceptions<2>();
   CheckInvalidSpacingExceptions<3>();
 }
+
+// Tests that the index-to-physical-point matrices agree with the Transform
+// member functions of an image with a non-identity direction.
+TEST(ImageBase, IndexToPhysicalPointMatrices)
+{
+  using ImageBaseType = itk::ImageBase<2>;
+  const auto image = ImageBaseType::New();
+
+  image->SetSpacing(itk::MakeVector(0.5, 2.0));
+  image->SetOrigin(itk::MakePoint(3.0, -1.0));
+  ImageBaseType::DirectionType direction;
+  direction[0][0] = 0.6;
+  direction[0][1] = -0.8;
+  direction[1][0] = 0.8;
+  direction[1][1] = 0.6;
+  image->SetDirection(direction);
+
+  itk::ContinuousIndex<double, 2> index;
+  index[0] = 1.5;
+  index[1] = -4.0;
+  const auto point = image->TransformContinuousIndexToPhysicalPoint<double>(index);
+
+  const auto offsetPoint = image->GetIndexToPhysicalPoint() * index.GetVectorFromOrigin();
+  const auto offsetIndex = image->GetPhysicalPointToIndex() * (point - image->GetOrigin());
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    EXPECT_NEAR(offsetPoint[i], point[i] - image->GetOrigin()[i], 1e-12);
+    EXPECT_NEAR(offsetIndex[i], index[i], 1e-12);
+  }
+}
@@ -53,7 +53,8 @@ namespace itk
  * \par
  * We then go through the 3D volume voxel by voxel, using those two tables we have defined
  * to construct elements within each voxel. We then merge all these mesh elements into
- * one 3D mesh.
+ * one 3D mesh. The voxels are classified in parallel, by slices; only the voxels
+ * crossing the surface are then merged, in order.
  *
  * \par PARAMETERS
  * The ObjectValue parameter is used to identify the object. In most applications,
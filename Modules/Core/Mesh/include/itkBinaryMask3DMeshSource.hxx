@@ -21,7 +21,9 @@
 #include "itkContinuousIndex.h"
 #include "itkNumericTraits.h"
 #include "itkMath.h"
+#include "itkMultiThreaderBase.h"
 #include "itkPrintHelper.h"
+#include <vector>
 
 namespace itk
 {
@@ -1010,36 +1012,117 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::CreateMesh()
   m_InputImage = this->GetInput();
   m_InputImage = static_cast<const InputImageType *>(this->ProcessObject::GetInput(0));
 
-  InputImageIterator it1(m_InputImage, m_RegionOfInterest);
-  InputImageIterator it2(m_InputImage, m_RegionOfInterest);
-  InputImageIterator it3(m_InputImage, m_RegionOfInterest);
-  InputImageIterator it4(m_InputImage, m_RegionOfInterest);
-
   InputImageSizeType inputImageSize = m_RegionOfInterest.GetSize();
   m_ImageWidth = inputImageSize[0];
   m_ImageHeight = inputImageSize[1];
   m_ImageDepth = inputImageSize[2];
   const int frame = m_ImageWidth * m_ImageHeight;
   const int row = m_ImageWidth;
-  {
-    int i = 0;
 
-    while (i < frame)
+  // Mark the object pixels of the region of interest, one slice per work unit
+  std::vector<unsigned char> isObject(m_RegionOfInterest.GetNumberOfPixels());
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    m_ImageDepth,
+    [this, frame, &isObject](SizeValueType z) {
+      RegionType slice = m_RegionOfInterest;
+      slice.SetIndex(2, m_RegionOfInterest.GetIndex(2) + static_cast<IndexValueType>(z));
+      slice.SetSize(2, 1);
+      unsigned char * object = isObject.data() + z * frame;
+      for (InputImageIterator it(m_InputImage, slice); !it.IsAtEnd(); ++it)
+      {
+        *object++ = Math::ExactlyEquals(it.Value(), m_ObjectValue);
+      }
+    },
+    nullptr);
+
+  // Compute the node combination of each voxel, whose nodes are the pixels
+  // i, i + 1, i + row, i + row + 1 and the same pixels in the next frame
+  const int  numberOfVoxels = std::max(static_cast<int>(isObject.size()) - frame - row, 0);
+  const auto vertexIndex = [this, frame, row, &isObject](int i) -> unsigned char {
+    unsigned char vertexindex = 0;
+
+    if (isObject[i])
     {
-      ++it3;
-      ++it4;
-      ++i;
+      vertexindex += 1;
+    }
+    if (isObject[i + row])
+    {
+      vertexindex += 8;
+    }
+    if (isObject[i + frame])
+    {
+      vertexindex += 16;
+    }
+    if (isObject[i + frame + row])
+    {
+      vertexindex += 128;
     }
 
-    i = 0;
-
-    while (i < row)
+    if ((i % m_ImageWidth < m_ImageWidth - 1) &&
+        ((i % (m_ImageWidth * m_ImageHeight)) / m_ImageWidth < m_ImageHeight - 1))
     {
-      ++it2;
-      ++it4;
-      ++i;
+      if (isObject[i + 1])
+      {
+        vertexindex += 2;
+      }
+      if (isObject[i + row + 1])
+      {
+        vertexindex += 4;
+      }
+      if (isObject[i + frame + 1])
+      {
+        vertexindex += 32;
+      }
+      if (isObject[i + frame + row + 1])
+      {
+        vertexindex += 64;
+      }
     }
-  }
+    else
+    {
+      if ((i % (m_ImageWidth * m_ImageHeight)) / m_ImageWidth == m_ImageHeight - 1)
+      {
+        if (vertexindex > 50)
+        {
+          vertexindex -= 128;
+        }
+        if (((vertexindex > 7) && (vertexindex < 10)) || (vertexindex > 17))
+        {
+          vertexindex -= 8;
+        }
+        if (isObject[i + 1])
+        {
+          vertexindex += 2;
+        }
+        if (isObject[i + frame + 1])
+        {
+          vertexindex += 32;
+        }
+      }
+    }
+    return vertexindex;
+  };
+
+  // Collect the voxels crossing the surface, one frame per work unit
+  const int numberOfFrames = (numberOfVoxels + frame - 1) / std::max(frame, 1);
+  std::vector<std::vector<std::pair<int, unsigned char>>> surfaceVoxels(numberOfFrames);
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    numberOfFrames,
+    [frame, numberOfVoxels, &vertexIndex, &surfaceVoxels](SizeValueType z) {
+      const int end = std::min(static_cast<int>(z + 1) * frame, numberOfVoxels);
+      for (int i = static_cast<int>(z) * frame; i < end; ++i)
+      {
+        const unsigned char vertexindex = vertexIndex(i);
+        if ((vertexindex != 0) && (vertexindex != 255))
+        {
+          surfaceVoxels[z].emplace_back(i, vertexindex);
+        }
+      }
+    },
+    nullptr);
 
   if (m_CurrentRow)
   {
@@ -1071,89 +1154,16 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::CreateMesh()
     m_CurrentFrame[i] = static_cast<IdentifierType *>(malloc(2 * sizeof(IdentifierType)));
   }
 
+  // Merge the elements of the surface voxels, in order
+  for (const auto & voxels : surfaceVoxels)
   {
-    int i = 0;
-    while (!it4.IsAtEnd())
+    for (const auto & voxel : voxels)
     {
-      unsigned char vertexindex = 0;
-
-      if (Math::ExactlyEquals(it1.Value(), m_ObjectValue))
-      {
-        vertexindex += 1;
-      }
-      if (Math::ExactlyEquals(it2.Value(), m_ObjectValue))
-      {
-        vertexindex += 8;
-      }
-      if (Math::ExactlyEquals(it3.Value(), m_ObjectValue))
-      {
-        vertexindex += 16;
-      }
-      if (Math::ExactlyEquals(it4.Value(), m_ObjectValue))
-      {
-        vertexindex += 128;
-      }
-      ++it1;
-      ++it2;
-      ++it3;
-      ++it4;
-
-      if ((i % m_ImageWidth < m_ImageWidth - 1) &&
-          ((i % (m_ImageWidth * m_ImageHeight)) / m_ImageWidth < m_ImageHeight - 1))
-      {
-        if (Math::ExactlyEquals(it1.Value(), m_ObjectValue))
-        {
-          vertexindex += 2;
-        }
-        if (Math::ExactlyEquals(it2.Value(), m_ObjectValue))
-        {
-          vertexindex += 4;
-        }
-        if (Math::ExactlyEquals(it3.Value(), m_ObjectValue))
-        {
-          vertexindex += 32;
-        }
-        if (Math::ExactlyEquals(it4.Value(), m_ObjectValue))
-        {
-          vertexindex += 64;
-        }
-      }
-      else
-      {
-        if ((i % (m_ImageWidth * m_ImageHeight)) / m_ImageWidth == m_ImageHeight - 1)
-        {
-          if (vertexindex > 50)
-          {
-            vertexindex -= 128;
-          }
-          if (((vertexindex > 7) && (vertexindex < 10)) || (vertexindex > 17))
-          {
-            vertexindex -= 8;
-          }
-          if (Math::ExactlyEquals(it1.Value(), m_ObjectValue))
-          {
-            vertexindex += 2;
-          }
-          if (Math::ExactlyEquals(it3.Value(), m_ObjectValue))
-          {
-            vertexindex += 32;
-          }
-        }
-      }
       for (auto & voxelElem : m_CurrentVoxel)
       {
         voxelElem = 0;
       }
-
-      if ((vertexindex == 0) || (vertexindex == 255))
-      {
-        //      for ( j=0; j<13; j++ ) m_LastVoxel[j] = 0;
-      }
-      else
-      {
-        this->AddCells(m_LUT[vertexindex][0], m_LUT[vertexindex][1], i);
-      }
-      ++i;
+      this->AddCells(m_LUT[voxel.second][0], m_LUT[voxel.second][1], voxel.first);
     }
   }
 
@@ -36,6 +36,8 @@
 #include "itkMapContainer.h"
 #include "itkCommonEnums.h"
 #include "ITKMeshExport.h"
+#include <atomic>
+#include <mutex>
 #include <vector>
 #include <set>
 #include "itkVectorContainer.h"
@@ -82,6 +84,19 @@ namespace itk
  * intersection does not need to be performed); then Mesh can be further
  * extended by adding explicit boundary assignments.
  *
+ * \par Compact cells
+ * Instead of one cell object per cell, the cells can be stored compactly as
+ * arrays of point identifiers in compressed sparse row format, see
+ * SetCompactCells(). Meshes with cells of a single type only store the point
+ * identifiers; meshes with mixed cell types also store the type and the
+ * offset of each cell. Compact cells are read-only: GetCell() returns a
+ * newly created cell, and Accept() visits lightweight cell views that are
+ * only valid during the visit. Methods that need the cell objects, such as
+ * GetCells() or SetCell(), convert the compact cells into cell objects first.
+ * The const methods keep the compact cells, so that a const mesh can be read
+ * from several threads at once; the methods that may modify the cells release
+ * them.
+ *
  * \par Usage
  * Mesh has three template parameters.  The first is the pixel type, or the
  * type of data stored (optionally) with points, cells, and/or boundaries.
@@ -191,6 +206,15 @@ public:
   using CellsVectorContainer = itk::VectorContainer<IdentifierType>;
   using CellsVectorContainerPointer = CellsVectorContainer::Pointer;
 
+  /** Containers of the compact cells: the cell types, the offsets of the
+   * cells in the point identifiers, and the point identifiers. */
+  using CellGeometryContainer = itk::VectorContainer<CellGeometryEnum>;
+  using CellGeometryContainerPointer = typename CellGeometryContainer::Pointer;
+  using CellOffsetsContainer = itk::VectorContainer<SizeValueType>;
+  using CellOffsetsContainerPointer = typename CellOffsetsContainer::Pointer;
+  using CellPointIdsContainer = itk::VectorContainer<PointIdentifier>;
+  using CellPointIdsContainerPointer = typename CellPointIdsContainer::Pointer;
+
   /** Used to support geometric operations on the toolkit. */
   using BoundingBoxType = BoundingBox<PointIdentifier, Self::PointDimension, CoordinateType, PointsContainer>;
 
@@ -231,6 +255,7 @@ public:
   using OutputQuadraticEdgeCellType = itk::QuadraticEdgeCell<CellType>;
   using OutputQuadraticTriangleCellType = itk::QuadraticTriangleCell<CellType>;
   using CellAutoPointer = typename CellType::CellAutoPointer;
+  using PointIdConstIterator = typename CellType::PointIdConstIterator;
 
   /** Visiting cells. */
   using CellMultiVisitorType = typename CellType::MultiVisitor;
@@ -296,8 +321,9 @@ public:
 
 protected:
   /** Holds cells used by the mesh.  Individual cells are accessed
-   *  through cell identifiers.  */
-  CellsContainerPointer m_CellsContainer{};
+   *  through cell identifiers.  Compact cells are expanded into this
+   *  container when it is first requested. */
+  mutable CellsContainerPointer m_CellsContainer{};
 
   CellsVectorContainerPointer cellOutputVectorContainer;
   /** An object containing data associated with the mesh's cells.
@@ -392,6 +418,55 @@ public:
   virtual CellsVectorContainer *
   GetCellsArray();
 
+  /** Set the cells as compact cells of a single type with a fixed number of
+   * points, such as triangles or tetrahedra. The point identifiers of cell
+   * i are stored at positions [i * n, (i + 1) * n) of \a pointIds, where n
+   * is the number of points of the cell type. The container is shared, and
+   * must not be modified afterwards. Previous cells are released. */
+  void
+  SetCompactCells(CellGeometryEnum cellType, CellPointIdsContainer * pointIds);
+
+  /** Set the cells as compact cells of mixed types. The point identifiers
+   * of cell i are stored at positions [offsets[i], offsets[i + 1]) of
+   * \a pointIds, so \a offsets holds one more element than \a cellTypes,
+   * and its last element is the number of point identifiers. */
+  void
+  SetCompactCells(CellGeometryContainer * cellTypes, CellOffsetsContainer * offsets, CellPointIdsContainer * pointIds);
+
+  /** Check whether the cells are stored as compact cells. */
+  [[nodiscard]] bool
+  HasCompactCells() const;
+
+  /** Get the containers of the compact cells. The cell types and the
+   * offsets are nullptr when all cells have the same type. */
+  /** @ITKStartGrouping */
+  [[nodiscard]] const CellGeometryContainer *
+  GetCompactCellTypes() const;
+  [[nodiscard]] const CellOffsetsContainer *
+  GetCompactCellOffsets() const;
+  [[nodiscard]] const CellPointIdsContainer *
+  GetCompactCellPointIds() const;
+  /** @ITKEndGrouping */
+
+  /** Get the type and the point identifiers of a compact cell, without
+   * creating a cell object. */
+  /** @ITKStartGrouping */
+  [[nodiscard]] CellGeometryEnum
+  GetCompactCellType(CellIdentifier cellId) const;
+  [[nodiscard]] PointIdConstIterator
+  GetCompactCellPointIdsBegin(CellIdentifier cellId) const;
+  [[nodiscard]] PointIdConstIterator
+  GetCompactCellPointIdsEnd(CellIdentifier cellId) const;
+  /** @ITKEndGrouping */
+
+  /** Create the cell objects of the compact cells in the cells container,
+   * once. Nothing is done if the cells are not compact, or were already
+   * expanded. The compact cells are kept until the cells may be modified,
+   * e.g. by GetCells() or SetCell(). This method is thread-safe: the const
+   * accessors of the cells, such as GetCells() const, call it on demand. */
+  void
+  ExpandCompactCells() const;
+
   /** Get the cells container. */
   CellsContainer *
   GetCells();
@@ -599,9 +674,32 @@ protected:
 private:
   MeshClassCellsAllocationMethodEnum m_CellsAllocationMethod{};
 
+  /** Compact cells. The cell types and offsets are only stored for mixed
+   * cell types; otherwise all cells have the type m_CompactCellType and
+   * m_CompactCellNumberOfPoints points. */
+  CellGeometryContainerPointer m_CompactCellTypes{};
+  CellOffsetsContainerPointer  m_CompactCellOffsets{};
+  CellPointIdsContainerPointer m_CompactCellPointIds{};
+  CellGeometryEnum             m_CompactCellType{ CellGeometryEnum::MAX_ITK_CELLS };
+  SizeValueType                m_CompactCellNumberOfPoints{ 0 };
+
+  /** Whether the cell objects of the compact cells were created, and the
+   * mutex which serializes their creation. */
+  mutable std::atomic<bool> m_CompactCellsExpanded{ false };
+  mutable std::mutex        m_CompactCellsMutex{};
+
   /** Create a new cell of a given type. */
   void
-  CreateCell(int cellType, CellAutoPointer &);
+  CreateCell(int cellType, CellAutoPointer &) const;
+
+  /** Release the compact cells. */
+  void
+  ReleaseCompactCells();
+
+  /** Expand the compact cells, and release them before the cells are
+   * modified. */
+  void
+  ConvertCompactCells();
 }; // End Class: Mesh
 
 /** Define how to print enumeration */
@@ -30,6 +30,7 @@
 
 #include "itkProcessObject.h"
 #include <algorithm>
+#include <array>
 #include <iterator>
 
 namespace itk
@@ -42,7 +43,8 @@ Mesh<TPixelType, VDimension, TMeshTraits>::PrintSelf(std::ostream & os, Indent i
   os << indent << "Number Of Points: " << ((this->m_PointsContainer.GetPointer()) ? this->m_PointsContainer->Size() : 0)
      << std::endl;
   os << indent << "Number Of Cell Links: " << ((m_CellLinksContainer) ? m_CellLinksContainer->Size() : 0) << std::endl;
-  os << indent << "Number Of Cells: " << ((m_CellsContainer) ? m_CellsContainer->Size() : 0) << std::endl;
+  os << indent << "Number Of Cells: " << this->GetNumberOfCells() << std::endl;
+  os << indent << "Compact Cells: " << this->HasCompactCells() << std::endl;
   os << indent
      << "Cell Data Container pointer: " << ((m_CellDataContainer) ? m_CellDataContainer.GetPointer() : nullptr)
      << std::endl;
@@ -110,6 +112,24 @@ Mesh<TPixelType, VDimension, TMeshTraits>::GetCellsArray() -> CellsVectorContain
   }
 
   IdentifierType index = 0;
+  if (this->HasCompactCells())
+  {
+    const CellIdentifier numberOfCells = this->GetNumberOfCells();
+    cellOutputVectorContainer->Reserve(2 * numberOfCells + m_CompactCellPointIds->Size());
+    for (CellIdentifier cellId = 0; cellId < numberOfCells; ++cellId)
+    {
+      const PointIdConstIterator first = this->GetCompactCellPointIdsBegin(cellId);
+      const PointIdConstIterator last = this->GetCompactCellPointIdsEnd(cellId);
+      cellOutputVectorContainer->SetElement(index++, static_cast<IdentifierType>(this->GetCompactCellType(cellId)));
+      cellOutputVectorContainer->SetElement(index++, static_cast<IdentifierType>(last - first));
+      for (PointIdConstIterator pointId = first; pointId != last; ++pointId)
+      {
+        cellOutputVectorContainer->SetElement(index++, *pointId);
+      }
+    }
+    return cellOutputVectorContainer;
+  }
+
   for (auto cellItr = m_CellsContainer->Begin(); cellItr != m_CellsContainer->End(); ++cellItr)
   {
     auto               cellPointer = cellItr->Value();
@@ -134,7 +154,7 @@ Mesh<TPixelType, VDimension, TMeshTraits>::GetCellsArray() -> CellsVectorContain
 
 template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 void
-Mesh<TPixelType, VDimension, TMeshTraits>::CreateCell(int cellType, CellAutoPointer & cellPointer)
+Mesh<TPixelType, VDimension, TMeshTraits>::CreateCell(int cellType, CellAutoPointer & cellPointer) const
 {
   auto cellTypeEnum = static_cast<CellGeometryEnum>(cellType);
 
@@ -236,6 +256,7 @@ template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 auto
 Mesh<TPixelType, VDimension, TMeshTraits>::GetCells() -> CellsContainer *
 {
+  this->ConvertCompactCells();
   itkDebugMacro("returning Cells container of " << m_CellsContainer);
   return m_CellsContainer;
 }
@@ -244,6 +265,7 @@ template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 auto
 Mesh<TPixelType, VDimension, TMeshTraits>::GetCells() const -> const CellsContainer *
 {
+  this->ExpandCompactCells();
   itkDebugMacro("returning Cells container of " << m_CellsContainer);
   return m_CellsContainer;
 }
@@ -328,6 +350,8 @@ template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 void
 Mesh<TPixelType, VDimension, TMeshTraits>::SetCell(CellIdentifier cellId, CellAutoPointer & cellPointer)
 {
+  this->ConvertCompactCells();
+
   /**
    * Make sure a cells container exists.
    */
@@ -346,6 +370,21 @@ template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 bool
 Mesh<TPixelType, VDimension, TMeshTraits>::GetCell(CellIdentifier cellId, CellAutoPointer & cellPointer) const
 {
+  /**
+   * A compact cell is returned as a new cell owned by the caller.
+   */
+  if (this->HasCompactCells())
+  {
+    if (cellId >= this->GetNumberOfCells())
+    {
+      cellPointer.Reset();
+      return false;
+    }
+    this->CreateCell(static_cast<int>(this->GetCompactCellType(cellId)), cellPointer);
+    cellPointer->SetPointIds(this->GetCompactCellPointIdsBegin(cellId), this->GetCompactCellPointIdsEnd(cellId));
+    return true;
+  }
+
   /**
    * If the cells container doesn't exist, then the cell doesn't exist.
    */
@@ -499,6 +538,8 @@ auto
 Mesh<TPixelType, VDimension, TMeshTraits>::GetNumberOfCellBoundaryFeatures(int dimension, CellIdentifier cellId) const
   -> CellFeatureCount
 {
+  this->ExpandCompactCells();
+
   /**
    * Make sure the cell container exists and contains the given cell Id.
    */
@@ -528,6 +569,12 @@ template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 auto
 Mesh<TPixelType, VDimension, TMeshTraits>::GetNumberOfCells() const -> CellIdentifier
 {
+  if (m_CompactCellPointIds)
+  {
+    return m_CompactCellTypes ? m_CompactCellTypes->Size()
+                              : m_CompactCellPointIds->Size() / m_CompactCellNumberOfPoints;
+  }
+
   if (!m_CellsContainer)
   {
     return 0;
@@ -557,6 +604,8 @@ Mesh<TPixelType, VDimension, TMeshTraits>::GetCellBoundaryFeature(int
                                                                   CellFeatureIdentifier featureId,
                                                                   CellAutoPointer &     boundary) const
 {
+  this->ExpandCompactCells();
+
   /**
    * First check if the boundary has been explicitly assigned.
    */
@@ -604,6 +653,8 @@ Mesh<TPixelType, VDimension, TMeshTraits>::GetCellBoundaryFeatureNeighbors(int
                                                                            std::set<CellIdentifier> * cellSet)
   -> CellIdentifier
 {
+  this->ExpandCompactCells();
+
   /**
    * Sanity check on mesh status.
    */
@@ -737,6 +788,8 @@ auto
 Mesh<TPixelType, VDimension, TMeshTraits>::GetCellNeighbors(CellIdentifier cellId, std::set<CellIdentifier> * cellSet)
   -> CellIdentifier
 {
+  this->ExpandCompactCells();
+
   /**
    * Sanity check on mesh status.
    */
@@ -859,6 +912,8 @@ Mesh<TPixelType, VDimension, TMeshTraits>::GetAssignedCellBoundaryIfOneExists(in
                                                                               CellFeatureIdentifier featureId,
                                                                               CellAutoPointer &     boundary) const
 {
+  this->ExpandCompactCells();
+
   if (m_BoundaryAssignmentsContainers[dimension].IsNotNull())
   {
     const BoundaryAssignmentIdentifier assignId(cellId, featureId);
@@ -885,6 +940,27 @@ template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 void
 Mesh<TPixelType, VDimension, TMeshTraits>::Accept(CellMultiVisitorType * mv) const
 {
+  if (this->HasCompactCells())
+  {
+    // A single cell of each geometry is reused as a view on the point
+    // identifiers of all the compact cells of that geometry.
+    std::array<CellAutoPointer, static_cast<size_t>(CellGeometryEnum::LAST_ITK_CELL) + 1> views;
+
+    const CellIdentifier numberOfCells = this->GetNumberOfCells();
+    for (CellIdentifier cellId = 0; cellId < numberOfCells; ++cellId)
+    {
+      const auto        cellType = this->GetCompactCellType(cellId);
+      CellAutoPointer & view = views[static_cast<size_t>(cellType)];
+      if (!view)
+      {
+        this->CreateCell(static_cast<int>(cellType), view);
+      }
+      view->SetPointIds(this->GetCompactCellPointIdsBegin(cellId), this->GetCompactCellPointIdsEnd(cellId));
+      view->Accept(cellId, mv);
+    }
+    return;
+  }
+
   if (!this->m_CellsContainer)
   {
     return;
@@ -929,6 +1005,23 @@ Mesh<TPixelType, VDimension, TMeshTraits>::BuildCellLinks() const
     this->m_CellLinksContainer = CellLinksContainer::New();
   }
 
+  /**
+   * Compact cells are linked directly from their point identifiers.
+   */
+  if (this->HasCompactCells())
+  {
+    const CellIdentifier numberOfCells = this->GetNumberOfCells();
+    for (CellIdentifier cellId = 0; cellId < numberOfCells; ++cellId)
+    {
+      const PointIdConstIterator last = this->GetCompactCellPointIdsEnd(cellId);
+      for (PointIdConstIterator pointId = this->GetCompactCellPointIdsBegin(cellId); pointId != last; ++pointId)
+      {
+        (m_CellLinksContainer->CreateElementAt(*pointId)).insert(cellId);
+      }
+    }
+    return;
+  }
+
   /**
    * Loop through each cell, and add its identifier to the CellLinks of each
    * of its points.
@@ -972,6 +1065,8 @@ void
 Mesh<TPixelType, VDimension, TMeshTraits>::ReleaseCellsMemory()
 {
   itkDebugMacro("Mesh  ReleaseCellsMemory method ");
+  this->ReleaseCompactCells();
+
   // Cells are stored as normal pointers in the CellContainer.
   //
   // The following cases are assumed here:
@@ -1089,12 +1184,183 @@ Mesh<TPixelType, VDimension, TMeshTraits>::Graft(const DataObject * data)
   this->m_CellDataContainer = mesh->m_CellDataContainer;
   this->m_CellLinksContainer = mesh->m_CellLinksContainer;
   this->m_BoundaryAssignmentsContainers = mesh->m_BoundaryAssignmentsContainers;
+  this->m_CompactCellTypes = mesh->m_CompactCellTypes;
+  this->m_CompactCellOffsets = mesh->m_CompactCellOffsets;
+  this->m_CompactCellPointIds = mesh->m_CompactCellPointIds;
+  this->m_CompactCellType = mesh->m_CompactCellType;
+  this->m_CompactCellNumberOfPoints = mesh->m_CompactCellNumberOfPoints;
+  this->m_CompactCellsExpanded = mesh->m_CompactCellsExpanded.load();
 
   // The cell allocation method must be maintained. The reference count
   // test on the container will prevent premature deletion of cells.
   this->m_CellsAllocationMethod = mesh->m_CellsAllocationMethod;
 }
 
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+void
+Mesh<TPixelType, VDimension, TMeshTraits>::SetCompactCells(CellGeometryEnum cellType, CellPointIdsContainer * pointIds)
+{
+  if (pointIds == nullptr)
+  {
+    itkExceptionMacro("The point identifiers of the compact cells are null");
+  }
+
+  CellAutoPointer cell;
+  this->CreateCell(static_cast<int>(cellType), cell);
+  const SizeValueType numberOfPoints = cell->GetNumberOfPoints();
+  if (numberOfPoints == 0)
+  {
+    itkExceptionMacro("Compact cells of type " << cellType
+                                               << " have no fixed number of points; set the cell offsets instead");
+  }
+  if (pointIds->Size() % numberOfPoints != 0)
+  {
+    itkExceptionMacro("The number of point identifiers " << pointIds->Size() << " is not a multiple of "
+                                                         << numberOfPoints);
+  }
+
+  this->ReleaseCellsMemory();
+  m_CellsContainer = CellsContainer::New();
+  m_CellsAllocationMethod = MeshClassCellsAllocationMethodEnum::CellsAllocatedDynamicallyCellByCell;
+
+  m_CompactCellPointIds = pointIds;
+  m_CompactCellType = cellType;
+  m_CompactCellNumberOfPoints = numberOfPoints;
+  this->Modified();
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+void
+Mesh<TPixelType, VDimension, TMeshTraits>::SetCompactCells(CellGeometryContainer * cellTypes,
+                                                           CellOffsetsContainer *  offsets,
+                                                           CellPointIdsContainer * pointIds)
+{
+  if (cellTypes == nullptr || offsets == nullptr || pointIds == nullptr)
+  {
+    itkExceptionMacro("The containers of the compact cells are null");
+  }
+  if (offsets->Size() != cellTypes->Size() + 1 || offsets->ElementAt(cellTypes->Size()) != pointIds->Size())
+  {
+    itkExceptionMacro("The cell offsets must hold one element per cell, followed by the number of point identifiers");
+  }
+
+  this->ReleaseCellsMemory();
+  m_CellsContainer = CellsContainer::New();
+  m_CellsAllocationMethod = MeshClassCellsAllocationMethodEnum::CellsAllocatedDynamicallyCellByCell;
+
+  m_CompactCellTypes = cellTypes;
+  m_CompactCellOffsets = offsets;
+  m_CompactCellPointIds = pointIds;
+  this->Modified();
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+bool
+Mesh<TPixelType, VDimension, TMeshTraits>::HasCompactCells() const
+{
+  return m_CompactCellPointIds.IsNotNull();
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+auto
+Mesh<TPixelType, VDimension, TMeshTraits>::GetCompactCellTypes() const -> const CellGeometryContainer *
+{
+  return m_CompactCellTypes.GetPointer();
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+auto
+Mesh<TPixelType, VDimension, TMeshTraits>::GetCompactCellOffsets() const -> const CellOffsetsContainer *
+{
+  return m_CompactCellOffsets.GetPointer();
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+auto
+Mesh<TPixelType, VDimension, TMeshTraits>::GetCompactCellPointIds() const -> const CellPointIdsContainer *
+{
+  return m_CompactCellPointIds.GetPointer();
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+auto
+Mesh<TPixelType, VDimension, TMeshTraits>::GetCompactCellType(CellIdentifier cellId) const -> CellGeometryEnum
+{
+  return m_CompactCellTypes ? m_CompactCellTypes->ElementAt(cellId) : m_CompactCellType;
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+auto
+Mesh<TPixelType, VDimension, TMeshTraits>::GetCompactCellPointIdsBegin(CellIdentifier cellId) const
+  -> PointIdConstIterator
+{
+  const SizeValueType offset =
+    m_CompactCellOffsets ? m_CompactCellOffsets->ElementAt(cellId) : cellId * m_CompactCellNumberOfPoints;
+  return m_CompactCellPointIds->CastToSTLConstContainer().data() + offset;
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+auto
+Mesh<TPixelType, VDimension, TMeshTraits>::GetCompactCellPointIdsEnd(CellIdentifier cellId) const
+  -> PointIdConstIterator
+{
+  const SizeValueType offset =
+    m_CompactCellOffsets ? m_CompactCellOffsets->ElementAt(cellId + 1) : (cellId + 1) * m_CompactCellNumberOfPoints;
+  return m_CompactCellPointIds->CastToSTLConstContainer().data() + offset;
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+void
+Mesh<TPixelType, VDimension, TMeshTraits>::ExpandCompactCells() const
+{
+  if (!this->HasCompactCells() || m_CompactCellsExpanded)
+  {
+    return;
+  }
+
+  // The compact cells are only read, so that the other threads may keep
+  // using them while the first one creates the cell objects.
+  const std::lock_guard<std::mutex> lock(m_CompactCellsMutex);
+  if (m_CompactCellsExpanded)
+  {
+    return;
+  }
+
+  // A new container is created, as the empty one may be shared with a
+  // grafted mesh.
+  auto                 cells = CellsContainer::New();
+  const CellIdentifier numberOfCells = this->GetNumberOfCells();
+  cells->Reserve(numberOfCells);
+  for (CellIdentifier cellId = 0; cellId < numberOfCells; ++cellId)
+  {
+    CellAutoPointer cell;
+    this->CreateCell(static_cast<int>(this->GetCompactCellType(cellId)), cell);
+    cell->SetPointIds(this->GetCompactCellPointIdsBegin(cellId), this->GetCompactCellPointIdsEnd(cellId));
+    cells->SetElement(cellId, cell.ReleaseOwnership());
+  }
+
+  m_CellsContainer = cells;
+  m_CompactCellsExpanded = true;
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+void
+Mesh<TPixelType, VDimension, TMeshTraits>::ReleaseCompactCells()
+{
+  m_CompactCellTypes = nullptr;
+  m_CompactCellOffsets = nullptr;
+  m_CompactCellPointIds = nullptr;
+  m_CompactCellsExpanded = false;
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+void
+Mesh<TPixelType, VDimension, TMeshTraits>::ConvertCompactCells()
+{
+  this->ExpandCompactCells();
+  this->ReleaseCompactCells();
+}
+
 template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 void
 Mesh<TPixelType, VDimension, TMeshTraits>::DeleteUnusedCellData()
@@ -1108,7 +1374,9 @@ Mesh<TPixelType, VDimension, TMeshTraits>::DeleteUnusedCellData()
   std::vector<typename CellDataContainer::ElementIdentifier> cell_data_to_delete;
   for (auto it = this->GetCellData()->Begin(); it != this->GetCellData()->End(); ++it)
   {
-    if (!this->GetCells()->IndexExists(it.Index()))
+    const bool cellExists = this->HasCompactCells() ? (it.Index() < this->GetNumberOfCells())
+                                                    : this->GetCells()->IndexExists(it.Index());
+    if (!cellExists)
     {
       cell_data_to_delete.push_back(it.Index());
     }
@@ -0,0 +1,222 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMeshCellLocator_h
+#define itkMeshCellLocator_h
+
+#include "itkObject.h"
+#include "itkMultiThreaderBase.h"
+#include <array>
+#include <vector>
+
+namespace itk
+{
+
+/** \class MeshCellLocator
+ * \brief Accelerate geometric queries on the surface cells of a mesh.
+ *
+ * This class builds a bounding volume hierarchy over the two-dimensional
+ * cells of a three-dimensional mesh, and uses it to answer closest point,
+ * ray intersection and inside/outside queries in logarithmic time instead
+ * of visiting every cell. Triangles, quadrilaterals and polygons are
+ * indexed; polygons are split into a fan of triangles. Vertex, line and
+ * volume cells are ignored. Both itk::Mesh, including meshes with compact
+ * cells, and itk::QuadEdgeMesh are supported.
+ *
+ * The hierarchy is built by Initialize(), which must be called again after
+ * the mesh is modified. The single point queries are const and can be
+ * called concurrently; the batched queries split the points among the
+ * work units of the multi-threader.
+ *
+ * IsInside() and the sign of ComputeSignedDistances() count the crossings
+ * of rays with the surface, so they are only meaningful for closed
+ * surfaces.
+ *
+ * \sa PointsLocator
+ *
+ * \ingroup ITKMesh
+ */
+template <typename TMesh>
+class ITK_TEMPLATE_EXPORT MeshCellLocator : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(MeshCellLocator);
+
+  /** Standard class type aliases. */
+  using Self = MeshCellLocator;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(MeshCellLocator);
+
+  /** Hold on to the type information specified by the template parameters. */
+  using MeshType = TMesh;
+  using MeshConstPointer = typename MeshType::ConstPointer;
+  using PointType = typename MeshType::PointType;
+  using PointIdentifier = typename MeshType::PointIdentifier;
+  using CellIdentifier = typename MeshType::CellIdentifier;
+  using CellType = typename MeshType::CellType;
+  using VectorType = typename PointType::VectorType;
+
+  static constexpr unsigned int PointDimension = MeshType::PointDimension;
+  static_assert(PointDimension == 3, "MeshCellLocator only supports three-dimensional meshes.");
+
+  /** Set/Get the mesh whose surface cells are indexed. */
+  /** @ITKStartGrouping */
+  itkSetConstObjectMacro(Mesh, MeshType);
+  itkGetConstObjectMacro(Mesh, MeshType);
+  /** @ITKEndGrouping */
+
+  /** Set/Get the maximum number of triangles in a leaf of the hierarchy. */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(BucketSize, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(BucketSize, unsigned int);
+  /** @ITKEndGrouping */
+
+  /** Set/Get the multi-threader used by the batched queries. */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(MultiThreader, MultiThreaderBase);
+  itkGetModifiableObjectMacro(MultiThreader, MultiThreaderBase);
+  /** @ITKEndGrouping */
+
+  /** Build the bounding volume hierarchy over the cells of the mesh. */
+  void
+  Initialize();
+
+  /** Get the number of triangles in the hierarchy. */
+  [[nodiscard]] SizeValueType
+  GetNumberOfTriangles() const
+  {
+    return static_cast<SizeValueType>(m_TriangleCellIds.size());
+  }
+
+  /** Find the point of the surface closest to \a query. Returns false if the
+   * mesh has no surface cells. The identifier of the cell that contains the
+   * closest point, and the squared distance to it, are also returned. */
+  bool
+  FindClosestPoint(const PointType & query,
+                   PointType &       closestPoint,
+                   CellIdentifier &  cellId,
+                   double &          squaredDistance) const;
+
+  /** Find the closest point of the surface to each of the \a queries, in
+   * parallel. The output vectors are resized to the number of queries. */
+  void
+  FindClosestPoints(const std::vector<PointType> & queries,
+                    std::vector<PointType> &       closestPoints,
+                    std::vector<CellIdentifier> &  cellIds,
+                    std::vector<double> &          squaredDistances) const;
+
+  /** Find the first intersection of the ray from \a origin along
+   * \a direction with the surface. The intersection point is
+   * origin + distance * direction, with a non-negative distance. Returns
+   * false if the ray does not intersect the surface. */
+  bool
+  IntersectRay(const PointType &  origin,
+               const VectorType & direction,
+               double &           distance,
+               CellIdentifier &   cellId) const;
+
+  /** Check whether a point is inside the closed surface. The parity of the
+   * number of surface crossings is computed along three rays, and the
+   * majority is returned, so that a ray grazing an edge does not change the
+   * result. */
+  [[nodiscard]] bool
+  IsInside(const PointType & query) const;
+
+  /** Compute the distance of each of the \a queries to the surface, in
+   * parallel. The distance is negative inside the surface. */
+  void
+  ComputeSignedDistances(const std::vector<PointType> & queries, std::vector<double> & distances) const;
+
+protected:
+  MeshCellLocator();
+  ~MeshCellLocator() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  using CoordinatesType = std::array<double, 3>;
+  using TriangleType = std::array<CoordinatesType, 3>;
+
+  /** A node of the hierarchy. Internal nodes have their first child right
+   * after them, and m_Offset is the index of their second child; leaves
+   * hold m_Count triangles starting at m_Offset. */
+  struct Node
+  {
+    CoordinatesType m_Minimum;
+    CoordinatesType m_Maximum;
+    SizeValueType   m_Offset;
+    SizeValueType   m_Count;
+  };
+
+  void
+  AddCell(CellIdentifier cellId, const PointIdentifier * begin, const PointIdentifier * end);
+
+  SizeValueType
+  BuildNode(SizeValueType                        begin,
+            SizeValueType                        end,
+            std::vector<SizeValueType> &         order,
+            const std::vector<CoordinatesType> & centroids);
+
+  static CoordinatesType
+  ToCoordinates(const PointType & point);
+
+  static double
+  SquaredDistanceToBox(const CoordinatesType & query, const Node & node);
+
+  static CoordinatesType
+  ClosestPointOnTriangle(const CoordinatesType & query, const TriangleType & triangle);
+
+  static bool
+  IntersectTriangle(const CoordinatesType & origin,
+                    const CoordinatesType & direction,
+                    const TriangleType &    triangle,
+                    double &                distance);
+
+  static bool
+  IntersectBox(const CoordinatesType & origin,
+               const CoordinatesType & inverseDirection,
+               const Node &            node,
+               double                  maximumDistance);
+
+  /** Count the crossings of the surface by the ray from origin along
+   * direction. */
+  SizeValueType
+  CountRayCrossings(const CoordinatesType & origin, const CoordinatesType & direction) const;
+
+  MeshConstPointer           m_Mesh{};
+  unsigned int               m_BucketSize{ 4 };
+  MultiThreaderBase::Pointer m_MultiThreader{};
+
+  std::vector<TriangleType>   m_Triangles{};
+  std::vector<CellIdentifier> m_TriangleCellIds{};
+  std::vector<Node>           m_Nodes{};
+};
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkMeshCellLocator.hxx"
+#endif
+
+#endif
@@ -0,0 +1,651 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMeshCellLocator_hxx
+#define itkMeshCellLocator_hxx
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace itk
+{
+namespace MeshCellLocatorDetail
+{
+using CoordinatesType = std::array<double, 3>;
+
+inline CoordinatesType
+Subtract(const CoordinatesType & a, const CoordinatesType & b)
+{
+  return { { a[0] - b[0], a[1] - b[1], a[2] - b[2] } };
+}
+
+inline double
+Dot(const CoordinatesType & a, const CoordinatesType & b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+inline CoordinatesType
+Cross(const CoordinatesType & a, const CoordinatesType & b)
+{
+  return { { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] } };
+}
+
+// Return a + s * b + t * c.
+inline CoordinatesType
+Combine(const CoordinatesType & a, double s, const CoordinatesType & b, double t, const CoordinatesType & c)
+{
+  return { { a[0] + s * b[0] + t * c[0], a[1] + s * b[1] + t * c[1], a[2] + s * b[2] + t * c[2] } };
+}
+} // namespace MeshCellLocatorDetail
+
+
+template <typename TMesh>
+MeshCellLocator<TMesh>::MeshCellLocator()
+  : m_MultiThreader(MultiThreaderBase::New())
+{}
+
+template <typename TMesh>
+void
+MeshCellLocator<TMesh>::Initialize()
+{
+  if (m_Mesh == nullptr)
+  {
+    itkExceptionStringMacro("Mesh is not set.");
+  }
+
+  m_Triangles.clear();
+  m_TriangleCellIds.clear();
+  m_Nodes.clear();
+
+  const auto isSurfaceCell = [](CellGeometryEnum cellType) {
+    return cellType == CellGeometryEnum::TRIANGLE_CELL || cellType == CellGeometryEnum::QUADRILATERAL_CELL ||
+           cellType == CellGeometryEnum::POLYGON_CELL;
+  };
+
+  if (m_Mesh->HasCompactCells())
+  {
+    const CellIdentifier numberOfCells = m_Mesh->GetNumberOfCells();
+    for (CellIdentifier cellId = 0; cellId < numberOfCells; ++cellId)
+    {
+      if (isSurfaceCell(m_Mesh->GetCompactCellType(cellId)))
+      {
+        this->AddCell(cellId, m_Mesh->GetCompactCellPointIdsBegin(cellId), m_Mesh->GetCompactCellPointIdsEnd(cellId));
+      }
+    }
+  }
+  else if (const auto * cells = m_Mesh->GetCells())
+  {
+    for (auto it = cells->Begin(); it != cells->End(); ++it)
+    {
+      const CellType * cell = it.Value();
+      if (isSurfaceCell(cell->GetType()))
+      {
+        // The point identifiers of QuadEdgeMesh polygons are gathered by
+        // PointIdsBegin(), so it has to be called before PointIdsEnd().
+        const auto * begin = cell->PointIdsBegin();
+        this->AddCell(it.Index(), begin, cell->PointIdsEnd());
+      }
+    }
+  }
+
+  const SizeValueType numberOfTriangles = m_Triangles.size();
+  if (numberOfTriangles == 0)
+  {
+    return;
+  }
+
+  std::vector<CoordinatesType> centroids(numberOfTriangles);
+  for (SizeValueType t = 0; t < numberOfTriangles; ++t)
+  {
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+      centroids[t][i] = (m_Triangles[t][0][i] + m_Triangles[t][1][i] + m_Triangles[t][2][i]) / 3.0;
+    }
+  }
+
+  std::vector<SizeValueType> order(numberOfTriangles);
+  std::iota(order.begin(), order.end(), SizeValueType{ 0 });
+  m_Nodes.reserve(2 * (numberOfTriangles / m_BucketSize) + 1);
+  this->BuildNode(0, numberOfTriangles, order, centroids);
+
+  // Store the triangles of each leaf contiguously.
+  std::vector<TriangleType>   triangles(numberOfTriangles);
+  std::vector<CellIdentifier> cellIds(numberOfTriangles);
+  for (SizeValueType t = 0; t < numberOfTriangles; ++t)
+  {
+    triangles[t] = m_Triangles[order[t]];
+    cellIds[t] = m_TriangleCellIds[order[t]];
+  }
+  m_Triangles.swap(triangles);
+  m_TriangleCellIds.swap(cellIds);
+}
+
+template <typename TMesh>
+void
+MeshCellLocator<TMesh>::AddCell(CellIdentifier cellId, const PointIdentifier * begin, const PointIdentifier * end)
+{
+  const auto numberOfPoints = static_cast<SizeValueType>(end - begin);
+  if (numberOfPoints < 3)
+  {
+    return;
+  }
+
+  std::vector<CoordinatesType> coordinates(numberOfPoints);
+  for (SizeValueType i = 0; i < numberOfPoints; ++i)
+  {
+    PointType point;
+    if (!m_Mesh->GetPoint(begin[i], &point))
+    {
+      itkExceptionMacro("Point " << begin[i] << " of cell " << cellId << " does not exist.");
+    }
+    coordinates[i] = ToCoordinates(point);
+  }
+
+  for (SizeValueType i = 1; i + 1 < numberOfPoints; ++i)
+  {
+    m_Triangles.push_back({ { coordinates[0], coordinates[i], coordinates[i + 1] } });
+    m_TriangleCellIds.push_back(cellId);
+  }
+}
+
+template <typename TMesh>
+SizeValueType
+MeshCellLocator<TMesh>::BuildNode(SizeValueType                        begin,
+                                  SizeValueType                        end,
+                                  std::vector<SizeValueType> &         order,
+                                  const std::vector<CoordinatesType> & centroids)
+{
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+
+  Node node;
+  node.m_Minimum.fill(infinity);
+  node.m_Maximum.fill(-infinity);
+  node.m_Offset = begin;
+  node.m_Count = end - begin;
+
+  CoordinatesType centroidMinimum = node.m_Minimum;
+  CoordinatesType centroidMaximum = node.m_Maximum;
+  for (SizeValueType t = begin; t < end; ++t)
+  {
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+      for (const auto & vertex : m_Triangles[order[t]])
+      {
+        node.m_Minimum[i] = std::min(node.m_Minimum[i], vertex[i]);
+        node.m_Maximum[i] = std::max(node.m_Maximum[i], vertex[i]);
+      }
+      centroidMinimum[i] = std::min(centroidMinimum[i], centroids[order[t]][i]);
+      centroidMaximum[i] = std::max(centroidMaximum[i], centroids[order[t]][i]);
+    }
+  }
+
+  const auto nodeIndex = static_cast<SizeValueType>(m_Nodes.size());
+  m_Nodes.push_back(node);
+
+  // Split at the median centroid along the largest extent of the centroids.
+  unsigned int axis = 0;
+  for (unsigned int i = 1; i < 3; ++i)
+  {
+    if (centroidMaximum[i] - centroidMinimum[i] > centroidMaximum[axis] - centroidMinimum[axis])
+    {
+      axis = i;
+    }
+  }
+  if (end - begin <= m_BucketSize || !(centroidMaximum[axis] > centroidMinimum[axis]))
+  {
+    return nodeIndex;
+  }
+
+  const SizeValueType middle = begin + (end - begin) / 2;
+  const auto          lessAlongAxis = [&centroids, axis](SizeValueType a, SizeValueType b) {
+    return centroids[a][axis] < centroids[b][axis];
+  };
+  std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end, lessAlongAxis);
+
+  this->BuildNode(begin, middle, order, centroids);
+  const SizeValueType secondChild = this->BuildNode(middle, end, order, centroids);
+
+  m_Nodes[nodeIndex].m_Offset = secondChild;
+  m_Nodes[nodeIndex].m_Count = 0;
+  return nodeIndex;
+}
+
+template <typename TMesh>
+auto
+MeshCellLocator<TMesh>::ToCoordinates(const PointType & point) -> CoordinatesType
+{
+  return { { static_cast<double>(point[0]), static_cast<double>(point[1]), static_cast<double>(point[2]) } };
+}
+
+template <typename TMesh>
+double
+MeshCellLocator<TMesh>::SquaredDistanceToBox(const CoordinatesType & query, const Node & node)
+{
+  double squaredDistance = 0.0;
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    const double difference = std::max({ node.m_Minimum[i] - query[i], 0.0, query[i] - node.m_Maximum[i] });
+    squaredDistance += difference * difference;
+  }
+  return squaredDistance;
+}
+
+template <typename TMesh>
+auto
+MeshCellLocator<TMesh>::ClosestPointOnTriangle(const CoordinatesType & query, const TriangleType & triangle)
+  -> CoordinatesType
+{
+  using namespace MeshCellLocatorDetail;
+
+  // Find the Voronoi region of the triangle that contains the query, as in
+  // Ericson, Real-Time Collision Detection, section 5.1.5.
+  const CoordinatesType & a = triangle[0];
+  const CoordinatesType & b = triangle[1];
+  const CoordinatesType & c = triangle[2];
+  const CoordinatesType   ab = Subtract(b, a);
+  const CoordinatesType   ac = Subtract(c, a);
+
+  const CoordinatesType ap = Subtract(query, a);
+  const double          d1 = Dot(ab, ap);
+  const double          d2 = Dot(ac, ap);
+  if (d1 <= 0.0 && d2 <= 0.0)
+  {
+    return a;
+  }
+
+  const CoordinatesType bp = Subtract(query, b);
+  const double          d3 = Dot(ab, bp);
+  const double          d4 = Dot(ac, bp);
+  if (d3 >= 0.0 && d4 <= d3)
+  {
+    return b;
+  }
+
+  const double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+  {
+    return Combine(a, d1 / (d1 - d3), ab, 0.0, ac);
+  }
+
+  const CoordinatesType cp = Subtract(query, c);
+  const double          d5 = Dot(ab, cp);
+  const double          d6 = Dot(ac, cp);
+  if (d6 >= 0.0 && d5 <= d6)
+  {
+    return c;
+  }
+
+  const double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+  {
+    return Combine(a, 0.0, ab, d2 / (d2 - d6), ac);
+  }
+
+  const double va = d3 * d6 - d5 * d4;
+  if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+  {
+    return Combine(b, (d4 - d3) / ((d4 - d3) + (d5 - d6)), Subtract(c, b), 0.0, ac);
+  }
+
+  const double denominator = va + vb + vc;
+  if (!(denominator > 0.0))
+  {
+    // Degenerate triangle that is not handled by the edge regions.
+    return a;
+  }
+  return Combine(a, vb / denominator, ab, vc / denominator, ac);
+}
+
+template <typename TMesh>
+bool
+MeshCellLocator<TMesh>::IntersectTriangle(const CoordinatesType & origin,
+                                          const CoordinatesType & direction,
+                                          const TriangleType &    triangle,
+                                          double &                distance)
+{
+  using namespace MeshCellLocatorDetail;
+
+  // Moller-Trumbore ray/triangle intersection.
+  const CoordinatesType edge1 = Subtract(triangle[1], triangle[0]);
+  const CoordinatesType edge2 = Subtract(triangle[2], triangle[0]);
+  const CoordinatesType p = Cross(direction, edge2);
+  const double          determinant = Dot(edge1, p);
+  if (determinant == 0.0)
+  {
+    return false;
+  }
+  const double inverseDeterminant = 1.0 / determinant;
+
+  const CoordinatesType s = Subtract(origin, triangle[0]);
+  const double          u = Dot(s, p) * inverseDeterminant;
+  if (u < 0.0 || u > 1.0)
+  {
+    return false;
+  }
+  const CoordinatesType q = Cross(s, edge1);
+  const double          v = Dot(direction, q) * inverseDeterminant;
+  if (v < 0.0 || u + v > 1.0)
+  {
+    return false;
+  }
+  distance = Dot(edge2, q) * inverseDeterminant;
+  return distance >= 0.0;
+}
+
+template <typename TMesh>
+bool
+MeshCellLocator<TMesh>::IntersectBox(const CoordinatesType & origin,
+                                     const CoordinatesType & inverseDirection,
+                                     const Node &            node,
+                                     double                  maximumDistance)
+{
+  double minimum = 0.0;
+  double maximum = maximumDistance;
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    double t1 = (node.m_Minimum[i] - origin[i]) * inverseDirection[i];
+    double t2 = (node.m_Maximum[i] - origin[i]) * inverseDirection[i];
+    if (t1 > t2)
+    {
+      std::swap(t1, t2);
+    }
+    // The comparisons are false for NaN, which occurs when the ray lies in
+    // the plane of a face of the box, so such faces do not clip the ray.
+    if (t1 > minimum)
+    {
+      minimum = t1;
+    }
+    if (t2 < maximum)
+    {
+      maximum = t2;
+    }
+    if (minimum > maximum)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename TMesh>
+bool
+MeshCellLocator<TMesh>::FindClosestPoint(const PointType & query,
+                                         PointType &       closestPoint,
+                                         CellIdentifier &  cellId,
+                                         double &          squaredDistance) const
+{
+  if (m_Nodes.empty())
+  {
+    return false;
+  }
+
+  const CoordinatesType q = ToCoordinates(query);
+
+  double          bestSquaredDistance = std::numeric_limits<double>::infinity();
+  SizeValueType   bestTriangle = 0;
+  CoordinatesType bestPoint{};
+
+  std::vector<SizeValueType> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const auto   nodeIndex = stack.back();
+    const Node & node = m_Nodes[nodeIndex];
+    stack.pop_back();
+    if (SquaredDistanceToBox(q, node) >= bestSquaredDistance)
+    {
+      continue;
+    }
+
+    if (node.m_Count > 0)
+    {
+      for (SizeValueType t = node.m_Offset; t < node.m_Offset + node.m_Count; ++t)
+      {
+        const CoordinatesType point = ClosestPointOnTriangle(q, m_Triangles[t]);
+        const CoordinatesType difference = MeshCellLocatorDetail::Subtract(point, q);
+        const double          distance = MeshCellLocatorDetail::Dot(difference, difference);
+        if (distance < bestSquaredDistance)
+        {
+          bestSquaredDistance = distance;
+          bestTriangle = t;
+          bestPoint = point;
+        }
+      }
+      continue;
+    }
+
+    // Visit the nearest child first, so that the farthest one is more likely
+    // to be pruned.
+    SizeValueType nearChild = nodeIndex + 1;
+    SizeValueType farChild = node.m_Offset;
+    double        nearDistance = SquaredDistanceToBox(q, m_Nodes[nearChild]);
+    double        farDistance = SquaredDistanceToBox(q, m_Nodes[farChild]);
+    if (farDistance < nearDistance)
+    {
+      std::swap(nearChild, farChild);
+      std::swap(nearDistance, farDistance);
+    }
+    if (farDistance < bestSquaredDistance)
+    {
+      stack.push_back(farChild);
+    }
+    if (nearDistance < bestSquaredDistance)
+    {
+      stack.push_back(nearChild);
+    }
+  }
+
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    closestPoint[i] = static_cast<typename PointType::ValueType>(bestPoint[i]);
+  }
+  cellId = m_TriangleCellIds[bestTriangle];
+  squaredDistance = bestSquaredDistance;
+  return true;
+}
+
+template <typename TMesh>
+void
+MeshCellLocator<TMesh>::FindClosestPoints(const std::vector<PointType> & queries,
+                                          std::vector<PointType> &       closestPoints,
+                                          std::vector<CellIdentifier> &  cellIds,
+                                          std::vector<double> &          squaredDistances) const
+{
+  const SizeValueType numberOfQueries = queries.size();
+  closestPoints.resize(numberOfQueries);
+  cellIds.resize(numberOfQueries);
+  squaredDistances.resize(numberOfQueries);
+
+  m_MultiThreader->ParallelizeArray(
+    0,
+    numberOfQueries,
+    [&](SizeValueType i) {
+      if (!this->FindClosestPoint(queries[i], closestPoints[i], cellIds[i], squaredDistances[i]))
+      {
+        squaredDistances[i] = std::numeric_limits<double>::infinity();
+      }
+    },
+    nullptr);
+}
+
+template <typename TMesh>
+bool
+MeshCellLocator<TMesh>::IntersectRay(const PointType &  origin,
+                                     const VectorType & direction,
+                                     double &           distance,
+                                     CellIdentifier &   cellId) const
+{
+  if (m_Nodes.empty())
+  {
+    return false;
+  }
+
+  const CoordinatesType o = ToCoordinates(origin);
+  const CoordinatesType d{ { static_cast<double>(direction[0]),
+                             static_cast<double>(direction[1]),
+                             static_cast<double>(direction[2]) } };
+  const CoordinatesType inverseDirection{ { 1.0 / d[0], 1.0 / d[1], 1.0 / d[2] } };
+
+  double bestDistance = std::numeric_limits<double>::infinity();
+  bool   found = false;
+
+  std::vector<SizeValueType> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const auto   nodeIndex = stack.back();
+    const Node & node = m_Nodes[nodeIndex];
+    stack.pop_back();
+    if (!IntersectBox(o, inverseDirection, node, bestDistance))
+    {
+      continue;
+    }
+
+    if (node.m_Count > 0)
+    {
+      for (SizeValueType t = node.m_Offset; t < node.m_Offset + node.m_Count; ++t)
+      {
+        double triangleDistance;
+        if (IntersectTriangle(o, d, m_Triangles[t], triangleDistance) && triangleDistance < bestDistance)
+        {
+          bestDistance = triangleDistance;
+          cellId = m_TriangleCellIds[t];
+          found = true;
+        }
+      }
+      continue;
+    }
+    stack.push_back(node.m_Offset);
+    stack.push_back(nodeIndex + 1);
+  }
+
+  if (found)
+  {
+    distance = bestDistance;
+  }
+  return found;
+}
+
+template <typename TMesh>
+SizeValueType
+MeshCellLocator<TMesh>::CountRayCrossings(const CoordinatesType & origin, const CoordinatesType & direction) const
+{
+  const CoordinatesType inverseDirection{ { 1.0 / direction[0], 1.0 / direction[1], 1.0 / direction[2] } };
+  constexpr double      infinity = std::numeric_limits<double>::infinity();
+
+  SizeValueType numberOfCrossings = 0;
+
+  std::vector<SizeValueType> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const auto   nodeIndex = stack.back();
+    const Node & node = m_Nodes[nodeIndex];
+    stack.pop_back();
+    if (!IntersectBox(origin, inverseDirection, node, infinity))
+    {
+      continue;
+    }
+
+    if (node.m_Count > 0)
+    {
+      for (SizeValueType t = node.m_Offset; t < node.m_Offset + node.m_Count; ++t)
+      {
+        double distance;
+        if (IntersectTriangle(origin, direction, m_Triangles[t], distance))
+        {
+          ++numberOfCrossings;
+        }
+      }
+      continue;
+    }
+    stack.push_back(node.m_Offset);
+    stack.push_back(nodeIndex + 1);
+  }
+  return numberOfCrossings;
+}
+
+template <typename TMesh>
+bool
+MeshCellLocator<TMesh>::IsInside(const PointType & query) const
+{
+  if (m_Nodes.empty())
+  {
+    return false;
+  }
+
+  // Directions that are not aligned with the axes nor with each other, so
+  // that regular meshes are unlikely to be hit on an edge by several rays.
+  static constexpr CoordinatesType directions[3] = { { { 0.8272, 0.4381, 0.3518 } },
+                                                     { { -0.3101, 0.8712, -0.3806 } },
+                                                     { { 0.2917, -0.4526, 0.8426 } } };
+
+  const CoordinatesType origin = ToCoordinates(query);
+  unsigned int          numberOfInsideVotes = 0;
+  for (const auto & direction : directions)
+  {
+    numberOfInsideVotes += static_cast<unsigned int>(this->CountRayCrossings(origin, direction) % 2);
+  }
+  return numberOfInsideVotes >= 2;
+}
+
+template <typename TMesh>
+void
+MeshCellLocator<TMesh>::ComputeSignedDistances(const std::vector<PointType> & queries,
+                                               std::vector<double> &          distances) const
+{
+  const SizeValueType numberOfQueries = queries.size();
+  distances.resize(numberOfQueries);
+
+  m_MultiThreader->ParallelizeArray(
+    0,
+    numberOfQueries,
+    [&](SizeValueType i) {
+      PointType      closestPoint;
+      CellIdentifier cellId;
+      double         squaredDistance;
+      if (!this->FindClosestPoint(queries[i], closestPoint, cellId, squaredDistance))
+      {
+        distances[i] = std::numeric_limits<double>::infinity();
+        return;
+      }
+      distances[i] = this->IsInside(queries[i]) ? -std::sqrt(squaredDistance) : std::sqrt(squaredDistance);
+    },
+    nullptr);
+}
+
+template <typename TMesh>
+void
+MeshCellLocator<TMesh>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  itkPrintSelfObjectMacro(Mesh);
+  os << indent << "BucketSize: " << m_BucketSize << std::endl;
+  itkPrintSelfObjectMacro(MultiThreader);
+  os << indent << "NumberOfTriangles: " << m_Triangles.size() << std::endl;
+  os << indent << "NumberOfNodes: " << m_Nodes.size() << std::endl;
+}
+
+} // end namespace itk
+
+#endif
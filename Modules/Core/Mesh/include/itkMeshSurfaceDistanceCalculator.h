@@ -0,0 +1,129 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMeshSurfaceDistanceCalculator_h
+#define itkMeshSurfaceDistanceCalculator_h
+
+#include "itkMeshCellLocator.h"
+
+namespace itk
+{
+
+/** \class MeshSurfaceDistanceCalculator
+ * \brief Compute the Hausdorff and mean surface distances between two meshes.
+ *
+ * The distance from a mesh to another one is measured from each point of
+ * the first mesh to the closest point of the surface cells of the other
+ * mesh, which is found with a MeshCellLocator. The queries are split among
+ * the work units of the multi-threader.
+ *
+ * After Compute(), GetDirectedHausdorffDistance() returns the largest
+ * distance from the points of Mesh1 to the surface of Mesh2,
+ * GetHausdorffDistance() returns the largest distance in both directions,
+ * and GetMeanDistance() returns the mean of the distances in both
+ * directions.
+ *
+ * \sa MeshCellLocator
+ *
+ * \ingroup ITKMesh
+ */
+template <typename TMesh1, typename TMesh2 = TMesh1>
+class ITK_TEMPLATE_EXPORT MeshSurfaceDistanceCalculator : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(MeshSurfaceDistanceCalculator);
+
+  /** Standard class type aliases. */
+  using Self = MeshSurfaceDistanceCalculator;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(MeshSurfaceDistanceCalculator);
+
+  /** Type information of the meshes. */
+  using Mesh1Type = TMesh1;
+  using Mesh2Type = TMesh2;
+  using Mesh1ConstPointer = typename Mesh1Type::ConstPointer;
+  using Mesh2ConstPointer = typename Mesh2Type::ConstPointer;
+  using Locator1Type = MeshCellLocator<Mesh1Type>;
+  using Locator2Type = MeshCellLocator<Mesh2Type>;
+
+  /** Set/Get the meshes. */
+  /** @ITKStartGrouping */
+  itkSetConstObjectMacro(Mesh1, Mesh1Type);
+  itkGetConstObjectMacro(Mesh1, Mesh1Type);
+  itkSetConstObjectMacro(Mesh2, Mesh2Type);
+  itkGetConstObjectMacro(Mesh2, Mesh2Type);
+  /** @ITKEndGrouping */
+
+  /** Set/Get the multi-threader used to compute the distances. */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(MultiThreader, MultiThreaderBase);
+  itkGetModifiableObjectMacro(MultiThreader, MultiThreaderBase);
+  /** @ITKEndGrouping */
+
+  /** Compute the distances between the meshes. */
+  void
+  Compute();
+
+  /** Get the largest distance from the points of a mesh to the surface of
+   * the other mesh. */
+  itkGetConstMacro(HausdorffDistance, double);
+
+  /** Get the largest distance from the points of Mesh1 to the surface of
+   * Mesh2. */
+  itkGetConstMacro(DirectedHausdorffDistance, double);
+
+  /** Get the mean distance from the points of a mesh to the surface of the
+   * other mesh, over the points of both meshes. */
+  itkGetConstMacro(MeanDistance, double);
+
+protected:
+  MeshSurfaceDistanceCalculator();
+  ~MeshSurfaceDistanceCalculator() override = default;
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Compute the distances from the points of \a mesh to the surface indexed
+   * by \a locator. Returns the largest distance, and adds the distances to
+   * \a sum. */
+  template <typename TMesh, typename TLocator>
+  double
+  ComputeDirectedDistance(const TMesh * mesh, const TLocator * locator, double & sum) const;
+
+private:
+  Mesh1ConstPointer          m_Mesh1{};
+  Mesh2ConstPointer          m_Mesh2{};
+  MultiThreaderBase::Pointer m_MultiThreader{};
+
+  double m_HausdorffDistance{ 0.0 };
+  double m_DirectedHausdorffDistance{ 0.0 };
+  double m_MeanDistance{ 0.0 };
+};
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkMeshSurfaceDistanceCalculator.hxx"
+#endif
+
+#endif
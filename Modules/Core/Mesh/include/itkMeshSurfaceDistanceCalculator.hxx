@@ -0,0 +1,118 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMeshSurfaceDistanceCalculator_hxx
+#define itkMeshSurfaceDistanceCalculator_hxx
+
+namespace itk
+{
+
+template <typename TMesh1, typename TMesh2>
+MeshSurfaceDistanceCalculator<TMesh1, TMesh2>::MeshSurfaceDistanceCalculator()
+  : m_MultiThreader(MultiThreaderBase::New())
+{}
+
+template <typename TMesh1, typename TMesh2>
+void
+MeshSurfaceDistanceCalculator<TMesh1, TMesh2>::Compute()
+{
+  if (m_Mesh1 == nullptr || m_Mesh2 == nullptr)
+  {
+    itkExceptionStringMacro("Mesh1 and Mesh2 must be set.");
+  }
+
+  auto locator1 = Locator1Type::New();
+  locator1->SetMesh(m_Mesh1);
+  locator1->SetMultiThreader(m_MultiThreader);
+  locator1->Initialize();
+
+  auto locator2 = Locator2Type::New();
+  locator2->SetMesh(m_Mesh2);
+  locator2->SetMultiThreader(m_MultiThreader);
+  locator2->Initialize();
+
+  if (locator1->GetNumberOfTriangles() == 0 || locator2->GetNumberOfTriangles() == 0)
+  {
+    itkExceptionStringMacro("Mesh1 and Mesh2 must have surface cells.");
+  }
+
+  double sum = 0.0;
+  m_DirectedHausdorffDistance = this->ComputeDirectedDistance(m_Mesh1.GetPointer(), locator2.GetPointer(), sum);
+  const double reverseDistance = this->ComputeDirectedDistance(m_Mesh2.GetPointer(), locator1.GetPointer(), sum);
+
+  m_HausdorffDistance = std::max(m_DirectedHausdorffDistance, reverseDistance);
+
+  const SizeValueType numberOfPoints = m_Mesh1->GetNumberOfPoints() + m_Mesh2->GetNumberOfPoints();
+  m_MeanDistance = (numberOfPoints > 0) ? sum / static_cast<double>(numberOfPoints) : 0.0;
+}
+
+template <typename TMesh1, typename TMesh2>
+template <typename TMesh, typename TLocator>
+double
+MeshSurfaceDistanceCalculator<TMesh1, TMesh2>::ComputeDirectedDistance(const TMesh *    mesh,
+                                                                       const TLocator * locator,
+                                                                       double &         sum) const
+{
+  using QueryPointType = typename TLocator::PointType;
+
+  std::vector<QueryPointType> queries;
+  if (const auto * points = mesh->GetPoints())
+  {
+    queries.reserve(points->Size());
+    for (auto it = points->Begin(); it != points->End(); ++it)
+    {
+      QueryPointType query;
+      for (unsigned int i = 0; i < TMesh::PointDimension; ++i)
+      {
+        query[i] = static_cast<typename QueryPointType::ValueType>(it.Value()[i]);
+      }
+      queries.push_back(query);
+    }
+  }
+
+  std::vector<QueryPointType>                    closestPoints;
+  std::vector<typename TLocator::CellIdentifier> cellIds;
+  std::vector<double>                            squaredDistances;
+  locator->FindClosestPoints(queries, closestPoints, cellIds, squaredDistances);
+
+  double maximum = 0.0;
+  for (const double squaredDistance : squaredDistances)
+  {
+    const double distance = std::sqrt(squaredDistance);
+    maximum = std::max(maximum, distance);
+    sum += distance;
+  }
+  return maximum;
+}
+
+template <typename TMesh1, typename TMesh2>
+void
+MeshSurfaceDistanceCalculator<TMesh1, TMesh2>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  itkPrintSelfObjectMacro(Mesh1);
+  itkPrintSelfObjectMacro(Mesh2);
+  itkPrintSelfObjectMacro(MultiThreader);
+  os << indent << "HausdorffDistance: " << m_HausdorffDistance << std::endl;
+  os << indent << "DirectedHausdorffDistance: " << m_DirectedHausdorffDistance << std::endl;
+  os << indent << "MeanDistance: " << m_MeanDistance << std::endl;
+}
+
+} // end namespace itk
+
+#endif
@@ -174,6 +174,28 @@ MeshToMeshFilter<TInputMesh, TOutputMesh>::CopyInputMeshToOutputMeshCells()
 
   outputMesh->SetCellsAllocationMethod(MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedDynamicallyCellByCell);
 
+  // Compact cells are never modified, so their containers are shared.
+  if constexpr (std::is_same_v<typename TInputMesh::CellPointIdsContainer,
+                               typename TOutputMesh::CellPointIdsContainer>)
+  {
+    if (inputMesh->HasCompactCells())
+    {
+      auto * pointIds = const_cast<typename TOutputMesh::CellPointIdsContainer *>(inputMesh->GetCompactCellPointIds());
+      if (inputMesh->GetCompactCellTypes())
+      {
+        outputMesh->SetCompactCells(
+          const_cast<typename TOutputMesh::CellGeometryContainer *>(inputMesh->GetCompactCellTypes()),
+          const_cast<typename TOutputMesh::CellOffsetsContainer *>(inputMesh->GetCompactCellOffsets()),
+          pointIds);
+      }
+      else
+      {
+        outputMesh->SetCompactCells(inputMesh->GetCompactCellType(0), pointIds);
+      }
+      return;
+    }
+  }
+
   auto                        outputCells = OutputCellsContainer::New();
   const InputCellsContainer * inputCells = inputMesh->GetCells();
 
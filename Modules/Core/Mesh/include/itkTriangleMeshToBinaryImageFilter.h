@@ -19,6 +19,7 @@
 #define itkTriangleMeshToBinaryImageFilter_h
 
 #include "itkImageSource.h"
+#include "itkImage.h"
 
 #include "itkPolygonCell.h"
 #include "itkMapContainer.h"
@@ -60,7 +61,20 @@ public:
 /** \class TriangleMeshToBinaryImageFilter
  *
  * \brief 3D Rasterization algorithm Courtesy of Dr David Gobbi of Atamai Inc.
-
+ *
+ * The output is divided into slabs of z slices, which are rasterized by
+ * separate work units.
+ *
+ * With ConservativeRasterization on, every voxel intersected by a triangle or
+ * polygon of the mesh is set to the inside value as well, so that thin
+ * structures are not lost at coarse resolutions.
+ *
+ * With ComputeSignedDistanceMap on, the second output holds the signed
+ * distance, in physical units, from each voxel to the nearest boundary voxel
+ * of the rasterized object. Boundary voxels are inside voxels with a face
+ * connected outside neighbor. Distances are negative inside the object and
+ * positive outside, as with SignedMaurerDistanceMapImageFilter.
+ *
  * \author Leila Baghdadi, MICe, Hospital for Sick Children, Toronto, Canada,
  * \ingroup ITKMesh
  */
@@ -124,6 +138,9 @@ public:
   using PointVector = std::vector<PointType>;
   using PointArray = std::vector<std::vector<PointType>>;
 
+  /** Type of the signed distance map output. */
+  using DistanceMapImageType = Image<float, 3>;
+
   /** Spacing (size of a pixel) of the output image. The
    * spacing is the geometric distance between image samples.
    * It is stored internally as double, but may be set from
@@ -213,6 +230,35 @@ public:
   itkSetMacro(Tolerance, double);
   itkGetConstMacro(Tolerance, double);
 
+  /** Set/Get whether the voxels intersected by the mesh are set to the
+   * inside value, in addition to the voxels whose center is inside the mesh.
+   * Default is false. */
+  /** @ITKStartGrouping */
+  itkSetMacro(ConservativeRasterization, bool);
+  itkGetConstMacro(ConservativeRasterization, bool);
+  itkBooleanMacro(ConservativeRasterization);
+  /** @ITKEndGrouping */
+
+  /** Set/Get whether the signed distance map output is computed.
+   * Default is false. */
+  /** @ITKStartGrouping */
+  itkSetMacro(ComputeSignedDistanceMap, bool);
+  itkGetConstMacro(ComputeSignedDistanceMap, bool);
+  itkBooleanMacro(ComputeSignedDistanceMap);
+  /** @ITKEndGrouping */
+
+  /** Get the signed distance map, computed when ComputeSignedDistanceMap is
+   * on. */
+  DistanceMapImageType *
+  GetSignedDistanceMap();
+
+  /** Standard itk::ProcessObject subclass method. */
+  using DataObjectPointer = ProcessObject::DataObjectPointer;
+  using DataObjectPointerArraySizeType = ProcessObject::DataObjectPointerArraySizeType;
+  using Superclass::MakeOutput;
+  DataObjectPointer
+  MakeOutput(DataObjectPointerArraySizeType idx) override;
+
 protected:
   TriangleMeshToBinaryImageFilter();
   ~TriangleMeshToBinaryImageFilter() override = default;
@@ -226,9 +272,28 @@ protected:
   virtual void
   RasterizeTriangles();
 
+  /** Compute the signed distance map of the rasterized output. */
+  virtual void
+  ComputeDistanceMap();
+
   /** Convert a single polygon/triangle to raster format. */
   static int
-  PolygonToImageRaster(PointVector coords, Point1DArray & zymatrix, int extent[6]);
+  PolygonToImageRaster(const PointVector & coords, Point1DArray & zymatrix, int extent[6]);
+
+  /** Convert a single polygon/triangle to raster format, for the slices
+   * firstSlice to lastSlice of the extent only. The first row of zymatrix
+   * corresponds to firstSlice. */
+  static int
+  PolygonToImageRaster(const PointVector & coords,
+                       Point1DArray &      zymatrix,
+                       int                 extent[6],
+                       int                 firstSlice,
+                       int                 lastSlice);
+
+  /** Return whether a triangle, in continuous index coordinates, intersects
+   * the voxel centered at the given index. */
+  static bool
+  TriangleIntersectsVoxel(const PointType & p0, const PointType & p1, const PointType & p2, const IndexType & index);
 
   OutputImageType * m_InfoImage{};
 
@@ -247,6 +312,9 @@ protected:
 
   DirectionType m_Direction{};
 
+  bool m_ConservativeRasterization{ false };
+  bool m_ComputeSignedDistanceMap{ false };
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
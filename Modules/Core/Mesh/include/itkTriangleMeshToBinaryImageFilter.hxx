@@ -19,8 +19,11 @@
 #define itkTriangleMeshToBinaryImageFilter_hxx
 
 #include "itkNumericTraits.h"
+#include "itkImageRegionIterator.h"
+#include "itkMultiThreaderBase.h"
 #include <cstdlib>
 #include <algorithm> // For max.
+#include <limits>
 #include "itkPrintHelper.h"
 
 namespace itk
@@ -46,6 +49,28 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::TriangleMeshToBinaryI
 
   m_Tolerance = 1e-5;
   m_InfoImage = nullptr;
+
+  // Make the outputs (binary image, signed distance map).
+  ProcessObject::MakeRequiredOutputs(*this, 2);
+}
+
+template <typename TInputMesh, typename TOutputImage>
+auto
+TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::MakeOutput(DataObjectPointerArraySizeType idx)
+  -> DataObjectPointer
+{
+  if (idx == 1)
+  {
+    return DistanceMapImageType::New().GetPointer();
+  }
+  return Superclass::MakeOutput(idx);
+}
+
+template <typename TInputMesh, typename TOutputImage>
+auto
+TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::GetSignedDistanceMap() -> DistanceMapImageType *
+{
+  return itkDynamicCastInDebugMode<DistanceMapImageType *>(this->ProcessObject::GetOutput(1));
 }
 
 template <typename TInputMesh, typename TOutputImage>
@@ -169,19 +194,35 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::GenerateData()
 
   RasterizeTriangles();
 
+  if (m_ComputeSignedDistanceMap)
+  {
+    this->ComputeDistanceMap();
+  }
+
   itkDebugMacro("TriangleMeshToBinaryImageFilter::Update() finished");
 }
 
 template <typename TInputMesh, typename TOutputImage>
 int
-TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(PointVector    coords,
-                                                                                Point1DArray & zymatrix,
-                                                                                int            extent[6])
+TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(const PointVector & coords,
+                                                                                Point1DArray &      zymatrix,
+                                                                                int                 extent[6])
+{
+  return PolygonToImageRaster(coords, zymatrix, extent, extent[4], extent[5]);
+}
+
+template <typename TInputMesh, typename TOutputImage>
+int
+TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(const PointVector & coords,
+                                                                                Point1DArray &      zymatrix,
+                                                                                int                 extent[6],
+                                                                                int                 firstSlice,
+                                                                                int                 lastSlice)
 {
   // convert the polygon into a rasterizable form by finding its
   // intersection with each z plane, and store the (x,y) coords
   // of each intersection in a vector called "matrix"
-  const int    zSize = extent[5] - extent[4] + 1;
+  const int    zSize = lastSlice - firstSlice + 1;
   const int    zInc = extent[3] - extent[2] + 1;
   Point2DArray matrix(zSize);
 
@@ -231,6 +272,8 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
     {
       zmax = extent[5] + 1;
     }
+    zmin = std::max(zmin, firstSlice);
+    zmax = std::min(zmax, lastSlice + 1);
     const double temp = 1.0 / (p2[2] - p1[2]);
     for (int z = zmin; z < zmax; ++z)
     {
@@ -239,7 +282,7 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
       Point2DType  XY;
       XY[0] = r * p1[0] + f * p2[0];
       XY[1] = r * p1[1] + f * p2[1];
-      matrix[z - extent[4]].push_back(XY);
+      matrix[z - firstSlice].push_back(XY);
     }
 
     p1 = coords[i];
@@ -265,9 +308,9 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
   // except that 'x' is our depth value and we can store multiple
   // 'x' values per (y,z) value.
 
-  for (int z = extent[4]; z <= extent[5]; ++z)
+  for (int z = firstSlice; z <= lastSlice; ++z)
   {
-    Point2DVector & xylist = matrix[z - extent[4]];
+    Point2DVector & xylist = matrix[z - firstSlice];
 
     if (xylist.empty())
     {
@@ -301,7 +344,7 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
         const double X = r * X1 + f * X2;
         if (extent[2] <= y && y <= extent[3])
         {
-          const int zyidx = (z - extent[4]) * zInc + (y - extent[2]);
+          const int zyidx = (z - firstSlice) * zInc + (y - extent[2]);
           zymatrix[zyidx].emplace_back(X, sign);
         }
       }
@@ -318,7 +361,6 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::RasterizeTriangles()
   const InputMeshPointer input = this->GetInput(0);
 
   const InputPointsContainerPointer myPoints = input->GetPoints();
-  InputPointsContainerIterator      points = myPoints->Begin();
 
   int extent[6];
 
@@ -333,40 +375,37 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::RasterizeTriangles()
   const OutputImagePointer OutputImage = this->GetOutput();
 
   // need to transform points from physical to index coordinates
-  auto                    NewPoints = PointsContainer::New();
-  auto                    NewPointSet = PointSetType::New();
-  PointSetType::PointType newpoint;
-
-  unsigned int pointId = 0;
-
-  while (points != myPoints->End())
+  PointVector newPoints;
+  newPoints.reserve(myPoints->Size());
+  for (InputPointsContainerIterator points = myPoints->Begin(); points != myPoints->End(); ++points)
   {
     const PointType p = points.Value();
-    // the index value type must match the point value type
-    const ContinuousIndex<PointType::ValueType, 3> ind =
-      OutputImage->template TransformPhysicalPointToContinuousIndex<PointType::ValueType>(p);
-    NewPoints->InsertElement(pointId++, ind);
-
-    ++points;
+    newPoints.push_back(p);
   }
-  NewPointSet->SetPoints(NewPoints);
 
-  // the stencil is kept in 'zymatrix' that provides
-  // the x extents for each (y,z) coordinate for which a ray
-  // parallel to the x axis intersects the polydata
-  const int    zInc = extent[3] - extent[2] + 1;
-  const int    zSize = extent[5] - extent[4] + 1;
-  Point1DArray zymatrix(zInc * zSize);
-  PointVector  coords;
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    newPoints.size(),
+    [&newPoints, &OutputImage](SizeValueType i) {
+      // the index value type must match the point value type
+      const ContinuousIndex<PointType::ValueType, 3> ind =
+        OutputImage->template TransformPhysicalPointToContinuousIndex<PointType::ValueType>(newPoints[i]);
+      for (unsigned int j = 0; j < 3; ++j)
+      {
+        newPoints[i][j] = ind[j];
+      }
+    },
+    nullptr);
 
-  const CellsContainerPointer cells = input->GetCells();
-  CellsContainerIterator      cellIt = cells->Begin();
+  // collect the polygons, in index coordinates, with their z range
+  PointArray                             polygons;
+  std::vector<std::pair<double, double>> zRanges;
 
-  while (cellIt != cells->End())
+  const CellsContainerPointer cells = input->GetCells();
+  for (CellsContainerIterator cellIt = cells->Begin(); cellIt != cells->End(); ++cellIt)
   {
-    CellType *                         nextCell = cellIt->Value();
-    typename CellType::PointIdIterator pointIt = nextCell->PointIdsBegin();
-    PointType                          p;
+    CellType * nextCell = cellIt->Value();
 
     switch (nextCell->GetType())
     {
@@ -376,112 +415,400 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::RasterizeTriangles()
       case CellGeometryEnum::TRIANGLE_CELL:
       case CellGeometryEnum::POLYGON_CELL:
       {
-        coords.clear();
-        while (pointIt != nextCell->PointIdsEnd())
+        PointVector coords;
+        double      zmin = NumericTraits<double>::max();
+        double      zmax = NumericTraits<double>::NonpositiveMin();
+        for (auto pointIt = nextCell->PointIdsBegin(); pointIt != nextCell->PointIdsEnd(); ++pointIt)
         {
-          if (!NewPointSet->GetPoint(*pointIt++, &newpoint))
+          if (*pointIt >= newPoints.size())
           {
-            itkExceptionMacro("Point with id " << *pointIt - 1 << " does not exist in the new pointset");
+            itkExceptionMacro("Point with id " << *pointIt << " does not exist in the new pointset");
           }
-          p[0] = newpoint[0];
-          p[1] = newpoint[1];
-          p[2] = newpoint[2];
+          const PointType & p = newPoints[*pointIt];
+          zmin = std::min(zmin, p[2]);
+          zmax = std::max(zmax, p[2]);
           coords.push_back(p);
         }
-        this->PolygonToImageRaster(coords, zymatrix, extent);
+        if (!coords.empty())
+        {
+          polygons.push_back(std::move(coords));
+          zRanges.emplace_back(zmin, zmax);
+        }
       }
       break;
       default:
         itkExceptionStringMacro("Need Triangle or Polygon cells ONLY");
     }
-    ++cellIt;
   }
 
-  const OutputImagePointer outputImage = this->GetOutput();
-  outputImage->FillBuffer(m_OutsideValue);
+  // the stencil is kept in 'zymatrix' that provides
+  // the x extents for each (y,z) coordinate for which a ray
+  // parallel to the x axis intersects the polydata. Each slab of z slices
+  // keeps its own stencil and is rasterized by a separate work unit.
+  const OutputImagePointer                   outputImage = this->GetOutput();
+  const typename OutputImageType::RegionType region = outputImage->GetBufferedRegion();
+  const SizeValueType                        numberOfSlices = region.GetSize(2);
+  const SizeValueType                        numberOfSlabs =
+    std::max(SizeValueType{ 1 }, std::min(SizeValueType{ this->GetNumberOfWorkUnits() }, numberOfSlices));
+  const int zInc = extent[3] - extent[2] + 1;
+
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    numberOfSlabs,
+    [this, &outputImage, &region, numberOfSlices, numberOfSlabs, &extent, zInc, &polygons, &zRanges](
+      SizeValueType s) {
+      typename OutputImageType::RegionType slabRegion = region;
+      const SizeValueType                  first = s * numberOfSlices / numberOfSlabs;
+      slabRegion.SetIndex(2, region.GetIndex(2) + static_cast<IndexValueType>(first));
+      slabRegion.SetSize(2, (s + 1) * numberOfSlices / numberOfSlabs - first);
+
+      for (ImageRegionIterator<OutputImageType> it(outputImage, slabRegion); !it.IsAtEnd(); ++it)
+      {
+        it.Set(m_OutsideValue);
+      }
 
-  for (int z = extent[4]; z <= extent[5]; ++z)
-  {
-    for (int y = extent[2]; y <= extent[3]; ++y)
-    {
-      const int     zyidx = (z - extent[4]) * zInc + (y - extent[2]);
-      Point1DVector xlist = zymatrix[zyidx];
+      const int firstSlice = std::max(extent[4], static_cast<int>(slabRegion.GetIndex(2)));
+      const int lastSlice =
+        std::min(extent[5], static_cast<int>(slabRegion.GetIndex(2) + slabRegion.GetSize(2)) - 1);
+      if (firstSlice > lastSlice)
+      {
+        return;
+      }
 
-      if (xlist.size() <= 1)
+      Point1DArray zymatrix(zInc * (lastSlice - firstSlice + 1));
+      for (size_t c = 0; c < polygons.size(); ++c)
       {
-        continue; // this is a peripheral point in the zy projection plane
+        if (zRanges[c].second >= firstSlice - 1 && zRanges[c].first <= lastSlice + 1)
+        {
+          PolygonToImageRaster(polygons[c], zymatrix, extent, firstSlice, lastSlice);
+        }
       }
 
-      std::sort(xlist.begin(), xlist.end(), ComparePoints1D);
+      for (int z = firstSlice; z <= lastSlice; ++z)
+      {
+        for (int y = extent[2]; y <= extent[3]; ++y)
+        {
+          const int       zyidx = (z - firstSlice) * zInc + (y - extent[2]);
+          Point1DVector & xlist = zymatrix[zyidx];
 
-      // get the first entry
-      double lastx = xlist[0].m_X;
-      int    lastSign = xlist[0].m_Sign;
-      int    signproduct = 1;
+          if (xlist.size() <= 1)
+          {
+            continue; // this is a peripheral point in the zy projection plane
+          }
 
-      // if adjacent x values are within tolerance of each
-      // other, check whether the number of 'exits' and
-      // 'entrances' are equal (via signproduct) and if so,
-      // ignore all x values, but if not, then count
-      // them as a single intersection of the ray with the
-      // surface
+          std::sort(xlist.begin(), xlist.end(), ComparePoints1D);
 
-      std::vector<double> nlist;
-      const size_t        m = xlist.size();
-      for (size_t j = 1; j < m; ++j)
-      {
-        const Point1D p1D = xlist[j];
-        const double  x = p1D.m_X;
-        const int     sign = p1D.m_Sign;
+          // get the first entry
+          double lastx = xlist[0].m_X;
+          int    lastSign = xlist[0].m_Sign;
+          int    signproduct = 1;
+
+          // if adjacent x values are within tolerance of each
+          // other, check whether the number of 'exits' and
+          // 'entrances' are equal (via signproduct) and if so,
+          // ignore all x values, but if not, then count
+          // them as a single intersection of the ray with the
+          // surface
+
+          std::vector<double> nlist;
+          const size_t        m = xlist.size();
+          for (size_t j = 1; j < m; ++j)
+          {
+            const Point1D p1D = xlist[j];
+            const double  x = p1D.m_X;
+            const int     sign = p1D.m_Sign;
+
+            // check absolute distance from lastx to x
+            if (itk::Math::Absolute(x - lastx) > m_Tolerance)
+            {
+              signproduct = sign * lastSign;
+              if (signproduct < 0)
+              {
+                nlist.push_back(lastx);
+              }
+            }
+            lastx = x;
+            lastSign = sign;
+          }
 
-        // check absolute distance from lastx to x
-        if (itk::Math::Absolute(x - lastx) > m_Tolerance)
+          nlist.push_back(lastx);
+
+          // create the stencil extents
+          int       minx1 = extent[0]; // minimum allowable x1 value
+          const int n = static_cast<int>(nlist.size()) / 2;
+
+          for (int i = 0; i < n; ++i)
+          {
+            auto x1 = static_cast<int>(std::ceil(nlist[2 * i]));
+            auto x2 = static_cast<int>(std::floor(nlist[2 * i + 1]));
+
+            if (x2 < extent[0] || x1 > (extent[1]))
+            {
+              continue;
+            }
+            x1 = (x1 > minx1) ? (x1) : (minx1);         // max(x1,minx1)
+            x2 = (x2 < extent[1]) ? (x2) : (extent[1]); // min(x2,extent[1])
+
+            if (x2 >= x1)
+            {
+              IndexType ind;
+              ind[0] = x1;
+              ind[1] = y;
+              ind[2] = z;
+              ValueType * span = outputImage->GetBufferPointer() + outputImage->ComputeOffset(ind);
+              std::fill(span, span + (x2 - x1 + 1), m_InsideValue);
+            }
+            // next x1 value must be at least x2+1
+            minx1 = x2 + 1;
+          }
+        }
+      }
+
+      if (m_ConservativeRasterization)
+      {
+        // set the voxels intersected by the triangles of each polygon
+        for (size_t c = 0; c < polygons.size(); ++c)
         {
-          signproduct = sign * lastSign;
-          if (signproduct < 0)
+          if (zRanges[c].second < firstSlice - 0.5 || zRanges[c].first > lastSlice + 0.5)
+          {
+            continue;
+          }
+          const PointVector & coords = polygons[c];
+          for (size_t k = 1; k + 1 < coords.size(); ++k)
           {
-            nlist.push_back(lastx);
+            const PointType & p0 = coords[0];
+            const PointType & p1 = coords[k];
+            const PointType & p2 = coords[k + 1];
+
+            const int bounds[6] = { extent[0], extent[1], extent[2], extent[3], firstSlice, lastSlice };
+            int       minIndex[3];
+            int       maxIndex[3];
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+              const double lower = std::min({ p0[j], p1[j], p2[j] });
+              const double upper = std::max({ p0[j], p1[j], p2[j] });
+              minIndex[j] = std::max(bounds[2 * j], static_cast<int>(std::ceil(lower - 0.5)));
+              maxIndex[j] = std::min(bounds[2 * j + 1], static_cast<int>(std::floor(upper + 0.5)));
+            }
+
+            IndexType ind;
+            for (ind[2] = minIndex[2]; ind[2] <= maxIndex[2]; ++ind[2])
+            {
+              for (ind[1] = minIndex[1]; ind[1] <= maxIndex[1]; ++ind[1])
+              {
+                for (ind[0] = minIndex[0]; ind[0] <= maxIndex[0]; ++ind[0])
+                {
+                  if (TriangleIntersectsVoxel(p0, p1, p2, ind))
+                  {
+                    outputImage->SetPixel(ind, m_InsideValue);
+                  }
+                }
+              }
+            }
           }
         }
-        lastx = x;
-        lastSign = sign;
       }
+    },
+    nullptr);
+}
+
+template <typename TInputMesh, typename TOutputImage>
+bool
+TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::TriangleIntersectsVoxel(const PointType & p0,
+                                                                                   const PointType & p1,
+                                                                                   const PointType & p2,
+                                                                                   const IndexType & index)
+{
+  // separating axis test of the triangle against the voxel box, see
+  // T. Akenine-Moller, "Fast 3D Triangle-Box Overlap Testing", 2001
+  using VectorType = Vector<double, 3>;
+  constexpr double halfSize = 0.5;
 
-      nlist.push_back(lastx);
+  VectorType v[3];
+  for (unsigned int j = 0; j < 3; ++j)
+  {
+    v[0][j] = p0[j] - index[j];
+    v[1][j] = p1[j] - index[j];
+    v[2][j] = p2[j] - index[j];
+  }
 
-      // create the stencil extents
-      int       minx1 = extent[0]; // minimum allowable x1 value
-      const int n = static_cast<int>(nlist.size()) / 2;
+  // project the triangle and the box onto an axis and check for a gap
+  const auto separated = [&v](const VectorType & axis) {
+    const double d0 = v[0] * axis;
+    const double d1 = v[1] * axis;
+    const double d2 = v[2] * axis;
+    const double radius =
+      halfSize * (itk::Math::Absolute(axis[0]) + itk::Math::Absolute(axis[1]) + itk::Math::Absolute(axis[2]));
+    return std::min({ d0, d1, d2 }) > radius || std::max({ d0, d1, d2 }) < -radius;
+  };
+
+  // the box normals
+  for (unsigned int j = 0; j < 3; ++j)
+  {
+    VectorType axis{};
+    axis[j] = 1.0;
+    if (separated(axis))
+    {
+      return false;
+    }
+  }
+
+  // the triangle normal
+  const VectorType edges[3] = { v[1] - v[0], v[2] - v[1], v[0] - v[2] };
+  if (separated(CrossProduct(edges[0], edges[1])))
+  {
+    return false;
+  }
 
-      for (int i = 0; i < n; ++i)
+  // the cross products of the box normals with the triangle edges
+  for (const auto & edge : edges)
+  {
+    for (unsigned int j = 0; j < 3; ++j)
+    {
+      VectorType normal{};
+      normal[j] = 1.0;
+      if (separated(CrossProduct(normal, edge)))
       {
-        auto x1 = static_cast<int>(std::ceil(nlist[2 * i]));
-        auto x2 = static_cast<int>(std::floor(nlist[2 * i + 1]));
+        return false;
+      }
+    }
+  }
+  return true;
+}
 
-        if (x2 < extent[0] || x1 > (extent[1]))
+template <typename TInputMesh, typename TOutputImage>
+void
+TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::ComputeDistanceMap()
+{
+  const OutputImageType * outputImage = this->GetOutput();
+  DistanceMapImageType *  distanceMap = this->GetSignedDistanceMap();
+  distanceMap->CopyInformation(outputImage);
+  distanceMap->SetRegions(outputImage->GetBufferedRegion());
+  distanceMap->Allocate();
+
+  const SizeType    size = outputImage->GetBufferedRegion().GetSize();
+  const SpacingType spacing = outputImage->GetSpacing();
+  SizeValueType     strides[3];
+  strides[0] = 1;
+  strides[1] = size[0];
+  strides[2] = size[0] * size[1];
+
+  const ValueType * mask = outputImage->GetBufferPointer();
+  float *           distance = distanceMap->GetBufferPointer();
+  constexpr float   infinity = std::numeric_limits<float>::infinity();
+
+  // the boundary voxels are the inside voxels with a face connected
+  // outside neighbor, and are the seeds of the squared distance transform
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    size[2],
+    [this, &size, &strides, mask, distance](SizeValueType z) {
+      for (SizeValueType y = 0; y < size[1]; ++y)
+      {
+        for (SizeValueType x = 0; x < size[0]; ++x)
         {
-          continue;
+          const SizeValueType offset = x * strides[0] + y * strides[1] + z * strides[2];
+          bool                boundary = false;
+          if (Math::ExactlyEquals(mask[offset], m_InsideValue))
+          {
+            const SizeValueType index[3] = { x, y, z };
+            for (unsigned int j = 0; j < 3 && !boundary; ++j)
+            {
+              boundary = (index[j] > 0 && Math::NotExactlyEquals(mask[offset - strides[j]], m_InsideValue)) ||
+                         (index[j] + 1 < size[j] && Math::NotExactlyEquals(mask[offset + strides[j]], m_InsideValue));
+            }
+          }
+          distance[offset] = boundary ? 0.0f : infinity;
         }
-        x1 = (x1 > minx1) ? (x1) : (minx1);         // max(x1,minx1)
-        x2 = (x2 < extent[1]) ? (x2) : (extent[1]); // min(x2,extent[1])
+      }
+    },
+    nullptr);
 
-        if (x2 >= x1)
+  // exact squared Euclidean distance transform, computed one dimension at a
+  // time with the lower envelope of parabolas of P. Felzenszwalb and
+  // D. Huttenlocher, "Distance Transforms of Sampled Functions", 2012
+  for (unsigned int d = 0; d < 3; ++d)
+  {
+    const unsigned int  outer = (d == 2) ? 1 : 2;
+    const unsigned int  inner = (d == 0) ? 1 : 0;
+    const SizeValueType n = size[d];
+    const double        s = spacing[d];
+
+    this->GetMultiThreader()->ParallelizeArray(
+      0,
+      size[outer],
+      [&size, &strides, distance, d, outer, inner, n, s](SizeValueType a) {
+        std::vector<double>        f(n);
+        std::vector<SizeValueType> v(n);
+        std::vector<double>        boundaries(n + 1);
+        for (SizeValueType b = 0; b < size[inner]; ++b)
         {
-          IndexType ind;
-          ind[1] = y;
-          ind[2] = z;
-          for (int idX = x1; idX <= x2; ++idX)
+          float * line = distance + a * strides[outer] + b * strides[inner];
+          for (SizeValueType q = 0; q < n; ++q)
           {
-            // TODO: check whether replacing this for loop by ImageScanlineIterator is faster
-            ind[0] = idX;
-            outputImage->SetPixel(ind, m_InsideValue);
+            f[q] = line[q * strides[d]];
+          }
+
+          // the lower envelope of the parabolas rooted at the finite values
+          int k = -1;
+          for (SizeValueType q = 0; q < n; ++q)
+          {
+            if (f[q] == std::numeric_limits<double>::infinity())
+            {
+              continue;
+            }
+            const double xq = q * s;
+            double       intersection = 0.0;
+            while (k >= 0)
+            {
+              const double xp = v[k] * s;
+              intersection = ((f[q] + xq * xq) - (f[v[k]] + xp * xp)) / (2.0 * (xq - xp));
+              if (intersection > boundaries[k])
+              {
+                break;
+              }
+              --k;
+            }
+            ++k;
+            v[k] = q;
+            boundaries[k] = (k == 0) ? -std::numeric_limits<double>::infinity() : intersection;
+          }
+          if (k < 0)
+          {
+            continue;
+          }
+          boundaries[k + 1] = std::numeric_limits<double>::infinity();
+
+          k = 0;
+          for (SizeValueType q = 0; q < n; ++q)
+          {
+            const double xq = q * s;
+            while (boundaries[k + 1] < xq)
+            {
+              ++k;
+            }
+            const double xp = v[k] * s;
+            line[q * strides[d]] = static_cast<float>((xq - xp) * (xq - xp) + f[v[k]]);
           }
         }
-        // next x1 value must be at least x2+1
-        minx1 = x2 + 1;
-      }
-    }
+      },
+      nullptr);
   }
+
+  // take the square root, negative inside the object
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    size[2],
+    [this, &strides, mask, distance](SizeValueType z) {
+      for (SizeValueType offset = z * strides[2]; offset < (z + 1) * strides[2]; ++offset)
+      {
+        const float value = (distance[offset] == std::numeric_limits<float>::infinity())
+                              ? NumericTraits<float>::max()
+                              : std::sqrt(distance[offset]);
+        distance[offset] = Math::ExactlyEquals(mask[offset], m_InsideValue) ? -value : value;
+      }
+    },
+    nullptr);
 }
 
 template <typename TInputMesh, typename TOutputImage>
@@ -497,6 +824,8 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PrintSelf(std::ostrea
   os << indent << "Spacing: " << m_Spacing << std::endl;
   os << indent << "Direction: " << std::endl << m_Direction << std::endl;
   os << indent << "Index: " << m_Index << std::endl;
+  itkPrintSelfBooleanMacro(ConservativeRasterization);
+  itkPrintSelfBooleanMacro(ComputeSignedDistanceMap);
 }
 } // end namespace itk
 
@@ -0,0 +1,263 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMeshCellLocator.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkRegularSphereMeshSource.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+using MeshType = itk::Mesh<float, Dimension>;
+using LocatorType = itk::MeshCellLocator<MeshType>;
+using PointType = MeshType::PointType;
+using CellType = MeshType::CellType;
+using QuadrilateralCellType = itk::QuadrilateralCell<CellType>;
+
+// The unit cube, made of six quadrilaterals.
+MeshType::Pointer
+MakeCubeMesh()
+{
+  auto mesh = MeshType::New();
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    PointType point;
+    point[0] = static_cast<float>(i & 1);
+    point[1] = static_cast<float>((i >> 1) & 1);
+    point[2] = static_cast<float>((i >> 2) & 1);
+    mesh->SetPoint(i, point);
+  }
+
+  constexpr MeshType::PointIdentifier faces[6][4] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 },
+                                                      { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+  for (unsigned int f = 0; f < 6; ++f)
+  {
+    CellType::CellAutoPointer cell;
+    cell.TakeOwnership(new QuadrilateralCellType);
+    cell->SetPointIds(faces[f]);
+    mesh->SetCell(f, cell);
+  }
+  return mesh;
+}
+
+bool
+CheckClosestPoint(const LocatorType * locator, const PointType & query, const PointType & expected)
+{
+  PointType                closestPoint;
+  MeshType::CellIdentifier cellId;
+  double                   squaredDistance;
+  if (!locator->FindClosestPoint(query, closestPoint, cellId, squaredDistance))
+  {
+    std::cerr << "No closest point found for " << query << std::endl;
+    return false;
+  }
+  if (closestPoint.EuclideanDistanceTo(expected) > 1e-6 ||
+      itk::Math::abs(squaredDistance - query.SquaredEuclideanDistanceTo(expected)) > 1e-6)
+  {
+    std::cerr << "Closest point of " << query << " is " << closestPoint << " at squared distance "
+              << squaredDistance << ", expected " << expected << std::endl;
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+int
+itkMeshCellLocatorTest(int, char *[])
+{
+  auto locator = LocatorType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(locator, MeshCellLocator, Object);
+
+  ITK_TRY_EXPECT_EXCEPTION(locator->Initialize());
+
+  constexpr unsigned int bucketSize = 2;
+  locator->SetBucketSize(bucketSize);
+  ITK_TEST_SET_GET_VALUE(bucketSize, locator->GetBucketSize());
+
+  int testStatus = EXIT_SUCCESS;
+
+  // The closest points on the faces, edges and vertices of a cube, whose
+  // quadrilaterals are split into triangles.
+  const auto cube = MakeCubeMesh();
+  locator->SetMesh(cube);
+  ITK_TEST_SET_GET_VALUE(cube.GetPointer(), locator->GetMesh());
+  ITK_TRY_EXPECT_NO_EXCEPTION(locator->Initialize());
+  ITK_TEST_EXPECT_EQUAL(locator->GetNumberOfTriangles(), 12u);
+
+  const std::vector<std::pair<PointType, PointType>> closestPoints = {
+    { itk::MakePoint(0.5f, 0.5f, 2.0f), itk::MakePoint(0.5f, 0.5f, 1.0f) },
+    { itk::MakePoint(0.25f, 0.75f, -1.0f), itk::MakePoint(0.25f, 0.75f, 0.0f) },
+    { itk::MakePoint(0.5f, 2.0f, 2.0f), itk::MakePoint(0.5f, 1.0f, 1.0f) },
+    { itk::MakePoint(2.0f, 2.0f, 2.0f), itk::MakePoint(1.0f, 1.0f, 1.0f) },
+    { itk::MakePoint(-1.0f, 0.5f, -1.0f), itk::MakePoint(0.0f, 0.5f, 0.0f) },
+    { itk::MakePoint(0.5f, 0.4f, 0.3f), itk::MakePoint(0.5f, 0.4f, 0.0f) }
+  };
+  for (const auto & closestPoint : closestPoints)
+  {
+    if (!CheckClosestPoint(locator, closestPoint.first, closestPoint.second))
+    {
+      testStatus = EXIT_FAILURE;
+    }
+  }
+
+  ITK_TEST_EXPECT_TRUE(locator->IsInside(itk::MakePoint(0.5f, 0.5f, 0.5f)));
+  ITK_TEST_EXPECT_TRUE(locator->IsInside(itk::MakePoint(0.1f, 0.9f, 0.5f)));
+  ITK_TEST_EXPECT_TRUE(!locator->IsInside(itk::MakePoint(1.5f, 0.5f, 0.5f)));
+  ITK_TEST_EXPECT_TRUE(!locator->IsInside(itk::MakePoint(-0.1f, -0.1f, -0.1f)));
+
+  const PointType          center = itk::MakePoint(0.5f, 0.5f, 0.5f);
+  double                   distance;
+  MeshType::CellIdentifier cellId;
+  ITK_TEST_EXPECT_TRUE(locator->IntersectRay(center, itk::MakeVector(1.0f, 0.0f, 0.0f), distance, cellId));
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(distance, 0.5));
+  ITK_TEST_EXPECT_EQUAL(cellId, 5);
+
+  const PointType below = itk::MakePoint(0.2f, 0.3f, -2.0f);
+  ITK_TEST_EXPECT_TRUE(locator->IntersectRay(below, itk::MakeVector(0.0f, 0.0f, 2.0f), distance, cellId));
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(distance, 1.0));
+  ITK_TEST_EXPECT_EQUAL(cellId, 0);
+
+  const PointType outside = itk::MakePoint(2.0f, 0.5f, 0.5f);
+  ITK_TEST_EXPECT_TRUE(!locator->IntersectRay(outside, itk::MakeVector(1.0f, 0.0f, 0.0f), distance, cellId));
+
+  // A sphere, whose queries are compared to an exhaustive search in a
+  // hierarchy made of a single leaf.
+  constexpr double radius = 10.0;
+  auto             sphere = itk::RegularSphereMeshSource<MeshType>::New();
+  sphere->SetResolution(3);
+  itk::RegularSphereMeshSource<MeshType>::VectorType scale;
+  scale.Fill(radius);
+  sphere->SetScale(scale);
+  sphere->Update();
+  const MeshType * sphereMesh = sphere->GetOutput();
+
+  locator->SetMesh(sphereMesh);
+  locator->SetBucketSize(4);
+  locator->Initialize();
+  ITK_TEST_EXPECT_EQUAL(locator->GetNumberOfTriangles(), sphereMesh->GetNumberOfCells());
+
+  auto exhaustiveLocator = LocatorType::New();
+  exhaustiveLocator->SetMesh(sphereMesh);
+  exhaustiveLocator->SetBucketSize(itk::NumericTraits<unsigned int>::max());
+  exhaustiveLocator->Initialize();
+
+  auto random = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  random->SetSeed(1234);
+  std::vector<PointType> queries(500);
+  for (auto & query : queries)
+  {
+    for (unsigned int i = 0; i < Dimension; ++i)
+    {
+      query[i] = static_cast<float>(random->GetUniformVariate(-1.5 * radius, 1.5 * radius));
+    }
+  }
+
+  std::vector<PointType>                closestPointsBatch;
+  std::vector<MeshType::CellIdentifier> cellIds;
+  std::vector<double>                   squaredDistances;
+  locator->FindClosestPoints(queries, closestPointsBatch, cellIds, squaredDistances);
+  ITK_TEST_EXPECT_EQUAL(squaredDistances.size(), queries.size());
+
+  std::vector<double> signedDistances;
+  locator->ComputeSignedDistances(queries, signedDistances);
+
+  unsigned int numberOfMismatches = 0;
+  for (size_t q = 0; q < queries.size(); ++q)
+  {
+    PointType                exhaustivePoint;
+    MeshType::CellIdentifier exhaustiveCellId;
+    double                   exhaustiveSquaredDistance;
+    exhaustiveLocator->FindClosestPoint(queries[q], exhaustivePoint, exhaustiveCellId, exhaustiveSquaredDistance);
+
+    if (!itk::Math::FloatAlmostEqual(squaredDistances[q], exhaustiveSquaredDistance, 4, 1e-9))
+    {
+      std::cerr << "Closest point of " << queries[q] << " is at squared distance " << squaredDistances[q]
+                << " instead of " << exhaustiveSquaredDistance << std::endl;
+      ++numberOfMismatches;
+    }
+
+    // The triangles of the sphere are smaller than 1, so queries away from
+    // the sphere are classified by their distance to the center.
+    const double distanceToCenter = queries[q].EuclideanDistanceTo(PointType(0.0f));
+    const bool   isInside = locator->IsInside(queries[q]);
+    if ((distanceToCenter < radius - 0.5 && !isInside) || (distanceToCenter > radius && isInside))
+    {
+      std::cerr << "Point " << queries[q] << " at distance " << distanceToCenter << " from the center is "
+                << (isInside ? "inside" : "outside") << std::endl;
+      ++numberOfMismatches;
+    }
+
+    const double expectedSignedDistance = (isInside ? -1.0 : 1.0) * std::sqrt(exhaustiveSquaredDistance);
+    if (!itk::Math::FloatAlmostEqual(signedDistances[q], expectedSignedDistance, 4, 1e-9))
+    {
+      std::cerr << "Signed distance of " << queries[q] << " is " << signedDistances[q] << " instead of "
+                << expectedSignedDistance << std::endl;
+      ++numberOfMismatches;
+    }
+
+    // Rays from the center hit the sphere close to the radius.
+    double rayDistance;
+    if (!locator->IntersectRay(PointType(0.0f), queries[q] - PointType(0.0f), rayDistance, cellId) ||
+        itk::Math::abs(rayDistance * distanceToCenter - radius) > 0.2)
+    {
+      std::cerr << "Ray from the center towards " << queries[q] << " does not hit the sphere" << std::endl;
+      ++numberOfMismatches;
+    }
+  }
+  if (numberOfMismatches > 0)
+  {
+    std::cerr << "Test failed: " << numberOfMismatches << " mismatches." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // The same queries on compact cells.
+  auto compactMesh = MeshType::New();
+  compactMesh->SetPoints(const_cast<MeshType::PointsContainer *>(sphereMesh->GetPoints()));
+  auto pointIds = MeshType::CellPointIdsContainer::New();
+  for (auto it = sphereMesh->GetCells()->Begin(); it != sphereMesh->GetCells()->End(); ++it)
+  {
+    for (auto pointId = it.Value()->PointIdsBegin(); pointId != it.Value()->PointIdsEnd(); ++pointId)
+    {
+      pointIds->push_back(*pointId);
+    }
+  }
+  compactMesh->SetCompactCells(itk::CellGeometryEnum::TRIANGLE_CELL, pointIds);
+
+  auto compactLocator = LocatorType::New();
+  compactLocator->SetMesh(compactMesh);
+  compactLocator->Initialize();
+  ITK_TEST_EXPECT_EQUAL(compactLocator->GetNumberOfTriangles(), sphereMesh->GetNumberOfCells());
+  for (size_t q = 0; q < queries.size(); ++q)
+  {
+    PointType                compactPoint;
+    MeshType::CellIdentifier compactCellId;
+    double                   compactSquaredDistance;
+    compactLocator->FindClosestPoint(queries[q], compactPoint, compactCellId, compactSquaredDistance);
+    if (compactSquaredDistance != squaredDistances[q] || compactCellId != cellIds[q])
+    {
+      std::cerr << "Test failed: compact cells give a different closest point for " << queries[q] << std::endl;
+      testStatus = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
@@ -0,0 +1,321 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkCellInterfaceVisitor.h"
+#include "itkMesh.h"
+#include "itkMeshFileReader.h"
+#include "itkMeshFileWriter.h"
+#include "itkMultiThreaderBase.h"
+#include "itkTransformMeshFilter.h"
+#include "itkTranslationTransform.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+using MeshType = itk::Mesh<float, Dimension>;
+using CellType = MeshType::CellType;
+using TriangleCellType = itk::TriangleCell<CellType>;
+using QuadrilateralCellType = itk::QuadrilateralCell<CellType>;
+
+// Count the visited cells and accumulate their point identifiers.
+class VisitCells
+{
+public:
+  void
+  Visit(unsigned long cellId, TriangleCellType * cell)
+  {
+    this->Count(cellId, cell);
+  }
+
+  void
+  Visit(unsigned long cellId, QuadrilateralCellType * cell)
+  {
+    this->Count(cellId, cell);
+  }
+
+  void
+  Count(unsigned long cellId, CellType * cell)
+  {
+    ++m_NumberOfCells;
+    m_CellIdSum += cellId;
+    for (auto pointId = cell->PointIdsBegin(); pointId != cell->PointIdsEnd(); ++pointId)
+    {
+      m_PointIdSum += *pointId;
+    }
+  }
+
+  unsigned int  m_NumberOfCells{ 0 };
+  unsigned long m_CellIdSum{ 0 };
+  unsigned long m_PointIdSum{ 0 };
+};
+
+using TriangleVisitorType =
+  itk::CellInterfaceVisitorImplementation<float, MeshType::CellTraits, TriangleCellType, VisitCells>;
+using QuadrilateralVisitorType =
+  itk::CellInterfaceVisitorImplementation<float, MeshType::CellTraits, QuadrilateralCellType, VisitCells>;
+
+// A grid of points on the z = 0 plane.
+MeshType::Pointer
+MakeGridMesh(unsigned int gridSize)
+{
+  auto mesh = MeshType::New();
+  for (unsigned int j = 0; j < gridSize; ++j)
+  {
+    for (unsigned int i = 0; i < gridSize; ++i)
+    {
+      mesh->SetPoint(j * gridSize + i, MeshType::PointType{ { static_cast<float>(i), static_cast<float>(j), 0.0f } });
+    }
+  }
+  return mesh;
+}
+
+// Check that the cells of the mesh have the given types and point identifiers.
+bool
+CheckCells(const MeshType *                               mesh,
+           const std::vector<itk::CellGeometryEnum> &     cellTypes,
+           const std::vector<MeshType::PointIdentifier> & pointIds)
+{
+  if (mesh->GetNumberOfCells() != cellTypes.size())
+  {
+    std::cerr << "Expected " << cellTypes.size() << " cells, got " << mesh->GetNumberOfCells() << std::endl;
+    return false;
+  }
+
+  size_t index = 0;
+  for (MeshType::CellIdentifier cellId = 0; cellId < cellTypes.size(); ++cellId)
+  {
+    MeshType::CellAutoPointer cell;
+    if (!mesh->GetCell(cellId, cell) || cell->GetType() != cellTypes[cellId])
+    {
+      std::cerr << "Invalid cell " << cellId << std::endl;
+      return false;
+    }
+    for (auto pointId = cell->PointIdsBegin(); pointId != cell->PointIdsEnd(); ++pointId)
+    {
+      if (*pointId != pointIds[index++])
+      {
+        std::cerr << "Invalid point identifier of cell " << cellId << std::endl;
+        return false;
+      }
+    }
+  }
+  return index == pointIds.size();
+}
+} // namespace
+
+int
+itkMeshCompactCellsTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputFileName" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Two triangles per square of a 3x3 grid of points.
+  constexpr unsigned int gridSize = 3;
+  auto                   mesh = MakeGridMesh(gridSize);
+
+  auto                                   pointIds = MeshType::CellPointIdsContainer::New();
+  std::vector<itk::CellGeometryEnum>     triangleTypes;
+  std::vector<MeshType::PointIdentifier> trianglePointIds;
+  for (unsigned int j = 0; j + 1 < gridSize; ++j)
+  {
+    for (unsigned int i = 0; i + 1 < gridSize; ++i)
+    {
+      const MeshType::PointIdentifier p = j * gridSize + i;
+      for (const MeshType::PointIdentifier id : { p, p + 1, p + gridSize, p + 1, p + gridSize + 1, p + gridSize })
+      {
+        trianglePointIds.push_back(id);
+      }
+      triangleTypes.insert(triangleTypes.end(), 2, itk::CellGeometryEnum::TRIANGLE_CELL);
+    }
+  }
+  pointIds->CastToSTLContainer() = trianglePointIds;
+
+  ITK_TEST_EXPECT_TRUE(!mesh->HasCompactCells());
+
+  // The number of point identifiers must be a multiple of the number of
+  // points of the cells, which must be fixed.
+  auto invalidPointIds = MeshType::CellPointIdsContainer::New();
+  invalidPointIds->CastToSTLContainer() = { 0, 1, 2, 3 };
+  ITK_TRY_EXPECT_EXCEPTION(mesh->SetCompactCells(itk::CellGeometryEnum::TRIANGLE_CELL, invalidPointIds));
+  ITK_TRY_EXPECT_EXCEPTION(mesh->SetCompactCells(itk::CellGeometryEnum::POLYGON_CELL, invalidPointIds));
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(mesh->SetCompactCells(itk::CellGeometryEnum::TRIANGLE_CELL, pointIds));
+  ITK_TEST_EXPECT_TRUE(mesh->HasCompactCells());
+  ITK_TEST_EXPECT_TRUE(mesh->GetCompactCellTypes() == nullptr);
+  ITK_TEST_EXPECT_TRUE(mesh->GetCompactCellOffsets() == nullptr);
+  ITK_TEST_EXPECT_EQUAL(mesh->GetCompactCellPointIds(), pointIds.GetPointer());
+  ITK_TEST_EXPECT_TRUE(CheckCells(mesh, triangleTypes, trianglePointIds));
+
+  // The visitors see every cell, without creating the cells.
+  {
+    auto triangleVisitor = TriangleVisitorType::New();
+    auto multiVisitor = CellType::MultiVisitor::New();
+    multiVisitor->AddVisitor(triangleVisitor);
+    mesh->Accept(multiVisitor);
+
+    unsigned long pointIdSum = 0;
+    for (const auto id : trianglePointIds)
+    {
+      pointIdSum += id;
+    }
+    ITK_TEST_EXPECT_EQUAL(triangleVisitor->m_NumberOfCells, triangleTypes.size());
+    ITK_TEST_EXPECT_EQUAL(triangleVisitor->m_CellIdSum, triangleTypes.size() * (triangleTypes.size() - 1) / 2);
+    ITK_TEST_EXPECT_EQUAL(triangleVisitor->m_PointIdSum, pointIdSum);
+    ITK_TEST_EXPECT_TRUE(mesh->HasCompactCells());
+  }
+
+  // The cell links are built from the point identifiers.
+  mesh->BuildCellLinks();
+  ITK_TEST_EXPECT_EQUAL(mesh->GetCellLinks()->ElementAt(0).size(), 1);
+  ITK_TEST_EXPECT_EQUAL(mesh->GetCellLinks()->ElementAt(gridSize + 1).size(), 6);
+  ITK_TEST_EXPECT_TRUE(mesh->HasCompactCells());
+
+  // The cells array holds the type, number of points and point identifiers.
+  const MeshType::CellsVectorContainer * cellsArray = mesh->GetCellsArray();
+  ITK_TEST_EXPECT_EQUAL(cellsArray->Size(), 2 * triangleTypes.size() + trianglePointIds.size());
+  ITK_TEST_EXPECT_EQUAL(cellsArray->ElementAt(0),
+                        static_cast<itk::IdentifierType>(itk::CellGeometryEnum::TRIANGLE_CELL));
+  ITK_TEST_EXPECT_EQUAL(cellsArray->ElementAt(1), 3);
+  ITK_TEST_EXPECT_EQUAL(cellsArray->ElementAt(4), trianglePointIds[2]);
+
+  // Filters share the compact cells of their input.
+  {
+    using TransformType = itk::TranslationTransform<double, Dimension>;
+    auto transform = TransformType::New();
+    transform->SetOffset(TransformType::OutputVectorType(1.0));
+
+    using FilterType = itk::TransformMeshFilter<MeshType, MeshType, TransformType>;
+    auto filter = FilterType::New();
+    filter->SetInput(mesh);
+    filter->SetTransform(transform);
+    ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+    ITK_TEST_EXPECT_TRUE(filter->GetOutput()->HasCompactCells());
+    ITK_TEST_EXPECT_EQUAL(filter->GetOutput()->GetCompactCellPointIds(), pointIds.GetPointer());
+    ITK_TEST_EXPECT_TRUE(CheckCells(filter->GetOutput(), triangleTypes, trianglePointIds));
+  }
+
+  // A const mesh expands its compact cells once, whichever thread requests
+  // the cell objects first, and keeps them.
+  {
+    auto sharedMesh = MakeGridMesh(gridSize);
+    sharedMesh->SetCompactCells(itk::CellGeometryEnum::TRIANGLE_CELL, pointIds);
+    const MeshType * constMesh = sharedMesh;
+
+    const MeshType::CellIdentifier numberOfCells = constMesh->GetNumberOfCells();
+    std::vector<unsigned char>     isValid(8 * numberOfCells, 0);
+
+    auto multiThreader = itk::MultiThreaderBase::New();
+    multiThreader->SetNumberOfWorkUnits(8);
+    multiThreader->ParallelizeArray(
+      0,
+      isValid.size(),
+      [constMesh, numberOfCells, &isValid](itk::SizeValueType i) {
+        const MeshType::CellIdentifier cellId = i % numberOfCells;
+        MeshType::CellAutoPointer      edge;
+        isValid[i] = constMesh->GetCells()->Size() == numberOfCells &&
+                     constMesh->GetCellBoundaryFeature(1, cellId, 0, edge) && edge->GetNumberOfPoints() == 2;
+      },
+      nullptr);
+
+    ITK_TEST_EXPECT_TRUE(std::all_of(isValid.begin(), isValid.end(), [](unsigned char valid) { return valid; }));
+    ITK_TEST_EXPECT_TRUE(constMesh->HasCompactCells());
+    ITK_TEST_EXPECT_TRUE(CheckCells(constMesh, triangleTypes, trianglePointIds));
+  }
+
+  // The cells are converted into cell objects when the cells container is
+  // requested for modification.
+  const MeshType::CellsContainer * cells = mesh->GetCells();
+  ITK_TEST_EXPECT_TRUE(!mesh->HasCompactCells());
+  ITK_TEST_EXPECT_EQUAL(cells->Size(), triangleTypes.size());
+  ITK_TEST_EXPECT_TRUE(CheckCells(mesh, triangleTypes, trianglePointIds));
+
+  // Mixed cell types are stored with their types and offsets.
+  auto mixedMesh = MakeGridMesh(gridSize);
+  auto cellTypes = MeshType::CellGeometryContainer::New();
+  auto offsets = MeshType::CellOffsetsContainer::New();
+  auto mixedPointIds = MeshType::CellPointIdsContainer::New();
+
+  const std::vector<itk::CellGeometryEnum>     mixedTypes{ itk::CellGeometryEnum::QUADRILATERAL_CELL,
+                                                       itk::CellGeometryEnum::TRIANGLE_CELL,
+                                                       itk::CellGeometryEnum::TRIANGLE_CELL,
+                                                       itk::CellGeometryEnum::POLYGON_CELL };
+  const std::vector<MeshType::PointIdentifier> mixedIds{ 0, 1, 4, 3, 1, 2, 4, 2, 5, 4, 3, 4, 7, 8, 6 };
+  cellTypes->CastToSTLContainer() = mixedTypes;
+  offsets->CastToSTLContainer() = { 0, 4, 7, 10, 15 };
+  mixedPointIds->CastToSTLContainer() = mixedIds;
+
+  offsets->CastToSTLContainer().pop_back();
+  ITK_TRY_EXPECT_EXCEPTION(mixedMesh->SetCompactCells(cellTypes, offsets, mixedPointIds));
+  offsets->CastToSTLContainer().push_back(15);
+  ITK_TRY_EXPECT_NO_EXCEPTION(mixedMesh->SetCompactCells(cellTypes, offsets, mixedPointIds));
+  ITK_TEST_EXPECT_TRUE(CheckCells(mixedMesh, mixedTypes, mixedIds));
+  ITK_TEST_EXPECT_EQUAL(mixedMesh->GetCompactCellType(3), itk::CellGeometryEnum::POLYGON_CELL);
+  ITK_TEST_EXPECT_EQUAL(mixedMesh->GetCompactCellPointIdsEnd(3) - mixedMesh->GetCompactCellPointIdsBegin(3), 5);
+
+  {
+    auto triangleVisitor = TriangleVisitorType::New();
+    auto quadrilateralVisitor = QuadrilateralVisitorType::New();
+    auto multiVisitor = CellType::MultiVisitor::New();
+    multiVisitor->AddVisitor(triangleVisitor);
+    multiVisitor->AddVisitor(quadrilateralVisitor);
+    mixedMesh->Accept(multiVisitor);
+    ITK_TEST_EXPECT_EQUAL(triangleVisitor->m_NumberOfCells, 2);
+    ITK_TEST_EXPECT_EQUAL(triangleVisitor->m_CellIdSum, 3);
+    ITK_TEST_EXPECT_EQUAL(triangleVisitor->m_PointIdSum, 18);
+    ITK_TEST_EXPECT_EQUAL(quadrilateralVisitor->m_NumberOfCells, 1);
+    ITK_TEST_EXPECT_EQUAL(quadrilateralVisitor->m_PointIdSum, 8);
+  }
+
+  // The compact cells are written without being converted, and read back as
+  // compact cells. Polygons with three points are read as triangles.
+  auto writer = itk::MeshFileWriter<MeshType>::New();
+  writer->SetInput(mixedMesh);
+  writer->SetFileName(argv[1]);
+  ITK_TRY_EXPECT_NO_EXCEPTION(writer->Update());
+  ITK_TEST_EXPECT_TRUE(mixedMesh->HasCompactCells());
+
+  auto reader = itk::MeshFileReader<MeshType>::New();
+  reader->SetFileName(argv[1]);
+  ITK_TEST_SET_GET_BOOLEAN(reader, CompactCells, true);
+  ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+  ITK_TEST_EXPECT_TRUE(reader->GetOutput()->HasCompactCells());
+  ITK_TEST_EXPECT_EQUAL(reader->GetOutput()->GetNumberOfCells(), mixedTypes.size());
+  ITK_TEST_EXPECT_EQUAL(reader->GetOutput()->GetCompactCellPointIds()->Size(), mixedIds.size());
+
+  // Setting a cell converts the compact cells first.
+  MeshType::CellAutoPointer triangle;
+  triangle.TakeOwnership(new TriangleCellType);
+  triangle->SetPointIds(mixedIds.data() + 4);
+  mixedMesh->SetCell(4, triangle);
+  ITK_TEST_EXPECT_TRUE(!mixedMesh->HasCompactCells());
+  std::vector<itk::CellGeometryEnum> expandedTypes = mixedTypes;
+  expandedTypes.push_back(itk::CellGeometryEnum::TRIANGLE_CELL);
+  std::vector<MeshType::PointIdentifier> expandedIds = mixedIds;
+  expandedIds.insert(expandedIds.end(), { 1, 2, 4 });
+  ITK_TEST_EXPECT_TRUE(CheckCells(mixedMesh, expandedTypes, expandedIds));
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMeshSurfaceDistanceCalculator.h"
+#include "itkRegularSphereMeshSource.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+using MeshType = itk::Mesh<float, Dimension>;
+using SphereType = itk::RegularSphereMeshSource<MeshType>;
+
+MeshType::Pointer
+MakeSphere(double radius, double shift)
+{
+  auto sphere = SphereType::New();
+  sphere->SetResolution(3);
+  SphereType::VectorType scale;
+  scale.Fill(radius);
+  sphere->SetScale(scale);
+  SphereType::PointType center;
+  center.Fill(0.0);
+  center[0] = shift;
+  sphere->SetCenter(center);
+  sphere->Update();
+  return sphere->GetOutput();
+}
+
+// Compute the directed Hausdorff distance by visiting all the points and
+// all the triangles, with the closest point computed by sampling the
+// triangles, so that it is only an upper bound of the exact distance.
+double
+DirectedHausdorffUpperBound(const MeshType * mesh1, const MeshType * mesh2)
+{
+  constexpr unsigned int numberOfSamples = 8;
+
+  std::vector<MeshType::PointType> samples;
+  for (auto it = mesh2->GetCells()->Begin(); it != mesh2->GetCells()->End(); ++it)
+  {
+    const auto * pointIds = it.Value()->PointIdsBegin();
+    const auto   a = mesh2->GetPoint(pointIds[0]);
+    const auto   b = mesh2->GetPoint(pointIds[1]);
+    const auto   c = mesh2->GetPoint(pointIds[2]);
+    for (unsigned int i = 0; i <= numberOfSamples; ++i)
+    {
+      for (unsigned int j = 0; i + j <= numberOfSamples; ++j)
+      {
+        const float u = static_cast<float>(i) / numberOfSamples;
+        const float v = static_cast<float>(j) / numberOfSamples;
+        samples.push_back(a + (b - a) * u + (c - a) * v);
+      }
+    }
+  }
+
+  double maximum = 0.0;
+  for (auto it = mesh1->GetPoints()->Begin(); it != mesh1->GetPoints()->End(); ++it)
+  {
+    double minimum = itk::NumericTraits<double>::max();
+    for (const auto & sample : samples)
+    {
+      minimum = std::min(minimum, it.Value().SquaredEuclideanDistanceTo(sample));
+    }
+    maximum = std::max(maximum, std::sqrt(minimum));
+  }
+  return maximum;
+}
+} // namespace
+
+int
+itkMeshSurfaceDistanceCalculatorTest(int, char *[])
+{
+  using CalculatorType = itk::MeshSurfaceDistanceCalculator<MeshType>;
+  auto calculator = CalculatorType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(calculator, MeshSurfaceDistanceCalculator, Object);
+
+  ITK_TRY_EXPECT_EXCEPTION(calculator->Compute());
+
+  const auto sphere = MakeSphere(10.0, 0.0);
+  const auto largerSphere = MakeSphere(12.0, 0.0);
+  const auto shiftedSphere = MakeSphere(10.0, 0.5);
+
+  // A mesh is at distance zero from itself.
+  calculator->SetMesh1(sphere);
+  ITK_TEST_SET_GET_VALUE(sphere.GetPointer(), calculator->GetMesh1());
+  calculator->SetMesh2(sphere);
+  ITK_TEST_SET_GET_VALUE(sphere.GetPointer(), calculator->GetMesh2());
+  ITK_TRY_EXPECT_NO_EXCEPTION(calculator->Compute());
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(calculator->GetHausdorffDistance(), 0.0));
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(calculator->GetMeanDistance(), 0.0));
+
+  int testStatus = EXIT_SUCCESS;
+
+  // The points of concentric spheres are about two apart from the other
+  // sphere. The points of the larger sphere are farther from the smaller
+  // sphere, because the triangles are inside the spheres.
+  calculator->SetMesh2(largerSphere);
+  calculator->Compute();
+  std::cout << "Concentric spheres: directed " << calculator->GetDirectedHausdorffDistance() << ", Hausdorff "
+            << calculator->GetHausdorffDistance() << ", mean " << calculator->GetMeanDistance() << std::endl;
+  if (calculator->GetDirectedHausdorffDistance() > 2.0 + 1e-4 || calculator->GetDirectedHausdorffDistance() < 1.8 ||
+      calculator->GetHausdorffDistance() < 2.0 - 1e-4 || calculator->GetHausdorffDistance() > 2.2 ||
+      calculator->GetMeanDistance() < 1.8 || calculator->GetMeanDistance() > 2.2)
+  {
+    std::cerr << "Test failed: unexpected distances between concentric spheres." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // Compare with an exhaustive search for shifted spheres.
+  calculator->SetMesh2(shiftedSphere);
+  calculator->GetMultiThreader()->SetNumberOfWorkUnits(3);
+  calculator->Compute();
+  const double upperBound = DirectedHausdorffUpperBound(sphere, shiftedSphere);
+  std::cout << "Shifted spheres: directed " << calculator->GetDirectedHausdorffDistance() << ", exhaustive "
+            << upperBound << std::endl;
+  if (calculator->GetDirectedHausdorffDistance() > upperBound + 1e-4 ||
+      calculator->GetDirectedHausdorffDistance() < upperBound - 0.05 || calculator->GetHausdorffDistance() > 0.5 + 1e-4)
+  {
+    std::cerr << "Test failed: unexpected distances between shifted spheres." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // A mesh without surface cells.
+  auto pointsOnly = MeshType::New();
+  pointsOnly->SetPoints(const_cast<MeshType::PointsContainer *>(sphere->GetPoints()));
+  calculator->SetMesh2(pointsOnly);
+  ITK_TRY_EXPECT_EXCEPTION(calculator->Compute());
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
@@ -0,0 +1,197 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkTriangleMeshToBinaryImageFilter.h"
+#include "itkRegularSphereMeshSource.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+using MeshType = itk::Mesh<float, Dimension>;
+using ImageType = itk::Image<unsigned char, Dimension>;
+using FilterType = itk::TriangleMeshToBinaryImageFilter<MeshType, ImageType>;
+
+FilterType::Pointer
+Rasterize(MeshType * mesh, itk::ThreadIdType numberOfWorkUnits, bool conservative, bool signedDistance)
+{
+  auto filter = FilterType::New();
+  filter->SetInput(mesh);
+  filter->SetSize(ImageType::SizeType{ { 30, 26, 22 } });
+  const double origin[3] = { -7.0, -6.0, -5.0 };
+  filter->SetOrigin(origin);
+  const double spacing[3] = { 0.5, 0.5, 0.6 };
+  filter->SetSpacing(spacing);
+  filter->SetInsideValue(255);
+  filter->SetOutsideValue(0);
+  filter->SetNumberOfWorkUnits(numberOfWorkUnits);
+  filter->SetConservativeRasterization(conservative);
+  filter->SetComputeSignedDistanceMap(signedDistance);
+  filter->Update();
+  return filter;
+}
+
+unsigned int
+CountInside(const ImageType * image)
+{
+  unsigned int count = 0;
+  for (itk::ImageRegionConstIteratorWithIndex<ImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    count += (it.Get() == 255);
+  }
+  return count;
+}
+} // namespace
+
+int
+itkTriangleMeshToBinaryImageFilterTest5(int, char *[])
+{
+  auto rasterizer = FilterType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(rasterizer, TriangleMeshToBinaryImageFilter, ImageSource);
+
+  ITK_TEST_SET_GET_BOOLEAN(rasterizer, ConservativeRasterization, true);
+  ITK_TEST_SET_GET_BOOLEAN(rasterizer, ComputeSignedDistanceMap, true);
+
+  // An ellipsoid, off the voxel grid.
+  using SphereType = itk::RegularSphereMeshSource<MeshType>;
+  auto sphere = SphereType::New();
+  sphere->SetResolution(4);
+  SphereType::VectorType scale;
+  scale[0] = 5.0;
+  scale[1] = 4.0;
+  scale[2] = 3.5;
+  sphere->SetScale(scale);
+  MeshType::PointType center;
+  center[0] = 0.3;
+  center[1] = -0.2;
+  center[2] = 0.1;
+  sphere->SetCenter(center);
+  sphere->Update();
+  MeshType * mesh = sphere->GetOutput();
+
+  int testStatus = EXIT_SUCCESS;
+
+  // The slabs rasterized by several work units give the same image.
+  const auto reference = Rasterize(mesh, 1, false, false);
+  const auto conservativeReference = Rasterize(mesh, 1, true, true);
+  for (const itk::ThreadIdType numberOfWorkUnits : { 3, 8, 64 })
+  {
+    for (const bool conservative : { false, true })
+    {
+      const auto         filter = Rasterize(mesh, numberOfWorkUnits, conservative, conservative);
+      const ImageType *  expected = conservative ? conservativeReference->GetOutput() : reference->GetOutput();
+      const ImageType *  image = filter->GetOutput();
+      const unsigned int numberOfPixels = image->GetBufferedRegion().GetNumberOfPixels();
+      if (!std::equal(
+            image->GetBufferPointer(), image->GetBufferPointer() + numberOfPixels, expected->GetBufferPointer()))
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Rasterization with " << numberOfWorkUnits << " work units differs" << std::endl;
+        testStatus = EXIT_FAILURE;
+      }
+      if (conservative &&
+          !std::equal(filter->GetSignedDistanceMap()->GetBufferPointer(),
+                      filter->GetSignedDistanceMap()->GetBufferPointer() + numberOfPixels,
+                      conservativeReference->GetSignedDistanceMap()->GetBufferPointer()))
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Signed distance map with " << numberOfWorkUnits << " work units differs" << std::endl;
+        testStatus = EXIT_FAILURE;
+      }
+    }
+  }
+
+  // The conservative rasterization contains the standard one, and every
+  // voxel a vertex of the mesh lies in.
+  const ImageType * image = reference->GetOutput();
+  const ImageType * conservativeImage = conservativeReference->GetOutput();
+  std::cout << "Inside voxels: " << CountInside(image) << ", conservative: " << CountInside(conservativeImage)
+            << std::endl;
+  ITK_TEST_EXPECT_TRUE(CountInside(conservativeImage) > CountInside(image));
+  for (itk::ImageRegionConstIteratorWithIndex<ImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    if (it.Get() == 255 && conservativeImage->GetPixel(it.GetIndex()) != 255)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Voxel " << it.GetIndex() << " is not in the conservative rasterization" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  for (auto it = mesh->GetPoints()->Begin(); it != mesh->GetPoints()->End(); ++it)
+  {
+    const auto index = conservativeImage->TransformPhysicalPointToIndex(it.Value());
+    if (conservativeImage->GetPixel(index) != 255)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Voxel " << index << " of vertex " << it.Value() << " is not set" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The signed distance map is the distance to the nearest boundary voxel.
+  const FilterType::DistanceMapImageType * distanceMap = conservativeReference->GetSignedDistanceMap();
+  ITK_TEST_EXPECT_EQUAL(distanceMap->GetBufferedRegion(), conservativeImage->GetBufferedRegion());
+  ITK_TEST_EXPECT_EQUAL(distanceMap->GetSpacing(), conservativeImage->GetSpacing());
+
+  std::vector<ImageType::PointType> boundary;
+  for (itk::ImageRegionConstIteratorWithIndex<ImageType> it(conservativeImage, conservativeImage->GetBufferedRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    bool isBoundary = false;
+    for (unsigned int j = 0; j < Dimension && it.Get() == 255; ++j)
+    {
+      for (const int step : { -1, 1 })
+      {
+        ImageType::IndexType neighbor = it.GetIndex();
+        neighbor[j] += step;
+        isBoundary |= conservativeImage->GetBufferedRegion().IsInside(neighbor) &&
+                      conservativeImage->GetPixel(neighbor) != 255;
+      }
+    }
+    if (isBoundary)
+    {
+      boundary.push_back(conservativeImage->TransformIndexToPhysicalPoint<double>(it.GetIndex()));
+    }
+  }
+
+  double maximumError = 0.0;
+  for (itk::ImageRegionConstIteratorWithIndex<ImageType> it(conservativeImage, conservativeImage->GetBufferedRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    const auto point = conservativeImage->TransformIndexToPhysicalPoint<double>(it.GetIndex());
+    double     expected = itk::NumericTraits<double>::max();
+    for (const auto & boundaryPoint : boundary)
+    {
+      expected = std::min(expected, point.EuclideanDistanceTo(boundaryPoint));
+    }
+    if (it.Get() == 255)
+    {
+      expected = -expected;
+    }
+    maximumError = std::max(maximumError, itk::Math::Absolute(expected - distanceMap->GetPixel(it.GetIndex())));
+  }
+  std::cout << "Maximum signed distance error: " << maximumError << std::endl;
+  ITK_TEST_EXPECT_TRUE(maximumError < 1e-4);
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
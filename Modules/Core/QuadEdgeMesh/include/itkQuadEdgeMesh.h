@@ -364,6 +364,16 @@ public:
   virtual QEPrimal *
   AddFaceTriangle(const PointIdentifier & aPid, const PointIdentifier & bPid, const PointIdentifier & cPid);
 
+  /** Adds triangular faces to the Mesh, given as a list of point
+   * identifiers with three points per face, each ordered counter-clock
+   * wise. The edges shared by the faces are matched in parallel by hashing,
+   * so that the faces are linked without searching the Onext() rings of
+   * their points. When the Mesh already has edges, or when the faces do not
+   * form a consistently oriented manifold, the faces are added one by one
+   * with AddFaceTriangle() instead. */
+  virtual void
+  AddFaceTriangles(const PointIdList & triangles);
+
   /** Deletion methods */
   virtual void
   DeletePoint(const PointIdentifier & pid);
@@ -17,7 +17,11 @@
  *=========================================================================*/
 #ifndef itkQuadEdgeMesh_hxx
 #define itkQuadEdgeMesh_hxx
+#include "itkMultiThreaderBase.h"
+#include <algorithm>
 #include <limits>
+#include <numeric>
+#include <unordered_map>
 #include <vector>
 
 namespace itk
@@ -1340,6 +1344,155 @@ QuadEdgeMesh<TPixel, VDimension, TTraits>::AddFaceTriangle(const PointIdentifier
   return this->AddFace(points);
 }
 
+/**
+ * Add triangle faces to this QuadEdgeMesh, matching their edges by hashing.
+ * @param triangles \ref PointIdentifier of the points of the faces
+ */
+template <typename TPixel, unsigned int VDimension, typename TTraits>
+void
+QuadEdgeMesh<TPixel, VDimension, TTraits>::AddFaceTriangles(const PointIdList & triangles)
+{
+  if (triangles.size() % 3 != 0)
+  {
+    itkExceptionMacro("The number of point identifiers " << triangles.size() << " is not a multiple of 3");
+  }
+
+  const auto addFacesOneByOne = [this, &triangles]() {
+    for (size_t i = 0; i < triangles.size(); i += 3)
+    {
+      this->AddFaceTriangle(triangles[i], triangles[i + 1], triangles[i + 2]);
+    }
+  };
+
+  if (m_NumberOfEdges > 0)
+  {
+    addFacesOneByOne();
+    return;
+  }
+
+  // The half edge h goes from the point h to the next point of its face.
+  const SizeValueType numberOfHalfEdges = triangles.size();
+  const auto destination = [&triangles](SizeValueType h) { return triangles[h - h % 3 + (h + 1) % 3]; };
+
+  using EdgeKeyType = std::pair<PointIdentifier, PointIdentifier>;
+  struct EdgeKeyHash
+  {
+    size_t
+    operator()(const EdgeKeyType & key) const
+    {
+      return std::hash<PointIdentifier>{}(key.first) * static_cast<size_t>(0x9E3779B97F4A7C15ull) ^
+             std::hash<PointIdentifier>{}(key.second);
+    }
+  };
+  const auto edgeKey = [&triangles, &destination](SizeValueType h) -> EdgeKeyType {
+    const PointIdentifier org = triangles[h];
+    const PointIdentifier dest = destination(h);
+    return (org < dest) ? EdgeKeyType(org, dest) : EdgeKeyType(dest, org);
+  };
+
+  // Check the faces and distribute the half edges into buckets of edges.
+  const auto          multiThreader = MultiThreaderBase::New();
+  const SizeValueType numberOfBuckets = std::max(multiThreader->GetNumberOfWorkUnits(), 1u);
+
+  const PointsContainer *    points = this->GetPoints();
+  std::vector<SizeValueType> buckets(numberOfHalfEdges);
+  std::vector<char>          invalidHalfEdges(numberOfHalfEdges, 0);
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfHalfEdges,
+    [&](SizeValueType h) {
+      invalidHalfEdges[h] = (triangles[h] == destination(h) || !points->IndexExists(triangles[h]));
+      buckets[h] = EdgeKeyHash{}(edgeKey(h)) % numberOfBuckets;
+    },
+    nullptr);
+  if (std::find(invalidHalfEdges.cbegin(), invalidHalfEdges.cend(), 1) != invalidHalfEdges.cend())
+  {
+    addFacesOneByOne();
+    return;
+  }
+
+  std::vector<SizeValueType> bucketOffsets(numberOfBuckets + 1, 0);
+  for (SizeValueType h = 0; h < numberOfHalfEdges; ++h)
+  {
+    ++bucketOffsets[buckets[h] + 1];
+  }
+  std::partial_sum(bucketOffsets.cbegin(), bucketOffsets.cend(), bucketOffsets.begin());
+  std::vector<SizeValueType> bucketHalfEdges(numberOfHalfEdges);
+  {
+    std::vector<SizeValueType> nextInBucket(bucketOffsets.cbegin(), bucketOffsets.cend() - 1);
+    for (SizeValueType h = 0; h < numberOfHalfEdges; ++h)
+    {
+      bucketHalfEdges[nextInBucket[buckets[h]]++] = h;
+    }
+  }
+
+  // Match the half edges of each bucket with the first half edge of their
+  // edge. A manifold edge is shared by at most two faces, with opposite
+  // orientations.
+  std::vector<SizeValueType> firstHalfEdges(numberOfHalfEdges);
+  std::vector<char>          nonManifoldBuckets(numberOfBuckets, 0);
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfBuckets,
+    [&](SizeValueType bucket) {
+      std::unordered_map<EdgeKeyType, SizeValueType, EdgeKeyHash> bucketEdges;
+      bucketEdges.reserve(bucketOffsets[bucket + 1] - bucketOffsets[bucket]);
+      for (SizeValueType i = bucketOffsets[bucket]; i < bucketOffsets[bucket + 1]; ++i)
+      {
+        const SizeValueType h = bucketHalfEdges[i];
+        const auto          inserted = bucketEdges.emplace(edgeKey(h), h);
+        const SizeValueType first = inserted.first->second;
+        firstHalfEdges[h] = first;
+        if (!inserted.second)
+        {
+          if (first == numberOfHalfEdges || triangles[first] == triangles[h])
+          {
+            nonManifoldBuckets[bucket] = 1;
+          }
+          // Mark the edge as shared by two faces.
+          inserted.first->second = numberOfHalfEdges;
+        }
+      }
+    },
+    nullptr);
+  if (std::find(nonManifoldBuckets.cbegin(), nonManifoldBuckets.cend(), 1) != nonManifoldBuckets.cend())
+  {
+    addFacesOneByOne();
+    return;
+  }
+
+  // Link the faces in order. The first half edge of each edge comes first,
+  // and creates the edge.
+  std::vector<QEPrimal *> edges(numberOfHalfEdges, nullptr);
+  QEPrimal *              faceEdges[3];
+  for (SizeValueType face = 0; face < numberOfHalfEdges; face += 3)
+  {
+    for (SizeValueType k = 0; k < 3; ++k)
+    {
+      const SizeValueType h = face + k;
+      const SizeValueType first = firstHalfEdges[h];
+      if (first == h)
+      {
+        edges[h] = this->AddEdgeWithSecurePointList(triangles[h], destination(h));
+        faceEdges[k] = edges[h];
+      }
+      else
+      {
+        faceEdges[k] = edges[first]->GetSym();
+      }
+    }
+
+    QEPrimal * e0 = faceEdges[2];
+    for (QEPrimal * faceEdge : faceEdges)
+    {
+      QEPrimal * e1 = e0->GetSym();
+      e0 = faceEdge;
+      e0->ReorderOnextRingBeforeAddFace(e1);
+    }
+    this->AddFace(faceEdges[0]);
+  }
+}
+
 /**
  */
 template <typename TPixel, unsigned int VDimension, typename TTraits>
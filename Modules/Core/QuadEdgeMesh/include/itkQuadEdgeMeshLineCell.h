@@ -239,6 +239,14 @@ private:
   CellIdentifier          m_Identifier{};
   QEType *                m_QuadEdgeGeom{};
   mutable PointIdentifier m_PointIds[2]{};
+
+  /**
+   * The quad-edges of the edge are stored in the cell itself, so that an
+   * edge takes a single allocation: the primal edge and its symmetric, and
+   * the dual edges rotating from one to the other.
+   */
+  QEType m_PrimalQuadEdges[2]{};
+  QEDual m_DualQuadEdges[2]{};
 };
 } // end namespace itk
 
@@ -26,11 +26,11 @@ namespace itk
 template <typename TCellInterface>
 QuadEdgeMeshLineCell<TCellInterface>::QuadEdgeMeshLineCell()
   : m_Identifier(0)
-  , m_QuadEdgeGeom(new QEType)
+  , m_QuadEdgeGeom(&m_PrimalQuadEdges[0])
 {
-  auto * e2 = new QEType;
-  auto * e1 = new QEDual;
-  auto * e3 = new QEDual;
+  QEType * e2 = &m_PrimalQuadEdges[1];
+  QEDual * e1 = &m_DualQuadEdges[0];
+  QEDual * e3 = &m_DualQuadEdges[1];
   this->m_QuadEdgeGeom->SetRot(e1);
   e1->SetRot(e2);
   e2->SetRot(e3);
@@ -43,62 +43,7 @@ QuadEdgeMeshLineCell<TCellInterface>::QuadEdgeMeshLineCell()
 
 // ---------------------------------------------------------------------
 template <typename TCellInterface>
-QuadEdgeMeshLineCell<TCellInterface>::~QuadEdgeMeshLineCell()
-{
-  // ALEX: for performance issues,
-  // we will assume the user calls Disconnect beforehand
-  // or else it is the mesh destructor, and we can proceed.
-  // if( !m_QuadEdgeGeom->IsDisconnected( ) )
-  //  {
-  //  m_QuadEdgeGeom->Disconnect( );
-  //  }
-
-  bool FoundNullPointer = false;
-
-  if (m_QuadEdgeGeom)
-  {
-    if (m_QuadEdgeGeom->GetRot())
-    {
-      if (m_QuadEdgeGeom->GetRot()->GetRot())
-      {
-        if (m_QuadEdgeGeom->GetRot()->GetRot()->GetRot())
-        {
-          delete m_QuadEdgeGeom->GetRot()->GetRot()->GetRot(); // e3
-          delete m_QuadEdgeGeom->GetRot()->GetRot();           // e2
-          delete m_QuadEdgeGeom->GetRot();                     // e1
-          delete m_QuadEdgeGeom;
-        }
-        else
-        {
-          FoundNullPointer = true;
-          delete m_QuadEdgeGeom->GetRot()->GetRot(); // e2
-          delete m_QuadEdgeGeom->GetRot();           // e1
-          delete m_QuadEdgeGeom;
-        }
-      }
-      else
-      {
-        FoundNullPointer = true;
-        delete m_QuadEdgeGeom->GetRot(); // e1
-        delete m_QuadEdgeGeom;
-      }
-    }
-    else
-    {
-      FoundNullPointer = true;
-      delete m_QuadEdgeGeom;
-    }
-  }
-  else
-  {
-    FoundNullPointer = true;
-  }
-
-  if (FoundNullPointer)
-  {
-    // Throw exception here
-  }
-}
+QuadEdgeMeshLineCell<TCellInterface>::~QuadEdgeMeshLineCell() = default;
 
 // ---------------------------------------------------------------------
 template <typename TCellInterface>
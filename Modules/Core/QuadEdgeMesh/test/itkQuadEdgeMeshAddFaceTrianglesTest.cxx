@@ -0,0 +1,216 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkQuadEdgeMesh.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+using MeshType = itk::QuadEdgeMesh<double, 3>;
+using PointIdList = MeshType::PointIdList;
+
+MeshType::Pointer
+CreateMesh(unsigned int numberOfPoints)
+{
+  auto mesh = MeshType::New();
+  for (unsigned int i = 0; i < numberOfPoints; ++i)
+  {
+    MeshType::PointType point;
+    point[0] = i;
+    point[1] = i * i;
+    point[2] = 0.0;
+    mesh->SetPoint(i, point);
+  }
+  return mesh;
+}
+
+MeshType::Pointer
+AddFacesOneByOne(unsigned int numberOfPoints, const PointIdList & triangles)
+{
+  auto mesh = CreateMesh(numberOfPoints);
+  for (size_t i = 0; i < triangles.size(); i += 3)
+  {
+    mesh->AddFaceTriangle(triangles[i], triangles[i + 1], triangles[i + 2]);
+  }
+  return mesh;
+}
+
+MeshType::Pointer
+AddFaces(unsigned int numberOfPoints, const PointIdList & triangles)
+{
+  auto mesh = CreateMesh(numberOfPoints);
+  mesh->AddFaceTriangles(triangles);
+  return mesh;
+}
+
+// Compare the faces and the Onext() rings of the points of two meshes.
+bool
+CompareMeshes(const MeshType * expected, const MeshType * mesh)
+{
+  if (expected->GetNumberOfEdges() != mesh->GetNumberOfEdges() ||
+      expected->GetNumberOfFaces() != mesh->GetNumberOfFaces())
+  {
+    std::cerr << "Expected " << expected->GetNumberOfEdges() << " edges and " << expected->GetNumberOfFaces()
+              << " faces, but got " << mesh->GetNumberOfEdges() << " edges and " << mesh->GetNumberOfFaces()
+              << " faces" << std::endl;
+    return false;
+  }
+
+  for (auto it = expected->GetCells()->Begin(); it != expected->GetCells()->End(); ++it)
+  {
+    MeshType::CellType * cell = nullptr;
+    if (!mesh->GetCells()->GetElementIfIndexExists(it.Index(), &cell))
+    {
+      std::cerr << "Face " << it.Index() << " is missing" << std::endl;
+      return false;
+    }
+    // The point identifiers of a polygon cell are gathered by PointIdsBegin().
+    const MeshType::CellType * const expectedCell = it.Value();
+    const MeshType::CellType * const constCell = cell;
+    const auto                       expectedPointIds = expectedCell->PointIdsBegin();
+    const auto                       pointIds = constCell->PointIdsBegin();
+    if (!std::equal(expectedPointIds, expectedCell->PointIdsEnd(), pointIds, constCell->PointIdsEnd()))
+    {
+      std::cerr << "Face " << it.Index() << " differs" << std::endl;
+      return false;
+    }
+  }
+
+  for (auto it = expected->GetPoints()->Begin(); it != expected->GetPoints()->End(); ++it)
+  {
+    const MeshType::QEPrimal * expectedEdge = it.Value().GetEdge();
+    const MeshType::QEPrimal * edge = mesh->GetPoints()->ElementAt(it.Index()).GetEdge();
+    if ((expectedEdge == nullptr) != (edge == nullptr))
+    {
+      std::cerr << "Point " << it.Index() << " differs" << std::endl;
+      return false;
+    }
+    if (expectedEdge == nullptr)
+    {
+      continue;
+    }
+
+    const MeshType::QEPrimal * expectedRingEdge = expectedEdge;
+    const MeshType::QEPrimal * ringEdge = edge;
+    do
+    {
+      if (expectedRingEdge->GetDestination() != ringEdge->GetDestination() ||
+          expectedRingEdge->IsLeftSet() != ringEdge->IsLeftSet())
+      {
+        std::cerr << "The Onext ring of point " << it.Index() << " differs" << std::endl;
+        return false;
+      }
+      expectedRingEdge = expectedRingEdge->GetOnext();
+      ringEdge = ringEdge->GetOnext();
+    } while (expectedRingEdge != expectedEdge && ringEdge != edge);
+
+    if (expectedRingEdge != expectedEdge || ringEdge != edge)
+    {
+      std::cerr << "The Onext ring of point " << it.Index() << " has a different length" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int
+itkQuadEdgeMeshAddFaceTrianglesTest(int, char *[])
+{
+  int testStatus = EXIT_SUCCESS;
+
+  // A triangulated grid, with alternating diagonals.
+  constexpr unsigned int gridSize = 12;
+  PointIdList            grid;
+  for (unsigned int j = 0; j + 1 < gridSize; ++j)
+  {
+    for (unsigned int i = 0; i + 1 < gridSize; ++i)
+    {
+      const MeshType::PointIdentifier p00 = j * gridSize + i;
+      const MeshType::PointIdentifier p10 = p00 + 1;
+      const MeshType::PointIdentifier p01 = p00 + gridSize;
+      const MeshType::PointIdentifier p11 = p01 + 1;
+      if ((i + j) % 2 == 0)
+      {
+        grid.insert(grid.end(), { p00, p10, p11, p00, p11, p01 });
+      }
+      else
+      {
+        grid.insert(grid.end(), { p00, p10, p01, p10, p11, p01 });
+      }
+    }
+  }
+  constexpr unsigned int numberOfGridPoints = gridSize * gridSize;
+
+  const auto expectedGrid = AddFacesOneByOne(numberOfGridPoints, grid);
+  const auto meshGrid = AddFaces(numberOfGridPoints, grid);
+  ITK_TEST_EXPECT_EQUAL(2 * (gridSize - 1) * (gridSize - 1), meshGrid->GetNumberOfFaces());
+  if (!CompareMeshes(expectedGrid, meshGrid))
+  {
+    std::cerr << "Test failed: the triangulated grid differs." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // A closed tetrahedron.
+  const PointIdList tetrahedron{ 0, 1, 2, 0, 3, 1, 1, 3, 2, 2, 3, 0 };
+  if (!CompareMeshes(AddFacesOneByOne(4, tetrahedron), AddFaces(4, tetrahedron)))
+  {
+    std::cerr << "Test failed: the tetrahedron differs." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // Two faces sharing a single point.
+  const PointIdList bowtie{ 0, 1, 2, 0, 3, 4 };
+  if (!CompareMeshes(AddFacesOneByOne(5, bowtie), AddFaces(5, bowtie)))
+  {
+    std::cerr << "Test failed: the faces sharing a point differ." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // Faces that are not added, because an edge is shared by three faces, or
+  // has the same orientation in two faces, or because a face is degenerate.
+  for (const auto & triangles : { PointIdList{ 0, 1, 2, 1, 0, 3, 0, 1, 4 },
+                                  PointIdList{ 0, 1, 2, 0, 1, 3 },
+                                  PointIdList{ 0, 1, 2, 2, 3, 3 } })
+  {
+    const auto expected = AddFacesOneByOne(5, triangles);
+    const auto mesh = AddFaces(5, triangles);
+    if (!CompareMeshes(expected, mesh))
+    {
+      std::cerr << "Test failed: the faces of a non-manifold mesh differ." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+  }
+
+  // Faces added to a mesh that already has edges.
+  const PointIdList firstTriangles(grid.cbegin(), grid.cbegin() + 30);
+  const PointIdList lastTriangles(grid.cbegin() + 30, grid.cend());
+  const auto        meshInTwoSteps = AddFaces(numberOfGridPoints, firstTriangles);
+  meshInTwoSteps->AddFaceTriangles(lastTriangles);
+  if (!CompareMeshes(expectedGrid, meshInTwoSteps))
+  {
+    std::cerr << "Test failed: the grid added in two steps differs." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  const PointIdList incomplete{ 0, 1, 2, 3 };
+  ITK_TRY_EXPECT_EXCEPTION(meshGrid->AddFaceTriangles(incomplete));
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
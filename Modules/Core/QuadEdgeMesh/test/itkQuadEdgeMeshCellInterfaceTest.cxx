@@ -410,30 +410,16 @@ itkQuadEdgeMeshCellInterfaceTest(int, char *[])
 
   mesh->Accept(multiVisitor);
 
-  // test 4 very specific QELineCell destructor cases
+  // The quad-edges of a QELineCell are owned by the cell
   {
     const QELineCellType test;
     QEType *             quadEdgeGeom = test.GetQEGeom();
-    delete quadEdgeGeom->GetRot()->GetRot()->GetRot();
-    quadEdgeGeom->GetRot()->GetRot()->SetRot(nullptr);
-  }
-  {
-    const QELineCellType test;
-    QEType *             quadEdgeGeom = test.GetQEGeom();
-    delete quadEdgeGeom->GetRot()->GetRot()->GetRot();
-    quadEdgeGeom->GetRot()->GetRot()->SetRot(nullptr);
-    delete quadEdgeGeom->GetRot()->GetRot();
-    quadEdgeGeom->GetRot()->SetRot(nullptr);
-  }
-  {
-    const QELineCellType test;
-    QEType *             quadEdgeGeom = test.GetQEGeom();
-    delete quadEdgeGeom->GetRot()->GetRot()->GetRot();
-    quadEdgeGeom->GetRot()->GetRot()->SetRot(nullptr);
-    delete quadEdgeGeom->GetRot()->GetRot();
-    quadEdgeGeom->GetRot()->SetRot(nullptr);
-    delete quadEdgeGeom->GetRot();
-    quadEdgeGeom->SetRot(nullptr);
+    if (quadEdgeGeom->GetRot()->GetRot()->GetRot()->GetRot() != quadEdgeGeom ||
+        quadEdgeGeom->GetSym()->GetSym() != quadEdgeGeom || quadEdgeGeom->GetSym() == quadEdgeGeom)
+    {
+      std::cerr << "The quad-edges of a QELineCell do not form a Rot ring." << std::endl;
+      status = EXIT_FAILURE;
+    }
   }
 
   return status;
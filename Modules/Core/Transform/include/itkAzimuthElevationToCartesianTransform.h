@@ -146,6 +146,13 @@ public:
   OutputPointType
   TransformPoint(const InputPointType & point) const override;
 
+  /** Transform a batch of points one by one, as the transform is not
+   * represented by its matrix and offset. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   /** Back transform from cartesian to azimuth-elevation.  */
   inline InputPointType
   BackTransform(const OutputPointType & point) const
@@ -66,6 +66,19 @@ AzimuthElevationToCartesianTransform<TParametersValueType, VDimension>::Transfor
   return result;
 }
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+AzimuthElevationToCartesianTransform<TParametersValueType, VDimension>::TransformPoints(
+  const InputPointType * inputPoints,
+  OutputPointType *      outputPoints,
+  SizeValueType          numberOfPoints) const
+{
+  for (SizeValueType i = 0; i < numberOfPoints; ++i)
+  {
+    outputPoints[i] = this->TransformPoint(inputPoints[i]);
+  }
+}
+
 template <typename TParametersValueType, unsigned int VDimension>
 auto
 AzimuthElevationToCartesianTransform<TParametersValueType, VDimension>::TransformAzElToCartesian(
@@ -239,6 +239,15 @@ public:
                  ParameterIndexArrayType & indices,
                  bool &                    inside) const override;
   /** @ITKEndGrouping */
+
+  /** Transform a batch of points. The offsets of the support region in the
+   * coefficient images are computed once for all points, and the
+   * coefficients are read directly from their buffers. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   /** Compute the Jacobian in one position. */
   void
   ComputeJacobianWithRespectToParameters(const InputPointType &, JacobianType &) const override;
@@ -591,6 +591,79 @@ BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::TransformPoint
   }
 }
 
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+void
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::TransformPoints(const InputPointType * inputPoints,
+                                                                                  OutputPointType *      outputPoints,
+                                                                                  SizeValueType numberOfPoints) const
+{
+  const ImageType * const coefficientImage = this->m_CoefficientImages[0];
+  if (!coefficientImage->GetBufferPointer())
+  {
+    Superclass::TransformPoints(inputPoints, outputPoints, numberOfPoints);
+    return;
+  }
+
+  // Offsets of the support region relative to its first coefficient, in the
+  // order of the weights: the first dimension varies fastest.
+  const OffsetValueType * offsetTable = coefficientImage->GetOffsetTable();
+  OffsetValueType         supportOffsets[Self::NumberOfWeights];
+  for (unsigned int k = 0; k < Self::NumberOfWeights; ++k)
+  {
+    unsigned int remainder = k;
+    supportOffsets[k] = 0;
+    for (unsigned int j = 0; j < SpaceDimension; ++j)
+    {
+      supportOffsets[k] += static_cast<OffsetValueType>(remainder % (SplineOrder + 1)) * offsetTable[j];
+      remainder /= SplineOrder + 1;
+    }
+  }
+
+  const ParametersValueType * coefficients[SpaceDimension];
+  for (unsigned int j = 0; j < SpaceDimension; ++j)
+  {
+    coefficients[j] = this->m_CoefficientImages[j]->GetBufferPointer();
+  }
+
+  WeightsType weights;
+  for (SizeValueType n = 0; n < numberOfPoints; ++n)
+  {
+    // Copied, as the output may overwrite the input
+    const InputPointType point = inputPoints[n];
+
+    ContinuousIndexType index =
+      coefficientImage->template TransformPhysicalPointToContinuousIndex<typename ContinuousIndexType::ValueType>(
+        point);
+
+    // NOTE: if the support region does not lie totally within the grid
+    // we assume zero displacement and return the input point
+    if (!this->InsideValidRegion(index))
+    {
+      outputPoints[n] = point;
+      continue;
+    }
+
+    IndexType supportIndex;
+    this->m_WeightsFunction->Evaluate(index, weights, supportIndex);
+    const OffsetValueType supportOffset = coefficientImage->ComputeOffset(supportIndex);
+
+    OutputPointType outputPoint;
+    outputPoint.Fill(ScalarType{});
+    for (unsigned int k = 0; k < Self::NumberOfWeights; ++k)
+    {
+      for (unsigned int j = 0; j < SpaceDimension; ++j)
+      {
+        outputPoint[j] += static_cast<ScalarType>(weights[k] * coefficients[j][supportOffset + supportOffsets[k]]);
+      }
+    }
+    for (unsigned int j = 0; j < SpaceDimension; ++j)
+    {
+      outputPoint[j] += point[j];
+    }
+    outputPoints[n] = outputPoint;
+  }
+}
+
 template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
 void
 BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::ComputeJacobianWithRespectToParameters(
@@ -271,6 +271,15 @@ public:
   OutputPointType
   TransformPoint(const InputPointType & inputPoint) const override;
 
+  /** Transform a batch of points. The points are processed in small blocks,
+   * and each sub-transform maps a whole block in place before the next one
+   * is applied, so that batched implementations of the sub-transforms are
+   * used. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   /**  Method to transform a vector. */
   using Superclass::TransformVector;
   OutputVectorType
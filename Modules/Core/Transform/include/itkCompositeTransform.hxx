@@ -20,6 +20,8 @@
 
 
 #include "itkPrintHelper.h"
+#include <algorithm>
+
 namespace itk
 {
 
@@ -71,6 +73,32 @@ CompositeTransform<TParametersValueType, VDimension>::TransformPoint(const Input
 }
 
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+CompositeTransform<TParametersValueType, VDimension>::TransformPoints(const InputPointType * inputPoints,
+                                                                      OutputPointType *      outputPoints,
+                                                                      SizeValueType          numberOfPoints) const
+{
+  if (inputPoints != outputPoints)
+  {
+    std::copy(inputPoints, inputPoints + numberOfPoints, outputPoints);
+  }
+
+  /* Apply in reverse queue order, one block of points at a time so that the
+   * block stays in cache while it passes through every sub-transform. */
+  constexpr SizeValueType blockSize = 256;
+  for (SizeValueType first = 0; first < numberOfPoints; first += blockSize)
+  {
+    OutputPointType * const block = outputPoints + first;
+    const SizeValueType     count = std::min(blockSize, numberOfPoints - first);
+    for (auto it = this->m_TransformQueue.rbegin(); it != this->m_TransformQueue.rend(); ++it)
+    {
+      (*it)->TransformPoints(block, block, count);
+    }
+  }
+}
+
+
 template <typename TParametersValueType, unsigned int VDimension>
 auto
 CompositeTransform<TParametersValueType, VDimension>::TransformVector(const InputVectorType & inputVector) const
@@ -140,8 +140,9 @@ public:
    * where \f$ d_i = q_i - p_i \f$. */
   itkGetModifiableObjectMacro(Displacements, VectorSetType);
 
-  /** Compute W matrix. */
-  void
+  /** Compute W matrix. Subclasses whose kernel allows a cheaper solve than
+   * the dense SVD may override it. */
+  virtual void
   ComputeWMatrix();
 
   /** Compute the position of point in the new space */
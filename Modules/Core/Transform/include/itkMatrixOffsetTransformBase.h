@@ -390,6 +390,13 @@ public:
   OutputPointType
   TransformPoint(const InputPointType & point) const override;
 
+  /** Transform a batch of points by the matrix and offset, without a
+   * virtual call per point. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   using Superclass::TransformVector;
 
   OutputVectorType
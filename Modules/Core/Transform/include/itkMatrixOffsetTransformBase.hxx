@@ -128,6 +128,22 @@ MatrixOffsetTransformBase<TParametersValueType, VInputDimension, VOutputDimensio
 }
 
 
+template <typename TParametersValueType, unsigned int VInputDimension, unsigned int VOutputDimension>
+void
+MatrixOffsetTransformBase<TParametersValueType, VInputDimension, VOutputDimension>::TransformPoints(
+  const InputPointType * inputPoints,
+  OutputPointType *      outputPoints,
+  SizeValueType          numberOfPoints) const
+{
+  for (SizeValueType i = 0; i < numberOfPoints; ++i)
+  {
+    // Copied, as the output may overwrite the input
+    const InputPointType point = inputPoints[i];
+    outputPoints[i] = m_Matrix * point + m_Offset;
+  }
+}
+
+
 template <typename TParametersValueType, unsigned int VInputDimension, unsigned int VOutputDimension>
 auto
 MatrixOffsetTransformBase<TParametersValueType, VInputDimension, VOutputDimension>::TransformVector(
@@ -254,6 +254,13 @@ public:
   TransformCategoryEnum
   GetTransformCategory() const override;
 
+  /** The modification time is the latest of this object's own time and those
+   * of its sub-transforms, since the mapping changes whenever any of them is
+   * modified. This lets caches of the mapping rely on the multi-transform
+   * alone. */
+  ModifiedTimeType
+  GetMTime() const override;
+
   /** Get/Set Parameter functions work on all sub-transforms.
       The parameter data from each sub-transform is
       concatenated into a single ParametersType object.
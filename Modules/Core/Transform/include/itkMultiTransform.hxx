@@ -18,6 +18,7 @@
 #ifndef itkMultiTransform_hxx
 #define itkMultiTransform_hxx
 
+#include <algorithm>
 
 namespace itk
 {
@@ -51,6 +52,22 @@ MultiTransform<TParametersValueType, VDimension, VSubDimensions>::GetTransformCa
 }
 
 
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSubDimensions>
+ModifiedTimeType
+MultiTransform<TParametersValueType, VDimension, VSubDimensions>::GetMTime() const
+{
+  ModifiedTimeType mtime = Superclass::GetMTime();
+  for (const auto & transform : this->m_TransformQueue)
+  {
+    if (transform)
+    {
+      mtime = std::max(mtime, transform->GetMTime());
+    }
+  }
+  return mtime;
+}
+
+
 template <typename TParametersValueType, unsigned int VDimension, unsigned int VSubDimensions>
 bool
 MultiTransform<TParametersValueType, VDimension, VSubDimensions>::IsLinear() const
@@ -116,6 +116,23 @@ ScaleTransform<TParametersValueType, VDimension>::TransformPoint(const InputPoin
   return result;
 }
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+ScaleTransform<TParametersValueType, VDimension>::TransformPoints(const InputPointType * inputPoints,
+                                                                  OutputPointType *      outputPoints,
+                                                                  SizeValueType          numberOfPoints) const
+{
+  const InputPointType & center = this->GetCenter();
+
+  for (SizeValueType n = 0; n < numberOfPoints; ++n)
+  {
+    for (unsigned int i = 0; i < SpaceDimension; ++i)
+    {
+      outputPoints[n][i] = (inputPoints[n][i] - center[i]) * m_Scale[i] + center[i];
+    }
+  }
+}
+
 
 template <typename TParametersValueType, unsigned int VDimension>
 auto
@@ -180,6 +180,17 @@ public:
   virtual OutputPointType
   TransformPoint(const InputPointType &) const = 0;
 
+  /** Method to transform a batch of points, e.g. a scanline of an image.
+   * The input and output arrays both hold numberOfPoints points, and may be
+   * the same array when the input and output point types are the same. The
+   * default transforms the points one by one with TransformPoint(); derived
+   * classes override it to share work between the points.
+   * \warning This method must be thread-safe. */
+  virtual void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const;
+
   /**  Method to transform a vector. */
   virtual OutputVectorType
   TransformVector(const InputVectorType &) const
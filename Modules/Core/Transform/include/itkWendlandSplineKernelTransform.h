@@ -0,0 +1,224 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkWendlandSplineKernelTransform_h
+#define itkWendlandSplineKernelTransform_h
+
+#include "itkKernelTransform.h"
+#include "itkIndex.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class WendlandSplineKernelTransform
+ * \brief Kernel transform with a compactly supported kernel, for large landmark sets.
+ *
+ * The thin plate and elastic body splines have global kernels: every
+ * landmark influences every point. KernelTransform::ComputeWMatrix() then
+ * solves a dense system of order N*VDimension with an SVD, and every
+ * evaluation sums over all N landmarks, which is impractical beyond a few
+ * thousand landmarks.
+ *
+ * This transform uses the Wendland function
+ * \f[ \phi(r) = (1 - r)_+^4 (4 r + 1), \quad r = \|x\| / a \f]
+ * as kernel, G(x) = phi(r) I, where a is the support radius. It is positive
+ * definite in up to three dimensions, and zero beyond the support radius.
+ * As with the other kernel transforms, an affine component is fitted along
+ * with the kernel coefficients, and the stiffness relaxes interpolation into
+ * approximation. Elastic registration with such kernels is described in
+ * "Radial basis functions with compact support for elastic registration of
+ * medical images" (Fornefett, Rohr and Stiehl, Image and Vision Computing,
+ * 2001).
+ *
+ * Since the kernel is diagonal, the system decouples into one sparse,
+ * symmetric positive definite system per dimension, all with the same
+ * matrix. ComputeWMatrix() assembles that matrix with a cell grid over the
+ * landmarks, solves it with conjugate gradients (the right-hand sides are
+ * solved concurrently), and eliminates the affine component through its small
+ * Schur complement. Evaluating a point only visits the landmarks in the
+ * neighboring cells, and TransformPoints() evaluates a batch of points
+ * without per-point virtual calls, which suits resampling.
+ *
+ * The support radius sets the trade-off: the cost of both the solve and the
+ * evaluation grows with the number of landmarks within one radius of each
+ * other, while a radius that is small compared to the landmark spacing
+ * leaves the deformation between landmarks to the affine component.
+ *
+ * \ingroup ITKTransform
+ */
+template <typename TParametersValueType, unsigned int VDimension = 3>
+class ITK_TEMPLATE_EXPORT WendlandSplineKernelTransform : public KernelTransform<TParametersValueType, VDimension>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(WendlandSplineKernelTransform);
+
+  /** Standard class type aliases. */
+  using Self = WendlandSplineKernelTransform;
+  using Superclass = KernelTransform<TParametersValueType, VDimension>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** New macro for creation of through a Smart Pointer */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(WendlandSplineKernelTransform);
+
+  /** Scalar type. */
+  using typename Superclass::ScalarType;
+
+  /** Parameters type. */
+  using typename Superclass::ParametersType;
+  using typename Superclass::FixedParametersType;
+
+  /** Jacobian Type */
+  using typename Superclass::JacobianType;
+  using typename Superclass::JacobianPositionType;
+  using typename Superclass::InverseJacobianPositionType;
+
+  /** Dimension of the domain space. */
+  static constexpr unsigned int SpaceDimension = Superclass::SpaceDimension;
+
+  /** These (rather redundant) type alias are needed because type alias are not inherited */
+  using typename Superclass::InputPointType;
+  using typename Superclass::OutputPointType;
+  using typename Superclass::InputVectorType;
+  using typename Superclass::OutputVectorType;
+  using typename Superclass::InputCovariantVectorType;
+  using typename Superclass::OutputCovariantVectorType;
+  using typename Superclass::PointsIterator;
+
+  /** Set/Get the radius beyond which a landmark has no influence. It must be
+   * set before ComputeWMatrix(). */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(SupportRadius, double, NumericTraits<double>::min(), NumericTraits<double>::max());
+  itkGetConstMacro(SupportRadius, double);
+  /** @ITKEndGrouping */
+
+  /** Set/Get the relative residual at which the conjugate gradient iterations
+   * stop. */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(SolverTolerance, double, 0.0, 1.0);
+  itkGetConstMacro(SolverTolerance, double);
+  /** @ITKEndGrouping */
+
+  /** Set/Get the maximum number of conjugate gradient iterations per
+   * right-hand side. Zero, the default, allows as many iterations as there
+   * are landmarks. */
+  /** @ITKStartGrouping */
+  itkSetMacro(MaximumNumberOfIterations, SizeValueType);
+  itkGetConstMacro(MaximumNumberOfIterations, SizeValueType);
+  /** @ITKEndGrouping */
+
+  /** Get the largest number of conjugate gradient iterations that one of the
+   * right-hand sides needed in the last ComputeWMatrix(). */
+  itkGetConstMacro(NumberOfIterations, SizeValueType);
+
+  /** Compute the kernel and affine coefficients with a sparse iterative
+   * solver, instead of the dense SVD of the superclass. */
+  void
+  ComputeWMatrix() override;
+
+  /** Transform a batch of points, visiting only the landmarks near each one. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
+protected:
+  WendlandSplineKernelTransform() = default;
+  ~WendlandSplineKernelTransform() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** These (rather redundant) type alias are needed because on type alias are not inherited. */
+  using typename Superclass::GMatrixType;
+
+  /** Compute G(x)
+   * For the Wendland spline, this is:
+   * \f$ G(x) = \phi(\|x\| / a) I \f$
+   * with \f$ \phi(r) = (1 - r)^4 (4 r + 1) \f$ for r < 1 and zero otherwise. */
+  void
+  ComputeG(const InputVectorType & x, GMatrixType & gmatrix) const override;
+
+  /** The kernel does not vanish at zero, so the block diagonal of K holds
+   * \f$ (\phi(0) + stiffness) I \f$. */
+  const GMatrixType & ComputeReflexiveG(PointsIterator) const override;
+
+  /** Compute the contribution of the landmarks near thisPoint. */
+  void
+  ComputeDeformationContribution(const InputPointType & thisPoint, OutputPointType & result) const override;
+
+private:
+  static_assert(VDimension <= 3, "The Wendland kernel used here is positive definite only up to three dimensions.");
+
+  using CellIndexType = Index<VDimension>;
+
+  /** Sparse symmetric matrix, in compressed rows. */
+  struct SparseMatrixType
+  {
+    std::vector<SizeValueType>        rowStart{};
+    std::vector<SizeValueType>        columns{};
+    std::vector<TParametersValueType> values{};
+  };
+
+  /** The Wendland function of a squared distance. */
+  TParametersValueType
+  EvaluateKernel(TParametersValueType squaredDistance) const;
+
+  /** Sort the source landmarks into the cell grid, and return for each
+   * sorted position the index of the landmark. */
+  std::vector<SizeValueType>
+  BuildCellGrid();
+
+  /** Call visitor(n, kernelValue) for the sorted position n of every landmark
+   * within the support radius of point. */
+  template <typename TVisitor>
+  void
+  VisitNeighbors(const InputPointType & point, TVisitor && visitor) const;
+
+  /** Solve matrix * solution = rhs, starting from zero. Returns whether the
+   * tolerance was reached, and the number of iterations in iterations. */
+  bool
+  SolveConjugateGradient(const SparseMatrixType &                  matrix,
+                         const std::vector<TParametersValueType> & rhs,
+                         std::vector<TParametersValueType> &       solution,
+                         SizeValueType &                           iterations) const;
+
+  double        m_SupportRadius{ 1.0 };
+  double        m_SolverTolerance{ 1e-10 };
+  SizeValueType m_MaximumNumberOfIterations{ 0 };
+  SizeValueType m_NumberOfIterations{ 0 };
+
+  /** Cell grid over the source landmarks. The landmarks are stored sorted by
+   * cell, along with their coefficients, so that neighbors are contiguous. */
+  InputPointType                m_GridOrigin{};
+  double                        m_CellSize{ 1.0 };
+  CellIndexType                 m_GridSize{};
+  std::vector<SizeValueType>    m_CellStart{};
+  std::vector<InputPointType>   m_SortedLandmarks{};
+  std::vector<OutputVectorType> m_SortedCoefficients{};
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkWendlandSplineKernelTransform.hxx"
+#endif
+
+#endif // itkWendlandSplineKernelTransform_h
@@ -0,0 +1,488 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkWendlandSplineKernelTransform_hxx
+#define itkWendlandSplineKernelTransform_hxx
+
+#include "itkMultiThreaderBase.h"
+#include "vnl/algo/vnl_svd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace itk
+{
+
+template <typename TParametersValueType, unsigned int VDimension>
+TParametersValueType
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::EvaluateKernel(
+  TParametersValueType squaredDistance) const
+{
+  const double r = std::sqrt(static_cast<double>(squaredDistance)) / m_SupportRadius;
+  if (r >= 1.0)
+  {
+    return TParametersValueType{};
+  }
+  const double t = 1.0 - r;
+  const double t2 = t * t;
+  return static_cast<TParametersValueType>(t2 * t2 * (4.0 * r + 1.0));
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::ComputeG(const InputVectorType & x,
+                                                                          GMatrixType &           gmatrix) const
+{
+  gmatrix.fill(TParametersValueType{});
+  gmatrix.fill_diagonal(this->EvaluateKernel(x.GetSquaredNorm()));
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+auto
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::ComputeReflexiveG(PointsIterator) const
+  -> const GMatrixType &
+{
+  this->m_GMatrix.fill(TParametersValueType{});
+  this->m_GMatrix.fill_diagonal(1.0 + this->m_Stiffness);
+
+  return this->m_GMatrix;
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+std::vector<SizeValueType>
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::BuildCellGrid()
+{
+  const typename Superclass::PointsContainer * landmarks = this->m_SourceLandmarks->GetPoints();
+  const SizeValueType                          numberOfLandmarks = landmarks->Size();
+
+  InputPointType lower;
+  InputPointType upper;
+  lower.Fill(NumericTraits<TParametersValueType>::max());
+  upper.Fill(NumericTraits<TParametersValueType>::NonpositiveMin());
+  for (auto it = landmarks->Begin(); it != landmarks->End(); ++it)
+  {
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      lower[d] = std::min(lower[d], it.Value()[d]);
+      upper[d] = std::max(upper[d], it.Value()[d]);
+    }
+  }
+
+  // Cells at least as large as the support radius, so that the neighbors of
+  // a point lie in the adjacent cells. Larger cells keep the grid from
+  // growing far beyond the number of landmarks when the radius is small.
+  const double maximumNumberOfCells = 8.0 * static_cast<double>(numberOfLandmarks) + 1.0;
+  m_CellSize = m_SupportRadius;
+  double numberOfCells = 0.0;
+  do
+  {
+    numberOfCells = 1.0;
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      numberOfCells *= std::floor((upper[d] - lower[d]) / m_CellSize) + 1.0;
+    }
+    if (numberOfCells > maximumNumberOfCells)
+    {
+      m_CellSize *= 2.0;
+    }
+  } while (numberOfCells > maximumNumberOfCells);
+
+  m_GridOrigin = lower;
+  for (unsigned int d = 0; d < VDimension; ++d)
+  {
+    m_GridSize[d] = static_cast<IndexValueType>(std::floor((upper[d] - lower[d]) / m_CellSize)) + 1;
+  }
+
+  const auto cellOf = [this](const InputPointType & point) {
+    SizeValueType cell = 0;
+    SizeValueType stride = 1;
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      const auto index = std::min(static_cast<IndexValueType>((point[d] - m_GridOrigin[d]) / m_CellSize),
+                                  m_GridSize[d] - 1);
+      cell += static_cast<SizeValueType>(index) * stride;
+      stride *= static_cast<SizeValueType>(m_GridSize[d]);
+    }
+    return cell;
+  };
+
+  // Counting sort of the landmarks by cell.
+  m_CellStart.assign(static_cast<SizeValueType>(numberOfCells) + 1, 0);
+  std::vector<SizeValueType> landmarkCells(numberOfLandmarks);
+  SizeValueType              landmark = 0;
+  for (auto it = landmarks->Begin(); it != landmarks->End(); ++it, ++landmark)
+  {
+    landmarkCells[landmark] = cellOf(it.Value());
+    ++m_CellStart[landmarkCells[landmark] + 1];
+  }
+  std::partial_sum(m_CellStart.begin(), m_CellStart.end(), m_CellStart.begin());
+
+  std::vector<SizeValueType> sortedToLandmark(numberOfLandmarks);
+  std::vector<SizeValueType> fill(m_CellStart.begin(), m_CellStart.end() - 1);
+  m_SortedLandmarks.resize(numberOfLandmarks);
+  landmark = 0;
+  for (auto it = landmarks->Begin(); it != landmarks->End(); ++it, ++landmark)
+  {
+    const SizeValueType sorted = fill[landmarkCells[landmark]]++;
+    m_SortedLandmarks[sorted] = it.Value();
+    sortedToLandmark[sorted] = landmark;
+  }
+  return sortedToLandmark;
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+template <typename TVisitor>
+void
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::VisitNeighbors(const InputPointType & point,
+                                                                                TVisitor &&            visitor) const
+{
+  if (m_SortedLandmarks.empty())
+  {
+    return;
+  }
+
+  CellIndexType lower;
+  CellIndexType upper;
+  for (unsigned int d = 0; d < VDimension; ++d)
+  {
+    // Clamped before the conversion, so that far away points cannot overflow.
+    const double position =
+      std::clamp((point[d] - m_GridOrigin[d]) / m_CellSize, -2.0, static_cast<double>(m_GridSize[d]) + 1.0);
+    const auto cell = static_cast<IndexValueType>(std::floor(position));
+    lower[d] = std::max<IndexValueType>(cell - 1, 0);
+    upper[d] = std::min<IndexValueType>(cell + 1, m_GridSize[d] - 1);
+    if (lower[d] > upper[d])
+    {
+      return;
+    }
+  }
+
+  const double  squaredRadius = m_SupportRadius * m_SupportRadius;
+  CellIndexType cell = lower;
+  while (true)
+  {
+    SizeValueType linearCell = 0;
+    SizeValueType stride = 1;
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      linearCell += static_cast<SizeValueType>(cell[d]) * stride;
+      stride *= static_cast<SizeValueType>(m_GridSize[d]);
+    }
+
+    for (SizeValueType n = m_CellStart[linearCell]; n < m_CellStart[linearCell + 1]; ++n)
+    {
+      const TParametersValueType squaredDistance = point.SquaredEuclideanDistanceTo(m_SortedLandmarks[n]);
+      if (squaredDistance < squaredRadius)
+      {
+        visitor(n, this->EvaluateKernel(squaredDistance));
+      }
+    }
+
+    unsigned int d = 0;
+    for (; d < VDimension; ++d)
+    {
+      if (++cell[d] <= upper[d])
+      {
+        break;
+      }
+      cell[d] = lower[d];
+    }
+    if (d == VDimension)
+    {
+      break;
+    }
+  }
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+bool
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::SolveConjugateGradient(
+  const SparseMatrixType &                  matrix,
+  const std::vector<TParametersValueType> & rhs,
+  std::vector<TParametersValueType> &       solution,
+  SizeValueType &                           iterations) const
+{
+  const SizeValueType n = rhs.size();
+  const auto          dot = [n](const std::vector<TParametersValueType> & a, const std::vector<TParametersValueType> & b) {
+    double sum = 0.0;
+    for (SizeValueType i = 0; i < n; ++i)
+    {
+      sum += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+    }
+    return sum;
+  };
+
+  solution.assign(n, TParametersValueType{});
+  iterations = 0;
+
+  std::vector<TParametersValueType> residual(rhs);
+  std::vector<TParametersValueType> direction(rhs);
+  std::vector<TParametersValueType> product(n);
+
+  double       squaredResidual = dot(residual, residual);
+  const double threshold = m_SolverTolerance * m_SolverTolerance * squaredResidual;
+  if (squaredResidual == 0.0)
+  {
+    return true;
+  }
+
+  const SizeValueType maximumNumberOfIterations = (m_MaximumNumberOfIterations > 0) ? m_MaximumNumberOfIterations : n;
+  while (squaredResidual > threshold && iterations < maximumNumberOfIterations)
+  {
+    for (SizeValueType i = 0; i < n; ++i)
+    {
+      double sum = 0.0;
+      for (SizeValueType k = matrix.rowStart[i]; k < matrix.rowStart[i + 1]; ++k)
+      {
+        sum += static_cast<double>(matrix.values[k]) * static_cast<double>(direction[matrix.columns[k]]);
+      }
+      product[i] = static_cast<TParametersValueType>(sum);
+    }
+
+    const double alpha = squaredResidual / dot(direction, product);
+    for (SizeValueType i = 0; i < n; ++i)
+    {
+      solution[i] += static_cast<TParametersValueType>(alpha * direction[i]);
+      residual[i] -= static_cast<TParametersValueType>(alpha * product[i]);
+    }
+
+    const double newSquaredResidual = dot(residual, residual);
+    const double beta = newSquaredResidual / squaredResidual;
+    for (SizeValueType i = 0; i < n; ++i)
+    {
+      direction[i] = residual[i] + static_cast<TParametersValueType>(beta * direction[i]);
+    }
+    squaredResidual = newSquaredResidual;
+    ++iterations;
+  }
+  return squaredResidual <= threshold;
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::ComputeWMatrix()
+{
+  const SizeValueType numberOfLandmarks = this->m_SourceLandmarks->GetNumberOfPoints();
+  if (numberOfLandmarks < VDimension + 1)
+  {
+    itkExceptionMacro("At least " << VDimension + 1 << " source landmarks are needed, but " << numberOfLandmarks
+                                  << " are set.");
+  }
+  if (this->m_TargetLandmarks->GetNumberOfPoints() != numberOfLandmarks)
+  {
+    itkExceptionMacro("The number of target landmarks (" << this->m_TargetLandmarks->GetNumberOfPoints()
+                                                         << ") differs from the number of source landmarks ("
+                                                         << numberOfLandmarks << ").");
+  }
+
+  this->ComputeD();
+  const std::vector<SizeValueType> sortedToLandmark = this->BuildCellGrid();
+
+  const auto multiThreader = MultiThreaderBase::New();
+
+  // Assemble the sparse kernel matrix over the sorted landmarks: count the
+  // neighbors of every landmark, then fill the rows.
+  SparseMatrixType kernelMatrix;
+  kernelMatrix.rowStart.assign(numberOfLandmarks + 1, 0);
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfLandmarks,
+    [this, &kernelMatrix](SizeValueType i) {
+      SizeValueType count = 0;
+      this->VisitNeighbors(m_SortedLandmarks[i], [&count](SizeValueType, TParametersValueType) { ++count; });
+      kernelMatrix.rowStart[i + 1] = count;
+    },
+    nullptr);
+  std::partial_sum(kernelMatrix.rowStart.begin(), kernelMatrix.rowStart.end(), kernelMatrix.rowStart.begin());
+
+  kernelMatrix.columns.resize(kernelMatrix.rowStart.back());
+  kernelMatrix.values.resize(kernelMatrix.rowStart.back());
+  const TParametersValueType stiffness = static_cast<TParametersValueType>(this->m_Stiffness);
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfLandmarks,
+    [this, &kernelMatrix, stiffness](SizeValueType i) {
+      SizeValueType position = kernelMatrix.rowStart[i];
+      this->VisitNeighbors(m_SortedLandmarks[i],
+                           [&kernelMatrix, &position, i, stiffness](SizeValueType n, TParametersValueType value) {
+                             kernelMatrix.columns[position] = n;
+                             kernelMatrix.values[position] = (n == i) ? value + stiffness : value;
+                             ++position;
+                           });
+    },
+    nullptr);
+
+  // The right-hand sides are the displacements, one per dimension, and the
+  // columns of the affine basis P = [p - centroid, 1].
+  InputPointType centroid;
+  centroid.Fill(0.0);
+  for (const auto & landmark : m_SortedLandmarks)
+  {
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      centroid[d] += landmark[d] / static_cast<TParametersValueType>(numberOfLandmarks);
+    }
+  }
+
+  constexpr unsigned int                         NumberOfAffineTerms = VDimension + 1;
+  std::vector<std::vector<TParametersValueType>> rhs(VDimension + NumberOfAffineTerms,
+                                                     std::vector<TParametersValueType>(numberOfLandmarks));
+  for (SizeValueType i = 0; i < numberOfLandmarks; ++i)
+  {
+    const InputVectorType & displacement = this->m_Displacements->ElementAt(sortedToLandmark[i]);
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      rhs[d][i] = displacement[d];
+      rhs[VDimension + d][i] = m_SortedLandmarks[i][d] - centroid[d];
+    }
+    rhs[VDimension + VDimension][i] = 1.0;
+  }
+
+  // Z = K^-1 Y and Q = K^-1 P, all with the same matrix.
+  std::vector<std::vector<TParametersValueType>> solutions(rhs.size());
+  std::vector<SizeValueType>                     iterations(rhs.size());
+  std::vector<char>                              converged(rhs.size());
+  multiThreader->ParallelizeArray(
+    0,
+    rhs.size(),
+    [this, &kernelMatrix, &rhs, &solutions, &iterations, &converged](SizeValueType column) {
+      converged[column] =
+        this->SolveConjugateGradient(kernelMatrix, rhs[column], solutions[column], iterations[column]);
+    },
+    nullptr);
+  m_NumberOfIterations = *std::max_element(iterations.begin(), iterations.end());
+  if (std::find(converged.begin(), converged.end(), 0) != converged.end())
+  {
+    itkWarningMacro("The conjugate gradient solver did not reach a relative residual of "
+                    << m_SolverTolerance << " in " << m_NumberOfIterations << " iterations.");
+  }
+
+  // Affine coefficients C = (P^T Q)^-1 P^T Z, kernel coefficients W = Z - Q C.
+  vnl_matrix<TParametersValueType> schurComplement(NumberOfAffineTerms, NumberOfAffineTerms);
+  vnl_matrix<TParametersValueType> projectedDisplacements(NumberOfAffineTerms, VDimension);
+  for (unsigned int a = 0; a < NumberOfAffineTerms; ++a)
+  {
+    const std::vector<TParametersValueType> & basis = rhs[VDimension + a];
+    for (unsigned int b = 0; b < NumberOfAffineTerms; ++b)
+    {
+      schurComplement(a, b) = std::inner_product(
+        basis.begin(), basis.end(), solutions[VDimension + b].begin(), TParametersValueType{});
+    }
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      projectedDisplacements(a, d) =
+        std::inner_product(basis.begin(), basis.end(), solutions[d].begin(), TParametersValueType{});
+    }
+  }
+  const vnl_svd<TParametersValueType>    svd(schurComplement, 1e-8);
+  const vnl_matrix<TParametersValueType> affine = svd.solve(projectedDisplacements);
+
+  m_SortedCoefficients.resize(numberOfLandmarks);
+  this->m_DMatrix.set_size(VDimension, numberOfLandmarks);
+  for (SizeValueType i = 0; i < numberOfLandmarks; ++i)
+  {
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      TParametersValueType coefficient = solutions[d][i];
+      for (unsigned int a = 0; a < NumberOfAffineTerms; ++a)
+      {
+        coefficient -= solutions[VDimension + a][i] * affine(a, d);
+      }
+      m_SortedCoefficients[i][d] = coefficient;
+      this->m_DMatrix(d, sortedToLandmark[i]) = coefficient;
+    }
+  }
+
+  // Undo the centering: A (x - c) + b = A x + (b - A c).
+  for (unsigned int d = 0; d < VDimension; ++d)
+  {
+    this->m_BVector(d) = affine(VDimension, d);
+    for (unsigned int j = 0; j < VDimension; ++j)
+    {
+      this->m_AMatrix(d, j) = affine(j, d);
+      this->m_BVector(d) -= affine(j, d) * centroid[j];
+    }
+  }
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::ComputeDeformationContribution(
+  const InputPointType & thisPoint,
+  OutputPointType &      result) const
+{
+  this->VisitNeighbors(thisPoint, [this, &result](SizeValueType n, TParametersValueType value) {
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      result[d] += value * m_SortedCoefficients[n][d];
+    }
+  });
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::TransformPoints(const InputPointType * inputPoints,
+                                                                                 OutputPointType *      outputPoints,
+                                                                                 SizeValueType numberOfPoints) const
+{
+  for (SizeValueType n = 0; n < numberOfPoints; ++n)
+  {
+    // Copied, as the output may overwrite the input
+    const InputPointType point = inputPoints[n];
+
+    OutputPointType result;
+    for (unsigned int d = 0; d < VDimension; ++d)
+    {
+      result[d] = point[d] + this->m_BVector(d);
+      for (unsigned int j = 0; j < VDimension; ++j)
+      {
+        result[d] += this->m_AMatrix(d, j) * point[j];
+      }
+    }
+    this->Self::ComputeDeformationContribution(point, result);
+    outputPoints[n] = result;
+  }
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+WendlandSplineKernelTransform<TParametersValueType, VDimension>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "SupportRadius: " << m_SupportRadius << std::endl;
+  os << indent << "SolverTolerance: " << m_SolverTolerance << std::endl;
+  os << indent << "MaximumNumberOfIterations: " << m_MaximumNumberOfIterations << std::endl;
+  os << indent << "NumberOfIterations: " << m_NumberOfIterations << std::endl;
+  os << indent << "GridOrigin: " << m_GridOrigin << std::endl;
+  os << indent << "CellSize: " << m_CellSize << std::endl;
+  os << indent << "GridSize: " << m_GridSize << std::endl;
+}
+
+} // namespace itk
+
+#endif
@@ -0,0 +1,191 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+#include "itkAffineTransform.h"
+#include "itkBSplineTransform.h"
+#include "itkCompositeTransform.h"
+#include "itkDisplacementFieldTransform.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkScaleTransform.h"
+
+#include <vector>
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+
+using TransformType = itk::Transform<double, Dimension, Dimension>;
+using PointType = TransformType::InputPointType;
+
+// Points on a coarse grid that covers the domains of the test transforms, and
+// reaches beyond them, so that points outside the B-spline and displacement
+// field domains are exercised as well.
+std::vector<PointType>
+MakePoints()
+{
+  std::vector<PointType> points;
+  for (int k = -2; k <= 12; k += 2)
+  {
+    for (int j = -2; j <= 12; j += 2)
+    {
+      for (int i = -2; i <= 12; ++i)
+      {
+        PointType point;
+        point[0] = 1.1 * i;
+        point[1] = 0.9 * j;
+        point[2] = 1.3 * k;
+        points.push_back(point);
+      }
+    }
+  }
+  return points;
+}
+
+// Checks that the batched and the point-wise paths agree, both out of place
+// and in place.
+void
+ExpectBatchMatchesPointwise(const TransformType & transform, const std::string & description)
+{
+  const std::vector<PointType> points = MakePoints();
+
+  std::vector<PointType> transformedPoints(points.size());
+  transform.TransformPoints(points.data(), transformedPoints.data(), points.size());
+
+  std::vector<PointType> inPlacePoints(points);
+  transform.TransformPoints(inPlacePoints.data(), inPlacePoints.data(), inPlacePoints.size());
+
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    const PointType expected = transform.TransformPoint(points[i]);
+    ITK_EXPECT_VECTOR_NEAR(transformedPoints[i], expected, 1e-12) << description << " point " << points[i];
+    ITK_EXPECT_VECTOR_NEAR(inPlacePoints[i], expected, 1e-12) << description << " in place, point " << points[i];
+  }
+}
+
+itk::AffineTransform<double, Dimension>::Pointer
+MakeAffineTransform()
+{
+  auto transform = itk::AffineTransform<double, Dimension>::New();
+  transform->Rotate3D(itk::Vector<double, Dimension>(1.0), 0.3);
+  transform->Scale(1.2);
+  itk::Vector<double, Dimension> translation;
+  translation[0] = 1.0;
+  translation[1] = -2.0;
+  translation[2] = 0.5;
+  transform->Translate(translation);
+  return transform;
+}
+
+itk::BSplineTransform<double, Dimension, 3>::Pointer
+MakeBSplineTransform()
+{
+  using BSplineType = itk::BSplineTransform<double, Dimension, 3>;
+  auto transform = BSplineType::New();
+
+  BSplineType::PhysicalDimensionsType physicalDimensions;
+  physicalDimensions.Fill(10.0);
+  BSplineType::MeshSizeType meshSize;
+  meshSize.Fill(4);
+  transform->SetTransformDomainPhysicalDimensions(physicalDimensions);
+  transform->SetTransformDomainMeshSize(meshSize);
+
+  BSplineType::ParametersType parameters(transform->GetNumberOfParameters());
+  for (unsigned int n = 0; n < parameters.Size(); ++n)
+  {
+    parameters[n] = 0.01 * ((n * 37) % 101) - 0.5;
+  }
+  transform->SetParametersByValue(parameters);
+  return transform;
+}
+
+itk::DisplacementFieldTransform<double, Dimension>::Pointer
+MakeDisplacementFieldTransform()
+{
+  using DisplacementFieldTransformType = itk::DisplacementFieldTransform<double, Dimension>;
+  using FieldType = DisplacementFieldTransformType::DisplacementFieldType;
+
+  auto field = FieldType::New();
+  FieldType::SizeType size;
+  size.Fill(8);
+  field->SetRegions(size);
+  FieldType::SpacingType spacing;
+  spacing.Fill(1.25);
+  field->SetSpacing(spacing);
+  field->Allocate();
+
+  for (itk::ImageRegionIteratorWithIndex<FieldType> it(field, field->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    const FieldType::IndexType index = it.GetIndex();
+    FieldType::PixelType       displacement;
+    displacement[0] = 0.1 * index[1];
+    displacement[1] = -0.05 * index[2] * index[0];
+    displacement[2] = 0.2;
+    it.Set(displacement);
+  }
+
+  auto transform = DisplacementFieldTransformType::New();
+  transform->SetDisplacementField(field);
+  return transform;
+}
+
+} // namespace
+
+
+TEST(TransformPoints, MatchesTransformPointForAffine)
+{
+  ExpectBatchMatchesPointwise(*MakeAffineTransform(), "Affine");
+}
+
+
+TEST(TransformPoints, MatchesTransformPointForScale)
+{
+  using ScaleTransformType = itk::ScaleTransform<double, Dimension>;
+  auto                          transform = ScaleTransformType::New();
+  ScaleTransformType::ScaleType scale;
+  scale[0] = 1.5;
+  scale[1] = 0.5;
+  scale[2] = 2.0;
+  transform->SetScale(scale);
+  PointType center;
+  center.Fill(3.0);
+  transform->SetCenter(center);
+  ExpectBatchMatchesPointwise(*transform, "Scale");
+}
+
+
+TEST(TransformPoints, MatchesTransformPointForBSpline)
+{
+  ExpectBatchMatchesPointwise(*MakeBSplineTransform(), "BSpline");
+}
+
+
+TEST(TransformPoints, MatchesTransformPointForDisplacementField)
+{
+  ExpectBatchMatchesPointwise(*MakeDisplacementFieldTransform(), "DisplacementField");
+}
+
+
+TEST(TransformPoints, MatchesTransformPointForComposite)
+{
+  auto composite = itk::CompositeTransform<double, Dimension>::New();
+  composite->AddTransform(MakeAffineTransform());
+  composite->AddTransform(MakeBSplineTransform());
+  composite->AddTransform(MakeDisplacementFieldTransform());
+  ExpectBatchMatchesPointwise(*composite, "Composite");
+}
@@ -0,0 +1,176 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkGTest.h"
+#include "itkWendlandSplineKernelTransform.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+
+using TransformType = itk::WendlandSplineKernelTransform<double, Dimension>;
+using PointType = TransformType::InputPointType;
+using PointSetType = TransformType::PointSetType;
+
+// Landmarks scattered in a 100 mm cube.
+std::vector<PointType>
+MakeSourceLandmarks(unsigned int numberOfLandmarks)
+{
+  std::mt19937                           generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 100.0);
+
+  std::vector<PointType> landmarks(numberOfLandmarks);
+  for (auto & landmark : landmarks)
+  {
+    for (unsigned int d = 0; d < Dimension; ++d)
+    {
+      landmark[d] = distribution(generator);
+    }
+  }
+  return landmarks;
+}
+
+PointType
+Affine(const PointType & point)
+{
+  PointType result;
+  result[0] = 1.1 * point[0] + 0.1 * point[1] - 3.0;
+  result[1] = -0.05 * point[0] + 0.95 * point[1] + 0.2 * point[2] + 1.5;
+  result[2] = 0.02 * point[1] + 1.05 * point[2] + 4.0;
+  return result;
+}
+
+PointType
+Warp(const PointType & point)
+{
+  PointType result = Affine(point);
+  result[0] += 2.0 * std::sin(point[1] / 15.0);
+  result[1] += 1.5 * std::cos(point[2] / 20.0);
+  result[2] += std::sin((point[0] + point[1]) / 25.0);
+  return result;
+}
+
+template <typename TMapping>
+TransformType::Pointer
+MakeTransform(const std::vector<PointType> & sources, TMapping mapping, double supportRadius)
+{
+  auto sourceLandmarks = PointSetType::New();
+  auto targetLandmarks = PointSetType::New();
+  for (unsigned int i = 0; i < sources.size(); ++i)
+  {
+    sourceLandmarks->SetPoint(i, sources[i]);
+    targetLandmarks->SetPoint(i, mapping(sources[i]));
+  }
+
+  auto transform = TransformType::New();
+  transform->SetSourceLandmarks(sourceLandmarks);
+  transform->SetTargetLandmarks(targetLandmarks);
+  transform->SetSupportRadius(supportRadius);
+  transform->ComputeWMatrix();
+  return transform;
+}
+
+} // namespace
+
+
+TEST(WendlandSplineKernelTransform, InterpolatesLandmarks)
+{
+  const std::vector<PointType> sources = MakeSourceLandmarks(2000);
+  const auto                   transform = MakeTransform(sources, Warp, 15.0);
+
+  EXPECT_GT(transform->GetNumberOfIterations(), 0u);
+  for (const auto & source : sources)
+  {
+    ITK_EXPECT_VECTOR_NEAR(transform->TransformPoint(source), Warp(source), 1e-6) << "landmark " << source;
+  }
+}
+
+
+TEST(WendlandSplineKernelTransform, ReproducesAffineMappings)
+{
+  const std::vector<PointType> sources = MakeSourceLandmarks(500);
+  const auto                   transform = MakeTransform(sources, Affine, 20.0);
+
+  // Points between the landmarks, and far outside their support.
+  for (const auto & point : MakeSourceLandmarks(50))
+  {
+    PointType shifted = point;
+    shifted[0] += 0.37;
+    ITK_EXPECT_VECTOR_NEAR(transform->TransformPoint(shifted), Affine(shifted), 1e-6);
+
+    PointType far = point;
+    far[2] += 1000.0;
+    ITK_EXPECT_VECTOR_NEAR(transform->TransformPoint(far), Affine(far), 1e-6);
+  }
+}
+
+
+TEST(WendlandSplineKernelTransform, StiffnessApproximatesLandmarks)
+{
+  const std::vector<PointType> sources = MakeSourceLandmarks(500);
+  auto                         transform = MakeTransform(sources, Warp, 20.0);
+  transform->SetStiffness(0.5);
+  transform->ComputeWMatrix();
+
+  double maximumError = 0.0;
+  for (const auto & source : sources)
+  {
+    maximumError = std::max(maximumError, transform->TransformPoint(source).EuclideanDistanceTo(Warp(source)));
+  }
+  EXPECT_GT(maximumError, 1e-3);
+  EXPECT_LT(maximumError, 3.0);
+}
+
+
+TEST(WendlandSplineKernelTransform, BatchMatchesTransformPoint)
+{
+  const std::vector<PointType> sources = MakeSourceLandmarks(1000);
+  const auto                   transform = MakeTransform(sources, Warp, 15.0);
+
+  std::vector<PointType> points = MakeSourceLandmarks(300);
+  for (auto & point : points)
+  {
+    point[1] += 0.5;
+  }
+
+  std::vector<PointType> transformedPoints(points.size());
+  transform->TransformPoints(points.data(), transformedPoints.data(), points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    ITK_EXPECT_VECTOR_NEAR(transformedPoints[i], transform->TransformPoint(points[i]), 1e-9);
+  }
+
+  // In place
+  std::vector<PointType> inPlacePoints(points);
+  transform->TransformPoints(inPlacePoints.data(), inPlacePoints.data(), inPlacePoints.size());
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    ITK_EXPECT_VECTOR_NEAR(inPlacePoints[i], transformedPoints[i], 1e-12);
+  }
+}
+
+
+TEST(WendlandSplineKernelTransform, RequiresEnoughLandmarks)
+{
+  const std::vector<PointType> sources = MakeSourceLandmarks(Dimension);
+  EXPECT_THROW(MakeTransform(sources, Warp, 10.0), itk::ExceptionObject);
+}
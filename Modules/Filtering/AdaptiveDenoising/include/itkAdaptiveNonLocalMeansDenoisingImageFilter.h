@@ -41,6 +41,17 @@ namespace itk
  * Spatially Varying Noise Levels, Journal of Magnetic Resonance Imaging,
  * 31:192-203, June 2010.
  *
+ * By default the distance between two patches is computed pixel by pixel
+ * for every pair of a voxel and one of its search neighbors, so the cost
+ * grows with the product of the search and patch sizes. When
+ * PatchDistanceComputation is set to INTEGRAL_IMAGE, the region of each
+ * thread is processed in blocks: for every search offset the squared
+ * differences of the block are summed over the patch window with running
+ * (summed-area) sums along each dimension, and these patch distances are
+ * shared by all voxels of the block. The cost then no longer depends on
+ * the patch size, and the output matches the direct computation up to
+ * floating-point rounding.
+ *
  * \ingroup AdaptiveDenoising
  */
 
@@ -88,6 +99,8 @@ public:
   using NeighborhoodOffsetType = typename Superclass::NeighborhoodOffsetType;
   using NeighborhoodOffsetListType = typename Superclass::NeighborhoodOffsetListType;
 
+  using PatchDistanceComputationEnum = typename Superclass::PatchDistanceComputationEnum;
+
   using ModifiedBesselCalculatorType = GaussianOperator<RealType>;
 
   /**
@@ -172,6 +185,13 @@ public:
   itkNonVirtualSetMacro(NeighborhoodRadiusForLocalMeanAndVariance, NeighborhoodRadiusType);
   itkNonVirtualGetConstMacro(NeighborhoodRadiusForLocalMeanAndVariance, NeighborhoodRadiusType);
 
+  /**
+   * Strategy used to compute the patch distances.
+   * Default = DIRECT.
+   */
+  itkNonVirtualSetMacro(PatchDistanceComputation, PatchDistanceComputationEnum);
+  itkNonVirtualGetConstMacro(PatchDistanceComputation, PatchDistanceComputationEnum);
+
 protected:
   AdaptiveNonLocalMeansDenoisingImageFilter();
   ~AdaptiveNonLocalMeansDenoisingImageFilter() override = default;
@@ -191,6 +211,19 @@ protected:
 private:
   RealType CalculateCorrectionFactor(RealType);
 
+  /** Sum a buffer laid out like an image of the given size over a window
+   * of the given radius, with zeros outside the buffer. */
+  static void
+  BoxSum(std::vector<RealType> &               buffer,
+         const typename RegionType::SizeType & size,
+         const NeighborhoodRadiusType &        radius);
+
+  /** Compute the mean squared differences between the patches centered at
+   * every voxel of the block and at its search neighbors. The distances
+   * are stored search offset by search offset, in block order. */
+  void
+  ComputeBlockPatchDistances(const RegionType & block, std::vector<RealType> & distances) const;
+
   bool m_UseRicianNoiseModel;
 
   ModifiedBesselCalculatorType m_ModifiedBesselCalculator;
@@ -211,6 +244,11 @@ private:
   RealImagePointer m_IntensitySquaredDistanceImage;
 
   NeighborhoodRadiusType m_NeighborhoodRadiusForLocalMeanAndVariance;
+
+  PatchDistanceComputationEnum m_PatchDistanceComputation{ PatchDistanceComputationEnum::DIRECT };
+
+  /** Input minus local mean, used by the integral image computation. */
+  RealImagePointer m_ResidualImage;
 };
 
 } // end namespace itk
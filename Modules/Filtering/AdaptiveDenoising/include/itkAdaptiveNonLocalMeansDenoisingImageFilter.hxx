@@ -24,6 +24,7 @@
 #include "itkImageRegionConstIterator.h"
 #include "itkImageRegionIterator.h"
 #include "itkImageRegionIteratorWithIndex.h"
+#include "itkImageRegionSplitterMultidimensional.h"
 #include "itkMath.h"
 #include "itkMeanImageFilter.h"
 #include "itkNeighborhoodIterator.h"
@@ -31,6 +32,7 @@
 #include "itkStatisticsImageFilter.h"
 #include "itkVarianceImageFilter.h"
 
+#include <algorithm>
 #include <numeric>
 
 namespace itk
@@ -56,6 +58,7 @@ AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>
   this->m_ThreadContributionCountImage = nullptr;
 
   this->m_RicianBiasImage = nullptr;
+  this->m_ResidualImage = nullptr;
 
   this->m_NeighborhoodRadiusForLocalMeanAndVariance.Fill(1);
   this->DynamicMultiThreadingOff();
@@ -108,6 +111,55 @@ AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>
     this->m_RicianBiasImage->Allocate(true);
   }
 
+  if (this->m_PatchDistanceComputation == PatchDistanceComputationEnum::INTEGRAL_IMAGE)
+  {
+    const RegionType             targetImageRegion = this->GetTargetImageRegion();
+    const NeighborhoodRadiusType neighborhoodPatchRadius = this->GetNeighborhoodPatchRadius();
+
+    this->m_ResidualImage = RealImageType::New();
+    this->m_ResidualImage->CopyInformation(inputImage);
+    this->m_ResidualImage->SetRegions(targetImageRegion);
+    this->m_ResidualImage->Allocate();
+
+    // The distance of a search neighbor patch to its local mean does not
+    // depend on the search offset, so it is computed once for the image.
+    std::vector<RealType> squaredResiduals(targetImageRegion.GetNumberOfPixels());
+
+    ImageRegionConstIterator<InputImageType> ItI(inputImage, targetImageRegion);
+    ImageRegionConstIterator<RealImageType>  ItM(this->m_MeanImage, targetImageRegion);
+    ImageRegionIterator<RealImageType>       ItR(this->m_ResidualImage, targetImageRegion);
+    for (SizeValueType n = 0; !ItR.IsAtEnd(); ++ItI, ++ItM, ++ItR, ++n)
+    {
+      const RealType residual = static_cast<RealType>(ItI.Get()) - ItM.Get();
+      ItR.Set(residual);
+      squaredResiduals[n] = itk::Math::sqr(residual);
+    }
+
+    Self::BoxSum(squaredResiduals, targetImageRegion.GetSize(), neighborhoodPatchRadius);
+
+    this->m_IntensitySquaredDistanceImage = RealImageType::New();
+    this->m_IntensitySquaredDistanceImage->CopyInformation(inputImage);
+    this->m_IntensitySquaredDistanceImage->SetRegions(targetImageRegion);
+    this->m_IntensitySquaredDistanceImage->Allocate();
+
+    ImageRegionIteratorWithIndex<RealImageType> ItD(this->m_IntensitySquaredDistanceImage, targetImageRegion);
+    for (SizeValueType n = 0; !ItD.IsAtEnd(); ++ItD, ++n)
+    {
+      const IndexType index = ItD.GetIndex();
+
+      RealType count = NumericTraits<RealType>::OneValue();
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        const IndexValueType first = std::max(index[d] - static_cast<IndexValueType>(neighborhoodPatchRadius[d]),
+                                              targetImageRegion.GetIndex(d));
+        const IndexValueType last = std::min(index[d] + static_cast<IndexValueType>(neighborhoodPatchRadius[d]),
+                                             targetImageRegion.GetUpperIndex()[d]);
+        count *= static_cast<RealType>(last - first + 1);
+      }
+      ItD.Set(squaredResiduals[n] / count);
+    }
+  }
+
   this->AllocateOutputs();
   // Output buffer needs to be zero initialized
   this->GetOutput()->FillBuffer(0.0);
@@ -131,246 +183,277 @@ AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>
 
   NeighborhoodRadiusType neighborhoodSearchRadius = this->GetNeighborhoodSearchRadius();
 
-  ConstNeighborhoodIterator<RealImageType> ItV(neighborhoodSearchRadius, this->m_VarianceImage, region);
-  ConstNeighborhoodIterator<RealImageType> ItM(neighborhoodSearchRadius, this->m_MeanImage, region);
-
   const unsigned int neighborhoodSearchSize = this->GetNeighborhoodSearchSize();
   const unsigned int neighborhoodPatchSize = this->GetNeighborhoodPatchSize();
 
   Array<RealType> weightedAverageIntensities(neighborhoodPatchSize);
 
-  ItM.GoToBegin();
-  ItV.GoToBegin();
+  // With integral images, the region is processed in blocks small enough
+  // for the patch distances of all their voxels, one set per search
+  // offset, to stay in cache.
+  const bool useIntegralImage = (this->m_PatchDistanceComputation == PatchDistanceComputationEnum::INTEGRAL_IMAGE);
 
-  while (!ItM.IsAtEnd())
+  std::vector<RegionType> blocks;
+  if (useIntegralImage)
   {
-    typename InputImageType::IndexType centerIndex = ItM.GetIndex();
+    constexpr SizeValueType blockNumberOfPixels = 4096;
 
-    InputPixelType inputCenterPixel = inputImage->GetPixel(centerIndex);
-    RealType       meanCenterPixel = this->m_MeanImage->GetPixel(centerIndex);
-    RealType       varianceCenterPixel = this->m_VarianceImage->GetPixel(centerIndex);
-
-    RealType maxWeight = NumericTraits<RealType>::ZeroValue();
-    RealType sumOfWeights = NumericTraits<RealType>::ZeroValue();
-
-    weightedAverageIntensities.Fill(NumericTraits<RealType>::ZeroValue());
-
-    RealType meanNeighborhoodPixel = NumericTraits<RealType>::ZeroValue();
-    RealType varianceNeighborhoodPixel = NumericTraits<RealType>::ZeroValue();
-
-    if (inputCenterPixel > 0 && meanCenterPixel > this->m_Epsilon && varianceCenterPixel > this->m_Epsilon &&
-        (!maskImage || maskImage->GetPixel(centerIndex) != NumericTraits<MaskPixelType>::ZeroValue()))
+    const auto         splitter = ImageRegionSplitterMultidimensional::New();
+    const unsigned int numberOfBlocks = splitter->GetNumberOfSplits(
+      region, static_cast<unsigned int>((region.GetNumberOfPixels() + blockNumberOfPixels - 1) / blockNumberOfPixels));
+    for (unsigned int i = 0; i < numberOfBlocks; ++i)
     {
-      // Calculate the minimum distance
-
-      RealType minimumDistance = NumericTraits<RealType>::max();
-      for (unsigned int m = 0; m < neighborhoodSearchSize; m++)
-      {
-        if (!ItM.IndexInBounds(m) || m == static_cast<unsigned int>(0.5 * neighborhoodSearchSize))
-        {
-          continue;
-        }
-
-        IndexType neighborhoodIndex = ItM.GetIndex(m);
-
-        if (inputImage->GetPixel(neighborhoodIndex) <= 0)
-        {
-          continue;
-        }
+      RegionType block = region;
+      splitter->GetSplit(i, numberOfBlocks, block);
+      blocks.push_back(block);
+    }
+  }
+  else
+  {
+    blocks.push_back(region);
+  }
 
-        meanNeighborhoodPixel = this->m_MeanImage->GetPixel(neighborhoodIndex);
-        varianceNeighborhoodPixel = this->m_VarianceImage->GetPixel(neighborhoodIndex);
+  std::vector<RealType> blockPatchDistances;
 
-        if (meanNeighborhoodPixel <= this->m_Epsilon || varianceNeighborhoodPixel <= this->m_Epsilon)
-        {
-          continue;
-        }
+  for (const RegionType & block : blocks)
+  {
+    const SizeValueType numberOfBlockPixels = block.GetNumberOfPixels();
+    if (useIntegralImage)
+    {
+      this->ComputeBlockPatchDistances(block, blockPatchDistances);
+    }
 
-        const RealType meanRatio = meanCenterPixel / meanNeighborhoodPixel;
-        const RealType meanRatioInverse = (this->m_MaximumInputPixelIntensity - meanCenterPixel) /
-                                          (this->m_MaximumInputPixelIntensity - meanNeighborhoodPixel);
+    ConstNeighborhoodIterator<RealImageType> ItV(neighborhoodSearchRadius, this->m_VarianceImage, block);
+    ConstNeighborhoodIterator<RealImageType> ItM(neighborhoodSearchRadius, this->m_MeanImage, block);
 
-        const RealType varianceRatio = varianceCenterPixel / varianceNeighborhoodPixel;
+    ItM.GoToBegin();
+    ItV.GoToBegin();
 
-        if (((meanRatio > this->m_MeanThreshold &&
-              meanRatio < itk::NumericTraits<RealType>::OneValue() / this->m_MeanThreshold) ||
-             (meanRatioInverse > this->m_MeanThreshold &&
-              meanRatioInverse < itk::NumericTraits<RealType>::OneValue() / this->m_MeanThreshold)) &&
-            varianceRatio > this->m_VarianceThreshold &&
-            varianceRatio < itk::NumericTraits<RealType>::OneValue() / this->m_VarianceThreshold)
-        {
+    for (SizeValueType blockOffset = 0; !ItM.IsAtEnd(); ++blockOffset)
+    {
+      typename InputImageType::IndexType centerIndex = ItM.GetIndex();
 
-          RealType averageDistance = itk::NumericTraits<RealType>::ZeroValue();
-          RealType count = itk::NumericTraits<RealType>::ZeroValue();
+      InputPixelType inputCenterPixel = inputImage->GetPixel(centerIndex);
+      RealType       meanCenterPixel = this->m_MeanImage->GetPixel(centerIndex);
+      RealType       varianceCenterPixel = this->m_VarianceImage->GetPixel(centerIndex);
 
-          for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
-          {
-            IndexType neighborhoodPatchIndex = neighborhoodIndex + neighborhoodPatchOffsetList[n];
+      RealType maxWeight = NumericTraits<RealType>::ZeroValue();
+      RealType sumOfWeights = NumericTraits<RealType>::ZeroValue();
 
-            if (!targetImageRegion.IsInside(neighborhoodPatchIndex))
-            {
-              continue;
-            }
-            RealType neighborhoodInputImagePixel = static_cast<RealType>(inputImage->GetPixel(neighborhoodPatchIndex));
-            RealType neighborhoodMeanImagePixel = this->m_MeanImage->GetPixel(neighborhoodPatchIndex);
-            averageDistance += itk::Math::sqr(neighborhoodInputImagePixel - neighborhoodMeanImagePixel);
+      weightedAverageIntensities.Fill(NumericTraits<RealType>::ZeroValue());
 
-            count += itk::NumericTraits<RealType>::OneValue();
-          }
-          averageDistance /= count;
-          minimumDistance = std::min(averageDistance, minimumDistance);
-        }
-      }
+      RealType meanNeighborhoodPixel = NumericTraits<RealType>::ZeroValue();
+      RealType varianceNeighborhoodPixel = NumericTraits<RealType>::ZeroValue();
 
-      if (itk::Math::AlmostEquals(minimumDistance, NumericTraits<RealType>::ZeroValue()))
+      if (inputCenterPixel > 0 && meanCenterPixel > this->m_Epsilon && varianceCenterPixel > this->m_Epsilon &&
+          (!maskImage || maskImage->GetPixel(centerIndex) != NumericTraits<MaskPixelType>::ZeroValue()))
       {
-        minimumDistance = NumericTraits<RealType>::OneValue();
-      }
+        // Calculate the minimum distance
 
-      // Rician correction
-
-      if (this->m_UseRicianNoiseModel)
-      {
-        for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
+        RealType minimumDistance = NumericTraits<RealType>::max();
+        for (unsigned int m = 0; m < neighborhoodSearchSize; m++)
         {
-          IndexType neighborhoodPatchIndex = centerIndex + neighborhoodPatchOffsetList[n];
-          if (!targetImageRegion.IsInside(neighborhoodPatchIndex))
+          if (!ItM.IndexInBounds(m) || m == static_cast<unsigned int>(0.5 * neighborhoodSearchSize))
           {
             continue;
           }
 
-          if (itk::Math::AlmostEquals(minimumDistance, NumericTraits<RealType>::max()))
+          IndexType neighborhoodIndex = ItM.GetIndex(m);
+
+          if (inputImage->GetPixel(neighborhoodIndex) <= 0)
           {
-            this->m_RicianBiasImage->SetPixel(neighborhoodPatchIndex, 0.0);
+            continue;
           }
-          else
+
+          meanNeighborhoodPixel = this->m_MeanImage->GetPixel(neighborhoodIndex);
+          varianceNeighborhoodPixel = this->m_VarianceImage->GetPixel(neighborhoodIndex);
+
+          if (meanNeighborhoodPixel <= this->m_Epsilon || varianceNeighborhoodPixel <= this->m_Epsilon)
           {
-            this->m_RicianBiasImage->SetPixel(neighborhoodPatchIndex, minimumDistance);
+            continue;
           }
-        }
-      }
 
-      // Patch filtering
+          const RealType meanRatio = meanCenterPixel / meanNeighborhoodPixel;
+          const RealType meanRatioInverse = (this->m_MaximumInputPixelIntensity - meanCenterPixel) /
+                                            (this->m_MaximumInputPixelIntensity - meanNeighborhoodPixel);
 
-      for (unsigned int m = 0; m < neighborhoodSearchSize; m++)
-      {
-        if (!ItM.IndexInBounds(m) || m == static_cast<unsigned int>(0.5 * neighborhoodSearchSize))
-        {
-          continue;
-        }
+          const RealType varianceRatio = varianceCenterPixel / varianceNeighborhoodPixel;
+
+          if (((meanRatio > this->m_MeanThreshold &&
+                meanRatio < itk::NumericTraits<RealType>::OneValue() / this->m_MeanThreshold) ||
+               (meanRatioInverse > this->m_MeanThreshold &&
+                meanRatioInverse < itk::NumericTraits<RealType>::OneValue() / this->m_MeanThreshold)) &&
+              varianceRatio > this->m_VarianceThreshold &&
+              varianceRatio < itk::NumericTraits<RealType>::OneValue() / this->m_VarianceThreshold)
+          {
 
-        IndexType neighborhoodIndex = ItM.GetIndex(m);
+            RealType averageDistance = itk::NumericTraits<RealType>::ZeroValue();
+            if (useIntegralImage)
+            {
+              averageDistance = this->m_IntensitySquaredDistanceImage->GetPixel(neighborhoodIndex);
+            }
+            else
+            {
+              RealType count = itk::NumericTraits<RealType>::ZeroValue();
 
-        if (inputImage->GetPixel(neighborhoodIndex) <= 0)
-        {
-          continue;
+              for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
+              {
+                IndexType neighborhoodPatchIndex = neighborhoodIndex + neighborhoodPatchOffsetList[n];
+
+                if (!targetImageRegion.IsInside(neighborhoodPatchIndex))
+                {
+                  continue;
+                }
+                RealType neighborhoodInputImagePixel =
+                  static_cast<RealType>(inputImage->GetPixel(neighborhoodPatchIndex));
+                RealType neighborhoodMeanImagePixel = this->m_MeanImage->GetPixel(neighborhoodPatchIndex);
+                averageDistance += itk::Math::sqr(neighborhoodInputImagePixel - neighborhoodMeanImagePixel);
+
+                count += itk::NumericTraits<RealType>::OneValue();
+              }
+              averageDistance /= count;
+            }
+            minimumDistance = std::min(averageDistance, minimumDistance);
+          }
         }
 
-        meanNeighborhoodPixel = this->m_MeanImage->GetPixel(neighborhoodIndex);
-        varianceNeighborhoodPixel = this->m_VarianceImage->GetPixel(neighborhoodIndex);
-
-        if (meanNeighborhoodPixel <= this->m_Epsilon || varianceNeighborhoodPixel <= this->m_Epsilon)
+        if (itk::Math::AlmostEquals(minimumDistance, NumericTraits<RealType>::ZeroValue()))
         {
-          continue;
+          minimumDistance = NumericTraits<RealType>::OneValue();
         }
 
-        const RealType meanRatio = meanCenterPixel / meanNeighborhoodPixel;
-        const RealType meanRatioInverse = (this->m_MaximumInputPixelIntensity - meanCenterPixel) /
-                                          (this->m_MaximumInputPixelIntensity - meanNeighborhoodPixel);
-
-        const RealType varianceRatio = varianceCenterPixel / varianceNeighborhoodPixel;
+        // Rician correction
 
-        if (((meanRatio > this->m_MeanThreshold &&
-              meanRatio < itk::NumericTraits<RealType>::OneValue() / this->m_MeanThreshold) ||
-             (meanRatioInverse > this->m_MeanThreshold &&
-              meanRatioInverse < itk::NumericTraits<RealType>::OneValue() / this->m_MeanThreshold)) &&
-            varianceRatio > this->m_VarianceThreshold &&
-            varianceRatio < itk::NumericTraits<RealType>::OneValue() / this->m_VarianceThreshold)
+        if (this->m_UseRicianNoiseModel)
         {
-
-          RealType averageDistance = 0.0;
-          RealType count = 0.0;
           for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
           {
-            IndexType searchNeighborhoodPatchIndex = neighborhoodIndex + neighborhoodPatchOffsetList[n];
-            IndexType centerNeighborhoodPatchIndex = centerIndex + neighborhoodPatchOffsetList[n];
-            if (!targetImageRegion.IsInside(searchNeighborhoodPatchIndex) ||
-                !targetImageRegion.IsInside(centerNeighborhoodPatchIndex))
+            IndexType neighborhoodPatchIndex = centerIndex + neighborhoodPatchOffsetList[n];
+            if (!targetImageRegion.IsInside(neighborhoodPatchIndex))
             {
               continue;
             }
-            RealType distance1 = inputImage->GetPixel(searchNeighborhoodPatchIndex) -
-                                 this->m_MeanImage->GetPixel(searchNeighborhoodPatchIndex);
-            RealType distance2 = inputImage->GetPixel(centerNeighborhoodPatchIndex) -
-                                 this->m_MeanImage->GetPixel(centerNeighborhoodPatchIndex);
-            averageDistance += itk::Math::sqr(distance1 - distance2);
-            count += itk::NumericTraits<RealType>::OneValue();
+
+            if (itk::Math::AlmostEquals(minimumDistance, NumericTraits<RealType>::max()))
+            {
+              this->m_RicianBiasImage->SetPixel(neighborhoodPatchIndex, 0.0);
+            }
+            else
+            {
+              this->m_RicianBiasImage->SetPixel(neighborhoodPatchIndex, minimumDistance);
+            }
           }
-          averageDistance /= count;
+        }
 
-          RealType weight = itk::NumericTraits<RealType>::ZeroValue();
-          if (averageDistance <= static_cast<RealType>(3.0) * minimumDistance)
+        // Patch filtering
+
+        for (unsigned int m = 0; m < neighborhoodSearchSize; m++)
+        {
+          if (!ItM.IndexInBounds(m) || m == static_cast<unsigned int>(0.5 * neighborhoodSearchSize))
           {
-            weight = std::exp(-averageDistance / minimumDistance);
+            continue;
           }
-          if (weight > maxWeight)
+
+          IndexType neighborhoodIndex = ItM.GetIndex(m);
+
+          if (inputImage->GetPixel(neighborhoodIndex) <= 0)
           {
-            maxWeight = weight;
+            continue;
           }
 
-          if (weight > itk::NumericTraits<RealType>::ZeroValue())
+          meanNeighborhoodPixel = this->m_MeanImage->GetPixel(neighborhoodIndex);
+          varianceNeighborhoodPixel = this->m_VarianceImage->GetPixel(neighborhoodIndex);
+
+          if (meanNeighborhoodPixel <= this->m_Epsilon || varianceNeighborhoodPixel <= this->m_Epsilon)
           {
-            for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
+            continue;
+          }
+
+          const RealType meanRatio = meanCenterPixel / meanNeighborhoodPixel;
+          const RealType meanRatioInverse = (this->m_MaximumInputPixelIntensity - meanCenterPixel) /
+                                            (this->m_MaximumInputPixelIntensity - meanNeighborhoodPixel);
+
+          const RealType varianceRatio = varianceCenterPixel / varianceNeighborhoodPixel;
+
+          if (((meanRatio > this->m_MeanThreshold &&
+                meanRatio < itk::NumericTraits<RealType>::OneValue() / this->m_MeanThreshold) ||
+               (meanRatioInverse > this->m_MeanThreshold &&
+                meanRatioInverse < itk::NumericTraits<RealType>::OneValue() / this->m_MeanThreshold)) &&
+              varianceRatio > this->m_VarianceThreshold &&
+              varianceRatio < itk::NumericTraits<RealType>::OneValue() / this->m_VarianceThreshold)
+          {
+
+            RealType averageDistance = 0.0;
+            if (useIntegralImage)
             {
-              IndexType neighborhoodPatchIndex = neighborhoodIndex + neighborhoodPatchOffsetList[n];
-              if (!targetImageRegion.IsInside(neighborhoodPatchIndex))
-              {
-                continue;
-              }
-              if (this->m_UseRicianNoiseModel)
+              averageDistance = blockPatchDistances[m * numberOfBlockPixels + blockOffset];
+            }
+            else
+            {
+              RealType count = 0.0;
+              for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
               {
-                weightedAverageIntensities[n] += weight * itk::Math::sqr(inputImage->GetPixel(neighborhoodPatchIndex));
+                IndexType searchNeighborhoodPatchIndex = neighborhoodIndex + neighborhoodPatchOffsetList[n];
+                IndexType centerNeighborhoodPatchIndex = centerIndex + neighborhoodPatchOffsetList[n];
+                if (!targetImageRegion.IsInside(searchNeighborhoodPatchIndex) ||
+                    !targetImageRegion.IsInside(centerNeighborhoodPatchIndex))
+                {
+                  continue;
+                }
+                RealType distance1 = inputImage->GetPixel(searchNeighborhoodPatchIndex) -
+                                     this->m_MeanImage->GetPixel(searchNeighborhoodPatchIndex);
+                RealType distance2 = inputImage->GetPixel(centerNeighborhoodPatchIndex) -
+                                     this->m_MeanImage->GetPixel(centerNeighborhoodPatchIndex);
+                averageDistance += itk::Math::sqr(distance1 - distance2);
+                count += itk::NumericTraits<RealType>::OneValue();
               }
-              else
+              averageDistance /= count;
+            }
+
+            RealType weight = itk::NumericTraits<RealType>::ZeroValue();
+            if (averageDistance <= static_cast<RealType>(3.0) * minimumDistance)
+            {
+              weight = std::exp(-averageDistance / minimumDistance);
+            }
+            if (weight > maxWeight)
+            {
+              maxWeight = weight;
+            }
+
+            if (weight > itk::NumericTraits<RealType>::ZeroValue())
+            {
+              for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
               {
-                weightedAverageIntensities[n] += weight * inputImage->GetPixel(neighborhoodPatchIndex);
+                IndexType neighborhoodPatchIndex = neighborhoodIndex + neighborhoodPatchOffsetList[n];
+                if (!targetImageRegion.IsInside(neighborhoodPatchIndex))
+                {
+                  continue;
+                }
+                if (this->m_UseRicianNoiseModel)
+                {
+                  weightedAverageIntensities[n] +=
+                    weight * itk::Math::sqr(inputImage->GetPixel(neighborhoodPatchIndex));
+                }
+                else
+                {
+                  weightedAverageIntensities[n] += weight * inputImage->GetPixel(neighborhoodPatchIndex);
+                }
               }
+              sumOfWeights += weight;
             }
-            sumOfWeights += weight;
           }
         }
-      }
-
-      if (itk::Math::AlmostEquals(maxWeight, NumericTraits<RealType>::ZeroValue()))
-      {
-        maxWeight = NumericTraits<RealType>::OneValue();
-      }
-    }
-    else
-    {
-      maxWeight = NumericTraits<RealType>::OneValue();
-    }
 
-    for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
-    {
-      IndexType neighborhoodPatchIndex = centerIndex + neighborhoodPatchOffsetList[n];
-      if (!targetImageRegion.IsInside(neighborhoodPatchIndex))
-      {
-        continue;
-      }
-      if (this->m_UseRicianNoiseModel)
-      {
-        weightedAverageIntensities[n] += maxWeight * itk::Math::sqr(inputImage->GetPixel(neighborhoodPatchIndex));
+        if (itk::Math::AlmostEquals(maxWeight, NumericTraits<RealType>::ZeroValue()))
+        {
+          maxWeight = NumericTraits<RealType>::OneValue();
+        }
       }
       else
       {
-        weightedAverageIntensities[n] += maxWeight * inputImage->GetPixel(neighborhoodPatchIndex);
+        maxWeight = NumericTraits<RealType>::OneValue();
       }
-    }
-    sumOfWeights += maxWeight;
 
-    if (sumOfWeights > itk::NumericTraits<RealType>::ZeroValue())
-    {
       for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
       {
         IndexType neighborhoodPatchIndex = centerIndex + neighborhoodPatchOffsetList[n];
@@ -378,19 +461,40 @@ AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>
         {
           continue;
         }
-        typename OutputImageType::PixelType estimate = outputImage->GetPixel(neighborhoodPatchIndex);
-        estimate += (weightedAverageIntensities[n] / sumOfWeights);
+        if (this->m_UseRicianNoiseModel)
+        {
+          weightedAverageIntensities[n] += maxWeight * itk::Math::sqr(inputImage->GetPixel(neighborhoodPatchIndex));
+        }
+        else
+        {
+          weightedAverageIntensities[n] += maxWeight * inputImage->GetPixel(neighborhoodPatchIndex);
+        }
+      }
+      sumOfWeights += maxWeight;
+
+      if (sumOfWeights > itk::NumericTraits<RealType>::ZeroValue())
+      {
+        for (unsigned int n = 0; n < neighborhoodPatchSize; n++)
+        {
+          IndexType neighborhoodPatchIndex = centerIndex + neighborhoodPatchOffsetList[n];
+          if (!targetImageRegion.IsInside(neighborhoodPatchIndex))
+          {
+            continue;
+          }
+          typename OutputImageType::PixelType estimate = outputImage->GetPixel(neighborhoodPatchIndex);
+          estimate += (weightedAverageIntensities[n] / sumOfWeights);
 
-        outputImage->SetPixel(neighborhoodPatchIndex, estimate);
-        this->m_ThreadContributionCountImage->SetPixel(
-          neighborhoodPatchIndex, this->m_ThreadContributionCountImage->GetPixel(neighborhoodPatchIndex) + 1);
+          outputImage->SetPixel(neighborhoodPatchIndex, estimate);
+          this->m_ThreadContributionCountImage->SetPixel(
+            neighborhoodPatchIndex, this->m_ThreadContributionCountImage->GetPixel(neighborhoodPatchIndex) + 1);
+        }
       }
-    }
 
-    ++ItM;
-    ++ItV;
+      ++ItM;
+      ++ItV;
 
-    progress.CompletedPixel();
+      progress.CompletedPixel();
+    }
   }
 }
 
@@ -469,6 +573,192 @@ AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>
   }
 }
 
+template <typename TInputImage, typename TOutputImage, typename TMaskImage>
+void
+AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>::BoxSum(
+  std::vector<RealType> &               buffer,
+  const typename RegionType::SizeType & size,
+  const NeighborhoodRadiusType &        radius)
+{
+  const auto numberOfPixels = static_cast<SizeValueType>(buffer.size());
+
+  std::vector<RealType> line;
+
+  SizeValueType stride = 1;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    const SizeValueType length = size[d];
+    const auto          lineRadius = static_cast<OffsetValueType>(radius[d]);
+    if (lineRadius > 0)
+    {
+      // Running sums along each line, accumulated in double precision.
+      line.resize(length);
+      const SizeValueType numberOfLines = numberOfPixels / length;
+      for (SizeValueType l = 0; l < numberOfLines; ++l)
+      {
+        RealType * first = buffer.data() + (l % stride) + (l / stride) * stride * length;
+        for (SizeValueType i = 0; i < length; ++i)
+        {
+          line[i] = first[i * stride];
+        }
+
+        double sum = 0.0;
+        for (OffsetValueType i = 0; i < std::min(lineRadius, static_cast<OffsetValueType>(length) - 1) + 1; ++i)
+        {
+          sum += line[i];
+        }
+        for (OffsetValueType i = 0; i < static_cast<OffsetValueType>(length); ++i)
+        {
+          first[i * stride] = static_cast<RealType>(sum);
+          if (i + lineRadius + 1 < static_cast<OffsetValueType>(length))
+          {
+            sum += line[i + lineRadius + 1];
+          }
+          if (i - lineRadius >= 0)
+          {
+            sum -= line[i - lineRadius];
+          }
+        }
+      }
+    }
+    stride *= length;
+  }
+}
+
+template <typename TInputImage, typename TOutputImage, typename TMaskImage>
+void
+AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>::ComputeBlockPatchDistances(
+  const RegionType &      block,
+  std::vector<RealType> & distances) const
+{
+  const RegionType                   targetImageRegion = this->GetTargetImageRegion();
+  const IndexType                    targetLowerIndex = targetImageRegion.GetIndex();
+  const IndexType                    targetUpperIndex = targetImageRegion.GetUpperIndex();
+  const NeighborhoodRadiusType       patchRadius = this->GetNeighborhoodPatchRadius();
+  const NeighborhoodOffsetListType & searchOffsetList = this->m_NeighborhoodSearchOffsetList;
+  const SizeValueType                neighborhoodSearchSize = this->GetNeighborhoodSearchSize();
+
+  // The squared differences are needed wherever a patch centered in the
+  // block overlaps the target region.
+  RegionType paddedBlock = block;
+  paddedBlock.PadByRadius(patchRadius);
+  paddedBlock.Crop(targetImageRegion);
+
+  const IndexType     paddedIndex = paddedBlock.GetIndex();
+  const auto          paddedSize = paddedBlock.GetSize();
+  const SizeValueType numberOfPaddedPixels = paddedBlock.GetNumberOfPixels();
+  const SizeValueType paddedLineLength = paddedSize[0];
+
+  const IndexType     blockIndex = block.GetIndex();
+  const auto          blockSize = block.GetSize();
+  const SizeValueType numberOfBlockPixels = block.GetNumberOfPixels();
+  const SizeValueType blockLineLength = blockSize[0];
+
+  const RealType * residuals = this->m_ResidualImage->GetBufferPointer();
+
+  std::vector<RealType> squaredDifferences(numberOfPaddedPixels);
+  distances.resize(neighborhoodSearchSize * numberOfBlockPixels);
+
+  for (SizeValueType m = 0; m < neighborhoodSearchSize; ++m)
+  {
+    if (m == static_cast<SizeValueType>(0.5 * neighborhoodSearchSize))
+    {
+      continue;
+    }
+
+    const NeighborhoodOffsetType & searchOffset = searchOffsetList[m];
+
+    // Patch voxels are compared only where both patches lie inside the
+    // target region.
+    IndexType validLowerIndex;
+    IndexType validUpperIndex;
+    for (unsigned int d = 0; d < ImageDimension; ++d)
+    {
+      validLowerIndex[d] = std::max(targetLowerIndex[d], targetLowerIndex[d] - searchOffset[d]);
+      validUpperIndex[d] = std::min(targetUpperIndex[d], targetUpperIndex[d] - searchOffset[d]);
+    }
+
+    const OffsetValueType searchBufferOffset =
+      this->m_ResidualImage->ComputeOffset(targetLowerIndex + searchOffset) -
+      this->m_ResidualImage->ComputeOffset(targetLowerIndex);
+
+    for (SizeValueType l = 0; l < numberOfPaddedPixels / paddedLineLength; ++l)
+    {
+      RealType * squaredDifferenceLine = squaredDifferences.data() + l * paddedLineLength;
+      std::fill(squaredDifferenceLine, squaredDifferenceLine + paddedLineLength, NumericTraits<RealType>::ZeroValue());
+
+      IndexType     lineIndex = paddedIndex;
+      SizeValueType remainder = l;
+      bool          isLineValid = true;
+      for (unsigned int d = 1; d < ImageDimension; ++d)
+      {
+        lineIndex[d] += static_cast<IndexValueType>(remainder % paddedSize[d]);
+        remainder /= paddedSize[d];
+        isLineValid = isLineValid && lineIndex[d] >= validLowerIndex[d] && lineIndex[d] <= validUpperIndex[d];
+      }
+
+      const IndexValueType begin = std::max(validLowerIndex[0], paddedIndex[0]);
+      const IndexValueType end =
+        std::min(validUpperIndex[0], paddedIndex[0] + static_cast<IndexValueType>(paddedLineLength) - 1) + 1;
+      if (!isLineValid || begin >= end)
+      {
+        continue;
+      }
+
+      lineIndex[0] = begin;
+      const RealType * centerResiduals = residuals + this->m_ResidualImage->ComputeOffset(lineIndex);
+      const RealType * searchResiduals = centerResiduals + searchBufferOffset;
+      RealType *       lineOutput = squaredDifferenceLine + (begin - paddedIndex[0]);
+      for (IndexValueType i = 0; i < end - begin; ++i)
+      {
+        lineOutput[i] = itk::Math::sqr(searchResiduals[i] - centerResiduals[i]);
+      }
+    }
+
+    Self::BoxSum(squaredDifferences, paddedSize, patchRadius);
+
+    // Normalize by the number of patch voxels that were compared.
+    RealType * blockDistances = distances.data() + m * numberOfBlockPixels;
+    for (SizeValueType l = 0; l < numberOfBlockPixels / blockLineLength; ++l)
+    {
+      IndexType     lineIndex = blockIndex;
+      SizeValueType remainder = l;
+      for (unsigned int d = 1; d < ImageDimension; ++d)
+      {
+        lineIndex[d] += static_cast<IndexValueType>(remainder % blockSize[d]);
+        remainder /= blockSize[d];
+      }
+
+      RealType      lineCount = NumericTraits<RealType>::OneValue();
+      SizeValueType paddedOffset = 0;
+      SizeValueType paddedStride = 1;
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        paddedOffset += static_cast<SizeValueType>(lineIndex[d] - paddedIndex[d]) * paddedStride;
+        paddedStride *= paddedSize[d];
+        if (d > 0)
+        {
+          const IndexValueType first =
+            std::max(lineIndex[d] - static_cast<IndexValueType>(patchRadius[d]), validLowerIndex[d]);
+          const IndexValueType last =
+            std::min(lineIndex[d] + static_cast<IndexValueType>(patchRadius[d]), validUpperIndex[d]);
+          lineCount *= static_cast<RealType>(std::max(last - first + 1, IndexValueType{ 0 }));
+        }
+      }
+
+      for (SizeValueType i = 0; i < blockLineLength; ++i)
+      {
+        const IndexValueType x = lineIndex[0] + static_cast<IndexValueType>(i);
+        const IndexValueType first = std::max(x - static_cast<IndexValueType>(patchRadius[0]), validLowerIndex[0]);
+        const IndexValueType last = std::min(x + static_cast<IndexValueType>(patchRadius[0]), validUpperIndex[0]);
+        const RealType count = lineCount * static_cast<RealType>(std::max(last - first + 1, IndexValueType{ 0 }));
+
+        blockDistances[l * blockLineLength + i] = squaredDifferences[paddedOffset + i] / count;
+      }
+    }
+  }
+}
+
 template <typename TInputImage, typename TOutputImage, typename TMaskImage>
 typename AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>::RealType
 AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>::CalculateCorrectionFactor(
@@ -517,6 +807,7 @@ AdaptiveNonLocalMeansDenoisingImageFilter<TInputImage, TOutputImage, TMaskImage>
   os << indent
      << "Neighborhood radius for local mean and variance = " << this->m_NeighborhoodRadiusForLocalMeanAndVariance
      << std::endl;
+  os << indent << "Patch distance computation = " << this->m_PatchDistanceComputation << std::endl;
 }
 
 } // end namespace itk
@@ -45,10 +45,22 @@ public:
     PEARSON_CORRELATION = 0,
     MEAN_SQUARES = 1
   };
+
+  /**\class PatchDistanceComputation
+   * \brief Strategy used to compute the distances between patches.
+   * \ingroup AdaptiveDenoising
+   */
+  enum class PatchDistanceComputation : uint8_t
+  {
+    DIRECT = 0,
+    INTEGRAL_IMAGE = 1
+  };
 };
 
 extern AdaptiveDenoising_EXPORT std::ostream &
 operator<<(std::ostream & out, const NonLocalPatchBasedImageFilterEnums::SimilarityMetric value);
+extern AdaptiveDenoising_EXPORT std::ostream &
+operator<<(std::ostream & out, const NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation value);
 
 
 /**
@@ -107,6 +119,7 @@ public:
   using NeighborhoodOffsetListType = std::vector<NeighborhoodOffsetType>;
 
   using SimilarityMetricEnum = NonLocalPatchBasedImageFilterEnums::SimilarityMetric;
+  using PatchDistanceComputationEnum = NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation;
 #if !defined(ITK_LEGACY_REMOVE)
   using SimilarityMetricType = SimilarityMetricEnum;
   static constexpr SimilarityMetricType PEARSON_CORRELATION = SimilarityMetricEnum::PEARSON_CORRELATION;
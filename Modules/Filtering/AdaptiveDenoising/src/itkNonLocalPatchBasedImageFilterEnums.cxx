@@ -39,4 +39,20 @@ operator<<(std::ostream & out, const NonLocalPatchBasedImageFilterEnums::Similar
   }();
 }
 
+std::ostream &
+operator<<(std::ostream & out, const NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation::DIRECT:
+        return "itk::NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation::DIRECT";
+      case NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation::INTEGRAL_IMAGE:
+        return "itk::NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation::INTEGRAL_IMAGE";
+      default:
+        return "INVALID VALUE FOR itk::NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation";
+    }
+  }();
+}
+
 } // end namespace itk
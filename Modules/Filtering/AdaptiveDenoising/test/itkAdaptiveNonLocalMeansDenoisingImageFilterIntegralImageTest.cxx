@@ -0,0 +1,132 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <set>
+#include "itkAdaptiveNonLocalMeansDenoisingImageFilter.h"
+
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkTestingMacros.h"
+#include "itkMath.h"
+
+namespace
+{
+
+// Denoise a noisy piecewise-constant image with direct and integral image
+// patch distances, and check that both computations agree.
+template <unsigned int VDimension>
+int
+CompareDirectAndIntegralImagePatchDistances(const typename itk::Image<float, VDimension>::SizeType & size,
+                                            bool useRicianNoiseModel)
+{
+  using ImageType = itk::Image<float, VDimension>;
+  using DenoiserType = itk::AdaptiveNonLocalMeansDenoisingImageFilter<ImageType, ImageType>;
+
+  auto random = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  random->SetSeed(1234);
+
+  auto image = ImageType::New();
+  image->SetRegions(size);
+  image->Allocate();
+  for (itk::ImageRegionIteratorWithIndex<ImageType> It(image, image->GetLargestPossibleRegion()); !It.IsAtEnd(); ++It)
+  {
+    const float value = (It.GetIndex()[0] < static_cast<itk::IndexValueType>(size[0] / 2)) ? 40.0f : 100.0f;
+    It.Set(value + static_cast<float>(random->GetNormalVariate(0.0, 25.0)));
+  }
+
+  typename DenoiserType::NeighborhoodRadiusType neighborhoodPatchRadius;
+  neighborhoodPatchRadius.Fill(1);
+  neighborhoodPatchRadius[0] = 2;
+  typename DenoiserType::NeighborhoodRadiusType neighborhoodSearchRadius;
+  neighborhoodSearchRadius.Fill(2);
+
+  typename ImageType::Pointer outputs[2];
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    auto filter = DenoiserType::New();
+    filter->SetInput(image);
+    filter->SetUseRicianNoiseModel(useRicianNoiseModel);
+    filter->SetNeighborhoodPatchRadius(neighborhoodPatchRadius);
+    filter->SetNeighborhoodSearchRadius(neighborhoodSearchRadius);
+    // Patches of neighboring voxels overlap, so a single work unit keeps
+    // the accumulated estimates reproducible.
+    filter->SetNumberOfWorkUnits(1);
+
+    const auto patchDistanceComputation =
+      (i == 0) ? DenoiserType::PatchDistanceComputationEnum::DIRECT
+               : DenoiserType::PatchDistanceComputationEnum::INTEGRAL_IMAGE;
+    filter->SetPatchDistanceComputation(patchDistanceComputation);
+    ITK_TEST_SET_GET_VALUE(patchDistanceComputation, filter->GetPatchDistanceComputation());
+
+    ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+    outputs[i] = filter->GetOutput();
+  }
+
+  constexpr float tolerance = 1e-3f;
+
+  itk::ImageRegionConstIterator<ImageType> ItD(outputs[0], outputs[0]->GetLargestPossibleRegion());
+  itk::ImageRegionConstIterator<ImageType> ItI(outputs[1], outputs[1]->GetLargestPossibleRegion());
+  for (; !ItD.IsAtEnd(); ++ItD, ++ItI)
+  {
+    if (!itk::Math::FloatAlmostEqual(ItD.Get(), ItI.Get(), 4, tolerance * std::max(1.0f, itk::Math::abs(ItD.Get()))))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Error in integral image patch distances at index " << ItD.GetIndex() << std::endl;
+      std::cerr << "Expected value " << ItD.Get() << std::endl;
+      std::cerr << " differs from " << ItI.Get() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int
+itkAdaptiveNonLocalMeansDenoisingImageFilterIntegralImageTest(int, char *[])
+{
+  int testStatus = EXIT_SUCCESS;
+
+  // The images are larger than a block, so several blocks are processed.
+  for (const bool useRicianNoiseModel : { false, true })
+  {
+    if (CompareDirectAndIntegralImagePatchDistances<2>({ { 90, 70 } }, useRicianNoiseModel) == EXIT_FAILURE)
+    {
+      testStatus = EXIT_FAILURE;
+    }
+    if (CompareDirectAndIntegralImagePatchDistances<3>({ { 24, 20, 16 } }, useRicianNoiseModel) == EXIT_FAILURE)
+    {
+      testStatus = EXIT_FAILURE;
+    }
+  }
+
+  // Test streaming enumeration for NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation elements
+  const std::set<itk::NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation> allPatchDistanceComputation{
+    itk::NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation::DIRECT,
+    itk::NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation::INTEGRAL_IMAGE
+  };
+  for (const auto & ee : allPatchDistanceComputation)
+  {
+    std::cout << "STREAMED ENUM VALUE NonLocalPatchBasedImageFilterEnums::PatchDistanceComputation: " << ee
+              << std::endl;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
@@ -37,6 +37,21 @@ namespace itk
  * convolution theorem to accelerate the convolution computation when
  * the kernel is large.
  *
+ * By default the output requested region, padded by the kernel radius
+ * and by the FFT size constraints, is transformed at once. When a
+ * BlockSize is set, the output requested region is instead split into
+ * blocks that are convolved independently with the overlap-save
+ * method: every block is padded by the kernel radius, transformed with
+ * an FFT of a common size, multiplied by a kernel spectrum computed
+ * only once, and transformed back. Blocks are processed in parallel and
+ * the memory footprint is bounded by the block size rather than by the
+ * size of the requested region.
+ *
+ * Small kernels are cheaper to apply in the spatial domain. When the
+ * number of pixels of the kernel is at most
+ * DirectConvolutionKernelPixelThreshold, the output is computed with
+ * ConvolutionImageFilter instead.
+ *
  * \warning This filter ignores the spacing, origin, and orientation
  * of the kernel image and treats them as identical to those in the
  * input image.
@@ -108,6 +123,26 @@ public:
   itkSetMacro(SizeGreatestPrimeFactor, SizeValueType);
   itkGetMacro(SizeGreatestPrimeFactor, SizeValueType);
 
+  /** Set/Get the size of the blocks in which the output requested
+   * region is convolved. A zero component means that blocks span the
+   * whole requested region along that dimension. The default, all
+   * zeros, convolves the requested region in a single FFT. Subclasses
+   * that override GenerateData() do not use this setting. */
+  /** @ITKStartGrouping */
+  itkSetMacro(BlockSize, OutputSizeType);
+  itkGetConstReferenceMacro(BlockSize, OutputSizeType);
+  /** @ITKEndGrouping */
+
+  /** Set/Get the largest number of kernel pixels for which the
+   * convolution is computed in the spatial domain with
+   * ConvolutionImageFilter. Defaults to 0, which always uses the FFT.
+   * Subclasses that override GenerateData() do not use this
+   * setting. */
+  /** @ITKStartGrouping */
+  itkSetMacro(DirectConvolutionKernelPixelThreshold, SizeValueType);
+  itkGetConstMacro(DirectConvolutionKernelPixelThreshold, SizeValueType);
+  /** @ITKEndGrouping */
+
 protected:
   FFTConvolutionImageFilter();
   ~FFTConvolutionImageFilter() override = default;
@@ -130,6 +165,14 @@ protected:
   void
   GenerateData() override;
 
+  /** Compute the output with ConvolutionImageFilter. */
+  void
+  DirectGenerateData();
+
+  /** Compute the output block by block with the overlap-save method. */
+  void
+  BlockGenerateData();
+
   /** Prepare the input images for operations in the Fourier
    * domain. This includes resizing the input and kernel images,
    * normalizing the kernel if requested, shifting the kernel, and
@@ -204,6 +247,8 @@ protected:
 
 private:
   SizeValueType      m_SizeGreatestPrimeFactor{};
+  OutputSizeType     m_BlockSize{ { 0 } };
+  SizeValueType      m_DirectConvolutionKernelPixelThreshold{ 0 };
   InternalSizeType   m_FFTPadSize{ { 0 } };
   InternalRegionType m_PaddedInputRegion{};
 };
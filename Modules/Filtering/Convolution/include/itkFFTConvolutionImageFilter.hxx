@@ -22,13 +22,17 @@
 #include "itkCastImageFilter.h"
 #include "itkChangeInformationImageFilter.h"
 #include "itkConstantPadImageFilter.h"
+#include "itkConvolutionImageFilter.h"
 #include "itkCyclicShiftImageFilter.h"
 #include "itkExtractImageFilter.h"
 #include "itkFFTPadImageFilter.h"
+#include "itkImageAlgorithm.h"
 #include "itkImageBase.h"
+#include "itkImageRegionIteratorWithIndex.h"
 #include "itkMultiplyImageFilter.h"
 #include "itkNormalizeToConstantImageFilter.h"
 #include "itkMath.h"
+#include "itkProgressTransformer.h"
 #include "itkRegionOfInterestImageFilter.h"
 
 namespace itk
@@ -81,6 +85,21 @@ template <typename TInputImage, typename TKernelImage, typename TOutputImage, ty
 void
 FFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::GenerateData()
 {
+  if (this->GetKernelImage()->GetLargestPossibleRegion().GetNumberOfPixels() <=
+      m_DirectConvolutionKernelPixelThreshold)
+  {
+    this->DirectGenerateData();
+    return;
+  }
+  for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+  {
+    if (m_BlockSize[dim] > 0)
+    {
+      this->BlockGenerateData();
+      return;
+    }
+  }
+
   // Create a process accumulator for tracking the progress of this minipipeline
   auto progress = ProgressAccumulator::New();
   progress->SetMiniPipelineFilter(this);
@@ -111,6 +130,181 @@ FFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrec
   this->ProduceOutput(multiplyFilter->GetOutput(), progress, 0.2);
 }
 
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+void
+FFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::DirectGenerateData()
+{
+  auto progress = ProgressAccumulator::New();
+  progress->SetMiniPipelineFilter(this);
+
+  auto localInput = InputImageType::New();
+  localInput->Graft(this->GetInput());
+
+  using DirectFilterType = ConvolutionImageFilter<InputImageType, KernelImageType, OutputImageType>;
+  auto directFilter = DirectFilterType::New();
+  directFilter->SetInput(localInput);
+  directFilter->SetKernelImage(this->GetKernelImage());
+  directFilter->SetNormalize(this->GetNormalize());
+  directFilter->SetBoundaryCondition(this->GetBoundaryCondition());
+  directFilter->SetOutputRegionMode(this->GetOutputRegionMode());
+  directFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  progress->RegisterInternalFilter(directFilter, 1.0f);
+
+  directFilter->GraftOutput(this->GetOutput());
+  directFilter->Update();
+  this->GraftOutput(directFilter->GetOutput());
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+void
+FFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::BlockGenerateData()
+{
+  const InputImageType * input = this->GetInput();
+  OutputImageType *      output = this->GetOutput();
+
+  this->AllocateOutputs();
+
+  const OutputRegionType outputRegion = output->GetRequestedRegion();
+  if (outputRegion.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+
+  // All blocks are transformed with an FFT of the same size, large
+  // enough to hold the biggest block padded by the kernel radius, so
+  // that the kernel spectrum is computed only once.
+  const KernelSizeType kernelRadius = this->GetKernelRadius();
+  OutputSizeType       blockSize;
+  OutputSizeType       numberOfBlocksPerDimension;
+  InternalSizeType     fftSize;
+  SizeValueType        numberOfBlocks = 1;
+  for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+  {
+    const SizeValueType requestedSize = outputRegion.GetSize(dim);
+    blockSize[dim] = (m_BlockSize[dim] > 0) ? std::min(m_BlockSize[dim], requestedSize) : requestedSize;
+    numberOfBlocksPerDimension[dim] = (requestedSize + blockSize[dim] - 1) / blockSize[dim];
+    numberOfBlocks *= numberOfBlocksPerDimension[dim];
+
+    fftSize[dim] = blockSize[dim] + 2 * kernelRadius[dim];
+    if (m_SizeGreatestPrimeFactor > 1)
+    {
+      while (Math::GreatestPrimeFactor(fftSize[dim]) > m_SizeGreatestPrimeFactor)
+      {
+        ++fftSize[dim];
+      }
+    }
+    else if (m_SizeGreatestPrimeFactor == 1)
+    {
+      // make sure the total size is even
+      fftSize[dim] += fftSize[dim] % 2;
+    }
+  }
+
+  auto progress = ProgressAccumulator::New();
+  progress->SetMiniPipelineFilter(this);
+
+  m_PaddedInputRegion = InternalRegionType(fftSize);
+  InternalComplexImagePointerType kernelSpectrum = nullptr;
+  this->PrepareKernel(this->GetKernelImage(), kernelSpectrum, progress, 0.1f);
+
+  // Blocks are distributed in contiguous chunks, one per work unit, so
+  // that each chunk reuses a single block buffer and pair of FFT filters.
+  const SizeValueType numberOfChunks = std::min<SizeValueType>(this->GetNumberOfWorkUnits(), numberOfBlocks);
+  const ThreadIdType  fftNumberOfWorkUnits = (numberOfChunks == 1) ? this->GetNumberOfWorkUnits() : 1;
+
+  const BoundaryConditionType * boundaryCondition = this->GetBoundaryCondition();
+  const InputRegionType         bufferedInputRegion = input->GetBufferedRegion();
+
+  const auto convolveChunk = [&](SizeValueType chunk) {
+    auto block = InternalImageType::New();
+    block->SetRegions(InternalRegionType(fftSize));
+    block->Allocate();
+
+    auto fftFilter = FFTFilterType::New();
+    fftFilter->SetNumberOfWorkUnits(fftNumberOfWorkUnits);
+    fftFilter->SetInput(block);
+
+    auto ifftFilter = IFFTFilterType::New();
+    ifftFilter->SetActualXDimensionIsOdd(fftSize[0] % 2 != 0);
+    ifftFilter->SetNumberOfWorkUnits(fftNumberOfWorkUnits);
+    ifftFilter->SetInput(fftFilter->GetOutput());
+
+    const SizeValueType firstBlock = chunk * numberOfBlocks / numberOfChunks;
+    const SizeValueType lastBlockPlus1 = (chunk + 1) * numberOfBlocks / numberOfChunks;
+    for (SizeValueType blockNumber = firstBlock; blockNumber < lastBlockPlus1; ++blockNumber)
+    {
+      // Locate the block in the output requested region.
+      OutputRegionType blockRegion;
+      SizeValueType    remainder = blockNumber;
+      for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+      {
+        const SizeValueType position = remainder % numberOfBlocksPerDimension[dim];
+        remainder /= numberOfBlocksPerDimension[dim];
+
+        const IndexValueType start = outputRegion.GetIndex(dim) + static_cast<IndexValueType>(position * blockSize[dim]);
+        const auto           remaining = static_cast<SizeValueType>(outputRegion.GetUpperIndex()[dim] + 1 - start);
+        blockRegion.SetIndex(dim, start);
+        blockRegion.SetSize(dim, std::min(blockSize[dim], remaining));
+      }
+
+      // Fill the block buffer with the input block padded by the kernel
+      // radius. Values beyond the padded block do not contribute to the
+      // output pixels of the block, so they are left at zero.
+      InputRegionType paddedBlockRegion = blockRegion;
+      paddedBlockRegion.PadByRadius(kernelRadius);
+      const InternalRegionType dataRegion(paddedBlockRegion.GetSize());
+
+      block->FillBuffer(TInternalPrecision{});
+      if (bufferedInputRegion.IsInside(paddedBlockRegion))
+      {
+        ImageAlgorithm::Copy(input, block.GetPointer(), paddedBlockRegion, dataRegion);
+      }
+      else
+      {
+        for (ImageRegionIteratorWithIndex<InternalImageType> it(block, dataRegion); !it.IsAtEnd(); ++it)
+        {
+          InputIndexType index;
+          for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+          {
+            index[dim] = paddedBlockRegion.GetIndex(dim) + it.GetIndex()[dim];
+          }
+          it.Set(static_cast<TInternalPrecision>(bufferedInputRegion.IsInside(index)
+                                                   ? input->GetPixel(index)
+                                                   : boundaryCondition->GetPixel(index, input)));
+        }
+      }
+      block->Modified();
+      fftFilter->Update();
+
+      // Multiply by the kernel spectrum in place.
+      InternalComplexImageType *  blockSpectrum = fftFilter->GetOutput();
+      InternalComplexType *       value = blockSpectrum->GetBufferPointer();
+      const InternalComplexType * kernelValue = kernelSpectrum->GetBufferPointer();
+      const SizeValueType         numberOfValues = blockSpectrum->GetBufferedRegion().GetNumberOfPixels();
+      for (SizeValueType i = 0; i < numberOfValues; ++i)
+      {
+        value[i] *= kernelValue[i];
+      }
+      ifftFilter->Update();
+
+      // The block output lies one kernel radius away from the origin of
+      // the circular convolution result.
+      InternalIndexType validIndex;
+      for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+      {
+        validIndex[dim] = static_cast<IndexValueType>(kernelRadius[dim]);
+      }
+      ImageAlgorithm::Copy(
+        ifftFilter->GetOutput(), output, InternalRegionType(validIndex, blockRegion.GetSize()), blockRegion);
+    }
+  };
+
+  ProgressTransformer progressTransformer(0.1f, 1.0f, this);
+  MultiThreaderBase * multiThreader = this->GetMultiThreader();
+  multiThreader->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  multiThreader->ParallelizeArray(0, numberOfChunks, convolveChunk, progressTransformer.GetProcessObject());
+}
+
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
 void
 FFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::PrepareInputs(
@@ -515,6 +709,8 @@ FFTConvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrec
 {
   Superclass::PrintSelf(os, indent);
   os << indent << "SizeGreatestPrimeFactor: " << m_SizeGreatestPrimeFactor << std::endl;
+  os << indent << "BlockSize: " << m_BlockSize << std::endl;
+  os << indent << "DirectConvolutionKernelPixelThreshold: " << m_DirectConvolutionKernelPixelThreshold << std::endl;
 }
 
 } // namespace itk
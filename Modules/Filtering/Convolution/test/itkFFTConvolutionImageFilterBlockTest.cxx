@@ -0,0 +1,146 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkConvolutionImageFilter.h"
+#include "itkFFTConvolutionImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIterator.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int Dimension = 2;
+using ImageType = itk::Image<float, Dimension>;
+
+ImageType::Pointer
+MakeRandomImage(const ImageType::SizeType & size, itk::Statistics::MersenneTwisterRandomVariateGenerator * random)
+{
+  auto image = ImageType::New();
+  image->SetRegions(size);
+  image->Allocate();
+  for (itk::ImageRegionIterator<ImageType> it(image, image->GetLargestPossibleRegion()); !it.IsAtEnd(); ++it)
+  {
+    it.Set(static_cast<float>(random->GetUniformVariate(-1.0, 1.0)));
+  }
+  return image;
+}
+
+bool
+CompareImages(const ImageType * expected, const ImageType * actual, const ImageType::RegionType & region)
+{
+  constexpr double tolerance = 1e-3;
+
+  itk::ImageRegionConstIterator<ImageType> expectedIt(expected, region);
+  itk::ImageRegionConstIterator<ImageType> actualIt(actual, region);
+  for (; !expectedIt.IsAtEnd(); ++expectedIt, ++actualIt)
+  {
+    if (itk::Math::abs(expectedIt.Get() - actualIt.Get()) > tolerance)
+    {
+      std::cerr << "Mismatch at index " << expectedIt.GetIndex() << ": expected " << expectedIt.Get() << ", got "
+                << actualIt.Get() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int
+itkFFTConvolutionImageFilterBlockTest(int, char *[])
+{
+  auto random = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  random->SetSeed(42);
+
+  // Use an even kernel dimension and an image size that is not a multiple
+  // of the block size to exercise the partial blocks.
+  const ImageType::Pointer input = MakeRandomImage({ { 61, 47 } }, random);
+  const ImageType::Pointer kernel = MakeRandomImage({ { 7, 6 } }, random);
+
+  using DirectFilterType = itk::ConvolutionImageFilter<ImageType>;
+  using FFTFilterType = itk::FFTConvolutionImageFilter<ImageType>;
+
+  int testStatus = EXIT_SUCCESS;
+  for (const bool normalize : { false, true })
+  {
+    auto reference = DirectFilterType::New();
+    reference->SetInput(input);
+    reference->SetKernelImage(kernel);
+    reference->SetNormalize(normalize);
+    ITK_TRY_EXPECT_NO_EXCEPTION(reference->Update());
+
+    auto convolver = FFTFilterType::New();
+
+    ITK_EXERCISE_BASIC_OBJECT_METHODS(convolver, FFTConvolutionImageFilter, ConvolutionImageFilterBase);
+
+    convolver->SetInput(input);
+    convolver->SetKernelImage(kernel);
+    convolver->SetNormalize(normalize);
+
+    const FFTFilterType::OutputSizeType blockSize{ { 16, 10 } };
+    convolver->SetBlockSize(blockSize);
+    ITK_TEST_SET_GET_VALUE(blockSize, convolver->GetBlockSize());
+
+    // Convolve the whole image block by block.
+    ITK_TRY_EXPECT_NO_EXCEPTION(convolver->Update());
+    if (!CompareImages(reference->GetOutput(), convolver->GetOutput(), input->GetLargestPossibleRegion()))
+    {
+      std::cerr << "Test failed: block convolution of the whole image differs from the direct convolution."
+                << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+
+    // Convolve a requested region touching a single image boundary.
+    const ImageType::RegionType subregion({ { 20, 30 } }, { { 35, 17 } });
+    convolver->Modified();
+    convolver->GetOutput()->SetRequestedRegion(subregion);
+    ITK_TRY_EXPECT_NO_EXCEPTION(convolver->Update());
+    if (!CompareImages(reference->GetOutput(), convolver->GetOutput(), subregion))
+    {
+      std::cerr << "Test failed: block convolution of a subregion differs from the direct convolution." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+
+    // A zero component lets the blocks span the requested region along that
+    // dimension, and a single thread processes all blocks in sequence.
+    convolver->SetBlockSize({ { 0, 8 } });
+    convolver->SetNumberOfWorkUnits(1);
+    convolver->GetOutput()->SetRequestedRegionToLargestPossibleRegion();
+    ITK_TRY_EXPECT_NO_EXCEPTION(convolver->Update());
+    if (!CompareImages(reference->GetOutput(), convolver->GetOutput(), input->GetLargestPossibleRegion()))
+    {
+      std::cerr << "Test failed: single-threaded block convolution differs from the direct convolution." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+
+    // Small kernels are convolved in the spatial domain.
+    convolver->SetBlockSize(FFTFilterType::OutputSizeType::Filled(0));
+    const FFTFilterType::SizeValueType threshold = kernel->GetLargestPossibleRegion().GetNumberOfPixels();
+    convolver->SetDirectConvolutionKernelPixelThreshold(threshold);
+    ITK_TEST_SET_GET_VALUE(threshold, convolver->GetDirectConvolutionKernelPixelThreshold());
+    ITK_TRY_EXPECT_NO_EXCEPTION(convolver->Update());
+    if (!CompareImages(reference->GetOutput(), convolver->GetOutput(), input->GetLargestPossibleRegion()))
+    {
+      std::cerr << "Test failed: direct convolution mode differs from the direct convolution." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
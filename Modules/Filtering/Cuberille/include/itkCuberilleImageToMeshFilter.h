@@ -34,6 +34,7 @@
 
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 namespace itk
 {
@@ -92,6 +93,11 @@ namespace itk
  * (Optional) ProjectVertexMaximumNumberOfSteps: specifies the maximum number
  * of steps used during vertex projection. The default value is 50.
  *
+ * \par Multithreading
+ * The image is divided into slabs of z slices, and the surface of each slab
+ * is extracted and projected by a separate work unit. The slabs are stitched
+ * in order, so the output mesh does not depend on the number of work units.
+ *
  * \par References
  * [1] G. Herman and H. Liu, "Three-dimensional Display of Human organs
  *     from Computed Tomograms", Computer Graphics and Images Processing,
@@ -398,15 +404,44 @@ private:
 
   /** Project vertex to the iso-surface by stepping along normal. */
   inline void
-  ProjectVertexToIsoSurface(PointType & vertex);
-
-  /** Add a vertex to the given mesh. Increments point identifier. */
-  inline PointVectorType
-  AddVertex(PointIdentifier &      id,
-            IndexType              index,
-            const InputImageType * image,
-            OutputMeshType *       mesh,
-            const size_t           numComponents);
+  ProjectVertexToIsoSurface(PointType & vertex) const;
+
+  /** Vertices and faces extracted from a slab of z slices. Point
+   * identifiers are local to the slab until the slabs are stitched. */
+  struct SlabSurface
+  {
+    /** Grid index and first local point identifier of each vertex. A vertex
+     * has one point per connected component of its 2x2x2 neighborhood. */
+    std::vector<IndexType>       m_VertexIndices;
+    std::vector<PointIdentifier> m_VertexFirstPointIds;
+    PointIdentifier              m_NumberOfPoints{ 0 };
+    IndexValueType               m_FirstSlice{ 0 };
+
+    /** Quadrilateral faces and the pixel value of the voxel they bound. */
+    std::vector<std::array<PointIdentifier, 4>> m_Faces;
+    std::vector<InputPixelType>                 m_FacePixels;
+
+    /** Global point identifier of each local point, and whether a vertex was
+     * already created by the previous slab. */
+    std::vector<PointIdentifier> m_PointIds;
+    std::vector<bool>            m_VertexIsShared;
+  };
+
+  /** Extract the vertices and faces of the surface voxels in the given
+   * region. Vertices are numbered in the order they are first used, as in a
+   * sequential scan of the image. */
+  void
+  ExtractSlabSurface(const typename InputImageType::RegionType & region, SlabSurface & slab);
+
+  /** Number the points of each slab consecutively, reusing the points the
+   * previous slab created on the first z plane of a slab. This reproduces
+   * the numbering of a single sequential scan. */
+  static PointIdentifier
+  StitchSlabSurfaces(std::vector<SlabSurface> & slabs);
+
+  /** Compute the position of the vertex at the given grid index. */
+  inline PointType
+  ComputeVertex(const IndexType & index, const InputImageType * image);
 
   /** Add quadrilateral face to the given mesh. Increments cell identifier. */
   inline void
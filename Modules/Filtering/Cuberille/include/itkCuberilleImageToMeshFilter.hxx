@@ -25,6 +25,7 @@
 #include <array>
 #include <utility>
 #include <bitset>
+#include <map>
 #include "itkPrintHelper.h"
 
 namespace itk
@@ -81,19 +82,91 @@ CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::GenerateDat
   // Create interpolator for gradient image
   ComputeGradientImage();
 
+  // Divide the image into slabs of z slices
+  const typename InputImageType::RegionType region = image->GetBufferedRegion();
+  const SizeValueType                       numberOfSlices = region.GetSize(2);
+  const SizeValueType                       numberOfSlabs =
+    std::max(SizeValueType{ 1 }, std::min(SizeValueType{ this->GetNumberOfWorkUnits() }, numberOfSlices));
+  std::vector<SlabSurface> slabs(numberOfSlabs);
+
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+
+  // Extract the surface of each slab
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    numberOfSlabs,
+    [this, &region, numberOfSlices, numberOfSlabs, &slabs](SizeValueType s) {
+      typename InputImageType::RegionType slabRegion = region;
+      const SizeValueType                 first = s * numberOfSlices / numberOfSlabs;
+      slabRegion.SetIndex(2, region.GetIndex(2) + static_cast<IndexValueType>(first));
+      slabRegion.SetSize(2, (s + 1) * numberOfSlices / numberOfSlabs - first);
+      slabs[s].m_FirstSlice = slabRegion.GetIndex(2);
+      this->ExtractSlabSurface(slabRegion, slabs[s]);
+    },
+    nullptr);
+
+  // Number the points of all slabs
+  const PointIdentifier numberOfPoints = StitchSlabSurfaces(slabs);
+
+  // Compute (and project) the vertices created by each slab
+  std::vector<PointType> points(numberOfPoints);
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    numberOfSlabs,
+    [this, &image, &slabs, &points](SizeValueType s) {
+      const SlabSurface & slab = slabs[s];
+      for (size_t i = 0; i < slab.m_VertexIndices.size(); ++i)
+      {
+        if (slab.m_VertexIsShared[i])
+        {
+          continue;
+        }
+        const PointType       vertex = this->ComputeVertex(slab.m_VertexIndices[i], image);
+        const PointIdentifier last =
+          (i + 1 < slab.m_VertexIndices.size()) ? slab.m_VertexFirstPointIds[i + 1] : slab.m_NumberOfPoints;
+        for (PointIdentifier id = slab.m_VertexFirstPointIds[i]; id < last; ++id)
+        {
+          points[slab.m_PointIds[id]] = vertex;
+        }
+      }
+    },
+    nullptr);
+
+  for (PointIdentifier id = 0; id < numberOfPoints; ++id)
+  {
+    mesh->GetPoints()->InsertElement(id, points[id]);
+  }
+
+  // Create the faces, in the order of the voxels they bound
+  CellIdentifier                 nextCellId = 0;
+  std::array<PointIdentifier, 4> f;
+  for (const SlabSurface & slab : slabs)
+  {
+    for (size_t i = 0; i < slab.m_Faces.size(); ++i)
+    {
+      for (unsigned int j = 0; j < 4; ++j)
+      {
+        f[j] = slab.m_PointIds[slab.m_Faces[i][j]];
+      }
+      AddQuadFace(nextCellId, f, mesh, slab.m_FacePixels[i]);
+    }
+  }
+}
+
+template <typename TInputImage, typename TOutputMesh, typename TInterpolator>
+void
+CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::ExtractSlabSurface(
+  const typename InputImageType::RegionType & region,
+  SlabSurface &                               slab)
+{
+  const InputImageType * image = this->GetInput();
+
   // Set up iterator
   typename InputImageIteratorType::SizeType radius;
   radius.Fill(1);
-  InputImageIteratorType it(radius, image, image->GetBufferedRegion());
+  InputImageIteratorType it(radius, image, region);
   setConnectivity<InputImageIteratorType>(&it, false); // Set face connectivity
 
-  // TODO: Estimate number of vertices/faces for which to reserve
-  // TODO: There is an issue with quad edge mesh related to reserving, see
-  // https://www.itk.org/mailman/private/insight-developers/2010-June/014653.html
-  // SizeType size = image->GetLargestPossibleRegion().GetSize();
-  // mesh->GetPoints()->Reserve( (size[0]*size[1]*size[2]) / 200 );
-  // mesh->GetCells()->Reserve( (size[0]*size[1]*size[2]) / 100 );
-
   // Set up helper structures
   unsigned int                                               look0 = 1;
   unsigned int                                               look1 = 0;
@@ -102,8 +175,6 @@ CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::GenerateDat
   std::array<bool, 8>                                        vertexHasQuad;
   std::array<PointIdentifier, 8>                             v;
   std::array<PointIdentifier, 4>                             f;
-  PointIdentifier                                            nextVertexId = 0;
-  CellIdentifier                                             nextCellId = 0;
   IndexType                                                  index;
   typename IndexType::IndexValueType                         lastZ = -1;
   InputPixelType                                             center = 0;
@@ -190,68 +261,118 @@ CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::GenerateDat
         if (!lookup[look].GetVertex(vindex[0], vindex[1], vindex[2], component, v[i]))
         {
           // Vertex was not in lookup, create and add to lookup
-          v[i] = nextVertexId;
-          const auto numComponents = (*std::max_element(components.begin(), components.end())) + 1;
-          const auto pv = AddVertex(nextVertexId, vindex, image, mesh, numComponents);
+          v[i] = slab.m_NumberOfPoints + component;
+          const auto      numComponents = (*std::max_element(components.begin(), components.end())) + 1;
+          PointVectorType pv;
+          for (int c = 0; c < numComponents; ++c)
+          {
+            pv.push_back(slab.m_NumberOfPoints + c);
+          }
+          slab.m_VertexIndices.push_back(vindex);
+          slab.m_VertexFirstPointIds.push_back(slab.m_NumberOfPoints);
+          slab.m_NumberOfPoints += numComponents;
           lookup[look].AddVertex(vindex[0], vindex[1], vindex[2], pv);
         }
 
       } // end foreach vertex
 
       // Create faces
+      const auto addFace = [&slab, &v, &f, center](unsigned int a, unsigned int b, unsigned int c, unsigned int d) {
+        f[0] = v[a];
+        f[1] = v[b];
+        f[2] = v[c];
+        f[3] = v[d];
+        slab.m_Faces.push_back(f);
+        slab.m_FacePixels.push_back(center);
+      };
       if (faceHasQuad[0])
       {
-        f[0] = v[0];
-        f[1] = v[4];
-        f[2] = v[7];
-        f[3] = v[3];
-        AddQuadFace(nextCellId, f, mesh, center);
+        addFace(0, 4, 7, 3);
       }
       if (faceHasQuad[1])
       {
-        f[0] = v[0];
-        f[1] = v[1];
-        f[2] = v[5];
-        f[3] = v[4];
-        AddQuadFace(nextCellId, f, mesh, center);
+        addFace(0, 1, 5, 4);
       }
       if (faceHasQuad[2])
       {
-        f[0] = v[1];
-        f[1] = v[2];
-        f[2] = v[6];
-        f[3] = v[5];
-        AddQuadFace(nextCellId, f, mesh, center);
+        addFace(1, 2, 6, 5);
       }
       if (faceHasQuad[3])
       {
-        f[0] = v[2];
-        f[1] = v[3];
-        f[2] = v[7];
-        f[3] = v[6];
-        AddQuadFace(nextCellId, f, mesh, center);
+        addFace(2, 3, 7, 6);
       }
       if (faceHasQuad[4])
       {
-        f[0] = v[0];
-        f[1] = v[3];
-        f[2] = v[2];
-        f[3] = v[1];
-        AddQuadFace(nextCellId, f, mesh, center);
+        addFace(0, 3, 2, 1);
       }
       if (faceHasQuad[5])
       {
-        f[0] = v[4];
-        f[1] = v[5];
-        f[2] = v[6];
-        f[3] = v[7];
-        AddQuadFace(nextCellId, f, mesh, center);
+        addFace(4, 5, 6, 7);
       }
 
     } // end if num faces > 0
   }
 }
 
+template <typename TInputImage, typename TOutputMesh, typename TInterpolator>
+auto
+CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::StitchSlabSurfaces(
+  std::vector<SlabSurface> & slabs) -> PointIdentifier
+{
+  PointIdentifier nextVertexId = 0;
+  for (size_t s = 0; s < slabs.size(); ++s)
+  {
+    SlabSurface & slab = slabs[s];
+    slab.m_PointIds.resize(slab.m_NumberOfPoints);
+    slab.m_VertexIsShared.assign(slab.m_VertexIndices.size(), false);
+
+    // The vertices of the previous slab on the first plane of this slab
+    std::map<std::pair<IndexValueType, IndexValueType>, size_t> previousPlane;
+    if (s > 0)
+    {
+      const SlabSurface & previous = slabs[s - 1];
+      for (size_t i = 0; i < previous.m_VertexIndices.size(); ++i)
+      {
+        const IndexType & vindex = previous.m_VertexIndices[i];
+        if (vindex[2] == slab.m_FirstSlice)
+        {
+          previousPlane.emplace(std::make_pair(vindex[0], vindex[1]), i);
+        }
+      }
+    }
+
+    for (size_t i = 0; i < slab.m_VertexIndices.size(); ++i)
+    {
+      const IndexType &     vindex = slab.m_VertexIndices[i];
+      const PointIdentifier first = slab.m_VertexFirstPointIds[i];
+      const PointIdentifier last =
+        (i + 1 < slab.m_VertexIndices.size()) ? slab.m_VertexFirstPointIds[i + 1] : slab.m_NumberOfPoints;
+
+      const auto found = (vindex[2] == slab.m_FirstSlice) ? previousPlane.find(std::make_pair(vindex[0], vindex[1]))
+                                                          : previousPlane.end();
+      if (found != previousPlane.end())
+      {
+        // Reuse the points of the previous slab
+        const SlabSurface & previous = slabs[s - 1];
+        const PointIdentifier previousFirst = previous.m_VertexFirstPointIds[found->second];
+        for (PointIdentifier id = first; id < last; ++id)
+        {
+          slab.m_PointIds[id] = previous.m_PointIds[previousFirst + id - first];
+        }
+        slab.m_VertexIsShared[i] = true;
+      }
+      else
+      {
+        for (PointIdentifier id = first; id < last; ++id)
+        {
+          slab.m_PointIds[id] = nextVertexId++;
+        }
+      }
+    }
+  }
+  return nextVertexId;
+}
+
 template <typename TInputImage, typename TOutputMesh, typename TInterpolator>
 void
 CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::SetVerticesFromFace(unsigned int          face,
@@ -340,13 +461,10 @@ CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::GetVertexLo
 }
 
 template <typename TInputImage, typename TOutputMesh, typename TInterpolator>
-typename CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::PointVectorType
-CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::AddVertex(
-  typename TOutputMesh::PointIdentifier & id,
-  typename TInputImage::IndexType         index,
-  const TInputImage *                     image,
-  TOutputMesh *                           mesh,
-  const size_t                            numComponents)
+auto
+CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::ComputeVertex(const IndexType &      index,
+                                                                                   const InputImageType * image)
+  -> PointType
 {
   PointType vertex;
   image->TransformIndexToPhysicalPoint(index, vertex);
@@ -358,13 +476,7 @@ CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::AddVertex(
   {
     ProjectVertexToIsoSurface(vertex);
   }
-  PointVectorType pointIDVector;
-  for (size_t i = 0; i < numComponents; ++i)
-  {
-    pointIDVector.push_back(id);
-    mesh->GetPoints()->InsertElement(id++, vertex);
-  }
-  return pointIDVector;
+  return vertex;
 }
 
 template <typename TInputImage, typename TOutputMesh, typename TInterpolator>
@@ -442,7 +554,7 @@ CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::AddQuadFace
 
 template <typename TInputImage, typename TOutputMesh, typename TInterpolator>
 void
-CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::ProjectVertexToIsoSurface(PointType & vertex)
+CuberilleImageToMeshFilter<TInputImage, TOutputMesh, TInterpolator>::ProjectVertexToIsoSurface(PointType & vertex) const
 {
   if constexpr (UseAdvancedProjection)
   {
@@ -0,0 +1,137 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <itkTestingMacros.h>
+#include <itkImage.h>
+#include <itkImageRegionIteratorWithIndex.h>
+#include <itkMersenneTwisterRandomVariateGenerator.h>
+#include <itkMesh.h>
+#include <itkCuberilleImageToMeshFilter.h>
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+using TPixel = unsigned char;
+using TCoordinate = double;
+using TImage = itk::Image<TPixel, Dimension>;
+using TMesh = itk::Mesh<TCoordinate, Dimension>;
+using TExtract = itk::CuberilleImageToMeshFilter<TImage, TMesh>;
+
+// Two overlapping balls and scattered voxels, which create vertices with
+// several connected components.
+TImage::Pointer
+CuberilleTestCreateImage()
+{
+  const auto image = TImage::New();
+  image->SetRegions(TImage::SizeType{ { 24, 20, 30 } });
+  image->Allocate();
+
+  const auto random = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  random->SetSeed(1234);
+
+  for (itk::ImageRegionIteratorWithIndex<TImage> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    const TImage::IndexType index = it.GetIndex();
+    TPixel                  value = 0;
+    for (const auto & center : { TImage::IndexType{ { 10, 9, 11 } }, TImage::IndexType{ { 14, 11, 18 } } })
+    {
+      const double dx = index[0] - center[0];
+      const double dy = index[1] - center[1];
+      const double dz = index[2] - center[2];
+      if (dx * dx + dy * dy + dz * dz < 36.0)
+      {
+        value = 200;
+      }
+    }
+    const bool interior = index[0] > 0 && index[0] < 23 && index[1] > 0 && index[1] < 19 && index[2] > 0 && index[2] < 29;
+    if (interior && random->GetUniformVariate(0.0, 1.0) < 0.15)
+    {
+      value = 100;
+    }
+    it.Set(value);
+  }
+  return image;
+}
+
+TMesh::Pointer
+CuberilleTestExtract(const TImage * image, bool generateTriangleFaces, itk::ThreadIdType numberOfWorkUnits)
+{
+  const auto extract = TExtract::New();
+  extract->SetInput(image);
+  extract->SetIsoSurfaceValue(100);
+  extract->SetGenerateTriangleFaces(generateTriangleFaces);
+  extract->ProjectVerticesToIsoSurfaceOn();
+  extract->SavePixelAsCellDataOn();
+  extract->SetNumberOfWorkUnits(numberOfWorkUnits);
+  extract->Update();
+  return extract->GetOutput();
+}
+} // namespace
+
+int
+CuberilleTest05(int itkNotUsed(argc), char * itkNotUsed(argv)[])
+{
+  const auto image = CuberilleTestCreateImage();
+
+  for (const bool generateTriangleFaces : { false, true })
+  {
+    const auto reference = CuberilleTestExtract(image, generateTriangleFaces, 1);
+    std::cout << "Points: " << reference->GetNumberOfPoints() << ", cells: " << reference->GetNumberOfCells()
+              << std::endl;
+    ITK_TEST_EXPECT_TRUE(reference->GetNumberOfCells() > 0);
+
+    // More work units than slices are clamped to one slice per slab
+    for (const itk::ThreadIdType numberOfWorkUnits : { 2, 3, 7, 64 })
+    {
+      const auto mesh = CuberilleTestExtract(image, generateTriangleFaces, numberOfWorkUnits);
+
+      ITK_TEST_EXPECT_EQUAL(mesh->GetNumberOfPoints(), reference->GetNumberOfPoints());
+      for (TMesh::PointIdentifier id = 0; id < reference->GetNumberOfPoints(); ++id)
+      {
+        if (mesh->GetPoint(id) != reference->GetPoint(id))
+        {
+          std::cerr << "Test failed!" << std::endl;
+          std::cerr << "Point " << id << " with " << numberOfWorkUnits << " work units is " << mesh->GetPoint(id)
+                    << " instead of " << reference->GetPoint(id) << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+
+      ITK_TEST_EXPECT_EQUAL(mesh->GetNumberOfCells(), reference->GetNumberOfCells());
+      ITK_TEST_EXPECT_EQUAL(mesh->GetCellData()->Size(), reference->GetCellData()->Size());
+      for (TMesh::CellIdentifier id = 0; id < reference->GetNumberOfCells(); ++id)
+      {
+        TMesh::CellAutoPointer cell;
+        TMesh::CellAutoPointer referenceCell;
+        mesh->GetCell(id, cell);
+        reference->GetCell(id, referenceCell);
+        if (cell->GetNumberOfPoints() != referenceCell->GetNumberOfPoints() ||
+            !std::equal(referenceCell->PointIdsBegin(), referenceCell->PointIdsEnd(), cell->PointIdsBegin()) ||
+            mesh->GetCellData()->GetElement(id) != reference->GetCellData()->GetElement(id))
+        {
+          std::cerr << "Test failed!" << std::endl;
+          std::cerr << "Cell " << id << " with " << numberOfWorkUnits << " work units differs" << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
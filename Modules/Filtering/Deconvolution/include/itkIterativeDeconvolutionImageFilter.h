@@ -21,6 +21,8 @@
 #include "itkFFTConvolutionImageFilter.h"
 #include "itkProgressAccumulator.h"
 
+#include <functional>
+
 namespace itk
 {
 /**
@@ -40,6 +42,19 @@ namespace itk
  * resume iterating, you must call SetStopIteration( bool ) with the
  * argument set to false before calling Update() a second time.
  *
+ * Subclasses compute their iterations with resident forward and
+ * inverse FFT filters, see ForwardTransform() and InverseTransform(),
+ * whose buffers are reused across iterations, and with fused
+ * element-wise passes, see ParallelizeBuffer(). No image is allocated
+ * after the first iteration.
+ *
+ * The iterations can optionally be accelerated with the vector
+ * extrapolation method of Biggs and Andrews (Applied Optics 36(8),
+ * 1997). Each iteration is then applied to a prediction extrapolated
+ * from the two previous estimates along the direction of the last
+ * update, which typically reduces the number of iterations needed to
+ * reach a given estimate by a factor of two or more.
+ *
  * This code was adapted from the Insight Journal contribution:
  *
  * "Deconvolution: infrastructure and reference algorithms"
@@ -101,6 +116,18 @@ public:
   /** Get the current iteration. */
   itkGetConstMacro(Iteration, unsigned int);
 
+  /** Set/get whether the iterations are accelerated by vector
+   * extrapolation. Defaults to off. */
+  /** @ITKStartGrouping */
+  itkSetMacro(Acceleration, bool);
+  itkGetConstMacro(Acceleration, bool);
+  itkBooleanMacro(Acceleration);
+  /** @ITKEndGrouping */
+
+  /** Get the extrapolation factor, between 0 and 1, of the last
+   * accelerated iteration. */
+  itkGetConstMacro(AccelerationFactor, double);
+
 protected:
   IterativeDeconvolutionImageFilter();
   ~IterativeDeconvolutionImageFilter() override;
@@ -117,6 +144,31 @@ protected:
   virtual void
   Finish(ProgressAccumulator * progress, float progressWeight);
 
+  /** Create the resident filters used by ForwardTransform() and
+   * InverseTransform(). Each run of a transform adds
+   * transformProgressWeight to the progress. */
+  void
+  InitializeTransforms(ProgressAccumulator * progress, float transformProgressWeight);
+
+  /** Compute the Fourier transform of an image of the padded input
+   * size. The returned image belongs to a resident filter and is
+   * overwritten by the next call. It may be modified in place. */
+  InternalComplexImageType *
+  ForwardTransform(const InternalImageType * image);
+
+  /** Compute the inverse Fourier transform of an image with the size
+   * of the transfer function. The returned image belongs to a resident
+   * filter and is overwritten by the next call. It may be modified in
+   * place. */
+  InternalImageType *
+  InverseTransform(const InternalComplexImageType * image);
+
+  /** Call function(begin, end) in parallel on contiguous chunks of the
+   * range [0, size). Used to fuse the element-wise steps of an
+   * iteration into single passes over the image buffers. */
+  void
+  ParallelizeBuffer(SizeValueType size, const std::function<void(SizeValueType, SizeValueType)> & function);
+
   /** This filter needs the entire image kernel, which in general is
    * going to be a different size then the output requested region. As
    * such, this filter needs to provide an implementation for
@@ -138,6 +190,11 @@ protected:
   /** Intermediate results. Protected for easy access by subclasses. */
   InternalImagePointerType m_CurrentEstimate{};
 
+  /** Whether estimates are constrained to be non-negative. The
+   * predictions of the accelerated iterations are then clamped at
+   * zero. */
+  bool m_NonNegativeEstimate{ false };
+
   using typename Superclass::FFTFilterType;
   using typename Superclass::IFFTFilterType;
 
@@ -145,6 +202,30 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  /** Replace the current estimate by the prediction extrapolated from
+   * the current and previous estimates. */
+  void
+  PredictEstimate();
+
+  /** Update the extrapolation factor from the change made by the last
+   * iteration to the prediction. */
+  void
+  UpdateAcceleration();
+
+  /** Resident transform filters and the inputs they are grafted to. */
+  typename FFTFilterType::Pointer  m_ForwardFFTFilter{};
+  typename IFFTFilterType::Pointer m_InverseFFTFilter{};
+  InternalImagePointerType         m_ForwardFFTInput{};
+  InternalComplexImagePointerType  m_InverseFFTInput{};
+
+  /** State of the accelerated iterations. */
+  bool                     m_Acceleration{ false };
+  double                   m_AccelerationFactor{ 0.0 };
+  InternalImagePointerType m_PreviousEstimate{};
+  InternalImagePointerType m_Change{};
+  InternalImagePointerType m_PreviousChange{};
+  unsigned int             m_NumberOfChanges{ 0 };
+
   /** Number of iterations to run. */
   unsigned int m_NumberOfIterations{};
 
@@ -20,6 +20,9 @@
 
 #include "itkCastImageFilter.h"
 
+#include <algorithm>
+#include <numeric>
+
 namespace itk
 {
 
@@ -64,6 +67,165 @@ IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInte
 
     m_KernelMTime = this->GetKernelImage()->GetMTime();
   }
+
+  if (m_Acceleration)
+  {
+    const auto allocateLikeEstimate = [this](InternalImagePointerType & image) {
+      image = InternalImageType::New();
+      image->CopyInformation(this->m_CurrentEstimate);
+      image->SetRegions(this->m_CurrentEstimate->GetBufferedRegion());
+      image->Allocate();
+    };
+    allocateLikeEstimate(m_PreviousEstimate);
+    allocateLikeEstimate(m_Change);
+    allocateLikeEstimate(m_PreviousChange);
+  }
+  m_AccelerationFactor = 0.0;
+  m_NumberOfChanges = 0;
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+void
+IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::InitializeTransforms(
+  ProgressAccumulator * progress,
+  float                 transformProgressWeight)
+{
+  // The filters read grafted copies of the images to transform, so that
+  // they never become part of a pipeline, and keep their outputs between
+  // updates, so that the output buffers are reused.
+  m_ForwardFFTInput = InternalImageType::New();
+  m_ForwardFFTFilter = FFTFilterType::New();
+  m_ForwardFFTFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  m_ForwardFFTFilter->SetInput(m_ForwardFFTInput);
+  m_ForwardFFTFilter->ReleaseDataBeforeUpdateFlagOff();
+  progress->RegisterInternalFilter(m_ForwardFFTFilter, transformProgressWeight);
+
+  m_InverseFFTInput = InternalComplexImageType::New();
+  m_InverseFFTFilter = IFFTFilterType::New();
+  m_InverseFFTFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  m_InverseFFTFilter->SetActualXDimensionIsOdd(this->GetXDimensionIsOdd());
+  m_InverseFFTFilter->SetInput(m_InverseFFTInput);
+  m_InverseFFTFilter->ReleaseDataBeforeUpdateFlagOff();
+  progress->RegisterInternalFilter(m_InverseFFTFilter, transformProgressWeight);
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+auto
+IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::ForwardTransform(
+  const InternalImageType * image) -> InternalComplexImageType *
+{
+  m_ForwardFFTInput->Graft(image);
+  m_ForwardFFTInput->Modified();
+  m_ForwardFFTFilter->UpdateLargestPossibleRegion();
+  return m_ForwardFFTFilter->GetOutput();
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+auto
+IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::InverseTransform(
+  const InternalComplexImageType * image) -> InternalImageType *
+{
+  m_InverseFFTInput->Graft(image);
+  m_InverseFFTInput->Modified();
+  m_InverseFFTFilter->UpdateLargestPossibleRegion();
+  return m_InverseFFTFilter->GetOutput();
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+void
+IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::ParallelizeBuffer(
+  SizeValueType                                                size,
+  const std::function<void(SizeValueType, SizeValueType)> & function)
+{
+  const SizeValueType numberOfChunks = std::min<SizeValueType>(this->GetNumberOfWorkUnits(), size);
+
+  MultiThreaderBase * multiThreader = this->GetMultiThreader();
+  multiThreader->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [size, numberOfChunks, &function](SizeValueType chunk) {
+      function(chunk * size / numberOfChunks, (chunk + 1) * size / numberOfChunks);
+    },
+    nullptr);
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+void
+IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::PredictEstimate()
+{
+  // y_k = x_k + alpha * (x_k - x_{k-1}), where x_k is the current
+  // estimate. The current estimate is replaced by the prediction y_k,
+  // and -y_k is stored so that UpdateAcceleration() can compute the
+  // change x_{k+1} - y_k made by the next iteration.
+  TInternalPrecision *       estimate = m_CurrentEstimate->GetBufferPointer();
+  TInternalPrecision *       previousEstimate = m_PreviousEstimate->GetBufferPointer();
+  TInternalPrecision *       change = m_Change->GetBufferPointer();
+  const auto                 alpha = static_cast<TInternalPrecision>(m_AccelerationFactor);
+  const bool                 nonNegative = m_NonNegativeEstimate;
+  const TInternalPrecision   zero{};
+  this->ParallelizeBuffer(m_CurrentEstimate->GetBufferedRegion().GetNumberOfPixels(),
+                          [=](SizeValueType begin, SizeValueType end) {
+                            for (SizeValueType i = begin; i < end; ++i)
+                            {
+                              const TInternalPrecision current = estimate[i];
+                              TInternalPrecision prediction = current + alpha * (current - previousEstimate[i]);
+                              if (nonNegative && prediction < zero)
+                              {
+                                prediction = zero;
+                              }
+                              previousEstimate[i] = current;
+                              estimate[i] = prediction;
+                              change[i] = -prediction;
+                            }
+                          });
+}
+
+template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
+void
+IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::UpdateAcceleration()
+{
+  const SizeValueType numberOfPixels = m_CurrentEstimate->GetBufferedRegion().GetNumberOfPixels();
+  const SizeValueType numberOfChunks = std::min<SizeValueType>(this->GetNumberOfWorkUnits(), numberOfPixels);
+
+  // Complete the change x_{k+1} - y_k and correlate it with the previous
+  // change. Partial sums are kept per chunk so that the result does not
+  // depend on the scheduling of the threads.
+  const TInternalPrecision * estimate = m_CurrentEstimate->GetBufferPointer();
+  TInternalPrecision *       change = m_Change->GetBufferPointer();
+  const TInternalPrecision * previousChange = m_PreviousChange->GetBufferPointer();
+  std::vector<double>        products(numberOfChunks);
+  std::vector<double>        squaredNorms(numberOfChunks);
+
+  MultiThreaderBase * multiThreader = this->GetMultiThreader();
+  multiThreader->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [&](SizeValueType chunk) {
+      double product = 0.0;
+      double squaredNorm = 0.0;
+      for (SizeValueType i = chunk * numberOfPixels / numberOfChunks;
+           i < (chunk + 1) * numberOfPixels / numberOfChunks;
+           ++i)
+      {
+        change[i] += estimate[i];
+        product += static_cast<double>(change[i]) * static_cast<double>(previousChange[i]);
+        squaredNorm += static_cast<double>(previousChange[i]) * static_cast<double>(previousChange[i]);
+      }
+      products[chunk] = product;
+      squaredNorms[chunk] = squaredNorm;
+    },
+    nullptr);
+
+  if (++m_NumberOfChanges > 1)
+  {
+    const double product = std::accumulate(products.cbegin(), products.cend(), 0.0);
+    const double squaredNorm = std::accumulate(squaredNorms.cbegin(), squaredNorms.cend(), 0.0);
+    m_AccelerationFactor =
+      (squaredNorm > 0.0) ? std::clamp(product / squaredNorm, 0.0, 1.0) : 0.0;
+  }
+  std::swap(m_Change, m_PreviousChange);
 }
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
@@ -76,6 +238,15 @@ IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInte
 
   m_CurrentEstimate = nullptr;
   m_TransferFunction = nullptr;
+
+  m_ForwardFFTFilter = nullptr;
+  m_InverseFFTFilter = nullptr;
+  m_ForwardFFTInput = nullptr;
+  m_InverseFFTInput = nullptr;
+
+  m_PreviousEstimate = nullptr;
+  m_Change = nullptr;
+  m_PreviousChange = nullptr;
 }
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
@@ -127,7 +298,17 @@ IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInte
       break;
     }
 
+    if (m_Acceleration)
+    {
+      this->PredictEstimate();
+    }
+
     this->Iteration(progress, iterationWeight);
+
+    if (m_Acceleration)
+    {
+      this->UpdateAcceleration();
+    }
   }
 
   this->Finish(progress, 0.1f);
@@ -144,6 +325,9 @@ IterativeDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInte
   os << indent << "NumberOfIterations: " << m_NumberOfIterations << std::endl;
   os << indent << "Iteration: " << m_Iteration << std::endl;
   os << indent << "StopIteration: " << m_StopIteration << std::endl;
+  itkPrintSelfBooleanMacro(Acceleration);
+  os << indent << "AccelerationFactor: " << m_AccelerationFactor << std::endl;
+  itkPrintSelfBooleanMacro(NonNegativeEstimate);
   os << indent << "InputMTime: " << m_InputMTime << std::endl;
   os << indent << "KernelMTime: " << m_KernelMTime << std::endl;
 }
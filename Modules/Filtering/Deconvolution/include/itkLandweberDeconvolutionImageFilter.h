@@ -72,6 +72,9 @@ public:
  * the blurred input image. As such, it is best suited for images that
  * have zero-mean Gaussian white noise.
  *
+ * Each iteration is computed with one forward and one inverse Fourier
+ * transform and a single fused pass over the spectrum of the estimate.
+ *
  * This is the base implementation of the Landweber algorithm. It may
  * produce results with negative values. For a version of this
  * algorithm that enforces a positivity constraint on each
@@ -156,13 +159,6 @@ private:
 
   using LandweberFunctor =
     Functor::LandweberMethod<InternalComplexType, InternalComplexType, InternalComplexType, InternalComplexType>;
-  using LandweberFilterType = TernaryGeneratorImageFilter<InternalComplexImageType,
-                                                          InternalComplexImageType,
-                                                          InternalComplexImageType,
-                                                          InternalComplexImageType>;
-
-  typename LandweberFilterType::Pointer m_LandweberFilter{};
-  typename IFFTFilterType::Pointer      m_IFFTFilter{};
 };
 
 } // end namespace itk
@@ -47,46 +47,36 @@ LandweberDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInte
 
   this->PrepareInput(this->GetInput(), m_TransformedInput, progress, 0.5f * progressWeight);
 
-  // Set up minipipeline to compute estimate at each iteration
-  m_LandweberFilter = LandweberFilterType::New();
-
-  LandweberFunctor functor;
-  functor.m_Alpha = m_Alpha;
-  m_LandweberFilter->SetFunctor(functor);
-  m_LandweberFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  // Transform of current estimate will be set as input 1 in Iteration()
-  m_LandweberFilter->SetInput2(this->m_TransferFunction);
-  m_LandweberFilter->SetInput3(m_TransformedInput);
-  m_LandweberFilter->ReleaseDataFlagOn();
-  progress->RegisterInternalFilter(m_LandweberFilter, 0.3f * iterationProgressWeight);
-
-  m_IFFTFilter = IFFTFilterType::New();
-  m_IFFTFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  m_IFFTFilter->SetActualXDimensionIsOdd(this->GetXDimensionIsOdd());
-  m_IFFTFilter->SetInput(m_LandweberFilter->GetOutput());
-  m_IFFTFilter->ReleaseDataFlagOn();
-  progress->RegisterInternalFilter(m_IFFTFilter, 0.7f * iterationProgressWeight);
+  this->InitializeTransforms(progress, 0.45f * iterationProgressWeight);
 }
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
 void
 LandweberDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::Iteration(
-  ProgressAccumulator * progress,
-  float                 iterationProgressWeight)
+  ProgressAccumulator * itkNotUsed(progress),
+  float                 itkNotUsed(iterationProgressWeight))
 {
-  // Set up minipipeline to compute the new estimate
-  InternalComplexImagePointerType transformedEstimate;
-  this->TransformPaddedInput(this->m_CurrentEstimate, transformedEstimate, progress, 0.1f * iterationProgressWeight);
-
-  // Set the inputs
-  m_LandweberFilter->SetInput1(transformedEstimate);
-
-  // Trigger the update
-  m_IFFTFilter->UpdateLargestPossibleRegion();
+  LandweberFunctor functor;
+  functor.m_Alpha = m_Alpha;
 
-  // Store the current estimate
-  this->m_CurrentEstimate = m_IFFTFilter->GetOutput();
-  this->m_CurrentEstimate->DisconnectPipeline();
+  // Apply the Landweber update to the spectrum of the estimate in place.
+  InternalComplexImageType *  spectrum = this->ForwardTransform(this->m_CurrentEstimate);
+  InternalComplexType *       spectrumBuffer = spectrum->GetBufferPointer();
+  const InternalComplexType * transferFunction = this->m_TransferFunction->GetBufferPointer();
+  const InternalComplexType * transformedInput = m_TransformedInput->GetBufferPointer();
+  this->ParallelizeBuffer(
+    spectrum->GetBufferedRegion().GetNumberOfPixels(),
+    [functor, spectrumBuffer, transferFunction, transformedInput](SizeValueType begin, SizeValueType end) {
+      for (SizeValueType i = begin; i < end; ++i)
+      {
+        spectrumBuffer[i] = functor(spectrumBuffer[i], transferFunction[i], transformedInput[i]);
+      }
+    });
+
+  // The new estimate shares the buffer of the inverse transform, which is
+  // only overwritten once the next iteration no longer needs the estimate.
+  this->m_CurrentEstimate->Graft(this->InverseTransform(spectrum));
+  this->m_CurrentEstimate->Modified();
 }
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
@@ -97,8 +87,7 @@ LandweberDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInte
 {
   this->Superclass::Finish(progress, progressWeight);
 
-  m_LandweberFilter = nullptr;
-  m_IFFTFilter = nullptr;
+  m_TransformedInput = nullptr;
 }
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
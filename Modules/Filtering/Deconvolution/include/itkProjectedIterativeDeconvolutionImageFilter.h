@@ -34,7 +34,9 @@ namespace itk
  * members of that filter, and it will override the definition of
  * Iteration() to first call the superclass's Iteration() method
  * followed by projecting all negative voxel values of each
- * intermediate estimate image to 0.
+ * intermediate estimate image to 0. The projection is applied in
+ * place, and the predictions of accelerated iterations are clamped at
+ * 0 as well.
  *
  * This code was adapted from the Insight Journal contribution:
  *
@@ -73,19 +75,11 @@ public:
   itkOverrideGetNameOfClassMacro(ProjectedIterativeDeconvolutionImageFilter);
 
 protected:
-  ProjectedIterativeDeconvolutionImageFilter() = default;
+  ProjectedIterativeDeconvolutionImageFilter();
   ~ProjectedIterativeDeconvolutionImageFilter() override;
 
-  void
-  Initialize(ProgressAccumulator * progress, float progressWeight, float iterationProgressWeight) override;
-
   void
   Iteration(ProgressAccumulator * progress, float iterationProgressWeight) override;
-
-private:
-  using ProjectionFilterType = ThresholdImageFilter<InternalImageType>;
-
-  typename ProjectionFilterType::Pointer m_ProjectionFilter{ nullptr };
 };
 } // namespace itk
 
@@ -23,23 +23,13 @@ namespace itk
 {
 
 template <typename TSuperclass>
-ProjectedIterativeDeconvolutionImageFilter<TSuperclass>::~ProjectedIterativeDeconvolutionImageFilter()
+ProjectedIterativeDeconvolutionImageFilter<TSuperclass>::ProjectedIterativeDeconvolutionImageFilter()
 {
-  m_ProjectionFilter = nullptr;
+  this->m_NonNegativeEstimate = true;
 }
 
 template <typename TSuperclass>
-void
-ProjectedIterativeDeconvolutionImageFilter<TSuperclass>::Initialize(ProgressAccumulator * progress,
-                                                                    float                 progressWeight,
-                                                                    float                 iterationProgressWeight)
-{
-  this->Superclass::Initialize(progress, progressWeight, iterationProgressWeight);
-
-  m_ProjectionFilter = ProjectionFilterType::New();
-  const typename InternalImageType::PixelType zero{};
-  m_ProjectionFilter->ThresholdBelow(zero);
-}
+ProjectedIterativeDeconvolutionImageFilter<TSuperclass>::~ProjectedIterativeDeconvolutionImageFilter() = default;
 
 template <typename TSuperclass>
 void
@@ -48,10 +38,17 @@ ProjectedIterativeDeconvolutionImageFilter<TSuperclass>::Iteration(ProgressAccum
 {
   this->Superclass::Iteration(progress, iterationProgressWeight);
 
-  m_ProjectionFilter->SetInput(this->m_CurrentEstimate);
-  m_ProjectionFilter->UpdateLargestPossibleRegion();
-  this->m_CurrentEstimate = m_ProjectionFilter->GetOutput();
-  this->m_CurrentEstimate->DisconnectPipeline();
+  using PixelType = typename InternalImageType::PixelType;
+  PixelType * estimate = this->m_CurrentEstimate->GetBufferPointer();
+  this->ParallelizeBuffer(this->m_CurrentEstimate->GetBufferedRegion().GetNumberOfPixels(),
+                          [estimate](SizeValueType begin, SizeValueType end) {
+                            const PixelType zero{};
+                            for (SizeValueType i = begin; i < end; ++i)
+                            {
+                              estimate[i] = std::max(estimate[i], zero);
+                            }
+                          });
+  this->m_CurrentEstimate->Modified();
 }
 
 } // end namespace itk
@@ -40,6 +40,12 @@ namespace itk
  * follows a Poisson distribution and that the distribution for each
  * pixel is independent of the other pixels.
  *
+ * Each iteration is computed with four Fourier transforms and fused
+ * element-wise passes that reuse the same buffers across iterations.
+ * Since the estimates are non-negative, the accelerated iterations
+ * (see IterativeDeconvolutionImageFilter::SetAcceleration()) clamp the
+ * predictions at zero.
+ *
  * This code was adapted from the Insight Journal contribution:
  *
  * "Deconvolution: infrastructure and reference algorithms"
@@ -109,24 +115,7 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
-  /** Filters to compute each iterative update step. */
-  using MultiplyFilterType = MultiplyImageFilter<InternalImageType>;
-  using ComplexMultiplyType = MultiplyImageFilter<InternalComplexImageType>;
-  using DivideFilterType = DivideOrZeroOutImageFilter<InternalImageType>;
-  using ConjugateAdaptorType = ComplexConjugateImageAdaptor<InternalComplexImageType>;
-  using ComplexConjugateMultiplyType =
-    MultiplyImageFilter<InternalComplexImageType, ConjugateAdaptorType, InternalComplexImageType>;
-
   InternalImagePointerType m_PaddedInput{};
-
-  typename ComplexMultiplyType::Pointer          m_ComplexMultiplyFilter1{};
-  typename IFFTFilterType::Pointer               m_IFFTFilter1{};
-  typename DivideFilterType::Pointer             m_DivideFilter{};
-  typename FFTFilterType::Pointer                m_FFTFilter{};
-  typename ConjugateAdaptorType::Pointer         m_ConjugateAdaptor{};
-  typename ComplexConjugateMultiplyType::Pointer m_ComplexMultiplyFilter2{};
-  typename IFFTFilterType::Pointer               m_IFFTFilter2{};
-  typename MultiplyFilterType::Pointer           m_MultiplyFilter{};
 };
 } // end namespace itk
 
@@ -26,7 +26,9 @@ template <typename TInputImage, typename TKernelImage, typename TOutputImage, ty
 RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::
   RichardsonLucyDeconvolutionImageFilter()
   : m_PaddedInput(nullptr)
-{}
+{
+  this->m_NonNegativeEstimate = true;
+}
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
 RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::
@@ -46,85 +48,62 @@ RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage,
 
   this->PadInput(this->GetInput(), m_PaddedInput, progress, 0.5f * progressWeight);
 
-  // Set up minipipeline to compute estimate at each iteration
-  m_ComplexMultiplyFilter1 = ComplexMultiplyType::New();
-  m_ComplexMultiplyFilter1->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  // Transformed estimate will be set as input 1 in Iteration()
-  m_ComplexMultiplyFilter1->SetInput2(this->m_TransferFunction);
-  m_ComplexMultiplyFilter1->InPlaceOn();
-  m_ComplexMultiplyFilter1->ReleaseDataFlagOn();
-  progress->RegisterInternalFilter(m_ComplexMultiplyFilter1, 0.07f * iterationProgressWeight);
-
-  m_IFFTFilter1 = IFFTFilterType::New();
-  m_IFFTFilter1->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  m_IFFTFilter1->SetActualXDimensionIsOdd(this->GetXDimensionIsOdd());
-  m_IFFTFilter1->SetInput(m_ComplexMultiplyFilter1->GetOutput());
-  m_IFFTFilter1->ReleaseDataFlagOn();
-  progress->RegisterInternalFilter(m_IFFTFilter1, 0.2f * iterationProgressWeight);
-
-  m_DivideFilter = DivideFilterType::New();
-  m_DivideFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  m_DivideFilter->SetInput1(m_PaddedInput);
-  m_DivideFilter->SetInput2(m_IFFTFilter1->GetOutput());
-  m_DivideFilter->InPlaceOn();
-  m_DivideFilter->SetCoordinateTolerance(NumericTraits<double>::max());
-  m_DivideFilter->SetDirectionTolerance(NumericTraits<double>::max());
-  progress->RegisterInternalFilter(m_DivideFilter, 0.1f * iterationProgressWeight);
-
-  m_FFTFilter = FFTFilterType::New();
-  m_FFTFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  m_FFTFilter->SetInput(m_DivideFilter->GetOutput());
-  m_FFTFilter->ReleaseDataFlagOn();
-  progress->RegisterInternalFilter(m_FFTFilter, 0.2f * iterationProgressWeight);
-
-  m_ConjugateAdaptor = ConjugateAdaptorType::New();
-  m_ConjugateAdaptor->SetImage(this->m_TransferFunction);
-
-  m_ComplexMultiplyFilter2 = ComplexConjugateMultiplyType::New();
-  m_ComplexMultiplyFilter2->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  m_ComplexMultiplyFilter2->SetInput1(m_FFTFilter->GetOutput());
-  m_ComplexMultiplyFilter2->SetInput2(m_ConjugateAdaptor);
-  m_ComplexMultiplyFilter2->ReleaseDataFlagOn();
-  progress->RegisterInternalFilter(m_ComplexMultiplyFilter2, 0.07f * iterationProgressWeight);
-
-  m_IFFTFilter2 = IFFTFilterType::New();
-  m_IFFTFilter2->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  m_IFFTFilter2->SetActualXDimensionIsOdd(this->GetXDimensionIsOdd());
-  m_IFFTFilter2->SetInput(m_ComplexMultiplyFilter2->GetOutput());
-  m_IFFTFilter2->ReleaseDataFlagOn();
-  progress->RegisterInternalFilter(m_IFFTFilter2, 0.2f * iterationProgressWeight);
-
-  m_MultiplyFilter = MultiplyFilterType::New();
-  m_MultiplyFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-  // Current estimate will be set as input 1 in Iteration()
-  m_MultiplyFilter->SetInput2(m_IFFTFilter2->GetOutput());
-  m_MultiplyFilter->InPlaceOn();
-  m_MultiplyFilter->ReleaseDataFlagOn();
-  m_MultiplyFilter->SetCoordinateTolerance(NumericTraits<double>::max());
-  m_MultiplyFilter->SetDirectionTolerance(NumericTraits<double>::max());
-  progress->RegisterInternalFilter(m_MultiplyFilter, 0.06f * iterationProgressWeight);
+  this->InitializeTransforms(progress, 0.2f * iterationProgressWeight);
 }
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
 void
 RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage, TInternalPrecision>::Iteration(
-  ProgressAccumulator * progress,
-  float                 iterationProgressWeight)
+  ProgressAccumulator * itkNotUsed(progress),
+  float                 itkNotUsed(iterationProgressWeight))
 {
-  // Set up minipipeline to compute the new estimate
-  InternalComplexImagePointerType transformedEstimate;
-  this->TransformPaddedInput(this->m_CurrentEstimate, transformedEstimate, progress, 0.1f * iterationProgressWeight);
-
-  // Set the inputs
-  m_ComplexMultiplyFilter1->SetInput1(transformedEstimate);
-  m_MultiplyFilter->SetInput1(this->m_CurrentEstimate);
-
-  // Trigger the update
-  m_MultiplyFilter->UpdateLargestPossibleRegion();
-
-  // Store the current estimate
-  this->m_CurrentEstimate = m_MultiplyFilter->GetOutput();
-  this->m_CurrentEstimate->DisconnectPipeline();
+  const InternalComplexType * transferFunction = this->m_TransferFunction->GetBufferPointer();
+  const TInternalPrecision *  paddedInput = m_PaddedInput->GetBufferPointer();
+  TInternalPrecision *        estimate = this->m_CurrentEstimate->GetBufferPointer();
+  const SizeValueType         numberOfPixels = this->m_CurrentEstimate->GetBufferedRegion().GetNumberOfPixels();
+  const SizeValueType numberOfFrequencies = this->m_TransferFunction->GetBufferedRegion().GetNumberOfPixels();
+
+  // Blur the estimate with the kernel.
+  InternalComplexImageType * spectrum = this->ForwardTransform(this->m_CurrentEstimate);
+  InternalComplexType *      spectrumBuffer = spectrum->GetBufferPointer();
+  this->ParallelizeBuffer(numberOfFrequencies, [spectrumBuffer, transferFunction](SizeValueType begin, SizeValueType end) {
+    for (SizeValueType i = begin; i < end; ++i)
+    {
+      spectrumBuffer[i] *= transferFunction[i];
+    }
+  });
+  InternalImageType *  blurredEstimate = this->InverseTransform(spectrum);
+  TInternalPrecision * ratio = blurredEstimate->GetBufferPointer();
+
+  // Divide the input by the blurred estimate in place, with the same
+  // threshold as DivideOrZeroOutImageFilter.
+  const auto threshold = static_cast<TInternalPrecision>(1e-5);
+  this->ParallelizeBuffer(numberOfPixels, [ratio, paddedInput, threshold](SizeValueType begin, SizeValueType end) {
+    for (SizeValueType i = begin; i < end; ++i)
+    {
+      ratio[i] = (ratio[i] < threshold) ? TInternalPrecision{} : paddedInput[i] / ratio[i];
+    }
+  });
+
+  // Correlate the ratio with the kernel.
+  spectrum = this->ForwardTransform(blurredEstimate);
+  spectrumBuffer = spectrum->GetBufferPointer();
+  this->ParallelizeBuffer(numberOfFrequencies, [spectrumBuffer, transferFunction](SizeValueType begin, SizeValueType end) {
+    for (SizeValueType i = begin; i < end; ++i)
+    {
+      spectrumBuffer[i] *= std::conj(transferFunction[i]);
+    }
+  });
+  const TInternalPrecision * correction = this->InverseTransform(spectrum)->GetBufferPointer();
+
+  // Update the estimate in place.
+  this->ParallelizeBuffer(numberOfPixels, [estimate, correction](SizeValueType begin, SizeValueType end) {
+    for (SizeValueType i = begin; i < end; ++i)
+    {
+      estimate[i] *= correction[i];
+    }
+  });
+  this->m_CurrentEstimate->Modified();
 }
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
@@ -135,14 +114,7 @@ RichardsonLucyDeconvolutionImageFilter<TInputImage, TKernelImage, TOutputImage,
 {
   this->Superclass::Finish(progress, progressWeight);
 
-  m_ComplexMultiplyFilter1 = nullptr;
-  m_IFFTFilter1 = nullptr;
-  m_DivideFilter = nullptr;
-  m_FFTFilter = nullptr;
-  m_ConjugateAdaptor = nullptr;
-  m_ComplexMultiplyFilter2 = nullptr;
-  m_IFFTFilter2 = nullptr;
-  m_MultiplyFilter = nullptr;
+  m_PaddedInput = nullptr;
 }
 
 template <typename TInputImage, typename TKernelImage, typename TOutputImage, typename TInternalPrecision>
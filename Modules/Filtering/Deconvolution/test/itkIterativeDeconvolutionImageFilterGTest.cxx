@@ -0,0 +1,197 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFFTConvolutionImageFilter.h"
+#include "itkImage.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkLandweberDeconvolutionImageFilter.h"
+#include "itkProjectedLandweberDeconvolutionImageFilter.h"
+#include "itkRichardsonLucyDeconvolutionImageFilter.h"
+#include "itkGTest.h"
+#include "itkTestDriverIncludeRequiredFactories.h"
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+
+class IterativeDeconvolutionImageFilterTest : public ::testing::Test
+{
+protected:
+  void
+  SetUp() override
+  {
+    RegisterRequiredFactories();
+
+    // A few bright discs on a dim background.
+    m_Truth = ImageType::New();
+    m_Truth->SetRegions(ImageType::SizeType{ { 64, 48 } });
+    m_Truth->Allocate();
+    for (itk::ImageRegionIteratorWithIndex<ImageType> it(m_Truth, m_Truth->GetLargestPossibleRegion()); !it.IsAtEnd();
+         ++it)
+    {
+      const ImageType::IndexType index = it.GetIndex();
+      float                      value = 10.0f;
+      for (const auto & center : { ImageType::IndexType{ { 20, 15 } }, ImageType::IndexType{ { 42, 30 } } })
+      {
+        const double dx = index[0] - center[0];
+        const double dy = index[1] - center[1];
+        if (dx * dx + dy * dy < 36.0)
+        {
+          value += 100.0f;
+        }
+      }
+      it.Set(value);
+    }
+
+    // A normalized Gaussian kernel.
+    m_Kernel = ImageType::New();
+    m_Kernel->SetRegions(ImageType::SizeType{ { 9, 9 } });
+    m_Kernel->Allocate();
+    double sum = 0.0;
+    for (itk::ImageRegionIteratorWithIndex<ImageType> it(m_Kernel, m_Kernel->GetLargestPossibleRegion());
+         !it.IsAtEnd();
+         ++it)
+    {
+      const double dx = it.GetIndex()[0] - 4.0;
+      const double dy = it.GetIndex()[1] - 4.0;
+      const double value = std::exp(-(dx * dx + dy * dy) / (2.0 * 1.5 * 1.5));
+      it.Set(static_cast<float>(value));
+      sum += value;
+    }
+    for (itk::ImageRegionIteratorWithIndex<ImageType> it(m_Kernel, m_Kernel->GetLargestPossibleRegion());
+         !it.IsAtEnd();
+         ++it)
+    {
+      it.Set(static_cast<float>(it.Get() / sum));
+    }
+
+    using ConvolutionFilterType = itk::FFTConvolutionImageFilter<ImageType>;
+    auto convolution = ConvolutionFilterType::New();
+    convolution->SetInput(m_Truth);
+    convolution->SetKernelImage(m_Kernel);
+    convolution->Update();
+    m_Blurred = convolution->GetOutput();
+    m_Blurred->DisconnectPipeline();
+  }
+
+  template <typename TFilter>
+  double
+  Deconvolve(TFilter * filter, unsigned int numberOfIterations, bool acceleration) const
+  {
+    filter->SetInput(m_Blurred);
+    filter->SetKernelImage(m_Kernel);
+    filter->SetNumberOfIterations(numberOfIterations);
+    filter->SetAcceleration(acceleration);
+    filter->Update();
+    EXPECT_EQ(filter->GetIteration(), numberOfIterations);
+    EXPECT_GE(filter->GetAccelerationFactor(), 0.0);
+    EXPECT_LE(filter->GetAccelerationFactor(), 1.0);
+    return this->MeanSquaredError(filter->GetOutput());
+  }
+
+  double
+  MeanSquaredError(const ImageType * image) const
+  {
+    const ImageType::RegionType              region = m_Truth->GetLargestPossibleRegion();
+    itk::ImageRegionConstIterator<ImageType> truthIt(m_Truth, region);
+    itk::ImageRegionConstIterator<ImageType> it(image, region);
+    double                                   sum = 0.0;
+    for (; !it.IsAtEnd(); ++it, ++truthIt)
+    {
+      const double difference = it.Get() - truthIt.Get();
+      sum += difference * difference;
+    }
+    return sum / static_cast<double>(region.GetNumberOfPixels());
+  }
+
+  static float
+  Minimum(const ImageType * image)
+  {
+    float minimum = itk::NumericTraits<float>::max();
+    for (itk::ImageRegionConstIterator<ImageType> it(image, image->GetLargestPossibleRegion()); !it.IsAtEnd(); ++it)
+    {
+      minimum = std::min(minimum, it.Get());
+    }
+    return minimum;
+  }
+
+  ImageType::Pointer m_Truth{};
+  ImageType::Pointer m_Kernel{};
+  ImageType::Pointer m_Blurred{};
+};
+} // namespace
+
+
+TEST_F(IterativeDeconvolutionImageFilterTest, RichardsonLucy)
+{
+  using FilterType = itk::RichardsonLucyDeconvolutionImageFilter<ImageType>;
+  auto filter = FilterType::New();
+
+  ITK_GTEST_EXERCISE_BASIC_OBJECT_METHODS(
+    filter, RichardsonLucyDeconvolutionImageFilter, IterativeDeconvolutionImageFilter);
+  EXPECT_FALSE(filter->GetAcceleration());
+
+  const double blurredError = this->MeanSquaredError(m_Blurred);
+  const double fewIterationsError = this->Deconvolve(filter.GetPointer(), 5, false);
+  const double iterationsError = this->Deconvolve(filter.GetPointer(), 20, false);
+  EXPECT_LT(fewIterationsError, blurredError);
+  EXPECT_LT(iterationsError, fewIterationsError);
+  EXPECT_GE(Minimum(filter->GetOutput()), 0.0f);
+
+  // The accelerated iterations reach at least the same error in a
+  // quarter of the iterations.
+  const double acceleratedError = this->Deconvolve(filter.GetPointer(), 5, true);
+  EXPECT_LT(acceleratedError, iterationsError);
+  EXPECT_GT(filter->GetAccelerationFactor(), 0.0);
+  EXPECT_GE(Minimum(filter->GetOutput()), 0.0f);
+}
+
+
+TEST_F(IterativeDeconvolutionImageFilterTest, Landweber)
+{
+  using FilterType = itk::LandweberDeconvolutionImageFilter<ImageType>;
+  auto filter = FilterType::New();
+  filter->SetAlpha(1.0);
+
+  const double blurredError = this->MeanSquaredError(m_Blurred);
+  const double fewIterationsError = this->Deconvolve(filter.GetPointer(), 5, false);
+  const double iterationsError = this->Deconvolve(filter.GetPointer(), 20, false);
+  EXPECT_LT(fewIterationsError, blurredError);
+  EXPECT_LT(iterationsError, fewIterationsError);
+
+  const double acceleratedError = this->Deconvolve(filter.GetPointer(), 10, true);
+  EXPECT_LT(acceleratedError, iterationsError);
+}
+
+
+TEST_F(IterativeDeconvolutionImageFilterTest, ProjectedLandweber)
+{
+  using FilterType = itk::ProjectedLandweberDeconvolutionImageFilter<ImageType>;
+  auto filter = FilterType::New();
+  filter->SetAlpha(1.0);
+
+  const double blurredError = this->MeanSquaredError(m_Blurred);
+  const double iterationsError = this->Deconvolve(filter.GetPointer(), 10, false);
+  EXPECT_LT(iterationsError, blurredError);
+  EXPECT_GE(Minimum(filter->GetOutput()), 0.0f);
+
+  const double acceleratedError = this->Deconvolve(filter.GetPointer(), 10, true);
+  EXPECT_LT(acceleratedError, iterationsError);
+  EXPECT_GE(Minimum(filter->GetOutput()), 0.0f);
+}
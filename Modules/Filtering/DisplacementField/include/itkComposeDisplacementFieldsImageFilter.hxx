@@ -22,6 +22,7 @@
 #include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkImageRegionIterator.h"
 #include "itkVectorLinearInterpolateImageFunction.h"
+#include <typeinfo>
 
 namespace itk
 {
@@ -77,6 +78,17 @@ ComposeDisplacementFieldsImageFilter<InputImage, TOutputImage>::DynamicThreadedG
   const typename OutputFieldType::Pointer     output = this->GetOutput();
   const typename InputFieldType::ConstPointer warpingField = this->GetWarpingField();
 
+  // The default interpolator is called without virtual calls, and the
+  // continuous index is computed once for both the bounds check and the
+  // evaluation.
+  using DefaultInterpolatorType = VectorLinearInterpolateImageFunction<InputFieldType, RealType>;
+  const DefaultInterpolatorType * linearInterpolator = nullptr;
+  if (typeid(*this->m_Interpolator) == typeid(DefaultInterpolatorType))
+  {
+    linearInterpolator = static_cast<const DefaultInterpolatorType *>(this->m_Interpolator.GetPointer());
+  }
+  const InputFieldType * displacementField = this->m_Interpolator->GetInputImage();
+
   ImageRegionConstIteratorWithIndex ItW(warpingField, region);
   ImageRegionIterator               ItF(output, region);
 
@@ -98,7 +110,17 @@ ComposeDisplacementFieldsImageFilter<InputImage, TOutputImage>::DynamicThreadedG
     }
 
     typename InterpolatorType::OutputType displacement{};
-    if (this->m_Interpolator->IsInsideBuffer(pointIn2))
+    if (linearInterpolator != nullptr)
+    {
+      const typename InterpolatorType::PointType           point(pointIn2);
+      const typename InterpolatorType::ContinuousIndexType index =
+        displacementField->template TransformPhysicalPointToContinuousIndex<RealType>(point);
+      if (linearInterpolator->DefaultInterpolatorType::IsInsideBuffer(index))
+      {
+        displacement = linearInterpolator->DefaultInterpolatorType::EvaluateAtContinuousIndex(index);
+      }
+    }
+    else if (this->m_Interpolator->IsInsideBuffer(pointIn2))
     {
       displacement = this->m_Interpolator->Evaluate(pointIn2);
     }
@@ -223,6 +223,14 @@ public:
   OutputPointType
   TransformPoint(const InputPointType & inputPoint) const override;
 
+  /** Transform a batch of points. Each point is mapped to a continuous
+   * index of the displacement field once, for both the bounds check and
+   * the interpolation. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   /**  Method to transform a vector. */
   /** @ITKStartGrouping */
   using Superclass::TransformVector;
@@ -101,6 +101,45 @@ DisplacementFieldTransform<TParametersValueType, VDimension>::TransformPoint(con
   return outputPoint;
 }
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+DisplacementFieldTransform<TParametersValueType, VDimension>::TransformPoints(const InputPointType * inputPoints,
+                                                                              OutputPointType *      outputPoints,
+                                                                              SizeValueType numberOfPoints) const
+{
+  if (!this->m_DisplacementField)
+  {
+    itkExceptionStringMacro("No displacement field is specified.");
+  }
+  if (!this->m_Interpolator)
+  {
+    itkExceptionStringMacro("No interpolator is specified.");
+  }
+
+  using ContinuousIndexValueType = typename InterpolatorType::ContinuousIndexType::ValueType;
+
+  for (SizeValueType n = 0; n < numberOfPoints; ++n)
+  {
+    typename InterpolatorType::PointType point;
+    point.CastFrom(inputPoints[n]);
+
+    OutputPointType outputPoint;
+    outputPoint.CastFrom(inputPoints[n]);
+
+    const typename InterpolatorType::ContinuousIndexType cidx =
+      this->m_DisplacementField->template TransformPhysicalPointToContinuousIndex<ContinuousIndexValueType>(point);
+    if (this->m_Interpolator->IsInsideBuffer(cidx))
+    {
+      const typename InterpolatorType::OutputType displacement = this->m_Interpolator->EvaluateAtContinuousIndex(cidx);
+      for (unsigned int ii = 0; ii < VDimension; ++ii)
+      {
+        outputPoint[ii] += displacement[ii];
+      }
+    }
+    outputPoints[n] = outputPoint;
+  }
+}
+
 template <typename TParametersValueType, unsigned int VDimension>
 bool
 DisplacementFieldTransform<TParametersValueType, VDimension>::GetInverse(Self * inverse) const
@@ -135,6 +135,13 @@ protected:
   void
   GenerateData() override;
 
+  /** Compute the composition u(x + u(x)) + u(x) of a displacement field u with
+   * itself, in one multi-threaded pass over the buffered region. The field is
+   * linearly interpolated with nearest neighbor extrapolation, as
+   * VectorLinearInterpolateNearestNeighborExtrapolateImageFunction does. */
+  void
+  ComposeWithItself(const OutputImageType * field, OutputImageType * composedField);
+
   using RegionType = typename InputImageType::RegionType;
 
   using DivideByConstantType =
@@ -163,8 +170,9 @@ private:
 
   DivideByConstantPointer m_Divider{};
   CasterPointer           m_Caster{};
-  VectorWarperPointer     m_Warper{};
-  AdderPointer            m_Adder{};
+
+  // Second buffer of the squarings
+  OutputImagePointer m_SquaringBuffer{};
 };
 } // end namespace itk
 
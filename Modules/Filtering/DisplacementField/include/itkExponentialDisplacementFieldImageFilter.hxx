@@ -20,6 +20,7 @@
 
 #include "itkProgressReporter.h"
 #include "itkImageRegionConstIterator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 
 namespace itk
 {
@@ -32,13 +33,7 @@ ExponentialDisplacementFieldImageFilter<TInputImage, TOutputImage>::ExponentialD
   , m_MaximumNumberOfIterations(20)
   , m_Divider(DivideByConstantType::New())
   , m_Caster(CasterType::New())
-  , m_Warper(VectorWarperType::New())
-  , m_Adder(AdderType::New())
-{
-  const FieldInterpolatorPointer VectorInterpolator = FieldInterpolatorType::New();
-  m_Warper->SetInterpolator(VectorInterpolator);
-  m_Adder->InPlaceOn();
-}
+{}
 
 /**
  * Print out a description of self
@@ -172,40 +167,152 @@ ExponentialDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData
 
   progress.CompletedPixel();
 
-  // Do the iterative composition of the vector field
-  m_Warper->SetOutputOrigin(inputPtr->GetOrigin());
-  m_Warper->SetOutputSpacing(inputPtr->GetSpacing());
-  m_Warper->SetOutputDirection(inputPtr->GetDirection());
+  // Do the iterative composition of the vector field. Each squaring is a
+  // single pass, which writes u(x) + u(x + u(x)) into the other of two
+  // buffers. The second buffer is kept between the executions of the filter.
+  const OutputImagePointer outputPtr = this->GetOutput();
+  const RegionType         bufferedRegion = outputPtr->GetBufferedRegion();
+  if (m_SquaringBuffer.IsNull() || m_SquaringBuffer->GetBufferedRegion() != bufferedRegion)
+  {
+    m_SquaringBuffer = OutputImageType::New();
+    m_SquaringBuffer->SetRegions(bufferedRegion);
+    m_SquaringBuffer->Allocate();
+  }
+  m_SquaringBuffer->CopyInformation(outputPtr);
 
+  OutputImageType * current = outputPtr;
+  OutputImageType * next = m_SquaringBuffer;
   for (unsigned int i = 0; i < numiter; ++i)
   {
-    m_Warper->SetInput(this->GetOutput());
-    m_Warper->SetDisplacementField(this->GetOutput());
+    this->ComposeWithItself(current, next);
+    std::swap(current, next);
 
-    m_Warper->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
+    progress.CompletedPixel();
+  }
 
-    m_Warper->Update();
+  if (current != outputPtr.GetPointer())
+  {
+    // Exchange the buffers, so that the output holds the result
+    const typename OutputImageType::PixelContainerPointer resultContainer = current->GetPixelContainer();
+    current->SetPixelContainer(outputPtr->GetPixelContainer());
+    outputPtr->SetPixelContainer(resultContainer);
+  }
+  this->GetOutput()->Modified();
+}
 
-    const OutputImagePointer warpedIm = m_Warper->GetOutput();
-    warpedIm->DisconnectPipeline();
+template <typename TInputImage, typename TOutputImage>
+void
+ExponentialDisplacementFieldImageFilter<TInputImage, TOutputImage>::ComposeWithItself(const OutputImageType * field,
+                                                                                       OutputImageType * composedField)
+{
+  using ValueType = typename OutputPixelType::ValueType;
+  using IndexType = typename OutputImageType::IndexType;
 
-    // Remember we chose to use an inplace adder
-    m_Adder->SetInput1(this->GetOutput());
+  const RegionType bufferedRegion = field->GetBufferedRegion();
+  const IndexType  startIndex = bufferedRegion.GetIndex();
+  IndexType        endIndex;
+  for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+  {
+    endIndex[dim] = startIndex[dim] + static_cast<IndexValueType>(bufferedRegion.GetSize(dim)) - 1;
+  }
 
-    m_Adder->SetInput2(warpedIm);
-    m_Adder->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
+  // Matrix mapping a physical vector to a continuous index vector
+  const auto &                                   spacing = field->GetSpacing();
+  const auto &                                   inverseDirection = field->GetInverseDirection();
+  Matrix<double, ImageDimension, ImageDimension> vectorToIndex;
+  for (unsigned int r = 0; r < ImageDimension; ++r)
+  {
+    for (unsigned int c = 0; c < ImageDimension; ++c)
+    {
+      vectorToIndex[r][c] = inverseDirection[r][c] / spacing[r];
+    }
+  }
 
-    m_Adder->Update();
+  const OutputPixelType * buffer = field->GetBufferPointer();
+  const OffsetValueType * offsetTable = field->GetOffsetTable();
 
-    // Region passing stuff
-    this->GraftOutput(m_Adder->GetOutput());
+  auto composeRegion = [&](const RegionType & region) {
+    ImageRegionConstIteratorWithIndex<OutputImageType> fieldIt(field, region);
+    ImageRegionIterator<OutputImageType>               composedIt(composedField, region);
 
-    // Make a call to modified. This seems only necessary for
-    // a non-inplace adder but it doesn't hurt anyhow.
-    this->GetOutput()->Modified();
+    IndexType       baseIndex;
+    double          distance[ImageDimension];
+    OutputPixelType outputValue;
 
-    progress.CompletedPixel();
-  }
+    for (; !fieldIt.IsAtEnd(); ++fieldIt, ++composedIt)
+    {
+      const OutputPixelType & displacement = fieldIt.Get();
+      const IndexType &       index = fieldIt.GetIndex();
+
+      // Continuous index of x + u(x), and linear interpolation of u there,
+      // with the nearest neighbor extrapolation of
+      // VectorLinearInterpolateNearestNeighborExtrapolateImageFunction
+      OffsetValueType baseOffset = 0;
+      for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+      {
+        double continuousIndex = static_cast<double>(index[dim]);
+        for (unsigned int c = 0; c < ImageDimension; ++c)
+        {
+          continuousIndex += vectorToIndex[dim][c] * displacement[c];
+        }
+
+        baseIndex[dim] = Math::Floor<IndexValueType>(continuousIndex);
+        if (baseIndex[dim] < startIndex[dim])
+        {
+          baseIndex[dim] = startIndex[dim];
+          distance[dim] = 0.0;
+        }
+        else if (baseIndex[dim] >= endIndex[dim])
+        {
+          baseIndex[dim] = endIndex[dim];
+          distance[dim] = 0.0;
+        }
+        else
+        {
+          distance[dim] = continuousIndex - static_cast<double>(baseIndex[dim]);
+        }
+        baseOffset += (baseIndex[dim] - startIndex[dim]) * offsetTable[dim];
+      }
+
+      double interpolated[ImageDimension] = {};
+      for (unsigned int counter = 0; counter < (1u << ImageDimension); ++counter)
+      {
+        double          overlap = 1.0;
+        OffsetValueType neighborOffset = baseOffset;
+        for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+        {
+          if (counter & (1u << dim))
+          {
+            neighborOffset += offsetTable[dim];
+            overlap *= distance[dim];
+          }
+          else
+          {
+            overlap *= 1.0 - distance[dim];
+          }
+        }
+
+        // The neighbors without overlap may be outside of the buffer
+        if (overlap != 0.0)
+        {
+          const OutputPixelType & neighbor = buffer[neighborOffset];
+          for (unsigned int k = 0; k < ImageDimension; ++k)
+          {
+            interpolated[k] += overlap * static_cast<double>(neighbor[k]);
+          }
+        }
+      }
+
+      for (unsigned int k = 0; k < ImageDimension; ++k)
+      {
+        outputValue[k] = displacement[k] + static_cast<ValueType>(interpolated[k]);
+      }
+      composedIt.Set(outputValue);
+    }
+  };
+
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    bufferedRegion, composeRegion, nullptr);
 }
 } // end namespace itk
 
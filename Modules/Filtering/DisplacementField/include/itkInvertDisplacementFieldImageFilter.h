@@ -180,7 +180,8 @@ public:
   itkGetInputMacro(InverseFieldInitialEstimate, InverseDisplacementFieldType);
   /** @ITKEndGrouping */
 
-  /* Set the interpolator. */
+  /* Set the interpolator of the displacement field, used to compose it with the
+   * inverse field. */
   virtual void
   SetInterpolator(InterpolatorType * interpolator);
 
@@ -227,6 +228,12 @@ protected:
   DynamicThreadedGenerateData(const RegionType &) override;
 
 private:
+  /** Run one multi-threaded pass over the output region, which updates the
+   * inverse field and/or composes it with the displacement field, as set by
+   * m_DoThreadedEstimateInverse and m_DoThreadedComposition. */
+  void
+  ThreadedIteration(float oldProgress, float newProgress);
+
   /** The interpolator. */
   typename InterpolatorType::Pointer m_Interpolator{};
 
@@ -240,13 +247,17 @@ private:
   typename DisplacementFieldType::Pointer m_ComposedField{};
   typename RealImageType::Pointer         m_ScaledNormImage{};
 
-  RealType    m_MaxErrorNorm{};
-  RealType    m_MeanErrorNorm{};
-  RealType    m_Epsilon{};
-  SpacingType m_DisplacementFieldSpacing{};
-  bool        m_DoThreadedEstimateInverse{ false };
-  bool        m_EnforceBoundaryCondition{ true };
-  std::mutex  m_Mutex{};
+  RealType      m_MaxErrorNorm{};
+  RealType      m_MeanErrorNorm{};
+  RealType      m_ComposedMaxErrorNorm{};
+  RealType      m_ComposedMeanErrorNorm{};
+  RealType      m_Epsilon{};
+  SpacingType   m_DisplacementFieldSpacing{};
+  SizeValueType m_NumberOfPixelsInRegion{};
+  bool          m_DoThreadedEstimateInverse{ false };
+  bool          m_DoThreadedComposition{ false };
+  bool          m_EnforceBoundaryCondition{ true };
+  std::mutex    m_Mutex{};
 };
 
 } // end namespace itk
@@ -19,11 +19,12 @@
 #define itkInvertDisplacementFieldImageFilter_hxx
 
 
-#include "itkComposeDisplacementFieldsImageFilter.h"
 #include "itkImageDuplicator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkImageRegionIterator.h"
 #include "itkImageRegionIteratorWithIndex.h"
 #include <mutex>
+#include <typeinfo>
 #include "itkProgressTransformer.h"
 
 namespace itk
@@ -105,13 +106,39 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
   this->m_ScaledNormImage->SetRegions(displacementField->GetRequestedRegion());
   this->m_ScaledNormImage->AllocateInitialized();
 
-  const SizeValueType numberOfPixelsInRegion = (displacementField->GetRequestedRegion()).GetNumberOfPixels();
+  // The composed field is allocated once for all the iterations
+  this->m_ComposedField = DisplacementFieldType::New();
+  this->m_ComposedField->CopyInformation(displacementField);
+  this->m_ComposedField->SetRegions(displacementField->GetRequestedRegion());
+  this->m_ComposedField->Allocate();
+
+  this->m_Interpolator->SetInputImage(displacementField);
+
+  this->m_NumberOfPixelsInRegion = (displacementField->GetRequestedRegion()).GetNumberOfPixels();
   this->m_MaxErrorNorm = NumericTraits<RealType>::max();
   this->m_MeanErrorNorm = NumericTraits<RealType>::max();
-  unsigned int iteration = 0;
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
 
-  float oldProgress = 0.0f;
+  if (this->m_MaximumNumberOfIterations == 0)
+  {
+    this->UpdateProgress(1.0f);
+    return;
+  }
+
+  // The update of the inverse field at a point only depends on the composed
+  // field at this point, and the composition only on the inverse field at this
+  // point, so each iteration is a single pass which updates the inverse field
+  // and composes it for the next iteration. The first composition is done
+  // alone.
+  //
+  // As when the composition started each iteration, the stopping criteria are
+  // tested against the errors of the field before the previous update, and
+  // the first update is always done.
+  this->m_DoThreadedEstimateInverse = false;
+  this->m_DoThreadedComposition = true;
+  this->ThreadedIteration(0.0f, 0.5f / m_MaximumNumberOfIterations);
 
+  unsigned int iteration = 0;
   while ((iteration++ < this->m_MaximumNumberOfIterations) &&
          (this->m_MaxErrorNorm > this->m_MaxErrorToleranceThreshold) &&
          (this->m_MeanErrorNorm > this->m_MeanErrorToleranceThreshold))
@@ -119,31 +146,9 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
     itkDebugMacro("Iteration " << iteration << ": mean error norm = " << this->m_MeanErrorNorm
                                << ", max error norm = " << this->m_MaxErrorNorm);
 
-    using ComposerType = ComposeDisplacementFieldsImageFilter<DisplacementFieldType>;
-    auto composer = ComposerType::New();
-    composer->SetDisplacementField(displacementField);
-    composer->SetWarpingField(inverseDisplacementField);
-
-    this->m_ComposedField = composer->GetOutput();
-    this->m_ComposedField->Update();
-    this->m_ComposedField->DisconnectPipeline();
-
-    // Multithread processing to multiply each element of the composed field by 1 / spacing
-    this->m_MeanErrorNorm = RealType{};
-    this->m_MaxErrorNorm = RealType{};
-
-    float               newProgress = static_cast<float>(2 * iteration - 1) / (2 * m_MaximumNumberOfIterations);
-    ProgressTransformer pt(oldProgress, newProgress, this);
-    this->m_DoThreadedEstimateInverse = false;
-    this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
-    this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
-      this->GetOutput()->GetRequestedRegion(),
-      [this](const OutputImageRegionType & outputRegionForThread) {
-        this->DynamicThreadedGenerateData(outputRegionForThread);
-      },
-      pt.GetProcessObject());
-
-    this->m_MeanErrorNorm /= static_cast<RealType>(numberOfPixelsInRegion);
+    // The errors of the field before this update
+    this->m_MeanErrorNorm = this->m_ComposedMeanErrorNorm;
+    this->m_MaxErrorNorm = this->m_ComposedMaxErrorNorm;
 
     this->m_Epsilon = 0.5;
     if (iteration == 1)
@@ -151,23 +156,40 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
       this->m_Epsilon = 0.75;
     }
 
-    oldProgress = newProgress;
-    newProgress = static_cast<float>(2 * iteration) / (2 * m_MaximumNumberOfIterations);
-    ProgressTransformer pt2(oldProgress, newProgress, this);
-    // Multithread processing to estimate inverse field
+    // The composition is only needed if the stopping criteria will be checked
+    // for another iteration.
     this->m_DoThreadedEstimateInverse = true;
-    this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
-      this->GetOutput()->GetRequestedRegion(),
-      [this](const OutputImageRegionType & outputRegionForThread) {
-        this->DynamicThreadedGenerateData(outputRegionForThread);
-      },
-      pt2.GetProcessObject());
-    oldProgress = newProgress;
+    this->m_DoThreadedComposition = iteration < this->m_MaximumNumberOfIterations;
+
+    const float oldProgress = (iteration - 0.5f) / m_MaximumNumberOfIterations;
+    const float newProgress = (iteration + 0.5f) / m_MaximumNumberOfIterations;
+    this->ThreadedIteration(oldProgress, std::min(newProgress, 1.0f));
   }
 
   this->UpdateProgress(1.0f);
 }
 
+template <typename TInputImage, typename TOutputImage>
+void
+InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::ThreadedIteration(float oldProgress, float newProgress)
+{
+  this->m_ComposedMeanErrorNorm = RealType{};
+  this->m_ComposedMaxErrorNorm = RealType{};
+
+  ProgressTransformer pt(oldProgress, newProgress, this);
+  this->GetMultiThreader()->template ParallelizeImageRegion<TOutputImage::ImageDimension>(
+    this->GetOutput()->GetRequestedRegion(),
+    [this](const OutputImageRegionType & outputRegionForThread) {
+      this->DynamicThreadedGenerateData(outputRegionForThread);
+    },
+    pt.GetProcessObject());
+
+  if (this->m_DoThreadedComposition)
+  {
+    this->m_ComposedMeanErrorNorm /= static_cast<RealType>(this->m_NumberOfPixelsInRegion);
+  }
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(const RegionType & region)
@@ -177,14 +199,38 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGe
   const typename DisplacementFieldType::IndexType  startIndex = fullRegion.GetIndex();
   const typename DisplacementFieldType::PixelType  zeroVector{};
 
-  ImageRegionIterator ItE(this->m_ComposedField, region);
-  ImageRegionIterator ItS(this->m_ScaledNormImage, region);
+  const typename InverseDisplacementFieldType::Pointer inverseField = this->GetOutput();
+
+  // The composition is computed as ComposeDisplacementFieldsImageFilter does.
+  // The default interpolator is called without virtual calls.
+  const DefaultInterpolatorType * linearInterpolator = nullptr;
+  if (typeid(*this->m_Interpolator) == typeid(DefaultInterpolatorType))
+  {
+    linearInterpolator = static_cast<const DefaultInterpolatorType *>(this->m_Interpolator.GetPointer());
+  }
+  const DisplacementFieldType * displacementField = this->m_Interpolator->GetInputImage();
+
+  VectorType inverseSpacing;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    inverseSpacing[d] = 1.0 / this->m_DisplacementFieldSpacing[d];
+  }
+  RealType localMean{};
+  RealType localMax{};
+
+  ImageRegionIterator          ItE(this->m_ComposedField, region);
+  ImageRegionIterator          ItS(this->m_ScaledNormImage, region);
+  ImageRegionIteratorWithIndex ItI(inverseField, region);
+
+  PointType pointIn1;
+  PointType pointIn2;
+  PointType pointIn3;
 
-  if (this->m_DoThreadedEstimateInverse)
+  for (ItI.GoToBegin(), ItE.GoToBegin(), ItS.GoToBegin(); !ItI.IsAtEnd(); ++ItI, ++ItE, ++ItS)
   {
-    ImageRegionIteratorWithIndex ItI(this->GetOutput(), region);
+    const typename DisplacementFieldType::IndexType index = ItI.GetIndex();
 
-    for (ItI.GoToBegin(), ItE.GoToBegin(), ItS.GoToBegin(); !ItI.IsAtEnd(); ++ItI, ++ItE, ++ItS)
+    if (this->m_DoThreadedEstimateInverse)
     {
       VectorType     update = ItE.Get();
       const RealType scaledNorm = ItS.Get();
@@ -195,7 +241,6 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGe
       }
       update = ItI.Get() + update * this->m_Epsilon;
       ItI.Set(update);
-      typename DisplacementFieldType::IndexType index = ItI.GetIndex();
       if (this->m_EnforceBoundaryCondition)
       {
         for (unsigned int d = 0; d < ImageDimension; ++d)
@@ -208,20 +253,41 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGe
         }
       } // enforce boundary condition
     }
-  }
-  else
-  {
-    VectorType inverseSpacing;
-    RealType   localMean{};
-    RealType   localMax{};
-    for (unsigned int d = 0; d < ImageDimension; ++d)
-    {
-      inverseSpacing[d] = 1.0 / this->m_DisplacementFieldSpacing[d];
-    }
-    for (ItE.GoToBegin(), ItS.GoToBegin(); !ItE.IsAtEnd(); ++ItE, ++ItS)
+
+    if (this->m_DoThreadedComposition)
     {
-      const VectorType & displacement = ItE.Get();
-      RealType           scaledNorm = 0.0;
+      inverseField->TransformIndexToPhysicalPoint(index, pointIn1);
+
+      const VectorType warpVector = ItI.Get();
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        pointIn2[d] = pointIn1[d] + warpVector[d];
+      }
+
+      typename InterpolatorType::OutputType interpolated{};
+      if (linearInterpolator != nullptr)
+      {
+        const typename InterpolatorType::PointType           point(pointIn2);
+        const typename InterpolatorType::ContinuousIndexType continuousIndex =
+          displacementField->template TransformPhysicalPointToContinuousIndex<RealType>(point);
+        if (linearInterpolator->DefaultInterpolatorType::IsInsideBuffer(continuousIndex))
+        {
+          interpolated = linearInterpolator->DefaultInterpolatorType::EvaluateAtContinuousIndex(continuousIndex);
+        }
+      }
+      else if (this->m_Interpolator->IsInsideBuffer(pointIn2))
+      {
+        interpolated = this->m_Interpolator->Evaluate(pointIn2);
+      }
+
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        pointIn3[d] = pointIn2[d] + interpolated[d];
+      }
+      const VectorType displacement = pointIn3 - pointIn1;
+
+      // Scale the composed field by 1 / spacing for the error norms
+      RealType scaledNorm = 0.0;
       for (unsigned int d = 0; d < ImageDimension; ++d)
       {
         scaledNorm += itk::Math::sqr(displacement[d] * inverseSpacing[d]);
@@ -237,13 +303,15 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGe
       ItS.Set(scaledNorm);
       ItE.Set(-displacement);
     }
+  }
+
+  if (this->m_DoThreadedComposition)
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    this->m_ComposedMeanErrorNorm += localMean;
+    if (this->m_ComposedMaxErrorNorm < localMax)
     {
-      const std::lock_guard<std::mutex> lockGuard(m_Mutex);
-      this->m_MeanErrorNorm += localMean;
-      if (this->m_MaxErrorNorm < localMax)
-      {
-        this->m_MaxErrorNorm = localMax;
-      }
+      this->m_ComposedMaxErrorNorm = localMax;
     }
   }
 }
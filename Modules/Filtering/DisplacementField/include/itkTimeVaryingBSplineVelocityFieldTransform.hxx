@@ -83,6 +83,7 @@ TimeVaryingBSplineVelocityFieldTransform<TParametersValueType, VDimension>::Inte
   }
 
   integrator->SetNumberOfIntegrationSteps(this->GetNumberOfIntegrationSteps());
+  integrator->ComputeInverseDisplacementFieldOn();
   integrator->Update();
 
   const typename DisplacementFieldType::Pointer displacementField = integrator->GetOutput();
@@ -91,20 +92,7 @@ TimeVaryingBSplineVelocityFieldTransform<TParametersValueType, VDimension>::Inte
   this->SetDisplacementField(displacementField);
   this->GetModifiableInterpolator()->SetInputImage(displacementField);
 
-  auto inverseIntegrator = IntegratorType::New();
-  inverseIntegrator->SetInput(bsplinerOutput);
-  inverseIntegrator->SetLowerTimeBound(this->GetUpperTimeBound());
-  inverseIntegrator->SetUpperTimeBound(this->GetLowerTimeBound());
-
-  if (this->GetVelocityFieldInterpolator())
-  {
-    inverseIntegrator->SetVelocityFieldInterpolator(this->GetModifiableVelocityFieldInterpolator());
-  }
-
-  inverseIntegrator->SetNumberOfIntegrationSteps(this->GetNumberOfIntegrationSteps());
-  inverseIntegrator->Update();
-
-  const typename DisplacementFieldType::Pointer inverseDisplacementField = inverseIntegrator->GetOutput();
+  const typename DisplacementFieldType::Pointer inverseDisplacementField = integrator->GetInverseDisplacementField();
   inverseDisplacementField->DisconnectPipeline();
 
   this->SetInverseDisplacementField(inverseDisplacementField);
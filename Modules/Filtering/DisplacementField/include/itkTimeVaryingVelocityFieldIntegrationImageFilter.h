@@ -41,6 +41,16 @@ namespace itk
  * diffeomorphism.  The output diffeomorphism is produced using fourth order
  * Runge-Kutta.
  *
+ * The inverse diffeomorphism, integrated from the upper to the lower time
+ * bound, can be computed in the same pass, see
+ * SetComputeInverseDisplacementField(). The initial diffeomorphism only
+ * applies to the forward integration.
+ *
+ * When the velocity field interpolator is a VectorLinearInterpolateImageFunction,
+ * the default, the velocity field is interpolated by a kernel specialized
+ * for the geometry of the velocity field, which is cached before the
+ * integration.
+ *
  * \warning The output deformation field needs to have dimensionality of 1
  * less than the input time-varying velocity field.
  *
@@ -160,6 +170,23 @@ public:
   itkGetConstMacro(TimeBoundsAsRates, bool);
   itkBooleanMacro(TimeBoundsAsRates);
   /** @ITKEndGrouping */
+
+  /**
+   * Get/Set a flag to also integrate from the upper to the lower time bound,
+   * in the same pass, into the inverse displacement field output.
+   * Default = false.
+   */
+  /** @ITKStartGrouping */
+  itkSetMacro(ComputeInverseDisplacementField, bool);
+  itkGetConstMacro(ComputeInverseDisplacementField, bool);
+  itkBooleanMacro(ComputeInverseDisplacementField);
+  /** @ITKEndGrouping */
+
+  /** Get the inverse displacement field, the second output, which is only
+   * computed if ComputeInverseDisplacementField is on. */
+  DisplacementFieldType *
+  GetInverseDisplacementField();
+
 protected:
   TimeVaryingVelocityFieldIntegrationImageFilter();
   ~TimeVaryingVelocityFieldIntegrationImageFilter() override = default;
@@ -170,6 +197,9 @@ protected:
   void
   GenerateOutputInformation() override;
 
+  void
+  AllocateOutputs() override;
+
   void
   BeforeThreadedGenerateData() override;
 
@@ -180,6 +210,21 @@ protected:
   VectorType
   IntegrateVelocityAtPoint(const PointType & initialSpatialPoint, const TimeVaryingVelocityFieldType * inputField);
 
+  /** Integrate from lowerTimeBound to upperTimeBound, starting at the
+   * initial spatial point displaced by the initial displacement. */
+  VectorType
+  IntegrateVelocityAtPoint(const PointType &  initialSpatialPoint,
+                           const VectorType & initialDisplacement,
+                           RealType           lowerTimeBound,
+                           RealType           upperTimeBound) const;
+
+  using VelocityFieldPointType = typename TimeVaryingVelocityFieldType::PointType;
+
+  /** Interpolate the velocity at a point of the velocity field domain.
+   * Returns false if the point is outside of the buffer. */
+  bool
+  EvaluateVelocityAtPoint(const VelocityFieldPointType & point, VectorType & velocity) const;
+
   RealType m_LowerTimeBound{};
   RealType m_UpperTimeBound{};
 
@@ -193,8 +238,29 @@ protected:
 
   bool m_TimeBoundsAsRates{ true };
 
+  bool m_ComputeInverseDisplacementField{ false };
+
 private:
   VelocityFieldInterpolatorPointer m_VelocityFieldInterpolator{};
+
+  /** Mapping of the time bounds into the time dimension of the velocity
+   * field, cached before the integration. */
+  RealType m_TimeOrigin{ 0.0 };
+  RealType m_TimeScale{ 1.0 };
+
+  /** Geometry of the velocity field, cached before the integration for the
+   * linear interpolation kernel. */
+  using VelocityFieldPixelType = typename TimeVaryingVelocityFieldType::PixelType;
+  using VelocityFieldIndexType = typename TimeVaryingVelocityFieldType::IndexType;
+  using VelocityFieldMatrixType = typename TimeVaryingVelocityFieldType::DirectionType;
+
+  bool                           m_UseLinearVelocityFieldKernel{ false };
+  const VelocityFieldPixelType * m_VelocityFieldBuffer{ nullptr };
+  VelocityFieldMatrixType        m_VelocityFieldPhysicalPointToIndex{};
+  VelocityFieldPointType         m_VelocityFieldOrigin{};
+  VelocityFieldIndexType         m_VelocityFieldStartIndex{};
+  VelocityFieldIndexType         m_VelocityFieldEndIndex{};
+  OffsetValueType                m_VelocityFieldOffsetTable[InputImageDimension]{};
 };
 } // namespace itk
 
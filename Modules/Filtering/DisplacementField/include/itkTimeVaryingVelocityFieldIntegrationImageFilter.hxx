@@ -18,9 +18,12 @@
 #ifndef itkTimeVaryingVelocityFieldIntegrationImageFilter_hxx
 #define itkTimeVaryingVelocityFieldIntegrationImageFilter_hxx
 
+#include "itkImageRegionIterator.h"
 #include "itkImageRegionIteratorWithIndex.h"
 #include "itkVectorLinearInterpolateImageFunction.h"
 
+#include <typeinfo>
+
 namespace itk
 {
 
@@ -54,9 +57,22 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField,
   auto deformationFieldInterpolator = DefaultDisplacementFieldInterpolatorType::New();
 
   this->m_DisplacementFieldInterpolator = deformationFieldInterpolator;
+
+  // The inverse displacement field
+  this->SetNthOutput(1, this->MakeOutput(1));
+
   this->DynamicMultiThreadingOn();
 }
 
+template <typename TTimeVaryingVelocityField, typename TDisplacementField>
+auto
+TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField,
+                                               TDisplacementField>::GetInverseDisplacementField()
+  -> DisplacementFieldType *
+{
+  return dynamic_cast<DisplacementFieldType *>(this->ProcessObject::GetOutput(1));
+}
+
 template <typename TTimeVaryingVelocityField, typename TDisplacementField>
 void
 TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField,
@@ -113,6 +129,30 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField,
   output->SetSpacing(spacing);
   output->SetDirection(direction);
   output->SetRegions(size);
+
+  DisplacementFieldType * inverseOutput = this->GetInverseDisplacementField();
+  if (inverseOutput)
+  {
+    inverseOutput->CopyInformation(output);
+    inverseOutput->SetRegions(size);
+  }
+}
+
+template <typename TTimeVaryingVelocityField, typename TDisplacementField>
+void
+TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDisplacementField>::AllocateOutputs()
+{
+  // The inverse displacement field is only allocated when it is computed.
+  DisplacementFieldType * output = this->GetOutput();
+  output->SetBufferedRegion(output->GetRequestedRegion());
+  output->Allocate();
+
+  if (this->m_ComputeInverseDisplacementField)
+  {
+    DisplacementFieldType * inverseOutput = this->GetInverseDisplacementField();
+    inverseOutput->SetBufferedRegion(output->GetRequestedRegion());
+    inverseOutput->Allocate();
+  }
 }
 
 template <typename TTimeVaryingVelocityField, typename TDisplacementField>
@@ -120,12 +160,65 @@ void
 TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField,
                                                TDisplacementField>::BeforeThreadedGenerateData()
 {
-  this->m_VelocityFieldInterpolator->SetInputImage(this->GetInput());
-  this->m_NumberOfTimePoints = this->GetInput()->GetLargestPossibleRegion().GetSize()[InputImageDimension - 1];
+  const TimeVaryingVelocityFieldType * inputField = this->GetInput();
+
+  this->m_VelocityFieldInterpolator->SetInputImage(inputField);
+  this->m_NumberOfTimePoints = inputField->GetLargestPossibleRegion().GetSize()[InputImageDimension - 1];
   if (!this->m_InitialDiffeomorphism.IsNull())
   {
     this->m_DisplacementFieldInterpolator->SetInputImage(this->m_InitialDiffeomorphism);
   }
+
+  // With TimeBoundsAsRates On, we need to map the time dimension of the input image to the
+  // normalized domain of [0,1].
+  this->m_TimeOrigin = 0.0;
+  this->m_TimeScale = 1.0;
+  if (this->m_TimeBoundsAsRates)
+  {
+    using RegionType = typename TimeVaryingVelocityFieldType::RegionType;
+    const RegionType region = inputField->GetLargestPossibleRegion();
+
+    typename RegionType::IndexType lastIndex = region.GetIndex();
+    typename RegionType::SizeType  size = region.GetSize();
+    for (unsigned int d = 0; d < InputImageDimension; ++d)
+    {
+      lastIndex[d] += (size[d] - 1);
+    }
+
+    VelocityFieldPointType spaceTimeEnd;
+    inputField->TransformIndexToPhysicalPoint(lastIndex, spaceTimeEnd);
+
+    this->m_TimeOrigin = inputField->GetOrigin()[InputImageDimension - 1];
+    this->m_TimeScale = spaceTimeEnd[InputImageDimension - 1] - this->m_TimeOrigin;
+  }
+
+  // Cache the geometry of the velocity field for the linear interpolation kernel.
+  using DefaultVelocityFieldInterpolatorType =
+    VectorLinearInterpolateImageFunction<TimeVaryingVelocityFieldType, ScalarType>;
+
+  this->m_UseLinearVelocityFieldKernel = false;
+  if constexpr (std::is_same_v<TimeVaryingVelocityFieldType, Image<VelocityFieldPixelType, InputImageDimension>>)
+  {
+    // Only the default interpolator itself, not a class derived from it,
+    // is known to compute what the kernel computes.
+    if (typeid(*this->m_VelocityFieldInterpolator) == typeid(DefaultVelocityFieldInterpolatorType))
+    {
+      this->m_UseLinearVelocityFieldKernel = true;
+      this->m_VelocityFieldBuffer = inputField->GetBufferPointer();
+      this->m_VelocityFieldPhysicalPointToIndex = inputField->GetPhysicalPointToIndex();
+      this->m_VelocityFieldOrigin = inputField->GetOrigin();
+
+      const typename TimeVaryingVelocityFieldType::RegionType bufferedRegion = inputField->GetBufferedRegion();
+      this->m_VelocityFieldStartIndex = bufferedRegion.GetIndex();
+      this->m_VelocityFieldEndIndex = bufferedRegion.GetUpperIndex();
+
+      const OffsetValueType * offsetTable = inputField->GetOffsetTable();
+      for (unsigned int d = 0; d < InputImageDimension; ++d)
+      {
+        this->m_VelocityFieldOffsetTable[d] = offsetTable[d];
+      }
+    }
+  }
 }
 
 template <typename TTimeVaryingVelocityField, typename TDisplacementField>
@@ -136,6 +229,10 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
   if (Math::ExactlyEquals(this->m_LowerTimeBound, this->m_UpperTimeBound) || this->m_NumberOfIntegrationSteps == 0)
   {
     this->GetOutput()->FillBuffer(typename DisplacementFieldType::PixelType{});
+    if (this->m_ComputeInverseDisplacementField)
+    {
+      this->GetInverseDisplacementField()->FillBuffer(typename DisplacementFieldType::PixelType{});
+    }
     return;
   }
 
@@ -143,12 +240,28 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
 
   const typename DisplacementFieldType::Pointer outputField = this->GetOutput();
 
-  for (ImageRegionIteratorWithIndex It(outputField, region); !It.IsAtEnd(); ++It)
+  if (!this->m_ComputeInverseDisplacementField)
+  {
+    for (ImageRegionIteratorWithIndex It(outputField, region); !It.IsAtEnd(); ++It)
+    {
+      PointType point;
+      outputField->TransformIndexToPhysicalPoint(It.GetIndex(), point);
+      const VectorType displacement = this->IntegrateVelocityAtPoint(point, inputField);
+      It.Set(displacement);
+    }
+    return;
+  }
+
+  // Integrate both directions from each point in a single pass.
+  DisplacementFieldType * inverseField = this->GetInverseDisplacementField();
+
+  ImageRegionIterator<DisplacementFieldType> ItI(inverseField, region);
+  for (ImageRegionIteratorWithIndex It(outputField, region); !It.IsAtEnd(); ++It, ++ItI)
   {
     PointType point;
     outputField->TransformIndexToPhysicalPoint(It.GetIndex(), point);
-    const VectorType displacement = this->IntegrateVelocityAtPoint(point, inputField);
-    It.Set(displacement);
+    It.Set(this->IntegrateVelocityAtPoint(point, inputField));
+    ItI.Set(this->IntegrateVelocityAtPoint(point, VectorType{}, this->m_UpperTimeBound, this->m_LowerTimeBound));
   }
 }
 
@@ -156,16 +269,11 @@ template <typename TTimeVaryingVelocityField, typename TDisplacementField>
 auto
 TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDisplacementField>::IntegrateVelocityAtPoint(
   const PointType &                    initialSpatialPoint,
-  const TimeVaryingVelocityFieldType * inputField) -> VectorType
+  const TimeVaryingVelocityFieldType * itkNotUsed(inputField)) -> VectorType
 {
-  // Solve the initial value problem using fourth-order Runge-Kutta
-  //    y' = f(t, y), y(t_0) = y_0
-
-  constexpr VectorType zeroVector{};
-
   // Initial conditions
 
-  VectorType displacement = zeroVector;
+  VectorType displacement{};
   if (!this->m_InitialDiffeomorphism.IsNull())
   {
     if (this->m_DisplacementFieldInterpolator->IsInsideBuffer(initialSpatialPoint))
@@ -174,47 +282,39 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
     }
   }
 
-  // Perform the integration.
-  // With TimeBoundsAsRates On, we need to map the time dimension of the input image to the
-  // normalized domain of [0,1].
-
-  RealType timeOrigin = 0.;
-  RealType timeScale = 1.;
-  if (m_TimeBoundsAsRates)
-  {
-    typename TimeVaryingVelocityFieldType::PointType spaceTimeOrigin = inputField->GetOrigin();
+  return this->IntegrateVelocityAtPoint(
+    initialSpatialPoint, displacement, this->m_LowerTimeBound, this->m_UpperTimeBound);
+}
 
-    using RegionType = typename TimeVaryingVelocityFieldType::RegionType;
-    const RegionType region = inputField->GetLargestPossibleRegion();
+template <typename TTimeVaryingVelocityField, typename TDisplacementField>
+auto
+TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDisplacementField>::IntegrateVelocityAtPoint(
+  const PointType &  initialSpatialPoint,
+  const VectorType & initialDisplacement,
+  RealType           lowerTimeBound,
+  RealType           upperTimeBound) const -> VectorType
+{
+  // Solve the initial value problem using fourth-order Runge-Kutta
+  //    y' = f(t, y), y(t_0) = y_0
 
-    typename RegionType::IndexType lastIndex = region.GetIndex();
-    typename RegionType::SizeType  size = region.GetSize();
-    for (unsigned int d = 0; d < InputImageDimension; ++d)
-    {
-      lastIndex[d] += (size[d] - 1);
-    }
+  constexpr VectorType zeroVector{};
 
-    typename TimeVaryingVelocityFieldType::PointType spaceTimeEnd;
-    inputField->TransformIndexToPhysicalPoint(lastIndex, spaceTimeEnd);
+  VectorType displacement = initialDisplacement;
 
-    timeOrigin = spaceTimeOrigin[InputImageDimension - 1];
-    const RealType timeEnd = spaceTimeEnd[InputImageDimension - 1];
-    timeScale = timeEnd - timeOrigin;
-  }
+  // Perform the integration.
 
-  RealType timePointInImage = timeOrigin + this->m_LowerTimeBound * timeScale;
+  RealType timePointInImage = this->m_TimeOrigin + lowerTimeBound * this->m_TimeScale;
 
   // Calculate the delta time used for integration
-  const RealType deltaTime =
-    (this->m_UpperTimeBound - this->m_LowerTimeBound) / static_cast<RealType>(this->m_NumberOfIntegrationSteps);
-  const RealType deltaTimeInImage = timeScale * deltaTime;
+  const RealType deltaTime = (upperTimeBound - lowerTimeBound) / static_cast<RealType>(this->m_NumberOfIntegrationSteps);
+  const RealType deltaTimeInImage = this->m_TimeScale * deltaTime;
 
   for (unsigned int n = 0; n < this->m_NumberOfIntegrationSteps; ++n)
   {
-    typename TimeVaryingVelocityFieldType::PointType x1;
-    typename TimeVaryingVelocityFieldType::PointType x2;
-    typename TimeVaryingVelocityFieldType::PointType x3;
-    typename TimeVaryingVelocityFieldType::PointType x4;
+    VelocityFieldPointType x1;
+    VelocityFieldPointType x2;
+    VelocityFieldPointType x3;
+    VelocityFieldPointType x4;
 
     for (unsigned int d = 0; d < OutputImageDimension; ++d)
     {
@@ -230,9 +330,8 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
     x4[OutputImageDimension] = timePointInImage + deltaTimeInImage;
 
     VectorType f1 = zeroVector;
-    if (this->m_VelocityFieldInterpolator->IsInsideBuffer(x1))
+    if (this->EvaluateVelocityAtPoint(x1, f1))
     {
-      f1 = this->m_VelocityFieldInterpolator->Evaluate(x1);
       for (unsigned int jj = 0; jj < OutputImageDimension; ++jj)
       {
         x2[jj] += f1[jj] * deltaTime * 0.5;
@@ -240,9 +339,8 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
     }
 
     VectorType f2 = zeroVector;
-    if (this->m_VelocityFieldInterpolator->IsInsideBuffer(x2))
+    if (this->EvaluateVelocityAtPoint(x2, f2))
     {
-      f2 = this->m_VelocityFieldInterpolator->Evaluate(x2);
       for (unsigned int jj = 0; jj < OutputImageDimension; ++jj)
       {
         x3[jj] += f2[jj] * deltaTime * 0.5;
@@ -250,9 +348,8 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
     }
 
     VectorType f3 = zeroVector;
-    if (this->m_VelocityFieldInterpolator->IsInsideBuffer(x3))
+    if (this->EvaluateVelocityAtPoint(x3, f3))
     {
-      f3 = this->m_VelocityFieldInterpolator->Evaluate(x3);
       for (unsigned int jj = 0; jj < OutputImageDimension; ++jj)
       {
         x4[jj] += f3[jj] * deltaTime;
@@ -260,10 +357,7 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
     }
 
     VectorType f4 = zeroVector;
-    if (this->m_VelocityFieldInterpolator->IsInsideBuffer(x4))
-    {
-      f4 = this->m_VelocityFieldInterpolator->Evaluate(x4);
-    }
+    this->EvaluateVelocityAtPoint(x4, f4);
 
     for (unsigned int jj = 0; jj < OutputImageDimension; ++jj)
     {
@@ -276,6 +370,88 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
   return displacement;
 }
 
+template <typename TTimeVaryingVelocityField, typename TDisplacementField>
+bool
+TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDisplacementField>::EvaluateVelocityAtPoint(
+  const VelocityFieldPointType & point,
+  VectorType &                   velocity) const
+{
+  if (!this->m_UseLinearVelocityFieldKernel)
+  {
+    if (!this->m_VelocityFieldInterpolator->IsInsideBuffer(point))
+    {
+      return false;
+    }
+    velocity = this->m_VelocityFieldInterpolator->Evaluate(point);
+    return true;
+  }
+
+  // Multilinear interpolation of the velocity field, equivalent to
+  // VectorLinearInterpolateImageFunction, on the cached geometry.
+  double difference[InputImageDimension];
+  for (unsigned int j = 0; j < InputImageDimension; ++j)
+  {
+    difference[j] = point[j] - this->m_VelocityFieldOrigin[j];
+  }
+
+  OffsetValueType baseOffset = 0;
+  OffsetValueType upperOffsets[InputImageDimension];
+  double          distance[InputImageDimension];
+  for (unsigned int i = 0; i < InputImageDimension; ++i)
+  {
+    double continuousIndex = 0.0;
+    for (unsigned int j = 0; j < InputImageDimension; ++j)
+    {
+      continuousIndex += this->m_VelocityFieldPhysicalPointToIndex[i][j] * difference[j];
+    }
+    continuousIndex = static_cast<ScalarType>(continuousIndex);
+
+    // Test for negative of a positive so we can catch NaN's.
+    if (!(continuousIndex >= this->m_VelocityFieldStartIndex[i] - 0.5 &&
+          continuousIndex < this->m_VelocityFieldEndIndex[i] + 0.5))
+    {
+      return false;
+    }
+
+    const auto baseIndex = Math::Floor<IndexValueType>(continuousIndex);
+    distance[i] = continuousIndex - static_cast<double>(baseIndex);
+
+    // Neighbors outside of the buffer are clamped to its boundary.
+    const IndexValueType lowerIndex = std::max(baseIndex, this->m_VelocityFieldStartIndex[i]);
+    const IndexValueType upperIndex = std::min(baseIndex + 1, this->m_VelocityFieldEndIndex[i]);
+    baseOffset += (lowerIndex - this->m_VelocityFieldStartIndex[i]) * this->m_VelocityFieldOffsetTable[i];
+    upperOffsets[i] = (upperIndex - lowerIndex) * this->m_VelocityFieldOffsetTable[i];
+  }
+
+  velocity.Fill(0.0);
+  for (unsigned int neighbor = 0; neighbor < (1u << InputImageDimension); ++neighbor)
+  {
+    double          overlap = 1.0;
+    OffsetValueType offset = baseOffset;
+    for (unsigned int i = 0; i < InputImageDimension; ++i)
+    {
+      if (neighbor & (1u << i))
+      {
+        overlap *= distance[i];
+        offset += upperOffsets[i];
+      }
+      else
+      {
+        overlap *= 1.0 - distance[i];
+      }
+    }
+    if (overlap != 0.0)
+    {
+      const VelocityFieldPixelType & value = this->m_VelocityFieldBuffer[offset];
+      for (unsigned int k = 0; k < OutputImageDimension; ++k)
+      {
+        velocity[k] += overlap * static_cast<double>(value[k]);
+      }
+    }
+  }
+  return true;
+}
+
 template <typename TTimeVaryingVelocityField, typename TDisplacementField>
 void
 TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDisplacementField>::PrintSelf(
@@ -288,6 +464,7 @@ TimeVaryingVelocityFieldIntegrationImageFilter<TTimeVaryingVelocityField, TDispl
   os << indent << "LowerTimeBound: " << this->m_LowerTimeBound << std::endl;
   os << indent << "UpperTimeBound: " << this->m_UpperTimeBound << std::endl;
   os << indent << "NumberOfIntegrationSteps: " << this->m_NumberOfIntegrationSteps << std::endl;
+  itkPrintSelfBooleanMacro(ComputeInverseDisplacementField);
   itkPrintSelfObjectMacro(InitialDiffeomorphism);
   itkPrintSelfObjectMacro(DisplacementFieldInterpolator);
 }
@@ -43,6 +43,7 @@ TimeVaryingVelocityFieldTransform<TParametersValueType, VDimension>::IntegrateVe
     }
 
     integrator->SetNumberOfIntegrationSteps(this->GetNumberOfIntegrationSteps());
+    integrator->ComputeInverseDisplacementFieldOn();
     integrator->Update();
 
     const typename DisplacementFieldType::Pointer displacementField = integrator->GetOutput();
@@ -51,19 +52,7 @@ TimeVaryingVelocityFieldTransform<TParametersValueType, VDimension>::IntegrateVe
     this->SetDisplacementField(displacementField);
     this->GetModifiableInterpolator()->SetInputImage(displacementField);
 
-    auto inverseIntegrator = IntegratorType::New();
-    inverseIntegrator->SetInput(this->GetVelocityField());
-    inverseIntegrator->SetLowerTimeBound(this->GetUpperTimeBound());
-    inverseIntegrator->SetUpperTimeBound(this->GetLowerTimeBound());
-    if (!this->GetVelocityFieldInterpolator())
-    {
-      inverseIntegrator->SetVelocityFieldInterpolator(this->GetModifiableVelocityFieldInterpolator());
-    }
-
-    inverseIntegrator->SetNumberOfIntegrationSteps(this->GetNumberOfIntegrationSteps());
-    inverseIntegrator->Update();
-
-    const typename DisplacementFieldType::Pointer inverseDisplacementField = inverseIntegrator->GetOutput();
+    const typename DisplacementFieldType::Pointer inverseDisplacementField = integrator->GetInverseDisplacementField();
     inverseDisplacementField->DisconnectPipeline();
 
     this->SetInverseDisplacementField(inverseDisplacementField);
@@ -0,0 +1,153 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTransformToDisplacementFieldCache_h
+#define itkTransformToDisplacementFieldCache_h
+
+#include "itkDisplacementFieldTransform.h"
+#include "itkImageBase.h"
+
+#include <mutex>
+
+namespace itk
+{
+/** \class TransformToDisplacementFieldCache
+ * \brief Caches a transform flattened into a DisplacementFieldTransform on a reference grid.
+ *
+ * Deep CompositeTransform chains (for example several affine and deformable
+ * stages read from a transform file) are expensive to evaluate, and are often
+ * applied many times on the same grid: to a label image, an intensity image
+ * and any number of derived maps. This class samples the transform once on a
+ * reference grid with the multithreaded TransformToDisplacementFieldFilter,
+ * and hands out a DisplacementFieldTransform that linearly interpolates the
+ * sampled field.
+ *
+ * The field is recomputed on the next call to GetDisplacementFieldTransform()
+ * or Update() whenever the transform or the reference grid has changed since
+ * the last computation. A CompositeTransform reports the latest modification
+ * time of its sub-transforms, so changes to any stage of the chain invalidate
+ * the cache. Setting a reference image whose grid is the same as the current
+ * one keeps the cached field, so the same cache can be used for every image
+ * that shares a grid.
+ *
+ * The flattened transform is only an approximation of the original one
+ * between grid points, and it maps points outside the reference grid to
+ * themselves. It is meant for resampling onto that grid.
+ *
+ * GetDisplacementFieldTransform() and Update() may be called concurrently;
+ * the computation itself is done once, by the first caller.
+ *
+ * \sa TransformToDisplacementFieldFilter
+ *
+ * \ingroup ITKDisplacementField
+ */
+template <typename TParametersValueType = double, unsigned int VDimension = 3>
+class ITK_TEMPLATE_EXPORT TransformToDisplacementFieldCache : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(TransformToDisplacementFieldCache);
+
+  /** Standard class type aliases. */
+  using Self = TransformToDisplacementFieldCache;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(TransformToDisplacementFieldCache);
+
+  static constexpr unsigned int Dimension = VDimension;
+
+  using TransformType = Transform<TParametersValueType, VDimension, VDimension>;
+  using DisplacementFieldTransformType = DisplacementFieldTransform<TParametersValueType, VDimension>;
+  using DisplacementFieldType = typename DisplacementFieldTransformType::DisplacementFieldType;
+  using ReferenceImageBaseType = ImageBase<VDimension>;
+
+  using RegionType = typename DisplacementFieldType::RegionType;
+  using SpacingType = typename DisplacementFieldType::SpacingType;
+  using PointType = typename DisplacementFieldType::PointType;
+  using DirectionType = typename DisplacementFieldType::DirectionType;
+
+  /** Set/Get the transform to flatten, typically a CompositeTransform. It maps
+   * points of the reference grid to the space being resampled. */
+  /** @ITKStartGrouping */
+  itkSetConstObjectMacro(Transform, TransformType);
+  itkGetConstObjectMacro(Transform, TransformType);
+  /** @ITKEndGrouping */
+
+  /** Set the reference grid from an image. Only the largest possible region,
+   * spacing, origin and direction of the image are used, and the cache is
+   * invalidated only if they differ from the current grid. */
+  void
+  SetReferenceImage(const ReferenceImageBaseType * image);
+
+  /** Get the reference grid. */
+  /** @ITKStartGrouping */
+  itkGetConstReferenceMacro(ReferenceRegion, RegionType);
+  itkGetConstReferenceMacro(ReferenceSpacing, SpacingType);
+  itkGetConstReferenceMacro(ReferenceOrigin, PointType);
+  itkGetConstReferenceMacro(ReferenceDirection, DirectionType);
+  /** @ITKEndGrouping */
+
+  /** Recompute the displacement field if the transform or the reference grid
+   * has changed since it was last computed. */
+  void
+  Update();
+
+  /** Update the cache, and return the flattened transform. A recomputation
+   * replaces the transform rather than modifying it, so the returned
+   * SmartPointer stays valid while other threads update the cache. */
+  typename DisplacementFieldTransformType::ConstPointer
+  GetDisplacementFieldTransform();
+
+protected:
+  TransformToDisplacementFieldCache();
+  ~TransformToDisplacementFieldCache() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Recompute the displacement field if needed. m_Mutex must be held. */
+  void
+  UpdateCache();
+
+  typename TransformType::ConstPointer m_Transform{};
+
+  RegionType    m_ReferenceRegion{};
+  SpacingType   m_ReferenceSpacing{};
+  PointType     m_ReferenceOrigin{};
+  DirectionType m_ReferenceDirection{};
+
+  typename DisplacementFieldTransformType::Pointer m_DisplacementFieldTransform{};
+
+  /** Times of this object and of the transform when the field was computed. */
+  ModifiedTimeType m_CacheTime{};
+  ModifiedTimeType m_TransformCacheTime{};
+
+  std::mutex m_Mutex{};
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkTransformToDisplacementFieldCache.hxx"
+#endif
+
+#endif
@@ -0,0 +1,142 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTransformToDisplacementFieldCache_hxx
+#define itkTransformToDisplacementFieldCache_hxx
+
+#include "itkTransformToDisplacementFieldFilter.h"
+
+namespace itk
+{
+
+template <typename TParametersValueType, unsigned int VDimension>
+TransformToDisplacementFieldCache<TParametersValueType, VDimension>::TransformToDisplacementFieldCache()
+{
+  m_ReferenceSpacing.Fill(1.0);
+  m_ReferenceOrigin.Fill(0.0);
+  m_ReferenceDirection.SetIdentity();
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+TransformToDisplacementFieldCache<TParametersValueType, VDimension>::SetReferenceImage(
+  const ReferenceImageBaseType * image)
+{
+  if (image == nullptr)
+  {
+    itkExceptionMacro("The reference image is null.");
+  }
+
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+
+  if (m_ReferenceRegion != image->GetLargestPossibleRegion() || m_ReferenceSpacing != image->GetSpacing() ||
+      m_ReferenceOrigin != image->GetOrigin() || m_ReferenceDirection != image->GetDirection())
+  {
+    m_ReferenceRegion = image->GetLargestPossibleRegion();
+    m_ReferenceSpacing = image->GetSpacing();
+    m_ReferenceOrigin = image->GetOrigin();
+    m_ReferenceDirection = image->GetDirection();
+    this->Modified();
+  }
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+TransformToDisplacementFieldCache<TParametersValueType, VDimension>::Update()
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  this->UpdateCache();
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+auto
+TransformToDisplacementFieldCache<TParametersValueType, VDimension>::GetDisplacementFieldTransform()
+  -> typename DisplacementFieldTransformType::ConstPointer
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  this->UpdateCache();
+  typename DisplacementFieldTransformType::ConstPointer displacementFieldTransform = m_DisplacementFieldTransform;
+  return displacementFieldTransform;
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+TransformToDisplacementFieldCache<TParametersValueType, VDimension>::UpdateCache()
+{
+  if (!m_Transform)
+  {
+    itkExceptionMacro("No transform is specified.");
+  }
+
+  // A CompositeTransform reports the latest time of its sub-transforms, so
+  // this also catches changes deep inside the chain.
+  const ModifiedTimeType transformTime = m_Transform->GetMTime();
+  if (m_DisplacementFieldTransform && this->GetMTime() <= m_CacheTime && transformTime <= m_TransformCacheTime)
+  {
+    return;
+  }
+
+  if (m_ReferenceRegion.GetNumberOfPixels() == 0)
+  {
+    itkExceptionMacro("No reference grid is specified.");
+  }
+
+  using FilterType = TransformToDisplacementFieldFilter<DisplacementFieldType, TParametersValueType>;
+  auto filter = FilterType::New();
+  filter->SetTransform(m_Transform);
+  filter->SetOutputStartIndex(m_ReferenceRegion.GetIndex());
+  filter->SetSize(m_ReferenceRegion.GetSize());
+  filter->SetOutputSpacing(m_ReferenceSpacing);
+  filter->SetOutputOrigin(m_ReferenceOrigin);
+  filter->SetOutputDirection(m_ReferenceDirection);
+  filter->Update();
+
+  typename DisplacementFieldType::Pointer field = filter->GetOutput();
+  field->DisconnectPipeline();
+
+  auto displacementFieldTransform = DisplacementFieldTransformType::New();
+  displacementFieldTransform->SetDisplacementField(field);
+
+  m_DisplacementFieldTransform = displacementFieldTransform;
+  m_CacheTime = this->GetMTime();
+  m_TransformCacheTime = transformTime;
+}
+
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+TransformToDisplacementFieldCache<TParametersValueType, VDimension>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  itkPrintSelfObjectMacro(Transform);
+  os << indent << "ReferenceRegion: " << m_ReferenceRegion << std::endl;
+  os << indent << "ReferenceSpacing: " << m_ReferenceSpacing << std::endl;
+  os << indent << "ReferenceOrigin: " << m_ReferenceOrigin << std::endl;
+  os << indent << "ReferenceDirection: " << m_ReferenceDirection << std::endl;
+  itkPrintSelfObjectMacro(DisplacementFieldTransform);
+  os << indent << "CacheTime: " << m_CacheTime << std::endl;
+  os << indent << "TransformCacheTime: " << m_TransformCacheTime << std::endl;
+}
+
+} // end namespace itk
+
+#endif
@@ -23,6 +23,8 @@
 #include "itkTotalProgressReporter.h"
 #include "itkImageScanlineIterator.h"
 
+#include <vector>
+
 namespace itk
 {
 
@@ -176,36 +178,39 @@ TransformToDisplacementFieldFilter<TOutputImage, TParametersValueType>::Nonlinea
   OutputImageType *     output = this->GetOutput();
   const TransformType * transform = this->GetInput()->Get();
 
-  // Define a few variables that will be used to translate from an input pixel
-  // to an output pixel
-  PointType outputPoint;       // Coordinates of output pixel
-  PointType transformedPoint;  // Coordinates of transformed pixel
-  PixelType displacementPixel; // the difference, cast to pixel type
-
+  // Points of one scanline are transformed together, so that transforms
+  // providing a batched TransformPoints can amortize their setup.
+  const SizeValueType                                  scanlineLength = outputRegionForThread.GetSize()[0];
+  std::vector<typename TransformType::InputPointType>  outputPoints(scanlineLength);
+  std::vector<typename TransformType::OutputPointType> transformedPoints(scanlineLength);
+  PixelType                                            displacementPixel; // the difference, cast to pixel type
 
   TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
 
   // Walk the output region for this thread.
   for (ImageScanlineIterator outIt(output, outputRegionForThread); !outIt.IsAtEnd(); outIt.NextLine())
   {
-    while (!outIt.IsAtEndOfLine())
+    // Determine the coordinates of the output pixels of this scanline
+    IndexType index = outIt.GetIndex();
+    for (SizeValueType i = 0; i < scanlineLength; ++i, ++index[0])
     {
-      // Determine the index of the current output pixel
-      output->TransformIndexToPhysicalPoint(outIt.ComputeIndex(), outputPoint);
+      output->TransformIndexToPhysicalPoint(index, outputPoints[i]);
+    }
 
-      // Compute corresponding input pixel position
-      transformedPoint = transform->TransformPoint(outputPoint);
+    // Compute corresponding input pixel positions
+    transform->TransformPoints(outputPoints.data(), transformedPoints.data(), scanlineLength);
 
-      const typename PointType::VectorType displacementVector = transformedPoint - outputPoint;
+    for (SizeValueType i = 0; i < scanlineLength; ++i, ++outIt)
+    {
       // Cast PointType -> PixelType
       for (IndexValueType idx = 0; idx < ImageDimension; ++idx)
       {
-        displacementPixel[idx] = static_cast<typename PixelType::ValueType>(displacementVector[idx]);
+        displacementPixel[idx] =
+          static_cast<typename PixelType::ValueType>(transformedPoints[i][idx] - outputPoints[i][idx]);
       }
       outIt.Set(displacementPixel);
-      ++outIt;
     }
-    progress.Completed(outputRegionForThread.GetSize()[0]);
+    progress.Completed(scanlineLength);
   }
 }
 
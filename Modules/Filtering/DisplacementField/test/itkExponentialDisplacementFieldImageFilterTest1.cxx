@@ -0,0 +1,163 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkExponentialDisplacementFieldImageFilter.h"
+#include "itkAddImageFilter.h"
+#include "itkEuler3DTransform.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkVectorLinearInterpolateNearestNeighborExtrapolateImageFunction.h"
+#include "itkWarpVectorImageFilter.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int ImageDimension = 3;
+using PixelType = itk::Vector<double, ImageDimension>;
+using ImageType = itk::Image<PixelType, ImageDimension>;
+
+// The exponential computed by a warp of the field by itself, followed by an
+// addition, for each squaring.
+ImageType::Pointer
+ComputeReferenceExponential(const ImageType * field, unsigned int numberOfSquarings, bool computeInverse)
+{
+  auto result = ImageType::New();
+  result->CopyInformation(field);
+  result->SetRegions(field->GetLargestPossibleRegion());
+  result->Allocate();
+
+  const double divider = (computeInverse ? -1.0 : 1.0) * static_cast<double>(1 << numberOfSquarings);
+  itk::ImageRegionConstIterator<ImageType> fieldIt(field, field->GetLargestPossibleRegion());
+  itk::ImageRegionIterator<ImageType>      resultIt(result, result->GetLargestPossibleRegion());
+  for (; !fieldIt.IsAtEnd(); ++fieldIt, ++resultIt)
+  {
+    resultIt.Set(fieldIt.Get() / divider);
+  }
+
+  using WarperType = itk::WarpVectorImageFilter<ImageType, ImageType, ImageType>;
+  using InterpolatorType = itk::VectorLinearInterpolateNearestNeighborExtrapolateImageFunction<ImageType, double>;
+  using AdderType = itk::AddImageFilter<ImageType, ImageType, ImageType>;
+
+  for (unsigned int i = 0; i < numberOfSquarings; ++i)
+  {
+    auto warper = WarperType::New();
+    warper->SetInterpolator(InterpolatorType::New());
+    warper->SetOutputOrigin(field->GetOrigin());
+    warper->SetOutputSpacing(field->GetSpacing());
+    warper->SetOutputDirection(field->GetDirection());
+    warper->SetInput(result);
+    warper->SetDisplacementField(result);
+
+    auto adder = AdderType::New();
+    adder->SetInput1(result);
+    adder->SetInput2(warper->GetOutput());
+    adder->Update();
+
+    result = adder->GetOutput();
+    result->DisconnectPipeline();
+  }
+  return result;
+}
+} // namespace
+
+int
+itkExponentialDisplacementFieldImageFilterTest1(int, char *[])
+{
+  // A smooth, non-constant field on an oriented grid with anisotropic
+  // spacing. The displacements are several voxels long, so that the warps
+  // read between the voxels and beyond the boundary of the grid.
+  auto field = ImageType::New();
+  field->SetRegions(ImageType::RegionType({ { -3, 2, 0 } }, { { 14, 11, 9 } }));
+  field->Allocate();
+
+  ImageType::SpacingType spacing;
+  spacing[0] = 0.8;
+  spacing[1] = 1.25;
+  spacing[2] = 2.0;
+  field->SetSpacing(spacing);
+
+  ImageType::PointType origin;
+  origin[0] = 4.0;
+  origin[1] = -7.5;
+  origin[2] = 1.0;
+  field->SetOrigin(origin);
+
+  auto rotation = itk::Euler3DTransform<double>::New();
+  rotation->SetRotation(0.3, -0.2, 0.5);
+  field->SetDirection(rotation->GetMatrix());
+
+  for (itk::ImageRegionIteratorWithIndex<ImageType> it(field, field->GetLargestPossibleRegion()); !it.IsAtEnd(); ++it)
+  {
+    ImageType::PointType point;
+    field->TransformIndexToPhysicalPoint(it.GetIndex(), point);
+
+    PixelType displacement;
+    displacement[0] = 3.0 * std::sin(0.3 * point[1]) + 0.5;
+    displacement[1] = 2.5 * std::cos(0.2 * point[2] - 0.4 * point[0]);
+    displacement[2] = 4.0 * std::sin(0.25 * (point[0] + point[1]));
+    it.Set(displacement);
+  }
+
+  using FilterType = itk::ExponentialDisplacementFieldImageFilter<ImageType, ImageType>;
+  auto filter = FilterType::New();
+  filter->SetInput(field);
+  filter->AutomaticNumberOfIterationsOff();
+
+  int testStatus = EXIT_SUCCESS;
+
+  // With an odd number of squarings the result is computed in the second
+  // buffer of the filter, with an even number in its output. The same filter
+  // is run each time, so that the second buffer is reused.
+  for (const bool computeInverse : { false, true })
+  {
+    for (const unsigned int numberOfSquarings : { 3u, 4u, 1u, 2u })
+    {
+      filter->SetComputeInverse(computeInverse);
+      filter->SetMaximumNumberOfIterations(numberOfSquarings);
+      ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+      const ImageType *        output = filter->GetOutput();
+      const ImageType::Pointer reference = ComputeReferenceExponential(field, numberOfSquarings, computeInverse);
+
+      ITK_TEST_EXPECT_EQUAL(output->GetLargestPossibleRegion(), field->GetLargestPossibleRegion());
+      ITK_TEST_EXPECT_EQUAL(output->GetDirection(), field->GetDirection());
+
+      double maximumDifference = 0.0;
+      double maximumNorm = 0.0;
+      for (itk::ImageRegionConstIterator<ImageType> outputIt(output, output->GetLargestPossibleRegion()),
+           referenceIt(reference, reference->GetLargestPossibleRegion());
+           !outputIt.IsAtEnd();
+           ++outputIt, ++referenceIt)
+      {
+        maximumDifference = std::max(maximumDifference, (outputIt.Get() - referenceIt.Get()).GetNorm());
+        maximumNorm = std::max(maximumNorm, referenceIt.Get().GetNorm());
+      }
+
+      std::cout << "Squarings: " << numberOfSquarings << ", inverse: " << computeInverse
+                << ", maximum norm: " << maximumNorm << ", maximum difference: " << maximumDifference << std::endl;
+      if (maximumDifference > 1e-10)
+      {
+        std::cerr << "Test failed: the exponential with " << numberOfSquarings
+                  << " squarings differs from the warp and add pipeline by " << maximumDifference << std::endl;
+        testStatus = EXIT_FAILURE;
+      }
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
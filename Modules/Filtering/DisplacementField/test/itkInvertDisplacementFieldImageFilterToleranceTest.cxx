@@ -0,0 +1,218 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkInvertDisplacementFieldImageFilter.h"
+#include "itkComposeDisplacementFieldsImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int ImageDimension{ 2 };
+
+using VectorType = itk::Vector<float, ImageDimension>;
+using DisplacementFieldType = itk::Image<VectorType, ImageDimension>;
+using InverterType = itk::InvertDisplacementFieldImageFilter<DisplacementFieldType>;
+using RealType = InverterType::RealType;
+using RealImageType = InverterType::RealImageType;
+
+// Invert the field as the filter did when each iteration composed the fields
+// with ComposeDisplacementFieldsImageFilter, and return the number of updates.
+unsigned int
+InvertWithComposer(const DisplacementFieldType * field,
+                   unsigned int                  maximumNumberOfIterations,
+                   RealType                      meanTolerance,
+                   RealType                      maxTolerance,
+                   DisplacementFieldType *       inverse,
+                   RealType &                    meanErrorNorm,
+                   RealType &                    maxErrorNorm)
+{
+  const DisplacementFieldType::RegionType  region = field->GetLargestPossibleRegion();
+  const DisplacementFieldType::SpacingType spacing = field->GetSpacing();
+
+  inverse->CopyInformation(field);
+  inverse->SetRegions(region);
+  inverse->AllocateInitialized();
+
+  auto scaledNormImage = RealImageType::New();
+  scaledNormImage->CopyInformation(field);
+  scaledNormImage->SetRegions(region);
+  scaledNormImage->AllocateInitialized();
+
+  maxErrorNorm = itk::NumericTraits<RealType>::max();
+  meanErrorNorm = itk::NumericTraits<RealType>::max();
+
+  unsigned int iteration = 0;
+  while ((iteration++ < maximumNumberOfIterations) && (maxErrorNorm > maxTolerance) && (meanErrorNorm > meanTolerance))
+  {
+    using ComposerType = itk::ComposeDisplacementFieldsImageFilter<DisplacementFieldType>;
+    auto composer = ComposerType::New();
+    composer->SetDisplacementField(field);
+    composer->SetWarpingField(inverse);
+    composer->SetNumberOfWorkUnits(1);
+    composer->Update();
+    const DisplacementFieldType::Pointer composedField = composer->GetOutput();
+
+    meanErrorNorm = RealType{};
+    maxErrorNorm = RealType{};
+    itk::ImageRegionIterator<DisplacementFieldType> itE(composedField, region);
+    itk::ImageRegionIterator<RealImageType>         itS(scaledNormImage, region);
+    for (; !itE.IsAtEnd(); ++itE, ++itS)
+    {
+      const VectorType displacement = itE.Get();
+      RealType         scaledNorm = 0.0;
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        scaledNorm += itk::Math::sqr(displacement[d] * (1.0 / spacing[d]));
+      }
+      scaledNorm = std::sqrt(scaledNorm);
+      meanErrorNorm += scaledNorm;
+      maxErrorNorm = std::max(maxErrorNorm, scaledNorm);
+      itS.Set(scaledNorm);
+      itE.Set(-displacement);
+    }
+    meanErrorNorm /= static_cast<RealType>(region.GetNumberOfPixels());
+
+    const RealType epsilon = (iteration == 1) ? 0.75 : 0.5;
+
+    itk::ImageRegionIteratorWithIndex<DisplacementFieldType> itI(inverse, region);
+    for (itE.GoToBegin(), itS.GoToBegin(); !itI.IsAtEnd(); ++itI, ++itE, ++itS)
+    {
+      VectorType     update = itE.Get();
+      const RealType scaledNorm = itS.Get();
+      if (scaledNorm > epsilon * maxErrorNorm)
+      {
+        update *= (epsilon * maxErrorNorm / scaledNorm);
+      }
+      itI.Set(itI.Get() + update * epsilon);
+
+      const DisplacementFieldType::IndexType index = itI.GetIndex();
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        if (index[d] == region.GetIndex(d) || index[d] == region.GetUpperIndex()[d])
+        {
+          itI.Set(VectorType{});
+          break;
+        }
+      }
+    }
+  }
+  return iteration - 1;
+}
+
+bool
+TestStoppingCriterion(const DisplacementFieldType * field,
+                      unsigned int                  maximumNumberOfIterations,
+                      RealType                      meanTolerance,
+                      RealType                      maxTolerance,
+                      bool                          expectEarlyStop)
+{
+  std::cout << "Iterations: " << maximumNumberOfIterations << ", mean tolerance: " << meanTolerance
+            << ", max tolerance: " << maxTolerance << std::endl;
+
+  auto               expected = DisplacementFieldType::New();
+  RealType           expectedMeanErrorNorm;
+  RealType           expectedMaxErrorNorm;
+  const unsigned int numberOfUpdates = InvertWithComposer(field,
+                                                          maximumNumberOfIterations,
+                                                          meanTolerance,
+                                                          maxTolerance,
+                                                          expected,
+                                                          expectedMeanErrorNorm,
+                                                          expectedMaxErrorNorm);
+
+  // The tolerance, not the number of iterations, stops the loop.
+  if (expectEarlyStop != (numberOfUpdates < maximumNumberOfIterations))
+  {
+    std::cerr << "Unexpected number of updates of the reference: " << numberOfUpdates << std::endl;
+    return false;
+  }
+
+  auto inverter = InverterType::New();
+  inverter->SetDisplacementField(field);
+  inverter->SetMaximumNumberOfIterations(maximumNumberOfIterations);
+  inverter->SetMeanErrorToleranceThreshold(meanTolerance);
+  inverter->SetMaxErrorToleranceThreshold(maxTolerance);
+  inverter->Update();
+
+  if (itk::Math::abs(inverter->GetMeanErrorNorm() - expectedMeanErrorNorm) > 1e-4 ||
+      itk::Math::abs(inverter->GetMaxErrorNorm() - expectedMaxErrorNorm) > 1e-4)
+  {
+    std::cerr << "The error norms are " << inverter->GetMeanErrorNorm() << " and " << inverter->GetMaxErrorNorm()
+              << " instead of " << expectedMeanErrorNorm << " and " << expectedMaxErrorNorm << std::endl;
+    return false;
+  }
+
+  itk::ImageRegionConstIteratorWithIndex<DisplacementFieldType> itE(expected, expected->GetLargestPossibleRegion());
+  for (; !itE.IsAtEnd(); ++itE)
+  {
+    const VectorType inverse = inverter->GetOutput()->GetPixel(itE.GetIndex());
+    if ((inverse - itE.Get()).GetNorm() > 1e-4)
+    {
+      std::cerr << "The inverse at " << itE.GetIndex() << " is " << inverse << " instead of " << itE.Get()
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int
+itkInvertDisplacementFieldImageFilterToleranceTest(int, char *[])
+{
+  // A smooth sinusoidal field, which is zero on the boundary.
+  auto field = DisplacementFieldType::New();
+  field->SetRegions(DisplacementFieldType::SizeType{ { 40, 40 } });
+  field->Allocate();
+
+  for (itk::ImageRegionIteratorWithIndex<DisplacementFieldType> it(field, field->GetLargestPossibleRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    const double x = it.GetIndex()[0] * itk::Math::pi / 39.0;
+    const double y = it.GetIndex()[1] * itk::Math::pi / 39.0;
+    VectorType   displacement;
+    displacement[0] = 2.0 * std::sin(x) * std::sin(2.0 * y);
+    displacement[1] = 1.5 * std::sin(2.0 * x) * std::sin(y);
+    it.Set(displacement);
+  }
+
+  bool testPassed = true;
+
+  // The number of iterations stops the loop.
+  testPassed &= TestStoppingCriterion(field, 5, 0.0, 0.0, false);
+
+  // The max tolerance is met by the initial estimate: one update is done.
+  testPassed &= TestStoppingCriterion(field, 50, 0.0, 5.0, true);
+
+  // The max tolerance stops the loop after a few updates.
+  testPassed &= TestStoppingCriterion(field, 50, 0.0, 0.1, true);
+
+  // The mean tolerance stops the loop.
+  testPassed &= TestStoppingCriterion(field, 50, 0.05, 0.0, true);
+
+  if (!testPassed)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -17,10 +17,37 @@
  *=========================================================================*/
 
 #include "itkTimeVaryingVelocityFieldIntegrationImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
 #include "itkImportImageFilter.h"
 #include "itkTestingMacros.h"
 #include "itkVectorLinearInterpolateImageFunction.h"
 
+namespace
+{
+// Interpolates as VectorLinearInterpolateImageFunction, but is another
+// class, so the integrator evaluates it instead of its own linear kernel.
+template <typename TInputImage, typename TCoordinate>
+class DerivedVectorLinearInterpolateImageFunction
+  : public itk::VectorLinearInterpolateImageFunction<TInputImage, TCoordinate>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(DerivedVectorLinearInterpolateImageFunction);
+
+  using Self = DerivedVectorLinearInterpolateImageFunction;
+  using Superclass = itk::VectorLinearInterpolateImageFunction<TInputImage, TCoordinate>;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(DerivedVectorLinearInterpolateImageFunction);
+
+protected:
+  DerivedVectorLinearInterpolateImageFunction() = default;
+  ~DerivedVectorLinearInterpolateImageFunction() override = default;
+};
+} // namespace
+
 int
 itkTimeVaryingVelocityFieldIntegrationImageFilterTest(int argc, char * argv[])
 {
@@ -262,6 +289,145 @@ itkTimeVaryingVelocityFieldIntegrationImageFilterTest(int argc, char * argv[])
     return EXIT_FAILURE;
   }
 
+  /* Both directions are integrated in a single pass. */
+  ITK_TEST_SET_GET_BOOLEAN(integrator, ComputeInverseDisplacementField, false);
+  integrator->ComputeInverseDisplacementFieldOn();
+  integrator->SetLowerTimeBound(invUpperTimeBound);
+  integrator->SetUpperTimeBound(invLowerTimeBound);
+  integrator->Update();
+
+  const VectorType singlePassInverseDisplacement = integrator->GetInverseDisplacementField()->GetPixel(index);
+  std::cout << "Estimated single pass inverse displacement vector: " << singlePassInverseDisplacement << std::endl;
+  for (unsigned int d = 0; d < 3; ++d)
+  {
+    if (itk::Math::Absolute(singlePassInverseDisplacement[d] - displacement[d]) > 1e-10)
+    {
+      std::cerr << "Failed to produce the inverse integration in a single pass." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The forward displacement must not depend on the inverse being computed.
+  const VectorType singlePassForwardDisplacement = integrator->GetOutput()->GetPixel(index);
+  integrator->ComputeInverseDisplacementFieldOff();
+  integrator->Update();
+
+  displacement = integrator->GetOutput()->GetPixel(index);
+  std::cout << "Estimated single pass forward displacement vector: " << singlePassForwardDisplacement << std::endl;
+  for (unsigned int d = 0; d < 3; ++d)
+  {
+    if (itk::Math::Absolute(singlePassForwardDisplacement[d] - displacement[d]) > 1e-10)
+    {
+      std::cerr << "Failed to produce the forward integration in a single pass." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  /* The linear kernel of the integrator gives the same displacements as the
+   * interpolator it replaces, on a field with a non-identity direction and
+   * anisotropic spacing. The displacements are large enough for some
+   * trajectories to leave the field.
+   */
+  auto orientedVelocityField = TimeVaryingVelocityFieldType::New();
+  orientedVelocityField->SetRegions(TimeVaryingVelocityFieldType::SizeType{ { 12, 10, 9, 6 } });
+  orientedVelocityField->Allocate();
+
+  TimeVaryingVelocityFieldType::SpacingType orientedSpacing;
+  orientedSpacing[0] = 1.5;
+  orientedSpacing[1] = 0.75;
+  orientedSpacing[2] = 2.25;
+  orientedSpacing[3] = 0.2;
+  orientedVelocityField->SetSpacing(orientedSpacing);
+
+  TimeVaryingVelocityFieldType::PointType orientedOrigin;
+  orientedOrigin[0] = -4.0;
+  orientedOrigin[1] = 2.5;
+  orientedOrigin[2] = 1.0;
+  orientedOrigin[3] = 0.0;
+  orientedVelocityField->SetOrigin(orientedOrigin);
+
+  // Rotation about z followed by a rotation about x, the time axis is kept.
+  const double                                cz = std::cos(0.4);
+  const double                                sz = std::sin(0.4);
+  const double                                cx = std::cos(0.3);
+  const double                                sx = std::sin(0.3);
+  TimeVaryingVelocityFieldType::DirectionType direction;
+  direction.SetIdentity();
+  direction[0][0] = cz;
+  direction[0][1] = -sz * cx;
+  direction[0][2] = sz * sx;
+  direction[1][0] = sz;
+  direction[1][1] = cz * cx;
+  direction[1][2] = -cz * sx;
+  direction[2][1] = sx;
+  direction[2][2] = cx;
+  orientedVelocityField->SetDirection(direction);
+
+  for (itk::ImageRegionIteratorWithIndex<TimeVaryingVelocityFieldType> vIt(
+         orientedVelocityField, orientedVelocityField->GetLargestPossibleRegion());
+       !vIt.IsAtEnd();
+       ++vIt)
+  {
+    TimeVaryingVelocityFieldType::PointType point;
+    orientedVelocityField->TransformIndexToPhysicalPoint(vIt.GetIndex(), point);
+    VectorType velocity;
+    velocity[0] = 4.0 * std::sin(0.3 * point[1] + point[3]);
+    velocity[1] = 3.0 * std::cos(0.2 * point[2] - 0.25 * point[0]);
+    velocity[2] = 5.0 * std::sin(0.15 * (point[0] + point[1])) * (1.0 + point[3]);
+    vIt.Set(velocity);
+  }
+
+  DisplacementFieldType::Pointer kernelDisplacements[2];
+  for (const bool useKernel : { true, false })
+  {
+    auto orientedIntegrator = IntegratorType::New();
+    orientedIntegrator->SetInput(orientedVelocityField);
+    if (!useKernel)
+    {
+      orientedIntegrator->SetVelocityFieldInterpolator(
+        DerivedVectorLinearInterpolateImageFunction<TimeVaryingVelocityFieldType, IntegratorType::ScalarType>::New());
+    }
+    orientedIntegrator->SetLowerTimeBound(0.1);
+    orientedIntegrator->SetUpperTimeBound(0.9);
+    orientedIntegrator->SetNumberOfIntegrationSteps(20);
+    orientedIntegrator->ComputeInverseDisplacementFieldOn();
+    orientedIntegrator->Update();
+
+    if (useKernel)
+    {
+      kernelDisplacements[0] = orientedIntegrator->GetOutput();
+      kernelDisplacements[1] = orientedIntegrator->GetInverseDisplacementField();
+      kernelDisplacements[0]->DisconnectPipeline();
+      kernelDisplacements[1]->DisconnectPipeline();
+      continue;
+    }
+
+    const DisplacementFieldType * interpolatorDisplacements[2] = { orientedIntegrator->GetOutput(),
+                                                                    orientedIntegrator->GetInverseDisplacementField() };
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+      double maximumDifference = 0.0;
+      double maximumNorm = 0.0;
+      for (itk::ImageRegionConstIterator<DisplacementFieldType>
+             kIt(kernelDisplacements[i], kernelDisplacements[i]->GetLargestPossibleRegion()),
+           iIt(interpolatorDisplacements[i], interpolatorDisplacements[i]->GetLargestPossibleRegion());
+           !kIt.IsAtEnd();
+           ++kIt, ++iIt)
+      {
+        maximumDifference = std::max(maximumDifference, (kIt.Get() - iIt.Get()).GetNorm());
+        maximumNorm = std::max(maximumNorm, iIt.Get().GetNorm());
+      }
+      std::cout << (i == 0 ? "Forward" : "Inverse") << " displacements of the oriented field: maximum norm "
+                << maximumNorm << ", maximum difference between the kernel and the interpolator "
+                << maximumDifference << std::endl;
+      if (maximumDifference > 1e-9)
+      {
+        std::cerr << "The linear kernel differs from the velocity field interpolator." << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,177 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkTransformToDisplacementFieldCache.h"
+#include "itkAffineTransform.h"
+#include "itkCompositeTransform.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkTranslationTransform.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+template <typename TCache, typename TTransform>
+bool
+CheckFlattenedTransform(TCache * cache, const TTransform * transform)
+{
+  using DisplacementFieldType = typename TCache::DisplacementFieldType;
+  const typename TCache::DisplacementFieldTransformType::ConstPointer flattenedTransform =
+    cache->GetDisplacementFieldTransform();
+  const DisplacementFieldType * field = flattenedTransform->GetDisplacementField();
+
+  // At grid points the flattened transform is exact.
+  for (itk::ImageRegionConstIteratorWithIndex<DisplacementFieldType> it(field, field->GetLargestPossibleRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    typename TTransform::InputPointType point;
+    field->TransformIndexToPhysicalPoint(it.GetIndex(), point);
+
+    const typename TTransform::OutputPointType expected = transform->TransformPoint(point);
+    const typename TTransform::OutputPointType flattened = flattenedTransform->TransformPoint(point);
+    for (unsigned int d = 0; d < TCache::Dimension; ++d)
+    {
+      if (itk::Math::abs(expected[d] - flattened[d]) > 1e-9)
+      {
+        std::cerr << "Flattened transform mismatch at " << point << ": expected " << expected << ", got "
+                  << flattened << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+} // namespace
+
+
+int
+itkTransformToDisplacementFieldCacheTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 2;
+  using ParametersValueType = double;
+
+  using CacheType = itk::TransformToDisplacementFieldCache<ParametersValueType, Dimension>;
+  using CompositeTransformType = itk::CompositeTransform<ParametersValueType, Dimension>;
+  using AffineTransformType = itk::AffineTransform<ParametersValueType, Dimension>;
+  using TranslationTransformType = itk::TranslationTransform<ParametersValueType, Dimension>;
+  using ImageType = itk::Image<float, Dimension>;
+
+  auto cache = CacheType::New();
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(cache, TransformToDisplacementFieldCache, Object);
+
+  // Updating without a transform or a grid is an error.
+  ITK_TRY_EXPECT_EXCEPTION(cache->Update());
+
+  auto affine = AffineTransformType::New();
+  affine->Rotate2D(0.2);
+  affine->Scale(1.1);
+
+  auto translation = TranslationTransformType::New();
+  TranslationTransformType::OutputVectorType offset;
+  offset[0] = 2.5;
+  offset[1] = -1.0;
+  translation->Translate(offset);
+
+  auto composite = CompositeTransformType::New();
+  composite->AddTransform(affine);
+  composite->AddTransform(translation);
+
+  cache->SetTransform(composite);
+  ITK_TEST_SET_GET_VALUE(composite.GetPointer(), cache->GetTransform());
+  ITK_TRY_EXPECT_EXCEPTION(cache->Update());
+
+  auto                  reference = ImageType::New();
+  ImageType::RegionType region;
+  region.SetIndex(0, 2);
+  region.SetIndex(1, -3);
+  region.SetSize(0, 16);
+  region.SetSize(1, 12);
+  reference->SetRegions(region);
+  ImageType::SpacingType spacing;
+  spacing[0] = 0.75;
+  spacing[1] = 1.5;
+  reference->SetSpacing(spacing);
+  ImageType::PointType origin;
+  origin[0] = -4.0;
+  origin[1] = 3.0;
+  reference->SetOrigin(origin);
+
+  cache->SetReferenceImage(reference);
+  ITK_TEST_SET_GET_VALUE(region, cache->GetReferenceRegion());
+  ITK_TEST_SET_GET_VALUE(spacing, cache->GetReferenceSpacing());
+  ITK_TEST_SET_GET_VALUE(origin, cache->GetReferenceOrigin());
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(cache->Update());
+  CacheType::DisplacementFieldTransformType::ConstPointer flattened = cache->GetDisplacementFieldTransform();
+  ITK_TEST_EXPECT_EQUAL(flattened->GetDisplacementField()->GetLargestPossibleRegion(), region);
+  if (!CheckFlattenedTransform(cache.GetPointer(), composite.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Nothing changed: the cached field is kept.
+  ITK_TEST_EXPECT_EQUAL(cache->GetDisplacementFieldTransform().GetPointer(), flattened.GetPointer());
+
+  // Another image on the same grid keeps the cached field.
+  auto sameGrid = ImageType::New();
+  sameGrid->CopyInformation(reference);
+  sameGrid->SetRegions(region);
+  cache->SetReferenceImage(sameGrid);
+  ITK_TEST_EXPECT_EQUAL(cache->GetDisplacementFieldTransform().GetPointer(), flattened.GetPointer());
+
+  // Modifying a stage of the composite invalidates the cache.
+  offset[0] = -1.5;
+  translation->Translate(offset);
+  CacheType::DisplacementFieldTransformType::ConstPointer updated = cache->GetDisplacementFieldTransform();
+  ITK_TEST_EXPECT_TRUE(updated != flattened);
+  if (!CheckFlattenedTransform(cache.GetPointer(), composite.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // A transform obtained earlier is left untouched by the recomputation.
+  ITK_TEST_EXPECT_EQUAL(flattened->GetDisplacementField()->GetLargestPossibleRegion(), region);
+
+  // A different grid invalidates the cache.
+  region.SetSize(0, 9);
+  auto otherGrid = ImageType::New();
+  otherGrid->CopyInformation(reference);
+  otherGrid->SetRegions(region);
+  cache->SetReferenceImage(otherGrid);
+  updated = cache->GetDisplacementFieldTransform();
+  ITK_TEST_EXPECT_EQUAL(updated->GetDisplacementField()->GetLargestPossibleRegion(), region);
+  if (!CheckFlattenedTransform(cache.GetPointer(), composite.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Adding a stage to the composite invalidates the cache.
+  auto second = AffineTransformType::New();
+  second->Rotate2D(-0.1);
+  composite->AddTransform(second);
+  ITK_TEST_EXPECT_TRUE(cache->GetDisplacementFieldTransform() != updated);
+  if (!CheckFlattenedTransform(cache.GetPointer(), composite.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  ITK_TRY_EXPECT_EXCEPTION(cache->SetReferenceImage(nullptr));
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
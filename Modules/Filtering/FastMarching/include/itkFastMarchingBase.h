@@ -46,10 +46,24 @@ public:
     NoHandles,
     Strict
   };
+
+  /**
+   * \class FrontPropagation
+   * \ingroup ITKFastMarching
+   * Strategy used to propagate the front through the domain.
+   * */
+  enum class FrontPropagation : uint8_t
+  {
+    PriorityQueue = 0,
+    UntidyPriorityQueue,
+    FastIterativeMethod
+  };
 };
 // Define how to print enumeration
 extern ITKFastMarching_EXPORT std::ostream &
                               operator<<(std::ostream & out, const FastMarchingTraitsEnums::TopologyCheck value);
+extern ITKFastMarching_EXPORT std::ostream &
+                              operator<<(std::ostream & out, const FastMarchingTraitsEnums::FrontPropagation value);
 
 /**
  * \class FastMarchingBase
@@ -69,6 +83,18 @@ extern ITKFastMarching_EXPORT std::ostream &
  * Fast Marching sweeps through N points in (N log N) steps to obtain
  * the arrival time value as the front propagates through the domain.
  *
+ * \par Front propagation:
+ * The priority queue can be replaced by an untidy priority queue
+ * (FrontPropagation set to UntidyPriorityQueue), see \cite yatziv2006.
+ * Trial nodes are then stored in a circular array of buckets of width
+ * BucketWidth, and nodes within a bucket are processed in first-in,
+ * first-out order. This reduces the complexity to O(N), at the cost of an
+ * additional error of the order of the bucket width. When the BucketWidth is
+ * not positive, a default width is computed by the subclass (the smallest
+ * step of the front between two neighboring nodes for images).
+ * Image-based subclasses additionally support the parallel fast
+ * iterative method (FrontPropagation set to FastIterativeMethod).
+ *
  * The initial front is specified by two containers:
  * \li one containing the known nodes (Alive Nodes: nodes that are already
  * part of the object),
@@ -171,6 +197,7 @@ public:
   */
 
   using TopologyCheckEnum = FastMarchingTraitsEnums::TopologyCheck;
+  using FrontPropagationEnum = FastMarchingTraitsEnums::FrontPropagation;
 #if !defined(ITK_LEGACY_REMOVE)
   using TopologyCheckType = FastMarchingTraitsEnums::TopologyCheck;
   /**Exposes enums values for backwards compatibility*/
@@ -185,6 +212,19 @@ public:
   itkSetEnumMacro(TopologyCheck, TopologyCheckEnum);
   itkGetConstReferenceMacro(TopologyCheck, TopologyCheckEnum);
   /** @ITKEndGrouping */
+  /** Set/Get the strategy used to propagate the front. Defaults to
+   * PriorityQueue. */
+  /** @ITKStartGrouping */
+  itkSetEnumMacro(FrontPropagation, FrontPropagationEnum);
+  itkGetConstReferenceMacro(FrontPropagation, FrontPropagationEnum);
+  /** @ITKEndGrouping */
+  /** Set/Get the width of the buckets of the untidy priority queue. A
+   * non-positive width (the default) selects the width returned by
+   * GetDefaultBucketWidth(). */
+  /** @ITKStartGrouping */
+  itkSetMacro(BucketWidth, double);
+  itkGetConstMacro(BucketWidth, double);
+  /** @ITKEndGrouping */
   /** Set/Get TrialPoints */
   /** @ITKStartGrouping */
   itkSetObjectMacro(TrialPoints, NodePairContainerType);
@@ -265,6 +305,33 @@ protected:
 
   TopologyCheckEnum m_TopologyCheck{};
 
+  FrontPropagationEnum m_FrontPropagation{ FrontPropagationEnum::PriorityQueue };
+
+  double m_BucketWidth{ 0.0 };
+
+  /** \brief Insert a trial node in the priority queue selected by
+   * FrontPropagation. */
+  void
+  PushTrialNode(const NodePairType & iNodePair);
+
+  /** \brief Remove and return the next trial node to process. */
+  NodePairType
+  PopTrialNode();
+
+  /** \brief Check if there is no trial node left to process. */
+  [[nodiscard]] bool
+  IsTrialQueueEmpty() const;
+
+  /** \brief Remove all trial nodes. */
+  void
+  ClearTrialQueue();
+
+  /** \brief Get the bucket width used when BucketWidth is not positive. By
+   * default the front is assumed to move by at most one unit length per node
+   * at the speed constant. */
+  [[nodiscard]] virtual double
+  GetDefaultBucketWidth() const;
+
   /** \brief Get the total number of nodes in the domain */
   [[nodiscard]] virtual IdentifierType
   GetTotalNumberOfNodes() const = 0;
@@ -325,6 +392,16 @@ protected:
   /** \brief PrintSelf method  */
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  // Circular array of buckets of the untidy priority queue. The bucket of
+  // the front, m_CurrentBucket, is stored at m_CurrentBucket modulo the
+  // number of buckets; its nodes are read from m_BucketHead.
+  std::vector<HeapContainerType> m_Buckets{};
+  SizeValueType                  m_CurrentBucket{ 0 };
+  SizeValueType                  m_BucketHead{ 0 };
+  SizeValueType                  m_NumberOfBucketedNodes{ 0 };
+  double                         m_InverseBucketWidth{ 1.0 };
 };
 } // namespace itk
 
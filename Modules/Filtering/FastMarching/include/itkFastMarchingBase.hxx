@@ -53,6 +53,8 @@ FastMarchingBase<TInput, TOutput>::PrintSelf(std::ostream & os, Indent indent) c
   Superclass::PrintSelf(os, indent);
   os << indent << "Speed constant: " << m_SpeedConstant << std::endl;
   os << indent << "Topology check: " << m_TopologyCheck << std::endl;
+  os << indent << "Front propagation: " << m_FrontPropagation << std::endl;
+  os << indent << "Bucket width: " << m_BucketWidth << std::endl;
   os << indent << "Normalization Factor: " << m_NormalizationFactor << std::endl;
 }
 
@@ -87,17 +89,18 @@ FastMarchingBase<TInput, TOutput>::Initialize(OutputDomainType * oDomain)
     }
   }
 
-  // make sure the heap is empty
-  while (!m_Heap.empty())
+  if (m_FrontPropagation == FrontPropagationEnum::UntidyPriorityQueue)
   {
-    m_Heap.pop();
-  }
-  /*
-  while ( !m_Heap->Empty() )
+    const double bucketWidth = (m_BucketWidth > 0.0) ? m_BucketWidth : this->GetDefaultBucketWidth();
+    if (!(bucketWidth > 0.0))
     {
-    m_Heap->Pop();
+      itkExceptionStringMacro("Bucket width of the untidy priority queue is null or negative");
     }
-  */
+    m_InverseBucketWidth = 1.0 / bucketWidth;
+  }
+
+  // make sure the heap is empty
+  this->ClearTrialQueue();
 
   this->InitializeOutput(oDomain);
 
@@ -112,6 +115,11 @@ template <typename TInput, typename TOutput>
 void
 FastMarchingBase<TInput, TOutput>::GenerateData()
 {
+  if (m_FrontPropagation == FrontPropagationEnum::FastIterativeMethod)
+  {
+    itkExceptionMacro("Front propagation " << m_FrontPropagation << " is not supported by this filter");
+  }
+
   OutputDomainType * output = this->GetOutput();
 
   Initialize(output);
@@ -124,18 +132,9 @@ FastMarchingBase<TInput, TOutput>::GenerateData()
 
   try
   {
-    // while( !m_Heap->Empty() )
-    while (!m_Heap.empty())
+    while (!this->IsTrialQueueEmpty())
     {
-      // PriorityQueueElementType element = m_Heap->Peek();
-      // m_Heap->Pop();
-      //
-      // NodeType current_node = element.m_Element;
-      // OutputPixelType current_value = element.m_Priority;
-
-
-      NodePairType current_node_pair = m_Heap.top();
-      m_Heap.pop();
+      const NodePairType current_node_pair = this->PopTrialNode();
 
       const NodeType current_node = current_node_pair.GetNode();
       current_value = this->GetOutputValue(output, current_node);
@@ -178,14 +177,7 @@ FastMarchingBase<TInput, TOutput>::GenerateData()
     // it.
     //
     // RELEASE MEMORY!!!
-    while (!m_Heap.empty())
-    {
-      m_Heap.pop();
-    }
-    /*while( !m_Heap->Empty() )
-      {
-      m_Heap->Pop();
-      }*/
+    this->ClearTrialQueue();
 
     throw ProcessAborted(__FILE__, __LINE__);
   }
@@ -193,14 +185,129 @@ FastMarchingBase<TInput, TOutput>::GenerateData()
   m_TargetReachedValue = current_value;
 
   // let's release some useless memory...
-  while (!m_Heap.empty())
+  this->ClearTrialQueue();
+}
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+void
+FastMarchingBase<TInput, TOutput>::PushTrialNode(const NodePairType & iNodePair)
+{
+  if (m_FrontPropagation != FrontPropagationEnum::UntidyPriorityQueue)
   {
-    m_Heap.pop();
+    m_Heap.push(iNodePair);
+    return;
+  }
+
+  // Nodes below the front are processed with the current bucket.
+  const double  bucket = std::floor(static_cast<double>(iNodePair.GetValue()) * m_InverseBucketWidth);
+  SizeValueType key = m_CurrentBucket;
+  if (bucket > static_cast<double>(m_CurrentBucket) || m_NumberOfBucketedNodes == 0)
+  {
+    if (!(bucket < static_cast<double>(NumericTraits<SizeValueType>::max() / 2)))
+    {
+      itkExceptionStringMacro("Trial value is out of range of the untidy priority queue; increase the bucket width");
+    }
+    key = static_cast<SizeValueType>(std::max(bucket, 0.0));
   }
-  /*while( !m_Heap->Empty() )
+  if (m_NumberOfBucketedNodes == 0)
+  {
+    m_CurrentBucket = key;
+    m_BucketHead = 0;
+  }
+
+  const SizeValueType span = key - m_CurrentBucket + 1;
+  if (span > m_Buckets.size())
+  {
+    // The maximum distance between the front and a trial node is bounded
+    // by the largest step of the front, so the array rarely grows.
+    constexpr SizeValueType maximumNumberOfBuckets = SizeValueType{ 1 } << 24;
+    if (span > maximumNumberOfBuckets)
+    {
+      itkExceptionStringMacro("Trial value is out of range of the untidy priority queue; increase the bucket width");
+    }
+    SizeValueType numberOfBuckets = std::max(SizeValueType{ 16 }, static_cast<SizeValueType>(m_Buckets.size()));
+    while (numberOfBuckets < span)
+    {
+      numberOfBuckets *= 2;
+    }
+    std::vector<HeapContainerType> buckets(numberOfBuckets);
+    for (SizeValueType i = 0; i < m_Buckets.size(); ++i)
     {
-    m_Heap->Pop();
-    }*/
+      const SizeValueType k = m_CurrentBucket + i;
+      buckets[k % numberOfBuckets].swap(m_Buckets[k % m_Buckets.size()]);
+    }
+    m_Buckets.swap(buckets);
+  }
+
+  m_Buckets[key % m_Buckets.size()].push_back(iNodePair);
+  ++m_NumberOfBucketedNodes;
+}
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+auto
+FastMarchingBase<TInput, TOutput>::PopTrialNode() -> NodePairType
+{
+  if (m_FrontPropagation != FrontPropagationEnum::UntidyPriorityQueue)
+  {
+    const NodePairType nodePair = m_Heap.top();
+    m_Heap.pop();
+    return nodePair;
+  }
+
+  // Move the front to the next non-empty bucket. Nodes within a bucket are
+  // processed in first-in, first-out order.
+  HeapContainerType * bucket = &m_Buckets[m_CurrentBucket % m_Buckets.size()];
+  while (m_BucketHead == bucket->size())
+  {
+    bucket->clear();
+    m_BucketHead = 0;
+    ++m_CurrentBucket;
+    bucket = &m_Buckets[m_CurrentBucket % m_Buckets.size()];
+  }
+  const NodePairType nodePair = (*bucket)[m_BucketHead++];
+  if (--m_NumberOfBucketedNodes == 0)
+  {
+    // The next push may move the front anywhere, so leave no consumed nodes
+    // behind in the bucket it starts from.
+    bucket->clear();
+    m_BucketHead = 0;
+  }
+  return nodePair;
+}
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+bool
+FastMarchingBase<TInput, TOutput>::IsTrialQueueEmpty() const
+{
+  if (m_FrontPropagation != FrontPropagationEnum::UntidyPriorityQueue)
+  {
+    return m_Heap.empty();
+  }
+  return m_NumberOfBucketedNodes == 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+void
+FastMarchingBase<TInput, TOutput>::ClearTrialQueue()
+{
+  m_Heap = PriorityQueueType();
+  m_Buckets.clear();
+  m_CurrentBucket = 0;
+  m_BucketHead = 0;
+  m_NumberOfBucketedNodes = 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename TInput, typename TOutput>
+double
+FastMarchingBase<TInput, TOutput>::GetDefaultBucketWidth() const
+{
+  // m_InverseSpeed is the negated squared slowness of the front.
+  return (m_InverseSpeed < 0.0) ? std::sqrt(-m_InverseSpeed) : 1.0;
 }
 // -----------------------------------------------------------------------------
 
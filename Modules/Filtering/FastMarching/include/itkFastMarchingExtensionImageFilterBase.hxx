@@ -107,6 +107,12 @@ void
 FastMarchingExtensionImageFilterBase<TInput, TOutput, TAuxValue, VAuxDimension>::InitializeOutput(
   OutputImageType * oImage)
 {
+  // The auxiliary outputs are computed while the front propagates.
+  if (this->m_FrontPropagation == Superclass::FrontPropagationEnum::FastIterativeMethod)
+  {
+    itkExceptionMacro("Front propagation " << this->m_FrontPropagation << " is not supported by this filter");
+  }
+
   this->Superclass::InitializeOutput(oImage);
 
   if (!m_AuxiliaryAliveValues)
@@ -226,7 +232,7 @@ FastMarchingExtensionImageFilterBase<TInput, TOutput, TAuxValue, VAuxDimension>:
     // node.SetValue( outputPixel );
     // node.SetIndex( index );
     // m_TrialHeap.push(node);
-    this->m_Heap.push(NodePairType(iNode, outputPixel));
+    this->PushTrialNode(NodePairType(iNode, outputPixel));
 
     // update auxiliary values
     for (unsigned int k = 0; k < AuxDimension; ++k)
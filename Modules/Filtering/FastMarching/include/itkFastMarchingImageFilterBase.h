@@ -56,6 +56,16 @@ namespace itk
  *
  * Else the output information is copied from the input speed image.
  *
+ * When FrontPropagation is set to FastIterativeMethod, the front is not
+ * propagated one node at a time, instead the arrival times are computed with
+ * the fast iterative method \cite jeong2008: the nodes of an active list are
+ * updated in parallel until their values change by less than the
+ * ConvergenceTolerance, and the converged nodes activate their neighbors.
+ * The stopping criterion is then applied to the nodes in increasing order
+ * of arrival time, and the nodes which would not have been reached by the
+ * front are reset to the large value. The fast iterative method does not
+ * support topology constraints.
+ *
  * Implementation of this class is based on \cite sethian1999a.
  *
  * For an alternative implementation, see itk::FastMarchingImageFilter.
@@ -157,6 +167,13 @@ public:
   itkGetConstReferenceMacro(OverrideOutputInformation, bool);
   itkBooleanMacro(OverrideOutputInformation);
   /** @ITKEndGrouping */
+
+  /** Set/Get the largest change of the value of a node for which it is
+   * considered converged by the fast iterative method. */
+  /** @ITKStartGrouping */
+  itkSetMacro(ConvergenceTolerance, double);
+  itkGetConstMacro(ConvergenceTolerance, double);
+  /** @ITKEndGrouping */
 protected:
   FastMarchingImageFilterBase();
 
@@ -175,6 +192,8 @@ protected:
   OutputDirectionType m_OutputDirection{};
   bool                m_OverrideOutputInformation{ false };
 
+  double m_ConvergenceTolerance{ 1e-6 };
+
   /** Generate the output image meta information. */
   void
   GenerateOutputInformation() override;
@@ -182,6 +201,14 @@ protected:
   void
   EnlargeOutputRequestedRegion(DataObject * output) override;
 
+  void
+  GenerateData() override;
+
+  /** The default bucket width is the smallest time for the front to move
+   * between two neighboring nodes. */
+  [[nodiscard]] double
+  GetDefaultBucketWidth() const override;
+
   LabelImagePointer              m_LabelImage{};
   ConnectedComponentImagePointer m_ConnectedComponentImage{};
 
@@ -267,6 +294,16 @@ protected:
   DoesVoxelChangeViolateStrictTopology(const NodeType &) const;
 
   const InputImageType * m_InputCache{};
+
+private:
+  /** Compute the arrival times with the fast iterative method. */
+  void
+  GenerateDataUsingFastIterativeMethod();
+
+  /** Solve the quadratic equation at a given node from the current values
+   * of all its neighbors. */
+  double
+  SolveFromNeighbors(OutputImageType * oImage, const NodeType & iNode) const;
 };
 } // end namespace itk
 
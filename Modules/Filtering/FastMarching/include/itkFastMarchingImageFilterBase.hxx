@@ -21,6 +21,7 @@
 
 
 #include "itkImageRegionIterator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkConnectedComponentImageFilter.h"
 #include "itkRelabelComponentImageFilter.h"
 
@@ -106,6 +107,239 @@ FastMarchingImageFilterBase<TInput, TOutput>::GetTotalNumberOfNodes() const
   return this->m_BufferedRegion.GetNumberOfPixels();
 }
 
+template <typename TInput, typename TOutput>
+void
+FastMarchingImageFilterBase<TInput, TOutput>::GenerateData()
+{
+  if (this->m_FrontPropagation == Superclass::FrontPropagationEnum::FastIterativeMethod)
+  {
+    this->GenerateDataUsingFastIterativeMethod();
+  }
+  else
+  {
+    Superclass::GenerateData();
+  }
+}
+
+template <typename TInput, typename TOutput>
+double
+FastMarchingImageFilterBase<TInput, TOutput>::GetDefaultBucketWidth() const
+{
+  // The output image information is set, but not yet cached.
+  const OutputSpacingType spacing = this->GetOutput()->GetSpacing();
+  double                  minimumSpacing = spacing[0];
+  for (unsigned int j = 1; j < ImageDimension; ++j)
+  {
+    minimumSpacing = std::min(minimumSpacing, static_cast<double>(spacing[j]));
+  }
+
+  const InputImageType * input = this->GetInput();
+  if (input == nullptr)
+  {
+    return minimumSpacing * Superclass::GetDefaultBucketWidth();
+  }
+
+  double maximumSpeed = 0.0;
+  for (ImageRegionConstIterator<InputImageType> it(input, input->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    maximumSpeed = std::max(maximumSpeed, static_cast<double>(it.Get()));
+  }
+  maximumSpeed /= this->m_NormalizationFactor;
+
+  return (maximumSpeed > 0.0) ? minimumSpacing / maximumSpeed : minimumSpacing;
+}
+
+template <typename TInput, typename TOutput>
+void
+FastMarchingImageFilterBase<TInput, TOutput>::GenerateDataUsingFastIterativeMethod()
+{
+  if (this->m_TopologyCheck != Superclass::TopologyCheckEnum::Nothing)
+  {
+    itkExceptionStringMacro("Topology constraints are not supported by the fast iterative method");
+  }
+
+  OutputImageType * output = this->GetOutput();
+
+  this->Initialize(output);
+
+  // The initial trial nodes keep their values, the trial queue is not used.
+  this->ClearTrialQueue();
+
+  // A node of the active list is either being updated, or a candidate which
+  // is only kept if its value decreases.
+  using ActiveNodeType = std::pair<NodeType, bool>;
+  std::vector<ActiveNodeType> activeNodes;
+  std::vector<ActiveNodeType> nextActiveNodes;
+
+  const auto activateNeighbors = [this](const NodeType & iNode, std::vector<ActiveNodeType> & ioActiveNodes) {
+    for (unsigned int j = 0; j < ImageDimension; ++j)
+    {
+      NodeType neighIndex = iNode;
+      for (int s = -1; s < 2; s += 2)
+      {
+        neighIndex[j] = iNode[j] + s;
+        if ((neighIndex[j] >= m_StartIndex[j]) && (neighIndex[j] <= m_LastIndex[j]) &&
+            (m_LabelImage->GetPixel(neighIndex) == Traits::Far))
+        {
+          m_LabelImage->SetPixel(neighIndex, Traits::Trial);
+          ioActiveNodes.emplace_back(neighIndex, true);
+        }
+      }
+    }
+  };
+
+  for (NodePairContainerConstIterator pointsIter = this->m_TrialPoints->Begin();
+       pointsIter != this->m_TrialPoints->End();
+       ++pointsIter)
+  {
+    const NodeType idx = pointsIter->Value().GetNode();
+    if (m_BufferedRegion.IsInside(idx) && (m_LabelImage->GetPixel(idx) == Traits::InitialTrial))
+    {
+      activateNeighbors(idx, activeNodes);
+    }
+  }
+
+  MultiThreaderBase * multiThreader = this->GetMultiThreader();
+  multiThreader->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+
+  std::vector<OutputPixelType> solutions;
+  while (!activeNodes.empty())
+  {
+    // The values of the active nodes are computed in parallel from the
+    // values of the previous iteration, then updated in sequence.
+    solutions.resize(activeNodes.size());
+    multiThreader->ParallelizeArray(
+      0,
+      activeNodes.size(),
+      [this, output, &activeNodes, &solutions](SizeValueType i) {
+        solutions[i] = static_cast<OutputPixelType>(this->SolveFromNeighbors(output, activeNodes[i].first));
+      },
+      nullptr);
+
+    nextActiveNodes.clear();
+    for (SizeValueType i = 0; i < activeNodes.size(); ++i)
+    {
+      const NodeType &      node = activeNodes[i].first;
+      const OutputPixelType previousValue = this->GetOutputValue(output, node);
+      const OutputPixelType value = solutions[i];
+
+      if (value < previousValue)
+      {
+        this->SetOutputValue(output, node, value);
+      }
+
+      if (activeNodes[i].second)
+      {
+        if (value < previousValue)
+        {
+          nextActiveNodes.emplace_back(node, false);
+        }
+        else
+        {
+          m_LabelImage->SetPixel(node, Traits::Far);
+        }
+      }
+      else if (static_cast<double>(previousValue) - static_cast<double>(value) > m_ConvergenceTolerance)
+      {
+        nextActiveNodes.emplace_back(node, false);
+      }
+      else
+      {
+        m_LabelImage->SetPixel(node, Traits::Far);
+        activateNeighbors(node, nextActiveNodes);
+      }
+    }
+    activeNodes.swap(nextActiveNodes);
+  }
+
+  // Accept the nodes in increasing order of arrival time until the stopping
+  // criterion is satisfied.
+  std::vector<NodePairType> nodePairs;
+  for (ImageRegionConstIteratorWithIndex<LabelImageType> it(m_LabelImage, m_BufferedRegion); !it.IsAtEnd(); ++it)
+  {
+    if (it.Get() == Traits::InitialTrial ||
+        (it.Get() == Traits::Far && this->GetOutputValue(output, it.GetIndex()) < this->m_LargeValue))
+    {
+      nodePairs.emplace_back(it.GetIndex(), this->GetOutputValue(output, it.GetIndex()));
+    }
+  }
+  std::sort(nodePairs.begin(), nodePairs.end());
+
+  this->m_StoppingCriterion->Reinitialize();
+
+  ProgressReporter progress(this, 0, nodePairs.size());
+
+  OutputPixelType currentValue{};
+  auto            nodePairIt = nodePairs.cbegin();
+  for (; nodePairIt != nodePairs.cend(); ++nodePairIt)
+  {
+    currentValue = nodePairIt->GetValue();
+
+    this->m_StoppingCriterion->SetCurrentNodePair(*nodePairIt);
+    if (this->m_StoppingCriterion->IsSatisfied())
+    {
+      break;
+    }
+
+    if (this->m_CollectPoints)
+    {
+      this->m_ProcessedPoints->push_back(*nodePairIt);
+    }
+    this->SetLabelValueForGivenNode(nodePairIt->GetNode(), Traits::Alive);
+    progress.CompletedPixel();
+  }
+
+  // The nodes which have not been reached keep their initial value, if any.
+  for (; nodePairIt != nodePairs.cend(); ++nodePairIt)
+  {
+    if (this->GetLabelValueForGivenNode(nodePairIt->GetNode()) != Traits::InitialTrial)
+    {
+      this->SetOutputValue(output, nodePairIt->GetNode(), this->m_LargeValue);
+    }
+  }
+
+  this->m_TargetReachedValue = currentValue;
+}
+
+template <typename TInput, typename TOutput>
+double
+FastMarchingImageFilterBase<TInput, TOutput>::SolveFromNeighbors(OutputImageType * oImage, const NodeType & iNode) const
+{
+  InternalNodeStructureArray neighbors;
+
+  bool hasNeighbor = false;
+  for (unsigned int j = 0; j < ImageDimension; ++j)
+  {
+    InternalNodeStructure & neighbor = neighbors[j];
+    neighbor.m_Value = this->m_LargeValue;
+    neighbor.m_Node = iNode;
+    neighbor.m_Axis = j;
+
+    NodeType neighIndex = iNode;
+    for (int s = -1; s < 2; s += 2)
+    {
+      neighIndex[j] = iNode[j] + s;
+      if ((neighIndex[j] >= m_StartIndex[j]) && (neighIndex[j] <= m_LastIndex[j]) &&
+          (m_LabelImage->GetPixel(neighIndex) != Traits::Forbidden))
+      {
+        const OutputPixelType neighValue = this->GetOutputValue(oImage, neighIndex);
+        if (neighValue < neighbor.m_Value)
+        {
+          neighbor.m_Value = neighValue;
+          neighbor.m_Node = neighIndex;
+        }
+      }
+    }
+    hasNeighbor = hasNeighbor || (neighbor.m_Value < this->m_LargeValue);
+  }
+
+  if (!hasNeighbor)
+  {
+    return static_cast<double>(this->m_LargeValue);
+  }
+  return std::min(this->Solve(oImage, iNode, neighbors), static_cast<double>(this->m_LargeValue));
+}
+
 template <typename TInput, typename TOutput>
 void
 FastMarchingImageFilterBase<TInput, TOutput>::SetOutputValue(OutputImageType *       oImage,
@@ -185,7 +419,7 @@ FastMarchingImageFilterBase<TInput, TOutput>::UpdateValue(OutputImageType * oIma
     this->SetLabelValueForGivenNode(iNode, Traits::Trial);
 
     // Insert point into trial heap
-    this->m_Heap.push(NodePairType(iNode, outputPixel));
+    this->PushTrialNode(NodePairType(iNode, outputPixel));
   }
 }
 
@@ -527,8 +761,7 @@ FastMarchingImageFilterBase<TInput, TOutput>::InitializeOutput(OutputImageType *
         outputPixel = pointsIter->Value().GetValue();
         this->SetOutputValue(oImage, idx, outputPixel);
 
-        // this->m_Heap->Push( PriorityQueueElementType( idx, pointsIter->second ) );
-        this->m_Heap.push(pointsIter->Value());
+        this->PushTrialNode(pointsIter->Value());
       }
       ++pointsIter;
     }
@@ -980,6 +1213,7 @@ FastMarchingImageFilterBase<TInput, TOutput>::PrintSelf(std::ostream & os, Inden
   os << indent << "OutputDirection: " << m_OutputDirection << std::endl;
 
   os << indent << "OverrideOutputInformation: " << m_OverrideOutputInformation << std::endl;
+  os << indent << "ConvergenceTolerance: " << m_ConvergenceTolerance << std::endl;
 
   itkPrintSelfObjectMacro(LabelImage);
 
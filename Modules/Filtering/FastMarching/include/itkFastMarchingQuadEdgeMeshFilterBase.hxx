@@ -202,7 +202,7 @@ FastMarchingQuadEdgeMeshFilterBase<TInput, TOutput>::UpdateValue(OutputMeshType
 
       this->SetLabelValueForGivenNode(iNode, Traits::Trial);
 
-      this->m_Heap.push(NodePairType(iNode, outputPixel));
+      this->PushTrialNode(NodePairType(iNode, outputPixel));
     }
   }
   else
@@ -668,7 +668,7 @@ FastMarchingQuadEdgeMeshFilterBase<TInput, TOutput>::InitializeOutput(OutputMesh
         this->SetLabelValueForGivenNode(idx, Traits::InitialTrial);
         this->SetOutputValue(oMesh, idx, outputPixel);
 
-        this->m_Heap.push(pointsIter->Value());
+        this->PushTrialNode(pointsIter->Value());
       }
 
       ++pointsIter;
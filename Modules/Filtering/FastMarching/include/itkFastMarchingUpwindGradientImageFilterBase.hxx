@@ -58,6 +58,12 @@ template <typename TInput, typename TOutput>
 void
 FastMarchingUpwindGradientImageFilterBase<TInput, TOutput>::InitializeOutput(OutputImageType * output)
 {
+  // The gradient is computed when the neighbors of an alive node are updated.
+  if (this->m_FrontPropagation == Superclass::FrontPropagationEnum::FastIterativeMethod)
+  {
+    itkExceptionMacro("Front propagation " << this->m_FrontPropagation << " is not supported by this filter");
+  }
+
   Superclass::InitializeOutput(output);
 
   // allocate memory for the GradientImage if requested
@@ -37,4 +37,22 @@ operator<<(std::ostream & out, const FastMarchingTraitsEnums::TopologyCheck valu
     }
   }();
 }
+
+std::ostream &
+operator<<(std::ostream & out, const FastMarchingTraitsEnums::FrontPropagation value)
+{
+  return out << [value] {
+    switch (value)
+    {
+      case FastMarchingTraitsEnums::FrontPropagation::PriorityQueue:
+        return "itk::FastMarchingTraitsEnums::FrontPropagation::PriorityQueue";
+      case FastMarchingTraitsEnums::FrontPropagation::UntidyPriorityQueue:
+        return "itk::FastMarchingTraitsEnums::FrontPropagation::UntidyPriorityQueue";
+      case FastMarchingTraitsEnums::FrontPropagation::FastIterativeMethod:
+        return "itk::FastMarchingTraitsEnums::FrontPropagation::FastIterativeMethod";
+      default:
+        return "INVALID VALUE FOR itk::FastMarchingTraitsEnums::FrontPropagation";
+    }
+  }();
+}
 } // end namespace itk
@@ -0,0 +1,233 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include <set>
+#include "itkFastMarchingImageFilterBase.h"
+#include "itkFastMarchingThresholdStoppingCriterion.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int Dimension = 2;
+using ImageType = itk::Image<float, Dimension>;
+using CriterionType = itk::FastMarchingThresholdStoppingCriterion<ImageType, ImageType>;
+using FastMarchingType = itk::FastMarchingImageFilterBase<ImageType, ImageType>;
+using FrontPropagationEnum = FastMarchingType::FrontPropagationEnum;
+
+ImageType::Pointer
+March(const ImageType *                         speedImage,
+      FastMarchingType::NodePairContainerType * trialPoints,
+      FastMarchingType::NodePairContainerType * forbiddenPoints,
+      FrontPropagationEnum                      frontPropagation,
+      double                                    threshold,
+      double                                    bucketWidth = 0.0)
+{
+  auto criterion = CriterionType::New();
+  criterion->SetThreshold(threshold);
+
+  auto marcher = FastMarchingType::New();
+  marcher->SetInput(speedImage);
+  marcher->SetTrialPoints(trialPoints);
+  marcher->SetForbiddenPoints(forbiddenPoints);
+  marcher->SetStoppingCriterion(criterion);
+  marcher->SetFrontPropagation(frontPropagation);
+  marcher->SetBucketWidth(bucketWidth);
+  marcher->Update();
+
+  return marcher->GetOutput();
+}
+
+// Compare the nodes reached by the reference front, up to the given tolerance.
+bool
+CompareArrivalTimes(const ImageType * reference, const ImageType * image, double threshold, double tolerance)
+{
+  double maximumDifference = 0.0;
+
+  itk::ImageRegionConstIterator<ImageType> referenceIt(reference, reference->GetBufferedRegion());
+  itk::ImageRegionConstIterator<ImageType> it(image, image->GetBufferedRegion());
+  for (; !it.IsAtEnd(); ++it, ++referenceIt)
+  {
+    if (referenceIt.Get() < threshold)
+    {
+      maximumDifference = std::max(maximumDifference, itk::Math::abs(double{ referenceIt.Get() } - it.Get()));
+    }
+    else if (it.Get() < threshold)
+    {
+      std::cerr << "Node " << it.GetIndex() << " is reached with value " << it.Get() << " but not by the reference"
+                << std::endl;
+      return false;
+    }
+  }
+
+  std::cout << "Maximum difference: " << maximumDifference << std::endl;
+  if (maximumDifference > tolerance)
+  {
+    std::cerr << "Maximum difference " << maximumDifference << " is larger than " << tolerance << std::endl;
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+int
+itkFastMarchingImageFilterBaseFrontPropagationTest(int, char *[])
+{
+  auto marcher = FastMarchingType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(marcher, FastMarchingImageFilterBase, FastMarchingBase);
+
+  ITK_TEST_SET_GET_VALUE(FrontPropagationEnum::PriorityQueue, marcher->GetFrontPropagation());
+  marcher->SetFrontPropagation(FrontPropagationEnum::UntidyPriorityQueue);
+  ITK_TEST_SET_GET_VALUE(FrontPropagationEnum::UntidyPriorityQueue, marcher->GetFrontPropagation());
+
+  constexpr double bucketWidth = 0.1;
+  marcher->SetBucketWidth(bucketWidth);
+  ITK_TEST_SET_GET_VALUE(bucketWidth, marcher->GetBucketWidth());
+
+  constexpr double convergenceTolerance = 1e-4;
+  marcher->SetConvergenceTolerance(convergenceTolerance);
+  ITK_TEST_SET_GET_VALUE(convergenceTolerance, marcher->GetConvergenceTolerance());
+
+  // A speed image quantized to two integer values, with a wall the front
+  // has to go around.
+  constexpr ImageType::SizeType size{ 64, 64 };
+
+  auto speedImage = ImageType::New();
+  speedImage->SetRegions(size);
+  speedImage->Allocate();
+
+  auto trialPoints = FastMarchingType::NodePairContainerType::New();
+  auto forbiddenPoints = FastMarchingType::NodePairContainerType::New();
+  for (itk::ImageRegionIteratorWithIndex<ImageType> it(speedImage, speedImage->GetLargestPossibleRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    const ImageType::IndexType index = it.GetIndex();
+    it.Set((index[0] < 32) ? 1.0f : 2.0f);
+    if (index[0] == 20 && index[1] > 10 && index[1] < 50)
+    {
+      forbiddenPoints->push_back(FastMarchingType::NodePairType(index, 0.0f));
+    }
+  }
+  trialPoints->push_back(FastMarchingType::NodePairType({ { 10, 30 } }, 0.0f));
+
+  constexpr double largeThreshold = 1000.0;
+  const auto       reference =
+    March(speedImage, trialPoints, forbiddenPoints, FrontPropagationEnum::PriorityQueue, largeThreshold);
+
+  int testStatus = EXIT_SUCCESS;
+
+  // The fast iterative method converges to the same solution.
+  const auto fastIterative =
+    March(speedImage, trialPoints, forbiddenPoints, FrontPropagationEnum::FastIterativeMethod, largeThreshold);
+  if (!CompareArrivalTimes(reference, fastIterative, largeThreshold, 1e-3))
+  {
+    std::cerr << "Test failed: the fast iterative method differs from the priority queue." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // The error of the untidy priority queue is bounded by the bucket width.
+  const auto untidy = March(
+    speedImage, trialPoints, forbiddenPoints, FrontPropagationEnum::UntidyPriorityQueue, largeThreshold, bucketWidth);
+  if (!CompareArrivalTimes(reference, untidy, largeThreshold, bucketWidth))
+  {
+    std::cerr << "Test failed: the untidy priority queue differs from the priority queue." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // In a corridor one pixel wide the front collapses to a single node, so
+  // the untidy priority queue empties after every node. Successive nodes
+  // share a bucket in the fast part, and the circular array of buckets wraps
+  // around in the slow part.
+  constexpr ImageType::SizeType corridorSize{ 64, 3 };
+
+  auto corridorSpeedImage = ImageType::New();
+  corridorSpeedImage->SetRegions(corridorSize);
+  corridorSpeedImage->Allocate();
+
+  auto corridorTrialPoints = FastMarchingType::NodePairContainerType::New();
+  auto corridorForbiddenPoints = FastMarchingType::NodePairContainerType::New();
+  for (itk::ImageRegionIteratorWithIndex<ImageType> it(corridorSpeedImage,
+                                                       corridorSpeedImage->GetLargestPossibleRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    const ImageType::IndexType index = it.GetIndex();
+    it.Set((index[0] < 32) ? 1.0f : 16.0f);
+    if (index[1] != 1)
+    {
+      corridorForbiddenPoints->push_back(FastMarchingType::NodePairType(index, 0.0f));
+    }
+  }
+  corridorTrialPoints->push_back(FastMarchingType::NodePairType({ { 1, 1 } }, 0.0f));
+
+  const auto corridorReference = March(corridorSpeedImage,
+                                       corridorTrialPoints,
+                                       corridorForbiddenPoints,
+                                       FrontPropagationEnum::PriorityQueue,
+                                       largeThreshold);
+  const auto corridorUntidy = March(corridorSpeedImage,
+                                    corridorTrialPoints,
+                                    corridorForbiddenPoints,
+                                    FrontPropagationEnum::UntidyPriorityQueue,
+                                    largeThreshold,
+                                    bucketWidth);
+  if (!CompareArrivalTimes(corridorReference, corridorUntidy, largeThreshold, bucketWidth))
+  {
+    std::cerr << "Test failed: the untidy priority queue loses nodes when it empties." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // The stopping criterion is applied in increasing order of arrival time.
+  constexpr double threshold = 20.0;
+  const auto       thresholdReference =
+    March(speedImage, trialPoints, forbiddenPoints, FrontPropagationEnum::PriorityQueue, threshold);
+  const auto thresholdFastIterative =
+    March(speedImage, trialPoints, forbiddenPoints, FrontPropagationEnum::FastIterativeMethod, threshold);
+  if (!CompareArrivalTimes(thresholdReference, thresholdFastIterative, threshold, 1e-3))
+  {
+    std::cerr << "Test failed: the fast iterative method does not stop as the priority queue." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // Topology constraints require the front to be propagated in order.
+  auto criterion = CriterionType::New();
+  criterion->SetThreshold(threshold);
+  marcher->SetInput(speedImage);
+  marcher->SetTrialPoints(trialPoints);
+  marcher->SetStoppingCriterion(criterion);
+  marcher->SetFrontPropagation(FrontPropagationEnum::FastIterativeMethod);
+  marcher->SetTopologyCheck(FastMarchingType::TopologyCheckEnum::Strict);
+  ITK_TRY_EXPECT_EXCEPTION(marcher->Update());
+
+  // Test streaming enumeration for FastMarchingTraitsEnums::FrontPropagation elements
+  const std::set<itk::FastMarchingTraitsEnums::FrontPropagation> allFrontPropagation{
+    itk::FastMarchingTraitsEnums::FrontPropagation::PriorityQueue,
+    itk::FastMarchingTraitsEnums::FrontPropagation::UntidyPriorityQueue,
+    itk::FastMarchingTraitsEnums::FrontPropagation::FastIterativeMethod
+  };
+  for (const auto & ee : allFrontPropagation)
+  {
+    std::cout << "STREAMED ENUM VALUE FastMarchingTraitsEnums::FrontPropagation: " << ee << std::endl;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
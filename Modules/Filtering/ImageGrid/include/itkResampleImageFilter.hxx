@@ -21,7 +21,6 @@
 #include "itkObjectFactory.h"
 #include "itkIdentityTransform.h"
 #include "itkTotalProgressReporter.h"
-#include "itkImageRegionIteratorWithIndex.h"
 #include "itkImageScanlineIterator.h"
 #include "itkSpecialCoordinatesImage.h"
 #include "itkDefaultConvertPixelTraits.h"
@@ -29,6 +28,7 @@
 
 #include <algorithm>   // For max.
 #include <type_traits> // For is_same.
+#include <vector>
 #include "itkPrintHelper.h"
 
 namespace itk
@@ -379,44 +379,58 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
   const bool isSpecialCoordinatesImage = (dynamic_cast<const InputSpecialCoordinatesImageType *>(inputPtr) != nullptr);
 
 
-  // Create an iterator that will walk the output region for this thread.
-
   using OutputType = typename InterpolatorType::OutputType;
 
-  // Walk the output region
-  for (ImageRegionIteratorWithIndex outIt(outputPtr, outputRegionForThread); !outIt.IsAtEnd(); ++outIt)
-  {
-    // Determine the index of the current output pixel
-
-    OutputPointType outputPoint; // Coordinates of current output pixel
-    outputPtr->TransformIndexToPhysicalPoint(outIt.GetIndex(), outputPoint);
-
-    // Compute corresponding input pixel position
-    const InputPointType inputPoint = transformPtr->TransformPoint(outputPoint);
+  // Points of one output scanline are transformed together, so that
+  // transforms providing a batched TransformPoints can amortize their setup.
+  std::vector<typename TransformType::InputPointType>  outputPoints;
+  std::vector<typename TransformType::OutputPointType> transformedPoints;
 
-    ContinuousInputIndexType inputIndex;
-    const bool               isInsideInput = inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, inputIndex);
+  // Walk the output region one scanline at a time
+  for (ImageScanlineIterator outIt(outputPtr, outputRegionForThread); !outIt.IsAtEnd(); outIt.NextLine())
+  {
+    const SizeValueType scanlineLength = outputRegionForThread.GetSize(0);
+    outputPoints.resize(scanlineLength);
+    transformedPoints.resize(scanlineLength);
 
-    OutputType value;
-    // Evaluate input at right position and copy to the output
-    if (m_Interpolator->IsInsideBuffer(inputIndex) && (!isSpecialCoordinatesImage || isInsideInput))
+    // Determine the coordinates of the output pixels of this scanline
+    IndexType index = outIt.GetIndex();
+    for (SizeValueType i = 0; i < scanlineLength; ++i, ++index[0])
     {
-      value = m_Interpolator->EvaluateAtContinuousIndex(inputIndex);
-      outIt.Set(Self::CastPixelWithBoundsChecking(value));
+      outputPtr->TransformIndexToPhysicalPoint(index, outputPoints[i]);
     }
-    else
+
+    // Compute corresponding input pixel positions
+    transformPtr->TransformPoints(outputPoints.data(), transformedPoints.data(), scanlineLength);
+
+    for (SizeValueType i = 0; i < scanlineLength; ++i, ++outIt)
     {
-      if (m_Extrapolator.IsNull())
+      const InputPointType inputPoint(transformedPoints[i]);
+
+      ContinuousInputIndexType inputIndex;
+      const bool isInsideInput = inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, inputIndex);
+
+      OutputType value;
+      // Evaluate input at right position and copy to the output
+      if (m_Interpolator->IsInsideBuffer(inputIndex) && (!isSpecialCoordinatesImage || isInsideInput))
       {
-        outIt.Set(m_DefaultPixelValue); // default background value
+        value = m_Interpolator->EvaluateAtContinuousIndex(inputIndex);
+        outIt.Set(Self::CastPixelWithBoundsChecking(value));
       }
       else
       {
-        value = m_Extrapolator->EvaluateAtContinuousIndex(inputIndex);
-        outIt.Set(Self::CastPixelWithBoundsChecking(value));
+        if (m_Extrapolator.IsNull())
+        {
+          outIt.Set(m_DefaultPixelValue); // default background value
+        }
+        else
+        {
+          value = m_Extrapolator->EvaluateAtContinuousIndex(inputIndex);
+          outIt.Set(Self::CastPixelWithBoundsChecking(value));
+        }
       }
     }
-    progress.CompletedPixel();
+    progress.Completed(scanlineLength);
   }
 }
 
@@ -20,6 +20,7 @@
 
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 
 #include "itkQuadEdgeMeshEulerOperatorJoinVertexFunction.h"
@@ -79,7 +80,7 @@ public:
                                                    PriorityType>;
   using PriorityQueuePointer = typename PriorityQueueType::Pointer;
 
-  using QueueMapType = std::map<OutputQEType *, PriorityQueueItemType *>;
+  using QueueMapType = std::unordered_map<OutputQEType *, PriorityQueueItemType *>;
   using QueueMapConstIterator = typename QueueMapType::const_iterator;
   using QueueMapIterator = typename QueueMapType::iterator;
 
@@ -107,6 +108,17 @@ protected:
   virtual MeasureType
   MeasureEdge(OutputQEType * iEdge) = 0;
 
+  /**
+   * \brief Whether MeasureEdge() can be called concurrently for different
+   * edges, in which case the priority queue is filled in parallel
+   * \return false by default
+   */
+  [[nodiscard]] virtual bool
+  IsMeasureEdgeThreadSafe() const
+  {
+    return false;
+  }
+
   /**
    * \brief Fill the priority queue
    */
@@ -141,6 +153,15 @@ protected:
   void
   DeleteElement(OutputQEType * iEdge);
 
+  /**
+   * \brief Delete an edge in the priority queue, given as stored in the
+   * priority queue. The edge is not accessed, so it may have been deleted
+   * from the mesh already.
+   * \param[in] iEdge
+   */
+  void
+  DeleteQueuedElement(OutputQEType * iEdge);
+
   virtual void
   DeletePoint(const OutputPointIdentifier & iIdToBeDeleted, const OutputPointIdentifier & iRemaining);
 
@@ -59,16 +59,47 @@ EdgeDecimationQuadEdgeMeshFilter<TInput, TOutput, TCriterion>::FillPriorityQueue
   // cache for use in MeasureEdge
   this->m_OutputMesh = this->GetOutput();
 
+  std::vector<OutputQEType *> edges;
+  edges.reserve(output->GetEdgeCells()->Size());
   while (it != end)
   {
     edge = dynamic_cast<OutputEdgeCellType *>(it.Value());
 
     if (edge)
     {
-      PushElement(edge->GetQEGeom());
+      OutputQEType * qe = edge->GetQEGeom();
+      edges.push_back((qe->GetOrigin() < qe->GetDestination()) ? qe : qe->GetSym());
     }
     ++it;
   }
+
+  // The measures only depend on the mesh, which is not modified until the
+  // queue is filled.
+  std::vector<MeasureType> measures(edges.size());
+  const auto               measureEdge = [this, &edges, &measures](SizeValueType i) {
+    measures[i] = this->MeasureEdge(edges[i]);
+  };
+  if (this->IsMeasureEdgeThreadSafe())
+  {
+    this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+    this->GetMultiThreader()->ParallelizeArray(0, edges.size(), measureEdge, nullptr);
+  }
+  else
+  {
+    for (SizeValueType i = 0; i < edges.size(); ++i)
+    {
+      measureEdge(i);
+    }
+  }
+
+  m_QueueMapper.reserve(edges.size());
+  for (SizeValueType i = 0; i < edges.size(); ++i)
+  {
+    auto * qi = new PriorityQueueItemType(edges[i], PriorityType(false, measures[i]));
+
+    m_QueueMapper[edges[i]] = qi;
+    m_PriorityQueue->Push(qi);
+  }
 }
 
 template <typename TInput, typename TOutput, typename TCriterion>
@@ -168,17 +199,23 @@ EdgeDecimationQuadEdgeMeshFilter<TInput, TOutput, TCriterion>::DeleteElement(Out
   if (iEdge) // this test can be removed
   {
     OutputQEType * temp = (iEdge->GetOrigin() < iEdge->GetDestination()) ? iEdge : iEdge->GetSym();
+    DeleteQueuedElement(temp);
+  }
+}
 
-    auto map_it = m_QueueMapper.find(temp);
-    if (map_it != m_QueueMapper.end())
+template <typename TInput, typename TOutput, typename TCriterion>
+void
+EdgeDecimationQuadEdgeMeshFilter<TInput, TOutput, TCriterion>::DeleteQueuedElement(OutputQEType * iEdge)
+{
+  auto map_it = m_QueueMapper.find(iEdge);
+  if (map_it != m_QueueMapper.end())
+  {
+    if (!map_it->second->m_Priority.first)
     {
-      if (!map_it->second->m_Priority.first)
-      {
-        PriorityQueueItemType * e(map_it->second);
-        m_PriorityQueue->DeleteElement(e);
-        delete map_it->second;
-        m_QueueMapper.erase(map_it);
-      }
+      PriorityQueueItemType * e(map_it->second);
+      m_PriorityQueue->DeleteElement(e);
+      delete map_it->second;
+      m_QueueMapper.erase(map_it);
     }
   }
 }
@@ -306,69 +343,75 @@ EdgeDecimationQuadEdgeMeshFilter<TInput, TOutput, TCriterion>::ProcessWithoutAny
     return false;
   }
 
-  std::list<OutputQEType *> list_qe_to_be_deleted;
-  OutputQEType *            temp = m_Element->GetOnext();
+  // The edges around both points, as stored in the priority queue. They
+  // are left in the queue when the edge cannot be collapsed, since the mesh
+  // is not modified then.
+  std::vector<OutputQEType *> list_qe_to_be_deleted;
+  OutputQEType *              temp = m_Element->GetOnext();
 
   while (temp != m_Element)
   {
-    list_qe_to_be_deleted.push_back(temp);
+    list_qe_to_be_deleted.push_back((temp->GetOrigin() < temp->GetDestination()) ? temp : temp->GetSym());
     temp = temp->GetOnext();
   }
 
   temp = m_Element->GetSym()->GetOnext();
   while (temp != m_Element->GetSym())
   {
-    list_qe_to_be_deleted.push_back(temp);
+    list_qe_to_be_deleted.push_back((temp->GetOrigin() < temp->GetDestination()) ? temp : temp->GetSym());
     temp = temp->GetOnext();
   }
 
-  auto it = list_qe_to_be_deleted.begin();
-
-  while (it != list_qe_to_be_deleted.end())
+  if (!m_JoinVertexFunction->Evaluate(m_Element))
   {
-    DeleteElement(*it);
-    ++it;
+    JoinVertexFailed();
+    return false;
   }
 
-  if (!m_JoinVertexFunction->Evaluate(m_Element))
-  {
-    it = list_qe_to_be_deleted.begin();
+  const OutputPointIdentifier old_id = m_JoinVertexFunction->GetOldPointID();
+
+  const OutputPointIdentifier new_id = (old_id == id_dest) ? id_org : id_dest;
+  DeletePoint(old_id, new_id);
 
-    while (it != list_qe_to_be_deleted.end())
+  OutputQEType * edge = this->m_OutputMesh->FindEdge(new_id);
+  if (edge == nullptr)
+  {
+    for (OutputQEType * qe : list_qe_to_be_deleted)
     {
-      PushOrUpdateElement(*it);
-      ++it;
+      DeleteQueuedElement(qe);
     }
-
-    JoinVertexFailed();
+    itkDebugMacro("edge == 0, at iteration " << this->m_Iteration);
+    return false;
   }
-  else
-  {
-    const OutputPointIdentifier old_id = m_JoinVertexFunction->GetOldPointID();
 
-    const OutputPointIdentifier new_id = (old_id == id_dest) ? id_org : id_dest;
-    DeletePoint(old_id, new_id);
+  if (m_Relocate)
+  {
+    pt.SetEdge(edge);
+    this->m_OutputMesh->SetPoint(new_id, pt);
+  }
 
-    OutputQEType * edge = this->m_OutputMesh->FindEdge(new_id);
-    if (edge == nullptr)
-    {
-      itkDebugMacro("edge == 0, at iteration " << this->m_Iteration);
-      return false;
-    }
+  // The edges which are still around the remaining point are updated in
+  // place; the other ones were deleted with the collapsed faces, and must
+  // not be accessed anymore.
+  std::vector<OutputQEType *> list_qe_to_be_updated;
+  temp = edge;
+  do
+  {
+    list_qe_to_be_updated.push_back((temp->GetOrigin() < temp->GetDestination()) ? temp : temp->GetSym());
+    temp = temp->GetOnext();
+  } while (temp != edge);
 
-    if (m_Relocate)
+  for (OutputQEType * qe : list_qe_to_be_deleted)
+  {
+    if (std::find(list_qe_to_be_updated.cbegin(), list_qe_to_be_updated.cend(), qe) == list_qe_to_be_updated.cend())
     {
-      pt.SetEdge(edge);
-      this->m_OutputMesh->SetPoint(new_id, pt);
+      DeleteQueuedElement(qe);
     }
+  }
 
-    temp = edge;
-
-    do
-    {
-      PushOrUpdateElement(temp);
-      temp = temp->GetOnext();
-    } while (temp != edge);
+  for (OutputQEType * qe : list_qe_to_be_updated)
+  {
+    PushOrUpdateElement(qe);
   }
   return false;
 }
@@ -122,7 +122,10 @@ protected:
   {
     const OutputPointIdentifier id_org = iEdge->GetOrigin();
     const OutputPointIdentifier id_dest = iEdge->GetDestination();
-    QuadricElementType          Q = m_Quadric[id_org] + m_Quadric[id_dest];
+
+    // The quadrics are looked up without being inserted, so that edges can
+    // be measured concurrently.
+    QuadricElementType Q = m_Quadric.find(id_org)->second + m_Quadric.find(id_dest)->second;
 
     const OutputPointType org = this->m_OutputMesh->GetPoint(id_org);
     const OutputPointType dest = this->m_OutputMesh->GetPoint(id_dest);
@@ -135,6 +138,13 @@ protected:
     return static_cast<MeasureType>(Q.ComputeError(p));
   }
 
+  /** \brief The quadric errors of the edges can be computed concurrently */
+  [[nodiscard]] bool
+  IsMeasureEdgeThreadSafe() const override
+  {
+    return true;
+  }
+
   /** \brief Delete point
    * \param[in] iIdToBeDeleted id of the point to be deleted
    * \param[in] iRemaining  id of the point to be kept
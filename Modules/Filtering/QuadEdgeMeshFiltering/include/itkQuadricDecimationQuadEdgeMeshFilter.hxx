@@ -30,7 +30,8 @@ QuadricDecimationQuadEdgeMeshFilter<TInput, TOutput, TCriterion>::Initialize()
   const OutputPointsContainerPointer points = output->GetPoints();
   OutputPointsContainerIterator      it = points->Begin();
 
-  OutputMeshType * outputMesh = this->GetOutput();
+  std::vector<OutputPointIdentifier> pointIds;
+  std::vector<OutputQEType *>        pointEdges;
   while (it != points->End())
   {
     OutputPointIdentifier p_id = it->Index();
@@ -38,14 +39,35 @@ QuadricDecimationQuadEdgeMeshFilter<TInput, TOutput, TCriterion>::Initialize()
     OutputQEType * qe = output->FindEdge(p_id);
     if (qe != nullptr)
     {
+      pointIds.push_back(p_id);
+      pointEdges.push_back(qe);
+    }
+    ++it;
+  }
+
+  // The quadric of each point only depends on the faces around it
+  OutputMeshType *                outputMesh = this->GetOutput();
+  std::vector<QuadricElementType> quadrics(pointIds.size());
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    pointIds.size(),
+    [this, &pointEdges, &quadrics, outputMesh](SizeValueType i) {
+      OutputQEType * qe = pointEdges[i];
       OutputQEType * qe_it = qe;
       do
       {
-        QuadricAtOrigin(qe_it, m_Quadric[p_id], outputMesh);
+        QuadricAtOrigin(qe_it, quadrics[i], outputMesh);
         qe_it = qe_it->GetOnext();
       } while (qe_it != qe);
-    }
-    ++it;
+    },
+    nullptr);
+
+  // The point identifiers are sorted, as in the points container
+  m_Quadric.clear();
+  for (SizeValueType i = 0; i < pointIds.size(); ++i)
+  {
+    m_Quadric.emplace_hint(m_Quadric.end(), pointIds[i], quadrics[i]);
   }
 }
 
@@ -93,6 +93,13 @@ protected:
     return static_cast<MeasureType>(org.SquaredEuclideanDistanceTo(dest));
   }
 
+  /** The squared edge lengths can be computed concurrently. */
+  [[nodiscard]] bool
+  IsMeasureEdgeThreadSafe() const override
+  {
+    return true;
+  }
+
   // keep the start of this documentation text on very first comment line,
   // it prevents a Doxygen bug
   /** Calculate the position of the remaining vertex from collapsing iEdge.
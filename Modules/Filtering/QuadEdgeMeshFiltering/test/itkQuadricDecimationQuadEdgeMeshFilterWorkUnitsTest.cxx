@@ -0,0 +1,136 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkQuadEdgeMesh.h"
+#include "itkQuadEdgeMeshDecimationCriteria.h"
+#include "itkQuadricDecimationQuadEdgeMeshFilter.h"
+#include "itkSquaredEdgeLengthDecimationQuadEdgeMeshFilter.h"
+#include "itkRegularSphereMeshSource.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+using MeshType = itk::QuadEdgeMesh<double, 3>;
+using CriterionType = itk::NumberOfFacesCriterion<MeshType>;
+
+// Decimate the mesh with the given number of work units.
+template <typename TDecimation>
+MeshType::Pointer
+Decimate(const MeshType * mesh, unsigned int numberOfFaces, itk::ThreadIdType numberOfWorkUnits)
+{
+  auto criterion = CriterionType::New();
+  criterion->SetTopologicalChange(false);
+  criterion->SetNumberOfElements(numberOfFaces);
+
+  auto decimation = TDecimation::New();
+  decimation->SetInput(mesh);
+  decimation->SetCriterion(criterion);
+  decimation->SetNumberOfWorkUnits(numberOfWorkUnits);
+  decimation->Update();
+
+  return decimation->GetOutput();
+}
+
+// Check that the decimation does not depend on the number of work units,
+// and preserves the topology of the sphere.
+template <typename TDecimation>
+bool
+CheckDecimation(const MeshType * mesh, unsigned int numberOfFaces)
+{
+  const auto expected = Decimate<TDecimation>(mesh, numberOfFaces, 1);
+  const auto decimated = Decimate<TDecimation>(mesh, numberOfFaces, 4);
+
+  std::cout << expected->GetNumberOfPoints() << " points, " << expected->GetNumberOfEdges() << " edges and "
+            << expected->GetNumberOfFaces() << " faces" << std::endl;
+  if (expected->GetNumberOfFaces() > numberOfFaces)
+  {
+    std::cerr << "Expected at most " << numberOfFaces << " faces" << std::endl;
+    return false;
+  }
+
+  const auto eulerCharacteristic = static_cast<long>(expected->GetNumberOfPoints()) -
+                                   static_cast<long>(expected->GetNumberOfEdges()) +
+                                   static_cast<long>(expected->GetNumberOfFaces());
+  if (eulerCharacteristic != 2)
+  {
+    std::cerr << "Expected an Euler characteristic of 2, but got " << eulerCharacteristic << std::endl;
+    return false;
+  }
+
+  if (expected->GetNumberOfPoints() != decimated->GetNumberOfPoints() ||
+      expected->GetNumberOfFaces() != decimated->GetNumberOfFaces())
+  {
+    std::cerr << "The decimated meshes differ" << std::endl;
+    return false;
+  }
+  for (auto it = expected->GetPoints()->Begin(); it != expected->GetPoints()->End(); ++it)
+  {
+    if (it.Value() != decimated->GetPoint(it.Index()))
+    {
+      std::cerr << "Point " << it.Index() << " differs: " << it.Value() << " vs " << decimated->GetPoint(it.Index())
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int
+itkQuadricDecimationQuadEdgeMeshFilterWorkUnitsTest(int, char *[])
+{
+  using SphereMeshSourceType = itk::RegularSphereMeshSource<MeshType>;
+  auto sphere = SphereMeshSourceType::New();
+  sphere->SetResolution(5);
+  ITK_TRY_EXPECT_NO_EXCEPTION(sphere->Update());
+
+  // Perturb the points, so that the edges have distinct measures.
+  const MeshType::Pointer mesh = sphere->GetOutput();
+  auto                    random = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  random->SetSeed(1234);
+  for (auto it = mesh->GetPoints()->Begin(); it != mesh->GetPoints()->End(); ++it)
+  {
+    MeshType::PointType & point = it.Value();
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      point[d] += random->GetUniformVariate(-0.01, 0.01);
+    }
+  }
+  std::cout << mesh->GetNumberOfFaces() << " faces" << std::endl;
+
+  int testStatus = EXIT_SUCCESS;
+
+  using QuadricDecimationType = itk::QuadricDecimationQuadEdgeMeshFilter<MeshType, MeshType, CriterionType>;
+  if (!CheckDecimation<QuadricDecimationType>(mesh, 500))
+  {
+    std::cerr << "Test failed for the quadric decimation." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  using SquaredEdgeLengthDecimationType =
+    itk::SquaredEdgeLengthDecimationQuadEdgeMeshFilter<MeshType, MeshType, CriterionType>;
+  if (!CheckDecimation<SquaredEdgeLengthDecimationType>(mesh, 500))
+  {
+    std::cerr << "Test failed for the squared edge length decimation." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
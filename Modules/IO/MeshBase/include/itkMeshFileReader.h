@@ -143,6 +143,16 @@ public:
   itkGetModifiableObjectMacro(MeshIO, MeshIOBase);
   /** @ITKEndGrouping */
 
+  /** Set/Get whether the cells are read as compact cells, see
+   * Mesh::SetCompactCells(). This avoids the allocation of a cell object per
+   * cell for large meshes. It only applies to itk::Mesh outputs, and has no
+   * effect for other mesh types such as QuadEdgeMesh. Default is false. */
+  /** @ITKStartGrouping */
+  itkSetMacro(CompactCells, bool);
+  itkGetConstMacro(CompactCells, bool);
+  itkBooleanMacro(CompactCells);
+  /** @ITKEndGrouping */
+
   /** Prepare the allocation of the output mesh during the first back
    * propagation of the pipeline. */
   void
@@ -193,6 +203,7 @@ protected:
   bool                m_UserSpecifiedMeshIO{}; // keep track whether the MeshIO is
                                                // user specified
   std::string m_FileName{};                    // The file to be read
+  bool        m_CompactCells{ false };
 
 private:
   template <typename T>
@@ -203,6 +214,11 @@ private:
   void
   ReadCellsUsingMeshIO();
 
+  /** Read the cells into the compact cell containers of the output mesh. */
+  template <typename T>
+  void
+  ReadCompactCells(T * buffer);
+
   std::string m_ExceptionMessage{};
 };
 
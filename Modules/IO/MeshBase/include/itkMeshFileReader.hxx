@@ -21,6 +21,7 @@
 #include "itkConvertPixelBuffer.h"
 #include "itkConvertArrayPixelBuffer.h"
 #include "itkConvertVariableLengthVectorPixelBuffer.h"
+#include "itkMesh.h"
 #include "itkMeshIOFactory.h"
 #include "itkMeshRegion.h"
 #include "itkObjectFactory.h"
@@ -29,6 +30,7 @@
 #include "itksys/SystemTools.hxx"
 #include "itkMakeUniqueForOverwrite.h"
 
+#include <algorithm>
 #include <fstream>
 
 namespace itk
@@ -50,6 +52,7 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Pr
 
   os << indent << "UserSpecifiedMeshIO flag: " << m_UserSpecifiedMeshIO << '\n';
   os << indent << "FileName: " << m_FileName << '\n';
+  os << indent << "CompactCells: " << m_CompactCells << '\n';
 }
 
 template <typename TOutputMesh, typename ConvertPointPixelTraits, typename ConvertCellPixelTraits>
@@ -120,6 +123,17 @@ template <typename T>
 void
 MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::ReadCells(T * buffer)
 {
+  if constexpr (std::is_same_v<
+                  TOutputMesh,
+                  Mesh<typename TOutputMesh::PixelType, OutputPointDimension, typename TOutputMesh::MeshTraits>>)
+  {
+    if (m_CompactCells)
+    {
+      this->ReadCompactCells(buffer);
+      return;
+    }
+  }
+
   const typename TOutputMesh::Pointer output = this->GetOutput();
 
   SizeValueType        index{};
@@ -338,6 +352,121 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
   }
 }
 
+template <typename TOutputMesh, typename ConvertPointPixelTraits, typename ConvertCellPixelTraits>
+template <typename T>
+void
+MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::ReadCompactCells(T * buffer)
+{
+  const typename TOutputMesh::Pointer output = this->GetOutput();
+
+  auto   cellTypes = TOutputMesh::CellGeometryContainer::New();
+  auto   offsets = TOutputMesh::CellOffsetsContainer::New();
+  auto   pointIds = TOutputMesh::CellPointIdsContainer::New();
+  auto & types = cellTypes->CastToSTLContainer();
+  auto & cellOffsets = offsets->CastToSTLContainer();
+  auto & ids = pointIds->CastToSTLContainer();
+  cellOffsets.push_back(0);
+  ids.reserve(m_MeshIO->GetCellBufferSize());
+
+  const auto addCell = [&types, &cellOffsets, &ids](CellGeometryEnum cellType) {
+    types.push_back(cellType);
+    cellOffsets.push_back(ids.size());
+  };
+
+  SizeValueType index{};
+  while (index < m_MeshIO->GetCellBufferSize())
+  {
+    auto type = static_cast<CellGeometryEnum>(static_cast<int>(buffer[index++]));
+    auto numberOfPoints = static_cast<unsigned int>(buffer[index++]);
+
+    unsigned int expectedNumberOfPoints = 0;
+    switch (type)
+    {
+      case CellGeometryEnum::VERTEX_CELL:
+        expectedNumberOfPoints = OutputVertexCellType::NumberOfPoints;
+        break;
+      case CellGeometryEnum::TRIANGLE_CELL:
+        expectedNumberOfPoints = OutputTriangleCellType::NumberOfPoints;
+        break;
+      case CellGeometryEnum::QUADRILATERAL_CELL:
+        expectedNumberOfPoints = OutputQuadrilateralCellType::NumberOfPoints;
+        break;
+      case CellGeometryEnum::TETRAHEDRON_CELL:
+        expectedNumberOfPoints = OutputTetrahedronCellType::NumberOfPoints;
+        break;
+      case CellGeometryEnum::HEXAHEDRON_CELL:
+        expectedNumberOfPoints = OutputHexahedronCellType::NumberOfPoints;
+        break;
+      case CellGeometryEnum::QUADRATIC_EDGE_CELL:
+        expectedNumberOfPoints = OutputQuadraticEdgeCellType::NumberOfPoints;
+        break;
+      case CellGeometryEnum::QUADRATIC_TRIANGLE_CELL:
+        expectedNumberOfPoints = OutputQuadraticTriangleCellType::NumberOfPoints;
+        break;
+      case CellGeometryEnum::LINE_CELL:
+      case CellGeometryEnum::POLYLINE_CELL:
+        if (numberOfPoints < 2)
+        {
+          itkExceptionMacro("Invalid Line Cell with number of points = " << numberOfPoints);
+        }
+        break;
+      case CellGeometryEnum::POLYGON_CELL:
+        break;
+      default:
+      {
+        itkExceptionStringMacro("Unknown cell type");
+      }
+    }
+    if (expectedNumberOfPoints != 0 && numberOfPoints != expectedNumberOfPoints)
+    {
+      itkExceptionMacro("Invalid " << type << " with number of points = " << numberOfPoints);
+    }
+
+    if (type == CellGeometryEnum::LINE_CELL)
+    {
+      // for polylines will be loaded as individual edges.
+      auto pointIDBuffer = static_cast<OutputPointIdentifier>(buffer[index++]);
+      for (unsigned int jj = 1; jj < numberOfPoints; ++jj)
+      {
+        ids.push_back(pointIDBuffer);
+        pointIDBuffer = static_cast<OutputPointIdentifier>(buffer[index++]);
+        ids.push_back(pointIDBuffer);
+        addCell(type);
+      }
+      continue;
+    }
+
+    for (unsigned int jj = 0; jj < numberOfPoints; ++jj)
+    {
+      ids.push_back(static_cast<OutputPointIdentifier>(buffer[index++]));
+    }
+
+    // For polyhedron, if the number of points is 3, then we treat it as
+    // triangle cell
+    if (type == CellGeometryEnum::POLYGON_CELL && numberOfPoints == OutputTriangleCellType::NumberOfPoints)
+    {
+      type = CellGeometryEnum::TRIANGLE_CELL;
+    }
+    addCell(type);
+  }
+
+  // Cells of a single type with a fixed number of points do not need the
+  // cell types and offsets.
+  const bool singleCellType =
+    !types.empty() && std::all_of(types.cbegin(), types.cend(), [&types](CellGeometryEnum cellType) {
+      return cellType == types.front();
+    });
+  if (singleCellType && types.front() != CellGeometryEnum::POLYGON_CELL &&
+      types.front() != CellGeometryEnum::POLYLINE_CELL)
+  {
+    output->SetCompactCells(types.front(), pointIds);
+  }
+  else
+  {
+    output->SetCompactCells(cellTypes, offsets, pointIds);
+  }
+}
+
 template <typename TOutputMesh, typename ConvertPointPixelTraits, typename ConvertCellPixelTraits>
 void
 MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::ReadPointData()
@@ -158,14 +158,21 @@ MeshFileWriter<TInputMesh>::Write()
   }
 
   // Whether write cells
-  if (input->GetCells() && input->GetNumberOfCells())
+  if ((input->HasCompactCells() || input->GetCells()) && input->GetNumberOfCells())
   {
     SizeValueType cellsBufferSize = 2 * input->GetNumberOfCells();
-    for (typename TInputMesh::CellsContainerConstIterator ct = input->GetCells()->Begin();
-         ct != input->GetCells()->End();
-         ++ct)
+    if (input->HasCompactCells())
     {
-      cellsBufferSize += ct->Value()->GetNumberOfPoints();
+      cellsBufferSize += input->GetCompactCellPointIds()->Size();
+    }
+    else
+    {
+      for (typename TInputMesh::CellsContainerConstIterator ct = input->GetCells()->Begin();
+           ct != input->GetCells()->End();
+           ++ct)
+      {
+        cellsBufferSize += ct->Value()->GetNumberOfPoints();
+      }
     }
     m_MeshIO->SetCellBufferSize(cellsBufferSize);
     m_MeshIO->SetUpdateCells(true);
@@ -205,7 +212,7 @@ MeshFileWriter<TInputMesh>::Write()
   }
 
   // Write cells
-  if (input->GetCells() && input->GetNumberOfCells())
+  if ((input->HasCompactCells() || input->GetCells()) && input->GetNumberOfCells())
   {
     WriteCells();
   }
@@ -327,13 +334,33 @@ template <typename Output>
 void
 MeshFileWriter<TInputMesh>::CopyCellsToBuffer(Output * data)
 {
+  const InputMeshType * input = this->GetInput();
+
+  // Compact cells are written without creating the cell objects
+  SizeValueType index{};
+  if (input->HasCompactCells())
+  {
+    const typename InputMeshType::CellIdentifier numberOfCells = input->GetNumberOfCells();
+    for (typename InputMeshType::CellIdentifier cellId = 0; cellId < numberOfCells; ++cellId)
+    {
+      const auto first = input->GetCompactCellPointIdsBegin(cellId);
+      const auto last = input->GetCompactCellPointIdsEnd(cellId);
+      data[index++] = static_cast<Output>(input->GetCompactCellType(cellId));
+      data[index++] = static_cast<Output>(last - first);
+      for (auto ptId = first; ptId != last; ++ptId)
+      {
+        data[index++] = static_cast<Output>(*ptId);
+      }
+    }
+    return;
+  }
+
   // Get input mesh pointer
-  const typename InputMeshType::CellsContainer * cells = this->GetInput()->GetCells();
+  const typename InputMeshType::CellsContainer * cells = input->GetCells();
 
   // Define required variables
 
   // For each cell
-  SizeValueType                                    index{};
   typename TInputMesh::CellsContainerConstIterator cter = cells->Begin();
   while (cter != cells->End())
   {
@@ -100,6 +100,13 @@ public:
   itkSetMacro(InitialLearningRate, TInternalComputationValueType);
   itkGetConstReferenceMacro(InitialLearningRate, TInternalComputationValueType);
 
+  /** The clone also copies the initial learning rate. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   /** Advance one Step following the gradient direction.
    * Includes transform update. */
@@ -112,6 +119,9 @@ protected:
   /** Destructor */
   ~ConjugateGradientLineSearchOptimizerv4Template() override = default;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
@@ -33,6 +33,21 @@ ConjugateGradientLineSearchOptimizerv4Template<TInternalComputationValueType>::P
   Superclass::PrintSelf(os, indent);
 }
 
+template <typename TInternalComputationValueType>
+LightObject::Pointer
+ConjugateGradientLineSearchOptimizerv4Template<TInternalComputationValueType>::InternalClone() const
+{
+  LightObject::Pointer loPtr = Superclass::InternalClone();
+
+  const typename Self::Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+  if (rval.IsNull())
+  {
+    itkExceptionMacro("downcast to type " << this->GetNameOfClass() << " failed.");
+  }
+  rval->m_InitialLearningRate = this->m_InitialLearningRate;
+  return loPtr;
+}
+
 template <typename TInternalComputationValueType>
 void
 ConjugateGradientLineSearchOptimizerv4Template<TInternalComputationValueType>::StartOptimization(
@@ -78,7 +93,7 @@ ConjugateGradientLineSearchOptimizerv4Template<TInternalComputationValueType>::A
 
   /* Estimate a learning rate for this step */
   this->m_LineSearchIterations = 0;
-  this->m_LearningRate = this->GoldenSectionSearch(
+  this->m_LearningRate = this->LineSearch(
     this->m_LearningRate * this->m_LowerLimit, this->m_LearningRate, this->m_LearningRate * this->m_UpperLimit);
 
   /* Begin threaded gradient modification of m_Gradient variable. */
@@ -20,6 +20,7 @@
 
 #include "itkIntTypes.h"
 #include "itkObjectToObjectOptimizerBase.h"
+#include <vector>
 
 namespace itk
 {
@@ -78,6 +79,14 @@ namespace itk
  * start_parameter[d] = - stepLength * scaling[d] * numberOfSteps[d]
  *   end_parameter[d] = + stepLength * scaling[d] * numberOfSteps[d]
  *
+ * The grid points can be evaluated concurrently, see
+ * SetNumberOfConcurrentEvaluations(). The points are then distributed over
+ * clones of the metric, which must therefore support cloning, and the
+ * IterationEvents are invoked in the grid order once a batch of points has
+ * been evaluated. Each clone shares the image data of the metric. For small
+ * images, limiting the metric to a single work unit avoids the threading
+ * overhead of each evaluation.
+ *
  * \ingroup ITKOptimizersv4
  */
 template <typename TInternalComputationValueType>
@@ -111,6 +120,10 @@ public:
   /** Scales type */
   using typename Superclass::ScalesType;
 
+  /** Metric type */
+  using typename Superclass::MetricType;
+  using typename Superclass::MetricTypePointer;
+
   void
   StartOptimization(bool doOnlyInitialization = false) override;
 
@@ -137,6 +150,15 @@ public:
   itkGetConstReferenceMacro(MaximumMetricValuePosition, ParametersType);
   itkGetConstReferenceMacro(CurrentIndex, ParametersType);
 
+  /** Set/Get the number of grid points evaluated concurrently. The number of
+   * concurrent evaluations is also limited by the number of work units. The
+   * default of 1 evaluates the grid points one after another with the
+   * metric itself. */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(NumberOfConcurrentEvaluations, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(NumberOfConcurrentEvaluations, SizeValueType);
+  /** @ITKEndGrouping */
+
   /** Get the reason for termination */
   std::string
   GetStopConditionDescription() const override;
@@ -165,6 +187,11 @@ protected:
   void
   IncrementIndex(ParametersType & newPosition);
 
+  /** Evaluate the grid points of the iterations in [begin, end) with the
+   * metric clones. The first of them is the current position. */
+  void
+  EvaluateGridPoints(SizeValueType begin, SizeValueType end, std::vector<MeasureType> & values);
+
 protected:
   ParametersType m_InitialPosition{};
   MeasureType    m_CurrentValue{ 0 };
@@ -176,6 +203,10 @@ protected:
   MeasureType    m_MinimumMetricValue{ 0.0 };
   ParametersType m_MinimumMetricValuePosition{};
   ParametersType m_MaximumMetricValuePosition{};
+  SizeValueType  m_NumberOfConcurrentEvaluations{ 1 };
+
+  /** Clones of the metric, one per concurrent evaluation */
+  std::vector<MetricTypePointer> m_GridMetrics{};
 
 private:
   std::ostringstream m_StopConditionDescription{ "" };
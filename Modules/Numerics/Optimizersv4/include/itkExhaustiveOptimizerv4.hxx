@@ -19,6 +19,7 @@
 #define itkExhaustiveOptimizerv4_hxx
 
 
+#include "itkPlatformMultiThreader.h"
 #include "itkPrintHelper.h"
 namespace itk
 {
@@ -80,6 +81,26 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::StartWalking()
                                                << '.');
   }
 
+  // Clone the metric for the concurrent evaluations.
+  this->m_GridMetrics.clear();
+  const SizeValueType numberOfConcurrentEvaluations = std::min({ this->m_NumberOfConcurrentEvaluations,
+                                                                 static_cast<SizeValueType>(this->m_NumberOfWorkUnits),
+                                                                 this->m_NumberOfIterations });
+  if (numberOfConcurrentEvaluations > 1)
+  {
+    if (!this->m_Metric->SupportsCloning())
+    {
+      itkExceptionMacro("Concurrent evaluations require a metric that supports cloning, but "
+                        << this->m_Metric->GetNameOfClass() << " does not.");
+    }
+    for (SizeValueType i = 0; i < numberOfConcurrentEvaluations; ++i)
+    {
+      const MetricTypePointer metric = dynamic_cast<MetricType *>(this->m_Metric->LightObject::Clone().GetPointer());
+      metric->Initialize();
+      this->m_GridMetrics.push_back(metric);
+    }
+  }
+
   // Setup first grid position.
   ParametersType position(spaceDimension);
   for (unsigned int i = 0; i < spaceDimension; ++i)
@@ -100,6 +121,11 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::ResumeWalking()
   itkDebugMacro("ResumeWalk");
   m_Stop = false;
 
+  // Values of the current batch of concurrent evaluations
+  SizeValueType            batchBegin = 0;
+  SizeValueType            batchEnd = 0;
+  std::vector<MeasureType> batchValues;
+
   while (!m_Stop)
   {
     const ParametersType currentPosition = this->GetCurrentPosition();
@@ -110,7 +136,23 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::ResumeWalking()
       break;
     }
 
-    m_CurrentValue = this->m_Metric->GetValue();
+    if (this->m_GridMetrics.empty())
+    {
+      m_CurrentValue = this->m_Metric->GetValue();
+    }
+    else
+    {
+      if (this->m_CurrentIteration >= batchEnd)
+      {
+        // A batch gives each metric clone a few grid points, to amortize the
+        // cost of starting the threads.
+        constexpr SizeValueType gridPointsPerMetric = 8;
+        batchBegin = this->m_CurrentIteration;
+        batchEnd = std::min(batchBegin + gridPointsPerMetric * this->m_GridMetrics.size(), this->m_NumberOfIterations);
+        this->EvaluateGridPoints(batchBegin, batchEnd, batchValues);
+      }
+      m_CurrentValue = batchValues[this->m_CurrentIteration - batchBegin];
+    }
 
     if (m_CurrentValue > m_MaximumMetricValue)
     {
@@ -207,6 +249,51 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::IncrementIndex(ParametersT
   }
 }
 
+template <typename TInternalComputationValueType>
+void
+ExhaustiveOptimizerv4<TInternalComputationValueType>::EvaluateGridPoints(SizeValueType              begin,
+                                                                         SizeValueType              end,
+                                                                         std::vector<MeasureType> & values)
+{
+  const SizeValueType numberOfGridPoints = end - begin;
+  values.assign(numberOfGridPoints, MeasureType{});
+
+  // The position of each grid point follows from its iteration, the first
+  // parameter varying fastest, as in IncrementIndex().
+  const unsigned int          spaceDimension = this->m_Metric->GetParameters().GetSize();
+  const ScalesType &          scales = this->GetScales();
+  std::vector<ParametersType> positions(numberOfGridPoints, this->GetCurrentPosition());
+  for (SizeValueType k = 1; k < numberOfGridPoints; ++k)
+  {
+    SizeValueType remainder = begin + k;
+    for (unsigned int i = 0; i < spaceDimension; ++i)
+    {
+      const SizeValueType numberOfSamples = 2 * m_NumberOfSteps[i] + 1;
+      const auto          index = static_cast<double>(remainder % numberOfSamples);
+      remainder /= numberOfSamples;
+      positions[k][i] = (index - m_NumberOfSteps[i]) * m_StepLength * scales[i] + this->GetInitialPosition()[i];
+    }
+  }
+
+  // The metric clones run on threads of their own, so that their own
+  // threaded evaluations do not wait for busy threads of the pool.
+  const auto numberOfMetrics = static_cast<ThreadIdType>(this->m_GridMetrics.size());
+  const auto threader = PlatformMultiThreader::New();
+  threader->SetNumberOfWorkUnits(numberOfMetrics);
+  threader->ParallelizeArray(
+    0,
+    numberOfMetrics,
+    [this, numberOfGridPoints, numberOfMetrics, &positions, &values](SizeValueType m) {
+      MetricType * metric = this->m_GridMetrics[m];
+      for (SizeValueType k = m; k < numberOfGridPoints; k += numberOfMetrics)
+      {
+        metric->SetParameters(positions[k]);
+        values[k] = metric->GetValue();
+      }
+    },
+    nullptr);
+}
+
 template <typename TInternalComputationValueType>
 std::string
 ExhaustiveOptimizerv4<TInternalComputationValueType>::GetStopConditionDescription() const
@@ -238,6 +325,7 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::PrintSelf(std::ostream & o
   print_helper::PrintNumericTrait(os, indent, "MinimumMetricValue", m_MinimumMetricValue);
   os << indent << "MinimumMetricValuePosition: " << m_MinimumMetricValuePosition << std::endl;
   os << indent << "MaximumMetricValuePosition: " << m_MaximumMetricValuePosition << std::endl;
+  os << indent << "NumberOfConcurrentEvaluations: " << m_NumberOfConcurrentEvaluations << std::endl;
 
   os << indent << "StopConditionDescription: " << m_StopConditionDescription.str() << std::endl;
 }
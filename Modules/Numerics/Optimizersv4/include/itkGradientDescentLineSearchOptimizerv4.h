@@ -50,6 +50,14 @@ namespace itk
  * lead to additional computation time but better localization of
  * the minimum.
  *
+ * When the number of line search points is set to more than one, the
+ * golden section search is replaced by a bracketing search: at each line
+ * search iteration, this number of learning rates evenly spaced inside the
+ * current bracket are evaluated concurrently, and the bracket shrinks to the
+ * neighbors of the best one. The concurrent evaluations are done on clones
+ * of the metric, which must therefore support cloning.
+ * See ObjectToObjectMetricBaseTemplate::SupportsCloning().
+ *
  * By default, this optimizer will return the best value and associated
  * parameters that were calculated during the optimization.
  * See SetReturnBestParametersAndValue().
@@ -84,6 +92,7 @@ public:
   /** Metric type over which this class is templated */
   using typename Superclass::MeasureType;
   using typename Superclass::ParametersType;
+  using typename Superclass::MetricType;
 
   /** Type for the convergence checker */
   using ConvergenceMonitoringType = itk::Function::WindowConvergenceMonitoringFunction<TInternalComputationValueType>;
@@ -112,6 +121,26 @@ public:
   itkSetMacro(MaximumLineSearchIterations, unsigned int);
   itkGetMacro(MaximumLineSearchIterations, unsigned int);
   /** @ITKEndGrouping */
+
+  /** Set/Get the number of learning rates evaluated concurrently at each
+   * iteration of the line search. The default of 1 selects the golden
+   * section search; larger values select the parallel bracketing search. */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(NumberOfLineSearchPoints, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(NumberOfLineSearchPoints, unsigned int);
+  /** @ITKEndGrouping */
+
+  /** Start and run the optimization. */
+  void
+  StartOptimization(bool doOnlyInitialization = false) override;
+
+  /** The clone also copies the settings of the line search. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   /** Advance one Step following the gradient direction.
    * Includes transform update. */
@@ -124,9 +153,18 @@ protected:
   /** Destructor */
   ~GradientDescentLineSearchOptimizerv4Template() override = default;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
+  /** Search the learning rate between \p a and \p c, with the golden section
+   * search or the bracketing search depending on the number of line search
+   * points. \p b is the center point of the golden section search. */
+  TInternalComputationValueType
+  LineSearch(TInternalComputationValueType a, TInternalComputationValueType b, TInternalComputationValueType c);
+
   /** Search the golden section.
    *
    * \p a and \p c are the current bounds; the minimum is between them.
@@ -141,6 +179,12 @@ protected:
                       TInternalComputationValueType c,
                       TInternalComputationValueType metricb = NumericTraits<TInternalComputationValueType>::max());
 
+  /** Shrink the bracket [\p a, \p c] around the best of the learning rates
+   * evaluated concurrently on the line search metrics, and return the best
+   * learning rate. */
+  TInternalComputationValueType
+  BracketingSearch(TInternalComputationValueType a, TInternalComputationValueType c);
+
   TInternalComputationValueType m_LowerLimit{};
   TInternalComputationValueType m_UpperLimit{};
   TInternalComputationValueType m_Phi{};
@@ -152,6 +196,12 @@ protected:
 
   /** Counts the recursion depth for the golden section search */
   unsigned int m_LineSearchIterations{};
+
+  /** Number of learning rates evaluated concurrently by the bracketing search */
+  unsigned int m_NumberOfLineSearchPoints{ 1 };
+
+  /** Clones of the metric, one per line search point */
+  std::vector<typename MetricType::Pointer> m_LineSearchMetrics{};
 };
 
 /** This helps to meet backward compatibility */
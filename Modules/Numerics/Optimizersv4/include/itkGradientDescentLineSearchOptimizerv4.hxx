@@ -19,7 +19,11 @@
 #define itkGradientDescentLineSearchOptimizerv4_hxx
 
 
+#include "itkPlatformMultiThreader.h"
 #include "itkPrintHelper.h"
+
+#include <exception>
+
 namespace itk
 {
 
@@ -37,6 +41,50 @@ GradientDescentLineSearchOptimizerv4Template<
   this->m_ReturnBestParametersAndValue = true;
 }
 
+template <typename TInternalComputationValueType>
+void
+GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::StartOptimization(
+  bool doOnlyInitialization)
+{
+  this->m_LineSearchMetrics.clear();
+  if (this->m_NumberOfLineSearchPoints > 1 && this->m_Metric.IsNotNull())
+  {
+    if (!this->m_Metric->SupportsCloning())
+    {
+      itkExceptionMacro("The bracketing line search requires a metric that supports cloning, but "
+                        << this->m_Metric->GetNameOfClass() << " does not.");
+    }
+    for (unsigned int i = 0; i < this->m_NumberOfLineSearchPoints; ++i)
+    {
+      const typename MetricType::Pointer metric =
+        dynamic_cast<MetricType *>(this->m_Metric->LightObject::Clone().GetPointer());
+      metric->Initialize();
+      this->m_LineSearchMetrics.push_back(metric);
+    }
+  }
+
+  Superclass::StartOptimization(doOnlyInitialization);
+}
+
+template <typename TInternalComputationValueType>
+LightObject::Pointer
+GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::InternalClone() const
+{
+  LightObject::Pointer loPtr = Superclass::InternalClone();
+
+  const typename Self::Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+  if (rval.IsNull())
+  {
+    itkExceptionMacro("downcast to type " << this->GetNameOfClass() << " failed.");
+  }
+  rval->m_LowerLimit = this->m_LowerLimit;
+  rval->m_UpperLimit = this->m_UpperLimit;
+  rval->m_Epsilon = this->m_Epsilon;
+  rval->m_MaximumLineSearchIterations = this->m_MaximumLineSearchIterations;
+  rval->m_NumberOfLineSearchPoints = this->m_NumberOfLineSearchPoints;
+  return loPtr;
+}
+
 template <typename TInternalComputationValueType>
 void
 GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::PrintSelf(std::ostream & os,
@@ -52,6 +100,7 @@ GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::Pri
 
   os << indent << "MaximumLineSearchIterations: " << m_MaximumLineSearchIterations << std::endl;
   os << indent << "LineSearchIterations: " << m_LineSearchIterations << std::endl;
+  os << indent << "NumberOfLineSearchPoints: " << m_NumberOfLineSearchPoints << std::endl;
 }
 
 template <typename TInternalComputationValueType>
@@ -72,7 +121,7 @@ GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::Adv
   }
 
   this->m_LineSearchIterations = 0;
-  this->m_LearningRate = this->GoldenSectionSearch(
+  this->m_LearningRate = this->LineSearch(
     this->m_LearningRate * this->m_LowerLimit, this->m_LearningRate, this->m_LearningRate * this->m_UpperLimit);
 
   /* Begin threaded gradient modification of m_Gradient variable. */
@@ -93,6 +142,114 @@ GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::Adv
   }
 }
 
+template <typename TInternalComputationValueType>
+TInternalComputationValueType
+GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::LineSearch(
+  TInternalComputationValueType a,
+  TInternalComputationValueType b,
+  TInternalComputationValueType c)
+{
+  if (this->m_LineSearchMetrics.size() > 1)
+  {
+    return this->BracketingSearch(a, c);
+  }
+  return this->GoldenSectionSearch(a, b, c);
+}
+
+template <typename TInternalComputationValueType>
+TInternalComputationValueType
+GradientDescentLineSearchOptimizerv4Template<TInternalComputationValueType>::BracketingSearch(
+  TInternalComputationValueType a,
+  TInternalComputationValueType c)
+{
+  itkDebugMacro("BracketingSearch: " << a << ' ' << c);
+
+  const auto           numberOfPoints = static_cast<unsigned int>(this->m_LineSearchMetrics.size());
+  const ParametersType baseParameters(this->GetCurrentPosition());
+
+  std::vector<TInternalComputationValueType> learningRates(numberOfPoints);
+  std::vector<MeasureType>                   metricValues(numberOfPoints);
+  std::vector<std::exception_ptr>            exceptions(numberOfPoints);
+
+  // The metric clones are evaluated on threads of their own, so that their
+  // own threaded evaluations do not wait for busy threads of the pool.
+  const auto threader = PlatformMultiThreader::New();
+  threader->SetNumberOfWorkUnits(numberOfPoints);
+
+  TInternalComputationValueType bestLearningRate = (a + c) / 2;
+  MeasureType                   bestMetricValue = NumericTraits<MeasureType>::max();
+  while (this->m_LineSearchIterations <= this->m_MaximumLineSearchIterations)
+  {
+    this->m_LineSearchIterations++;
+
+    const TInternalComputationValueType spacing = (c - a) / (numberOfPoints + 1);
+    for (unsigned int i = 0; i < numberOfPoints; ++i)
+    {
+      learningRates[i] = a + (i + 1) * spacing;
+    }
+
+    threader->ParallelizeArray(
+      0,
+      numberOfPoints,
+      [this, &baseParameters, &learningRates, &metricValues, &exceptions](SizeValueType i) {
+        MetricType * metric = this->m_LineSearchMetrics[i];
+        try
+        {
+          ParametersType parameters(baseParameters);
+          metric->SetParameters(parameters);
+
+          DerivativeType update(this->m_Gradient);
+          update *= learningRates[i];
+          metric->UpdateTransformParameters(update);
+          metricValues[i] = metric->GetValue();
+        }
+        catch (...)
+        {
+          // Rethrown once all the points are evaluated.
+          exceptions[i] = std::current_exception();
+        }
+      },
+      nullptr);
+
+    // As the golden section search, pass the exceptions of the metric on.
+    for (const auto & exception : exceptions)
+    {
+      if (exception)
+      {
+        std::rethrow_exception(exception);
+      }
+    }
+
+    const auto best = static_cast<unsigned int>(
+      std::distance(metricValues.begin(), std::min_element(metricValues.begin(), metricValues.end())));
+    if (metricValues[best] == NumericTraits<MeasureType>::max())
+    {
+      // Keep the lower bound when no learning rate gives a valid value,
+      // likely due to no valid sample points, from too large of a
+      // learning rate.
+      c = learningRates[0];
+      continue;
+    }
+    if (metricValues[best] < bestMetricValue)
+    {
+      bestMetricValue = metricValues[best];
+      bestLearningRate = learningRates[best];
+    }
+
+    a = best > 0 ? learningRates[best - 1] : a;
+    c = best + 1 < numberOfPoints ? learningRates[best + 1] : c;
+    if (itk::Math::Absolute(c - a) < 2 * this->m_Epsilon * itk::Math::Absolute(learningRates[best]))
+    {
+      break;
+    }
+  }
+
+  if (bestMetricValue == NumericTraits<MeasureType>::max())
+  {
+    return (c + a) / 2;
+  }
+  return bestLearningRate;
+}
 
 template <typename TInternalComputationValueType>
 TInternalComputationValueType
@@ -209,6 +209,10 @@ protected:
 
   /** Current gradient */
   DerivativeType m_Gradient{};
+
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 };
@@ -206,6 +206,15 @@ public:
   virtual void
   EstimateLearningRate();
 
+  /** The clone also copies the learning rate and the convergence settings.
+   * Derived optimizers with settings of their own override this method
+   * to return false, unless their clone copies them too. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   /** Advance one step following the gradient direction.
    * Includes transform update. */
@@ -226,6 +235,9 @@ protected:
   /** Destructor */
   ~GradientDescentOptimizerv4Template() override = default;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
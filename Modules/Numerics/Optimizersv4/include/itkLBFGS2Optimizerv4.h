@@ -465,6 +465,14 @@ public:
   itkGetConstReferenceMacro(EstimateScalesAtEachIteration, bool);
   itkBooleanMacro(EstimateScalesAtEachIteration);
   /** @ITKEndGrouping */
+
+  /** The clone does not copy the parameters of the L-BFGS algorithm. */
+  bool
+  SupportsCloning() const override
+  {
+    return false;
+  }
+
 protected:
   LBFGS2Optimizerv4Template();
   ~LBFGS2Optimizerv4Template() override;
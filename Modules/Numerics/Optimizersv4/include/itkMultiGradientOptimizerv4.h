@@ -128,6 +128,13 @@ public:
   const MetricValuesListType &
   GetMetricValuesList() const;
 
+  /** The clone does not copy the list of optimizers. */
+  bool
+  SupportsCloning() const override
+  {
+    return false;
+  }
+
 protected:
   /** Default constructor */
   /** @ITKStartGrouping */
@@ -36,6 +36,16 @@ namespace itk
  *   focus modifying the parameter sample space.  This is why we place the burden on the user to provide
  *   the parameter samples over which to optimize.
  *
+ *   The starts are independent, and a number of them can be optimized concurrently, see
+ *   SetNumberOfConcurrentStarts(). Each concurrent start evaluates its own clone of the metric,
+ *   which must therefore support cloning, and is optimized by its own clone of the local
+ *   optimizer, which must also support cloning and must not have a scales estimator: set the
+ *   scales of the local optimizer instead, e.g. estimated once beforehand. Observers of the
+ *   local optimizer are not called by its clones. The results and the events of the starts
+ *   are reported in order, as for serial starts.
+ *   See ObjectToObjectMetricBaseTemplate::SupportsCloning() and
+ *   ObjectToObjectOptimizerBaseTemplate::SupportsCloning().
+ *
  * \ingroup ITKOptimizersv4
  */
 template <typename TInternalComputationValueType>
@@ -152,6 +162,15 @@ public:
   itkSetObjectMacro(LocalOptimizer, OptimizerType);
   itkGetModifiableObjectMacro(LocalOptimizer, OptimizerType);
   /** @ITKEndGrouping */
+
+  /** Set/Get the number of starts optimized concurrently. The number of
+   * concurrent starts is also limited by the number of work units, which
+   * the concurrent starts share. The default of 1 optimizes the starts one
+   * after another with the metric and the local optimizer themselves. */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(NumberOfConcurrentStarts, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(NumberOfConcurrentStarts, SizeValueType);
+  /** @ITKEndGrouping */
   inline ParameterListSizeType
   GetBestParametersIndex()
   {
@@ -167,6 +186,15 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
+  /** Optimize the starts from \p begin to \p end concurrently, on the start
+   * metrics. The metric values of the starts, and whether their optimization
+   * succeeded, are returned in \p metricValues and \p succeeded. */
+  void
+  OptimizeConcurrentStarts(ParameterListSizeType        begin,
+                           ParameterListSizeType        end,
+                           MetricValuesListType &       metricValues,
+                           std::vector<unsigned char> & succeeded);
+
   /* Common variables for optimization control and reporting */
   bool                                     m_Stop{ false };
   StopConditionObjectToObjectOptimizerEnum m_StopCondition{};
@@ -177,6 +205,10 @@ protected:
   MeasureType                              m_MaximumMetricValue{};
   ParameterListSizeType                    m_BestParametersIndex{};
   OptimizerPointer                         m_LocalOptimizer{};
+  SizeValueType                            m_NumberOfConcurrentStarts{ 1 };
+
+  /** Clones of the metric, one per concurrent start */
+  std::vector<MetricTypePointer> m_StartMetrics{};
 };
 
 /** This helps to meet backward compatibility */
@@ -18,6 +18,7 @@
 #ifndef itkMultiStartOptimizerv4_hxx
 #define itkMultiStartOptimizerv4_hxx
 
+#include "itkPlatformMultiThreader.h"
 #include "itkPrintHelper.h"
 
 
@@ -55,6 +56,7 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::PrintSelf(std::ost
   print_helper::PrintNumericTrait(os, indent, "BestParametersIndex", m_BestParametersIndex);
 
   itkPrintSelfObjectMacro(LocalOptimizer);
+  os << indent << "NumberOfConcurrentStarts: " << m_NumberOfConcurrentStarts << std::endl;
 }
 
 template <typename TInternalComputationValueType>
@@ -140,6 +142,36 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::StartOptimization(
 
   this->m_CurrentIteration = static_cast<SizeValueType>(0);
 
+  // Clone the metric for the concurrent starts.
+  this->m_StartMetrics.clear();
+  const SizeValueType numberOfConcurrentStarts = std::min({ this->m_NumberOfConcurrentStarts,
+                                                            static_cast<SizeValueType>(this->m_NumberOfWorkUnits),
+                                                            this->m_NumberOfIterations });
+  if (numberOfConcurrentStarts > 1)
+  {
+    if (!this->m_Metric->SupportsCloning())
+    {
+      itkExceptionMacro("Concurrent starts require a metric that supports cloning, but "
+                        << this->m_Metric->GetNameOfClass() << " does not.");
+    }
+    if (this->m_LocalOptimizer && !this->m_LocalOptimizer->SupportsCloning())
+    {
+      itkExceptionMacro("Concurrent starts require a local optimizer that supports cloning, but "
+                        << this->m_LocalOptimizer->GetNameOfClass() << " does not.");
+    }
+    if (this->m_LocalOptimizer && this->m_LocalOptimizer->GetScalesEstimator())
+    {
+      itkExceptionMacro("Concurrent starts require a local optimizer without a scales estimator, since the estimator "
+                        "evaluates its own metric. Set the scales of the local optimizer instead.");
+    }
+    for (SizeValueType i = 0; i < numberOfConcurrentStarts; ++i)
+    {
+      const MetricTypePointer metric = dynamic_cast<MetricType *>(this->m_Metric->LightObject::Clone().GetPointer());
+      metric->Initialize();
+      this->m_StartMetrics.push_back(metric);
+    }
+  }
+
   if (!doOnlyInitialization)
   {
     if (this->m_NumberOfIterations > static_cast<SizeValueType>(0))
@@ -157,23 +189,52 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::ResumeOptimization
   this->m_StopConditionDescription << this->GetNameOfClass() << ": ";
   this->InvokeEvent(StartEvent());
 
+  // Results of the current batch of concurrent starts
+  ParameterListSizeType      batchBegin = 0;
+  ParameterListSizeType      batchEnd = 0;
+  MetricValuesListType       batchMetricValues;
+  std::vector<unsigned char> batchSucceeded;
+
   this->m_Stop = false;
   while (!this->m_Stop)
   {
-    // Compute metric value
-    try
+    bool succeeded = true;
+    if (this->m_StartMetrics.empty())
     {
-      this->m_Metric->SetParameters(this->m_ParametersList[this->m_CurrentIteration]);
-      if (this->m_LocalOptimizer)
+      // Compute metric value
+      try
+      {
+        this->m_Metric->SetParameters(this->m_ParametersList[this->m_CurrentIteration]);
+        if (this->m_LocalOptimizer)
+        {
+          this->m_LocalOptimizer->SetMetric(this->m_Metric);
+          this->m_LocalOptimizer->StartOptimization();
+          this->m_ParametersList[this->m_CurrentIteration] = this->m_Metric->GetParameters();
+        }
+        this->m_CurrentMetricValue = this->m_Metric->GetValue();
+        this->m_MetricValuesList.push_back(this->m_CurrentMetricValue);
+      }
+      catch (const ExceptionObject &)
       {
-        this->m_LocalOptimizer->SetMetric(this->m_Metric);
-        this->m_LocalOptimizer->StartOptimization();
-        this->m_ParametersList[this->m_CurrentIteration] = this->m_Metric->GetParameters();
+        succeeded = false;
       }
-      this->m_CurrentMetricValue = this->m_Metric->GetValue();
-      this->m_MetricValuesList.push_back(this->m_CurrentMetricValue);
     }
-    catch (const ExceptionObject &)
+    else
+    {
+      if (this->m_CurrentIteration >= batchEnd)
+      {
+        batchBegin = this->m_CurrentIteration;
+        batchEnd = std::min(batchBegin + this->m_StartMetrics.size(), this->m_ParametersList.size());
+        this->OptimizeConcurrentStarts(batchBegin, batchEnd, batchMetricValues, batchSucceeded);
+      }
+      succeeded = batchSucceeded[this->m_CurrentIteration - batchBegin];
+      if (succeeded)
+      {
+        this->m_CurrentMetricValue = batchMetricValues[this->m_CurrentIteration - batchBegin];
+        this->m_MetricValuesList.push_back(this->m_CurrentMetricValue);
+      }
+    }
+    if (!succeeded)
     {
       // We simply ignore this exception because it may just be a bad starting point.
       // We hope that other start points are better.
@@ -210,6 +271,60 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::ResumeOptimization
   }
 }
 
+template <typename TInternalComputationValueType>
+void
+MultiStartOptimizerv4Template<TInternalComputationValueType>::OptimizeConcurrentStarts(
+  ParameterListSizeType        begin,
+  ParameterListSizeType        end,
+  MetricValuesListType &       metricValues,
+  std::vector<unsigned char> & succeeded)
+{
+  const auto numberOfStarts = static_cast<ThreadIdType>(end - begin);
+  metricValues.assign(numberOfStarts, this->m_MaximumMetricValue);
+  succeeded.assign(numberOfStarts, 0);
+
+  // Each start gets a fresh clone of the local optimizer, and a share of the work units.
+  const ThreadIdType workUnitsPerStart =
+    std::max(this->m_NumberOfWorkUnits / static_cast<ThreadIdType>(this->m_StartMetrics.size()), ThreadIdType{ 1 });
+  std::vector<OptimizerPointer> localOptimizers(numberOfStarts);
+  if (this->m_LocalOptimizer)
+  {
+    for (ThreadIdType i = 0; i < numberOfStarts; ++i)
+    {
+      localOptimizers[i] = dynamic_cast<OptimizerType *>(this->m_LocalOptimizer->LightObject::Clone().GetPointer());
+      localOptimizers[i]->SetNumberOfWorkUnits(workUnitsPerStart);
+      localOptimizers[i]->SetMetric(this->m_StartMetrics[i]);
+    }
+  }
+
+  // The starts run on threads of their own, so that the threaded evaluations
+  // of their metrics do not wait for busy threads of the pool.
+  const auto threader = PlatformMultiThreader::New();
+  threader->SetNumberOfWorkUnits(numberOfStarts);
+  threader->ParallelizeArray(
+    0,
+    numberOfStarts,
+    [this, begin, &localOptimizers, &metricValues, &succeeded](SizeValueType i) {
+      MetricType * metric = this->m_StartMetrics[i];
+      try
+      {
+        metric->SetParameters(this->m_ParametersList[begin + i]);
+        if (localOptimizers[i])
+        {
+          localOptimizers[i]->StartOptimization();
+          this->m_ParametersList[begin + i] = metric->GetParameters();
+        }
+        metricValues[i] = metric->GetValue();
+        succeeded[i] = 1;
+      }
+      catch (const ExceptionObject &)
+      {
+        // Reported in order by ResumeOptimization().
+      }
+    },
+    nullptr);
+}
+
 } // namespace itk
 
 #endif
@@ -328,6 +328,12 @@ protected:
   ObjectToObjectMetric();
   ~ObjectToObjectMetric() override = default;
 
+  /** The clone gets its own copy of the moving transform. The fixed transform
+   * and a virtual domain set by the user are shared, since the metric does
+   * not modify them. */
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
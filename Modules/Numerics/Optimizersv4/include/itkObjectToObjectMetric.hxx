@@ -526,6 +526,33 @@ ObjectToObjectMetric<TFixedDimension, TMovingDimension, TVirtualImage, TParamete
   return true;
 }
 
+template <unsigned int TFixedDimension,
+          unsigned int TMovingDimension,
+          typename TVirtualImage,
+          typename TParametersValueType>
+LightObject::Pointer
+ObjectToObjectMetric<TFixedDimension, TMovingDimension, TVirtualImage, TParametersValueType>::InternalClone() const
+{
+  LightObject::Pointer loPtr = Superclass::InternalClone();
+
+  const typename Self::Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+  if (rval.IsNull())
+  {
+    itkExceptionMacro("downcast to type " << this->GetNameOfClass() << " failed.");
+  }
+  rval->m_FixedTransform = this->m_FixedTransform;
+  if (this->m_MovingTransform)
+  {
+    rval->m_MovingTransform = this->m_MovingTransform->Clone();
+  }
+  if (this->m_UserHasSetVirtualDomain)
+  {
+    rval->m_VirtualImage = this->m_VirtualImage;
+    rval->m_UserHasSetVirtualDomain = true;
+  }
+  return loPtr;
+}
+
 template <unsigned int TFixedDimension,
           unsigned int TMovingDimension,
           typename TVirtualImage,
@@ -249,10 +249,26 @@ public:
     return MetricCategoryEnum::UNKNOWN_METRIC;
   }
 
+  /** Return true if Clone() returns a metric with the inputs and settings of
+   * this one, and its own copy of the moving transform. Once initialized, such
+   * a clone can be evaluated concurrently with this metric, e.g. by the
+   * concurrent starts of MultiStartOptimizerv4.
+   * The default returns false. */
+  virtual bool
+  SupportsCloning() const
+  {
+    return false;
+  }
+
 protected:
   ObjectToObjectMetricBaseTemplate();
   ~ObjectToObjectMetricBaseTemplate() override = default;
 
+  /** Copy the fixed and moving objects and the gradient source to the clone.
+   * Derived classes copy their own settings. */
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
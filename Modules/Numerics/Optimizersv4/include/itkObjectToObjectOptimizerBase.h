@@ -208,6 +208,7 @@ public:
    * \sa SetDoEstimateScales()
    */
   itkSetObjectMacro(ScalesEstimator, ScalesEstimatorType);
+  itkGetConstObjectMacro(ScalesEstimator, ScalesEstimatorType);
 
   /** Option to use ScalesEstimator for scales estimation.
    * The estimation is performed once at begin of
@@ -283,12 +284,29 @@ public:
     return true;
   }
 
+  /** Return true if Clone() returns an optimizer with all the settings of
+   * this one. Such a clone can optimize another metric concurrently with
+   * this optimizer, e.g. as the local optimizer of the concurrent starts of
+   * MultiStartOptimizerv4.
+   * The default returns false. */
+  virtual bool
+  SupportsCloning() const
+  {
+    return false;
+  }
+
 protected:
   /** Default constructor */
   ObjectToObjectOptimizerBaseTemplate();
 
   ~ObjectToObjectOptimizerBaseTemplate() override;
 
+  /** The clone has the settings of this optimizer, including its scales
+   * estimator, but not its metric or the state of an optimization.
+   * Derived classes copy their own settings. */
+  LightObject::Pointer
+  InternalClone() const override;
+
   MetricTypePointer m_Metric{};
   ThreadIdType      m_NumberOfWorkUnits{};
   SizeValueType     m_CurrentIteration{};
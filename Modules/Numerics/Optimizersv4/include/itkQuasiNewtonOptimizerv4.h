@@ -123,6 +123,14 @@ public:
   virtual void
   EstimateNewtonStepOverSubRange(const IndexRangeType & subrange);
 
+  /** The clone also copies the maximum number of iterations without progress
+   * and the maximum Newton step size. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   /** The maximum tolerable number of iteration without any progress */
   SizeValueType m_MaximumIterationsWithoutProgress{ 30 };
@@ -199,6 +207,9 @@ protected:
   QuasiNewtonOptimizerv4Template();
   ~QuasiNewtonOptimizerv4Template() override = default;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
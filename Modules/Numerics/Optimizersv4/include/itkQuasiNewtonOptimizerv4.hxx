@@ -45,6 +45,22 @@ QuasiNewtonOptimizerv4Template<TInternalComputationValueType>::QuasiNewtonOptimi
   this->m_EstimateNewtonStepThreader = estimateNewtonStepThreader;
 }
 
+template <typename TInternalComputationValueType>
+LightObject::Pointer
+QuasiNewtonOptimizerv4Template<TInternalComputationValueType>::InternalClone() const
+{
+  LightObject::Pointer loPtr = Superclass::InternalClone();
+
+  const typename Self::Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+  if (rval.IsNull())
+  {
+    itkExceptionMacro("downcast to type " << this->GetNameOfClass() << " failed.");
+  }
+  rval->m_MaximumIterationsWithoutProgress = this->m_MaximumIterationsWithoutProgress;
+  rval->m_MaximumNewtonStepSizeInPhysicalUnits = this->m_MaximumNewtonStepSizeInPhysicalUnits;
+  return loPtr;
+}
+
 template <typename TInternalComputationValueType>
 void
 QuasiNewtonOptimizerv4Template<TInternalComputationValueType>::PrintSelf(std::ostream & os, Indent indent) const
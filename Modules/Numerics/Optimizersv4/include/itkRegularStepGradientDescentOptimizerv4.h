@@ -118,6 +118,14 @@ public:
   [[nodiscard]] double
   GetCurrentStepLength() const;
 
+  /** The clone also copies the relaxation factor, the minimum step length and
+   * the gradient magnitude tolerance. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   /** Advance one Step following the gradient direction.
    * Includes transform update. */
@@ -138,6 +146,9 @@ protected:
   /** Destructor. */
   ~RegularStepGradientDescentOptimizerv4() override = default;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
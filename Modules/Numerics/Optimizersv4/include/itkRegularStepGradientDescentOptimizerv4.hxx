@@ -265,6 +265,23 @@ RegularStepGradientDescentOptimizerv4<TInternalComputationValueType>::EstimateLe
     this->m_LearningRate *= gradientMagnitude;
   }
 }
+template <typename TInternalComputationValueType>
+LightObject::Pointer
+RegularStepGradientDescentOptimizerv4<TInternalComputationValueType>::InternalClone() const
+{
+  LightObject::Pointer loPtr = Superclass::InternalClone();
+
+  const typename Self::Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+  if (rval.IsNull())
+  {
+    itkExceptionMacro("downcast to type " << this->GetNameOfClass() << " failed.");
+  }
+  rval->m_RelaxationFactor = this->m_RelaxationFactor;
+  rval->m_MinimumStepLength = this->m_MinimumStepLength;
+  rval->m_GradientMagnitudeTolerance = this->m_GradientMagnitudeTolerance;
+  return loPtr;
+}
+
 template <typename TInternalComputationValueType>
 void
 RegularStepGradientDescentOptimizerv4<TInternalComputationValueType>::PrintSelf(std::ostream & os, Indent indent) const
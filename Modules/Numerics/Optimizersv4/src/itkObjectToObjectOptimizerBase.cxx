@@ -42,6 +42,26 @@ ObjectToObjectOptimizerBaseTemplate<TInternalComputationValueType>::ObjectToObje
 template <typename TInternalComputationValueType>
 ObjectToObjectOptimizerBaseTemplate<TInternalComputationValueType>::~ObjectToObjectOptimizerBaseTemplate() = default;
 
+template <typename TInternalComputationValueType>
+LightObject::Pointer
+ObjectToObjectOptimizerBaseTemplate<TInternalComputationValueType>::InternalClone() const
+{
+  LightObject::Pointer loPtr = Superclass::InternalClone();
+
+  const typename Self::Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+  if (rval.IsNull())
+  {
+    itkExceptionMacro("downcast to type " << this->GetNameOfClass() << " failed.");
+  }
+  rval->m_NumberOfWorkUnits = this->m_NumberOfWorkUnits;
+  rval->m_NumberOfIterations = this->m_NumberOfIterations;
+  rval->m_Scales = this->m_Scales;
+  rval->m_Weights = this->m_Weights;
+  rval->m_ScalesEstimator = this->m_ScalesEstimator;
+  rval->m_DoEstimateScales = this->m_DoEstimateScales;
+  return loPtr;
+}
+
 template <typename TInternalComputationValueType>
 void
 ObjectToObjectOptimizerBaseTemplate<TInternalComputationValueType>::PrintSelf(std::ostream & os, Indent indent) const
@@ -144,6 +144,24 @@ public:
   UpdateTransformParameters(const DerivativeType &, ParametersValueType) override
   {}
 
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
+protected:
+  itk::LightObject::Pointer
+  InternalClone() const override
+  {
+    itk::LightObject::Pointer loPtr = Superclass::InternalClone();
+
+    const Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+    rval->m_Parameters = m_Parameters;
+    rval->m_HasLocalSupport = m_HasLocalSupport;
+    return loPtr;
+  }
+
 private:
   ParametersType m_Parameters;
   bool           m_HasLocalSupport{ false };
@@ -328,6 +346,52 @@ itkExhaustiveOptimizerv4Test(int, char *[])
   }
 
 
+  // Evaluate the grid points concurrently, on clones of the metric. The
+  // results and the order of the iterations must not change.
+  auto concurrentOptimizer = OptimizerType::New();
+  ITK_TEST_SET_GET_VALUE(1, concurrentOptimizer->GetNumberOfConcurrentEvaluations());
+  concurrentOptimizer->SetNumberOfConcurrentEvaluations(4);
+  ITK_TEST_SET_GET_VALUE(4, concurrentOptimizer->GetNumberOfConcurrentEvaluations());
+  concurrentOptimizer->SetNumberOfWorkUnits(4);
+
+  auto concurrentIdxObserver = IndexObserver::New();
+  concurrentOptimizer->AddObserver(itk::IterationEvent(), concurrentIdxObserver);
+
+  metric->SetParameters(initialPosition);
+  concurrentOptimizer->SetMetric(metric);
+  concurrentOptimizer->SetScales(parametersScale);
+  concurrentOptimizer->SetStepLength(stepLength);
+  concurrentOptimizer->SetNumberOfSteps(steps);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(concurrentOptimizer->StartOptimization());
+
+  bool concurrentPass = true;
+  if (itk::Math::NotExactlyEquals(concurrentOptimizer->GetMinimumMetricValue(), itkOptimizer->GetMinimumMetricValue()) ||
+      itk::Math::NotExactlyEquals(concurrentOptimizer->GetMaximumMetricValue(), itkOptimizer->GetMaximumMetricValue()))
+  {
+    std::cout << "Concurrent evaluations: MinimumMetricValue = " << concurrentOptimizer->GetMinimumMetricValue()
+              << ", MaximumMetricValue = " << concurrentOptimizer->GetMaximumMetricValue() << std::endl;
+    concurrentPass = false;
+  }
+  if (concurrentOptimizer->GetMinimumMetricValuePosition() != itkOptimizer->GetMinimumMetricValuePosition() ||
+      concurrentOptimizer->GetMaximumMetricValuePosition() != itkOptimizer->GetMaximumMetricValuePosition())
+  {
+    std::cout << "Concurrent evaluations: Minimum Position = " << concurrentOptimizer->GetMinimumMetricValuePosition()
+              << ", Maximum Position = " << concurrentOptimizer->GetMaximumMetricValuePosition() << std::endl;
+    concurrentPass = false;
+  }
+  if (concurrentIdxObserver->m_VisitedIndices != idxObserver->m_VisitedIndices)
+  {
+    std::cout << "Concurrent evaluations: the grid points were not visited in order" << std::endl;
+    concurrentPass = false;
+  }
+  if (!concurrentPass)
+  {
+    std::cout << "Test failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+
   std::cout << "Test passed." << std::endl;
   return EXIT_SUCCESS;
 }
@@ -29,6 +29,7 @@
 #include "itkSubsample.h"
 
 #include "itkEuclideanDistanceMetric.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk::Statistics
 {
@@ -104,6 +105,18 @@ struct ITK_TEMPLATE_EXPORT KdTreeNode
   [[nodiscard]] virtual const Self *
   Right() const = 0;
 
+  /** Sets the left child of this node. Terminal nodes don't have any
+   * child, so this does nothing for them. */
+  virtual void
+  SetLeft(Self *)
+  {}
+
+  /** Sets the right child of this node. Terminal nodes don't have any
+   * child, so this does nothing for them. */
+  virtual void
+  SetRight(Self *)
+  {}
+
   /**
    * Returns the number of measurement vectors under this node including
    * its children
@@ -192,6 +205,20 @@ struct ITK_TEMPLATE_EXPORT KdTreeNonterminalNode : public KdTreeNode<TSample>
     return m_Right;
   }
 
+  /** Sets the left child of this node */
+  void
+  SetLeft(Superclass * left) override
+  {
+    m_Left = left;
+  }
+
+  /** Sets the right child of this node */
+  void
+  SetRight(Superclass * right) override
+  {
+    m_Right = right;
+  }
+
   /**
    * Returns the number of measurement vectors under this node including
    * its children
@@ -326,6 +353,20 @@ struct ITK_TEMPLATE_EXPORT KdTreeWeightedCentroidNonterminalNode : public KdTree
     return m_Right;
   }
 
+  /** Set the left tree pointer. */
+  void
+  SetLeft(Superclass * left) override
+  {
+    m_Left = left;
+  }
+
+  /** Set the right tree pointer. */
+  void
+  SetRight(Superclass * right) override
+  {
+    m_Right = right;
+  }
+
   /** Return the size of the node. */
   [[nodiscard]] unsigned int
   Size() const override
@@ -333,6 +374,11 @@ struct ITK_TEMPLATE_EXPORT KdTreeWeightedCentroidNonterminalNode : public KdTree
     return m_Size;
   }
 
+  /** Add a measurement vector inserted below this node to the weighted
+   * centroid, and update the centroid and the size. */
+  void
+  AddToWeightedCentroid(const typename TSample::MeasurementVectorType & measurement);
+
   /**
    * Returns the vector sum of the all measurement vectors under this node.
    */
@@ -507,15 +553,21 @@ private:
  * terminated when the node has no children (when the number of
  * measurement vectors is less than or equal to the size set by the
  * SetBucketSize. That is The split process is a recursive process in
- * nature and in implementation. This implementation doesn't support
- * dynamic insert and delete operations for the tree. Instead, we can
- * use the KdTreeGenerator or WeightedCentroidKdTreeGenerator to
- * generate a static KdTree object.
+ * nature and in implementation. We can use the KdTreeGenerator or
+ * WeightedCentroidKdTreeGenerator to generate a KdTree object. Measurement
+ * vectors appended to the sample afterwards can be inserted with
+ * AddInstance, without regenerating the tree. Delete operations are not
+ * supported.
  *
  * To search k-nearest neighbor, call the Search method with the query
  * point in a k-d space and the number of nearest neighbors. The
  * GetSearchResult method returns a pointer to a NearestNeighbors object
- * with k-nearest neighbors.
+ * with k-nearest neighbors. The BatchSearch methods search the neighbors
+ * of many query points at once, split among the work units of the
+ * multi-threader. It has a single work unit by default, since the searches
+ * can only run concurrently if the GetMeasurementVector() method of the
+ * sample can be called concurrently, which is not the case for
+ * ImageToListSampleAdaptor and PointSetToListSampleAdaptor.
  *
  * <b>Recent API changes:</b>
  * The static const macro to get the length of a measurement vector,
@@ -752,6 +804,38 @@ public:
   void
   Search(const MeasurementVectorType &, double, InstanceIdentifierVectorType &) const;
 
+  /** Searches the k-nearest neighbors of each of the queries in parallel,
+   * and returns their distances. The results are the same as those of
+   * Search for each query. */
+  void
+  BatchSearch(const std::vector<MeasurementVectorType> &  queries,
+              unsigned int                                numberOfNeighborsRequested,
+              std::vector<InstanceIdentifierVectorType> & results,
+              std::vector<std::vector<double>> &          distances) const;
+
+  /** Searches the neighbors fallen into a hypersphere around each of the
+   * queries in parallel. */
+  void
+  BatchSearch(const std::vector<MeasurementVectorType> &  queries,
+              double                                      radius,
+              std::vector<InstanceIdentifierVectorType> & results) const;
+
+  /** Inserts the measurement vector of the sample identified by the
+   * instance identifier in the tree. The measurement vector is added to
+   * the terminal node that contains it, and to the weighted centroids of
+   * the nonterminal nodes above it. The terminal nodes grow beyond the
+   * bucket size, so the tree should be generated again after inserting a
+   * large number of measurement vectors. */
+  void
+  AddInstance(InstanceIdentifier id);
+
+  /** Set/Get the multi-threader used by BatchSearch. It has a single work
+   * unit by default. */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(MultiThreader, MultiThreaderBase);
+  itkGetModifiableObjectMacro(MultiThreader, MultiThreaderBase);
+  /** @ITKEndGrouping */
+
   /** Returns true if the intermediate k-nearest neighbors exist within
    * the bounding box defined by the lowerBound and the
    * upperBound. Otherwise returns false. Returns false if the ball
@@ -800,6 +884,10 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
+  /** Initialize the bounds of a search to the whole space */
+  void
+  InitializeSearchBounds(MeasurementVectorType & lowerBound, MeasurementVectorType & upperBound) const;
+
   /** search loop */
   int
   NearestNeighborSearchLoop(const KdTreeNodeType *,
@@ -835,6 +923,9 @@ private:
 
   /** Measurement vector size */
   MeasurementVectorSizeType m_MeasurementVectorSize{};
+
+  /** Multi-threader of the batched searches */
+  MultiThreaderBase::Pointer m_MultiThreader{};
 }; // end of class
 } // namespace itk::Statistics
 
@@ -66,6 +66,19 @@ KdTreeWeightedCentroidNonterminalNode<TSample>::GetParameters(unsigned int &
   partitionValue = this->m_PartitionValue;
 }
 
+template <typename TSample>
+void
+KdTreeWeightedCentroidNonterminalNode<TSample>::AddToWeightedCentroid(
+  const typename TSample::MeasurementVectorType & measurement)
+{
+  for (MeasurementVectorSizeType i = 0; i < m_MeasurementVectorSize; ++i)
+  {
+    m_WeightedCentroid[i] += measurement[i];
+  }
+  ++m_Size;
+  m_Centroid = m_WeightedCentroid / static_cast<double>(m_Size);
+}
+
 template <typename TSample>
 KdTree<TSample>::KdTree()
   : m_Sample(nullptr)
@@ -73,8 +86,10 @@ KdTree<TSample>::KdTree()
   , m_Root(nullptr)
   , m_EmptyTerminalNode(new KdTreeTerminalNode<TSample>())
   , m_DistanceMetric(DistanceMetricType::New())
-
-{}
+  , m_MultiThreader(MultiThreaderBase::New())
+{
+  m_MultiThreader->SetNumberOfWorkUnits(1);
+}
 
 template <typename TSample>
 KdTree<TSample>::~KdTree()
@@ -112,6 +127,7 @@ KdTree<TSample>::PrintSelf(std::ostream & os, Indent indent) const
     os << "not set." << std::endl;
   }
   os << indent << "MeasurementVectorSize: " << this->m_MeasurementVectorSize << std::endl;
+  itkPrintSelfObjectMacro(MultiThreader);
 }
 
 template <typename TSample>
@@ -200,6 +216,95 @@ KdTree<TSample>::Search(const MeasurementVectorType &  query,
   MeasurementVectorType upperBound;
   NumericTraits<MeasurementVectorType>::SetLength(upperBound, this->m_MeasurementVectorSize);
 
+  this->InitializeSearchBounds(lowerBound, upperBound);
+  this->NearestNeighborSearchLoop(this->m_Root, query, lowerBound, upperBound, nearestNeighbors);
+
+  result = nearestNeighbors.GetNeighbors();
+}
+
+template <typename TSample>
+void
+KdTree<TSample>::BatchSearch(const std::vector<MeasurementVectorType> &  queries,
+                             unsigned int                                numberOfNeighborsRequested,
+                             std::vector<InstanceIdentifierVectorType> & results,
+                             std::vector<std::vector<double>> &          distances) const
+{
+  if (numberOfNeighborsRequested > this->Size())
+  {
+    itkExceptionMacro("The numberOfNeighborsRequested for the nearest "
+                      << "neighbor search should be less than or equal to the number of "
+                      << "the measurement vectors.");
+  }
+
+  const SizeValueType numberOfQueries = queries.size();
+  results.resize(numberOfQueries);
+  distances.resize(numberOfQueries);
+
+  // The queries are processed in blocks, so that the bounds are allocated
+  // once per block instead of once per query.
+  constexpr SizeValueType blockSize = 64;
+  const SizeValueType     numberOfBlocks = (numberOfQueries + blockSize - 1) / blockSize;
+
+  m_MultiThreader->ParallelizeArray(
+    0,
+    numberOfBlocks,
+    [&](SizeValueType block) {
+      MeasurementVectorType lowerBound;
+      NumericTraits<MeasurementVectorType>::SetLength(lowerBound, this->m_MeasurementVectorSize);
+      MeasurementVectorType upperBound;
+      NumericTraits<MeasurementVectorType>::SetLength(upperBound, this->m_MeasurementVectorSize);
+
+      const SizeValueType end = std::min(numberOfQueries, (block + 1) * blockSize);
+      for (SizeValueType q = block * blockSize; q < end; ++q)
+      {
+        NearestNeighbors nearestNeighbors(distances[q]);
+        nearestNeighbors.resize(numberOfNeighborsRequested);
+
+        // The search loop does not restore the bounds when it stops early.
+        this->InitializeSearchBounds(lowerBound, upperBound);
+        this->NearestNeighborSearchLoop(this->m_Root, queries[q], lowerBound, upperBound, nearestNeighbors);
+        results[q] = nearestNeighbors.GetNeighbors();
+      }
+    },
+    nullptr);
+}
+
+template <typename TSample>
+void
+KdTree<TSample>::BatchSearch(const std::vector<MeasurementVectorType> &  queries,
+                             double                                      radius,
+                             std::vector<InstanceIdentifierVectorType> & results) const
+{
+  const SizeValueType numberOfQueries = queries.size();
+  results.resize(numberOfQueries);
+
+  constexpr SizeValueType blockSize = 64;
+  const SizeValueType     numberOfBlocks = (numberOfQueries + blockSize - 1) / blockSize;
+
+  m_MultiThreader->ParallelizeArray(
+    0,
+    numberOfBlocks,
+    [&](SizeValueType block) {
+      MeasurementVectorType lowerBound;
+      NumericTraits<MeasurementVectorType>::SetLength(lowerBound, this->m_MeasurementVectorSize);
+      MeasurementVectorType upperBound;
+      NumericTraits<MeasurementVectorType>::SetLength(upperBound, this->m_MeasurementVectorSize);
+
+      const SizeValueType end = std::min(numberOfQueries, (block + 1) * blockSize);
+      for (SizeValueType q = block * blockSize; q < end; ++q)
+      {
+        results[q].clear();
+        this->InitializeSearchBounds(lowerBound, upperBound);
+        this->SearchLoop(this->m_Root, queries[q], radius, lowerBound, upperBound, results[q]);
+      }
+    },
+    nullptr);
+}
+
+template <typename TSample>
+void
+KdTree<TSample>::InitializeSearchBounds(MeasurementVectorType & lowerBound, MeasurementVectorType & upperBound) const
+{
   for (unsigned int d = 0; d < this->m_MeasurementVectorSize; ++d)
   {
     lowerBound[d] = static_cast<MeasurementType>(
@@ -207,9 +312,56 @@ KdTree<TSample>::Search(const MeasurementVectorType &  query,
     upperBound[d] =
       static_cast<MeasurementType>(std::sqrt(static_cast<double>(NumericTraits<MeasurementType>::max()) / 2.0));
   }
-  this->NearestNeighborSearchLoop(this->m_Root, query, lowerBound, upperBound, nearestNeighbors);
+}
 
-  result = nearestNeighbors.GetNeighbors();
+template <typename TSample>
+void
+KdTree<TSample>::AddInstance(InstanceIdentifier id)
+{
+  const MeasurementVectorType & measurement = this->m_Sample->GetMeasurementVector(id);
+
+  if (this->m_Root == nullptr || this->m_Root == this->m_EmptyTerminalNode)
+  {
+    this->m_Root = new KdTreeTerminalNode<TSample>();
+  }
+
+  // Descend to the terminal node that contains the measurement vector, as
+  // the searches do.
+  KdTreeNodeType * parent = nullptr;
+  KdTreeNodeType * node = this->m_Root;
+  bool             isLeftChild = false;
+  while (!node->IsTerminal())
+  {
+    if (auto * weightedNode = dynamic_cast<KdTreeWeightedCentroidNonterminalNode<TSample> *>(node))
+    {
+      weightedNode->AddToWeightedCentroid(measurement);
+    }
+
+    unsigned int    partitionDimension = 0;
+    MeasurementType partitionValue;
+    node->GetParameters(partitionDimension, partitionValue);
+
+    parent = node;
+    isLeftChild = (measurement[partitionDimension] <= partitionValue);
+    node = isLeftChild ? node->Left() : node->Right();
+  }
+
+  // The empty terminal node is shared, so it is replaced by a new one.
+  if (node == this->m_EmptyTerminalNode)
+  {
+    node = new KdTreeTerminalNode<TSample>();
+    if (isLeftChild)
+    {
+      parent->SetLeft(node);
+    }
+    else
+    {
+      parent->SetRight(node);
+    }
+  }
+  node->AddInstanceIdentifier(id);
+
+  this->Modified();
 }
 
 template <typename TSample>
@@ -325,13 +477,7 @@ KdTree<TSample>::Search(const MeasurementVectorType & query, double radius, Inst
   NumericTraits<MeasurementVectorType>::SetLength(lowerBound, this->m_MeasurementVectorSize);
   NumericTraits<MeasurementVectorType>::SetLength(upperBound, this->m_MeasurementVectorSize);
 
-  for (unsigned int d = 0; d < this->m_MeasurementVectorSize; ++d)
-  {
-    lowerBound[d] = static_cast<MeasurementType>(
-      -std::sqrt(-static_cast<double>(NumericTraits<MeasurementType>::NonpositiveMin())) / 2.0);
-    upperBound[d] =
-      static_cast<MeasurementType>(std::sqrt(static_cast<double>(NumericTraits<MeasurementType>::max()) / 2.0));
-  }
+  this->InitializeSearchBounds(lowerBound, upperBound);
 
   result.clear();
   this->SearchLoop(this->m_Root, query, radius, lowerBound, upperBound, result);
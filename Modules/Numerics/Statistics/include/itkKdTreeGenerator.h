@@ -18,6 +18,7 @@
 #ifndef itkKdTreeGenerator_h
 #define itkKdTreeGenerator_h
 
+#include <unordered_map>
 #include <vector>
 
 #include "itkKdTree.h"
@@ -50,6 +51,18 @@ namespace itk::Statistics
  * Update method will run this generator. To get the resulting KdTree
  * object, call the GetOutput method.
  *
+ * When the multi-threader has more than one work unit, the top levels of
+ * the tree are partitioned first, and the subtrees below them are
+ * generated in parallel. The resulting tree is identical to the one
+ * generated with a single work unit. The multi-threader is also passed to
+ * the generated KdTree for its batched searches.
+ *
+ * The multi-threader has a single work unit by default. The parallel
+ * generation calls GetMeasurementVector() of the sample concurrently, so
+ * only set more work units for samples that support it, such as
+ * ListSample. ImageToListSampleAdaptor and PointSetToListSampleAdaptor
+ * return a reference to a measurement vector of their own, and do not.
+ *
  * <b>Recent API changes:</b>
  * The static const macro to get the length of a measurement vector,
  * 'MeasurementVectorSize'  has been removed to allow the length of a measurement
@@ -121,6 +134,12 @@ public:
   SetBucketSize(unsigned int size);
   itkGetConstMacro(BucketSize, unsigned int);
   /** @ITKEndGrouping */
+  /** Set/Get the multi-threader used to generate the subtrees in parallel.
+   * It has a single work unit by default. */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(MultiThreader, MultiThreaderBase);
+  itkGetModifiableObjectMacro(MultiThreader, MultiThreaderBase);
+  /** @ITKEndGrouping */
   /** Returns the pointer to the generated k-d tree. */
   OutputPointer
   GetOutput()
@@ -177,6 +196,30 @@ protected:
                    unsigned int            level);
 
 private:
+  /** A subtree whose generation is deferred to the parallel stage. The
+   * placeholder is the node that stands for the subtree in its parent until
+   * the subtree is generated. */
+  struct DeferredSubtree
+  {
+    unsigned int          m_BeginIndex;
+    unsigned int          m_EndIndex;
+    MeasurementVectorType m_LowerBound;
+    MeasurementVectorType m_UpperBound;
+    unsigned int          m_Level;
+    KdTreeNodeType *      m_Placeholder;
+  };
+
+  using SubtreeMapType = std::unordered_map<KdTreeNodeType *, KdTreeNodeType *>;
+
+  /** Generates the deferred subtrees in parallel, each one with its own
+   * generator and subsample, and returns them by placeholder. */
+  SubtreeMapType
+  GenerateDeferredSubtrees();
+
+  /** Replaces the placeholders below the node by their subtrees. */
+  void
+  ReplaceDeferredSubtrees(KdTreeNodeType * node, const SubtreeMapType & subtrees);
+
   /** Pointer to the input (source) sample */
   TSample * m_SourceSample{};
 
@@ -203,6 +246,14 @@ private:
 
   /** Length of a measurement vector */
   MeasurementVectorSizeType m_MeasurementVectorSize{};
+
+  MultiThreaderBase::Pointer m_MultiThreader{};
+
+  /** Subtrees that have at most this number of measurement vectors are
+   * deferred to the parallel stage. Zero disables the deferral. */
+  unsigned int m_MaximumDeferredSubtreeSize{ 0 };
+
+  std::vector<DeferredSubtree> m_DeferredSubtrees{};
 }; // end of class
 } // namespace itk::Statistics
 
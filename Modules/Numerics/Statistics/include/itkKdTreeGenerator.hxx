@@ -25,7 +25,10 @@ KdTreeGenerator<TSample>::KdTreeGenerator()
   : m_SourceSample(nullptr)
   , m_Subsample(SubsampleType::New())
   , m_BucketSize(16)
-{}
+  , m_MultiThreader(MultiThreaderBase::New())
+{
+  m_MultiThreader->SetNumberOfWorkUnits(1);
+}
 
 template <typename TSample>
 void
@@ -45,6 +48,7 @@ KdTreeGenerator<TSample>::PrintSelf(std::ostream & os, Indent indent) const
 
   os << indent << "Bucket Size: " << m_BucketSize << std::endl;
   os << indent << "MeasurementVectorSize: " << m_MeasurementVectorSize << std::endl;
+  itkPrintSelfObjectMacro(MultiThreader);
 }
 
 template <typename TSample>
@@ -82,6 +86,7 @@ KdTreeGenerator<TSample>::GenerateData()
     m_Tree->SetSample(m_SourceSample);
     m_Tree->SetBucketSize(m_BucketSize);
   }
+  m_Tree->SetMultiThreader(m_MultiThreader);
 
   const SubsamplePointer subsample = this->GetSubsample();
 
@@ -103,10 +108,117 @@ KdTreeGenerator<TSample>::GenerateData()
     upperBound[d] = NumericTraits<MeasurementType>::max();
   }
 
-  KdTreeNodeType * root = this->GenerateTreeLoop(0, m_Subsample->Size(), lowerBound, upperBound, 0);
+  // With several work units, the subtrees that are small enough are only
+  // recorded while the top levels are partitioned, and generated afterwards
+  // in parallel. They cover disjoint ranges of the subsample.
+  const unsigned int numberOfWorkUnits = m_MultiThreader->GetNumberOfWorkUnits();
+  const unsigned int size = m_Subsample->Size();
+  m_MaximumDeferredSubtreeSize = 0;
+  if (numberOfWorkUnits > 1)
+  {
+    m_MaximumDeferredSubtreeSize = (size + 4 * numberOfWorkUnits - 1) / (4 * numberOfWorkUnits);
+  }
+
+  KdTreeNodeType * root = this->GenerateTreeLoop(0, size, lowerBound, upperBound, 0);
+  m_MaximumDeferredSubtreeSize = 0;
+
+  if (!m_DeferredSubtrees.empty())
+  {
+    const SubtreeMapType subtrees = this->GenerateDeferredSubtrees();
+    const auto           found = subtrees.find(root);
+    if (found != subtrees.end())
+    {
+      delete root;
+      root = found->second;
+    }
+    else
+    {
+      this->ReplaceDeferredSubtrees(root, subtrees);
+    }
+  }
   m_Tree->SetRoot(root);
 }
 
+template <typename TSample>
+auto
+KdTreeGenerator<TSample>::GenerateDeferredSubtrees() -> SubtreeMapType
+{
+  std::vector<DeferredSubtree> deferredSubtrees;
+  deferredSubtrees.swap(m_DeferredSubtrees);
+
+  std::vector<KdTreeNodeType *> roots(deferredSubtrees.size(), nullptr);
+
+  m_MultiThreader->ParallelizeArray(
+    0,
+    deferredSubtrees.size(),
+    [this, &deferredSubtrees, &roots](SizeValueType i) {
+      DeferredSubtree & subtree = deferredSubtrees[i];
+
+      // The subtree is generated by a generator of the same type, with a
+      // subsample of its own that holds the same instances in the same
+      // order, so that it is partitioned as it would be sequentially.
+      const typename LightObject::Pointer anotherObject = this->CreateAnother();
+      auto * generator = dynamic_cast<Self *>(anotherObject.GetPointer());
+      generator->m_SourceSample = m_SourceSample;
+      generator->m_BucketSize = m_BucketSize;
+      generator->m_Tree = m_Tree;
+      generator->m_MeasurementVectorSize = m_MeasurementVectorSize;
+      NumericTraits<MeasurementVectorType>::SetLength(generator->m_TempLowerBound, m_MeasurementVectorSize);
+      NumericTraits<MeasurementVectorType>::SetLength(generator->m_TempUpperBound, m_MeasurementVectorSize);
+      NumericTraits<MeasurementVectorType>::SetLength(generator->m_TempMean, m_MeasurementVectorSize);
+      generator->m_Subsample->SetSample(m_SourceSample);
+      for (unsigned int j = subtree.m_BeginIndex; j < subtree.m_EndIndex; ++j)
+      {
+        generator->m_Subsample->AddInstance(m_Subsample->GetInstanceIdentifier(j));
+      }
+
+      roots[i] = generator->GenerateTreeLoop(
+        0, subtree.m_EndIndex - subtree.m_BeginIndex, subtree.m_LowerBound, subtree.m_UpperBound, subtree.m_Level);
+    },
+    nullptr);
+
+  SubtreeMapType subtrees;
+  for (size_t i = 0; i < deferredSubtrees.size(); ++i)
+  {
+    subtrees[deferredSubtrees[i].m_Placeholder] = roots[i];
+  }
+  return subtrees;
+}
+
+template <typename TSample>
+void
+KdTreeGenerator<TSample>::ReplaceDeferredSubtrees(KdTreeNodeType * node, const SubtreeMapType & subtrees)
+{
+  if (node->IsTerminal())
+  {
+    return;
+  }
+
+  KdTreeNodeType * left = node->Left();
+  const auto       foundLeft = subtrees.find(left);
+  if (foundLeft != subtrees.end())
+  {
+    node->SetLeft(foundLeft->second);
+    delete left;
+  }
+  else
+  {
+    this->ReplaceDeferredSubtrees(left, subtrees);
+  }
+
+  KdTreeNodeType * right = node->Right();
+  const auto       foundRight = subtrees.find(right);
+  if (foundRight != subtrees.end())
+  {
+    node->SetRight(foundRight->second);
+    delete right;
+  }
+  else
+  {
+    this->ReplaceDeferredSubtrees(right, subtrees);
+  }
+}
+
 template <typename TSample>
 inline auto
 KdTreeGenerator<TSample>::GenerateNonterminalNode(unsigned int            beginIndex,
@@ -199,6 +311,13 @@ KdTreeGenerator<TSample>::GenerateTreeLoop(unsigned int            beginIndex,
     // return a terminal node
     return ptr;
   }
+  else if (endIndex - beginIndex <= m_MaximumDeferredSubtreeSize)
+  {
+    // generate the subtree later, in parallel with the other ones
+    auto * placeholder = new KdTreeTerminalNode<TSample>();
+    m_DeferredSubtrees.push_back(DeferredSubtree{ beginIndex, endIndex, lowerBound, upperBound, level, placeholder });
+    return placeholder;
+  }
   else
   {
     return this->GenerateNonterminalNode(beginIndex, endIndex, lowerBound, upperBound, level + 1);
@@ -0,0 +1,292 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkListSample.h"
+#include "itkImageRegionIterator.h"
+#include "itkImageToListSampleAdaptor.h"
+#include "itkWeightedCentroidKdTreeGenerator.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+
+namespace
+{
+constexpr unsigned int Dimension = 2;
+using MeasurementVectorType = itk::Vector<float, Dimension>;
+using SampleType = itk::Statistics::ListSample<MeasurementVectorType>;
+using TreeType = itk::Statistics::KdTree<SampleType>;
+using NodeType = TreeType::KdTreeNodeType;
+
+// Returns true if both subtrees have the same structure and contents.
+bool
+SameTree(NodeType * node1, NodeType * node2)
+{
+  if (node1->IsTerminal() != node2->IsTerminal() || node1->Size() != node2->Size())
+  {
+    return false;
+  }
+  if (node1->IsTerminal())
+  {
+    for (unsigned int i = 0; i < node1->Size(); ++i)
+    {
+      if (node1->GetInstanceIdentifier(i) != node2->GetInstanceIdentifier(i))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  unsigned int dimension1 = 0;
+  unsigned int dimension2 = 0;
+  float        value1 = 0.0f;
+  float        value2 = 0.0f;
+  node1->GetParameters(dimension1, value1);
+  node2->GetParameters(dimension2, value2);
+  NodeType::CentroidType centroid1;
+  NodeType::CentroidType centroid2;
+  node1->GetWeightedCentroid(centroid1);
+  node2->GetWeightedCentroid(centroid2);
+  return dimension1 == dimension2 && value1 == value2 && centroid1 == centroid2 &&
+         node1->GetInstanceIdentifier(0) == node2->GetInstanceIdentifier(0) &&
+         SameTree(node1->Left(), node2->Left()) && SameTree(node1->Right(), node2->Right());
+}
+
+// Returns the sorted identifiers of the k nearest measurement vectors.
+template <typename TSample>
+TreeType::InstanceIdentifierVectorType
+BruteForceSearch(const TSample * sample, const MeasurementVectorType & query, unsigned int k)
+{
+  std::vector<std::pair<double, TreeType::InstanceIdentifier>> distances;
+  for (TreeType::InstanceIdentifier id = 0; id < sample->Size(); ++id)
+  {
+    distances.emplace_back((sample->GetMeasurementVector(id) - query).GetSquaredNorm(), id);
+  }
+  std::partial_sort(distances.begin(), distances.begin() + k, distances.end());
+
+  TreeType::InstanceIdentifierVectorType result;
+  for (unsigned int i = 0; i < k; ++i)
+  {
+    result.push_back(distances[i].second);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+template <typename TGenerator>
+bool
+TestParallelGeneration(SampleType * sample)
+{
+  auto sequentialGenerator = TGenerator::New();
+  sequentialGenerator->SetSample(sample);
+  sequentialGenerator->SetBucketSize(4);
+  sequentialGenerator->GetMultiThreader()->SetNumberOfWorkUnits(1);
+  sequentialGenerator->Update();
+
+  auto parallelGenerator = TGenerator::New();
+  parallelGenerator->SetSample(sample);
+  parallelGenerator->SetBucketSize(4);
+  parallelGenerator->GetMultiThreader()->SetNumberOfWorkUnits(4);
+  parallelGenerator->Update();
+
+  if (!SameTree(sequentialGenerator->GetOutput()->GetRoot(), parallelGenerator->GetOutput()->GetRoot()))
+  {
+    std::cerr << "Test failed: the trees generated by " << sequentialGenerator->GetNameOfClass()
+              << " with one and four work units differ." << std::endl;
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+int
+itkKdTreeParallelTest(int, char *[])
+{
+  using GeneratorType = itk::Statistics::KdTreeGenerator<SampleType>;
+  using WeightedCentroidGeneratorType = itk::Statistics::WeightedCentroidKdTreeGenerator<SampleType>;
+
+  auto random = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  random->SetSeed(1234);
+
+  auto sample = SampleType::New();
+  sample->SetMeasurementVectorSize(Dimension);
+  for (unsigned int i = 0; i < 5000; ++i)
+  {
+    MeasurementVectorType measurement;
+    measurement[0] = static_cast<float>(random->GetUniformVariate(0.0, 100.0));
+    measurement[1] = static_cast<float>(random->GetUniformVariate(0.0, 100.0));
+    sample->PushBack(measurement);
+  }
+
+  int testStatus = EXIT_SUCCESS;
+
+  // The trees generated in parallel are the same as the sequential ones.
+  if (!TestParallelGeneration<GeneratorType>(sample) || !TestParallelGeneration<WeightedCentroidGeneratorType>(sample))
+  {
+    testStatus = EXIT_FAILURE;
+  }
+
+  auto generator = WeightedCentroidGeneratorType::New();
+  generator->SetSample(sample);
+  generator->SetBucketSize(8);
+  generator->GetMultiThreader()->SetNumberOfWorkUnits(3);
+  ITK_TEST_SET_GET_VALUE(3, generator->GetMultiThreader()->GetNumberOfWorkUnits());
+  generator->Update();
+  const TreeType::Pointer tree = generator->GetOutput();
+  ITK_TEST_SET_GET_VALUE(generator->GetMultiThreader(), tree->GetMultiThreader());
+
+  std::vector<MeasurementVectorType> queries;
+  for (unsigned int i = 0; i < 300; ++i)
+  {
+    MeasurementVectorType query;
+    query[0] = static_cast<float>(random->GetUniformVariate(-10.0, 110.0));
+    query[1] = static_cast<float>(random->GetUniformVariate(-10.0, 110.0));
+    queries.push_back(query);
+  }
+
+  // The batched searches give the same results as the searches of each query.
+  constexpr unsigned int                              numberOfNeighbors = 5;
+  constexpr double                                    radius = 3.0;
+  std::vector<TreeType::InstanceIdentifierVectorType> neighbors;
+  std::vector<std::vector<double>>                    distances;
+  std::vector<TreeType::InstanceIdentifierVectorType> radiusNeighbors;
+  tree->BatchSearch(queries, numberOfNeighbors, neighbors, distances);
+  tree->BatchSearch(queries, radius, radiusNeighbors);
+  ITK_TEST_EXPECT_EQUAL(queries.size(), neighbors.size());
+  ITK_TEST_EXPECT_EQUAL(queries.size(), distances.size());
+  ITK_TEST_EXPECT_EQUAL(queries.size(), radiusNeighbors.size());
+
+  for (size_t i = 0; i < queries.size(); ++i)
+  {
+    TreeType::InstanceIdentifierVectorType expected;
+    std::vector<double>                    expectedDistances;
+    tree->Search(queries[i], numberOfNeighbors, expected, expectedDistances);
+    TreeType::InstanceIdentifierVectorType expectedRadius;
+    tree->Search(queries[i], radius, expectedRadius);
+    if (neighbors[i] != expected || distances[i] != expectedDistances || radiusNeighbors[i] != expectedRadius)
+    {
+      std::cerr << "Test failed: the batched search of query " << i << " differs from its search." << std::endl;
+      testStatus = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  ITK_TRY_EXPECT_EXCEPTION(tree->BatchSearch(queries, 6000, neighbors, distances));
+
+  // Insert new measurement vectors, and compare the searches with a brute
+  // force search over the sample.
+  NodeType::CentroidType centroidBefore;
+  tree->GetRoot()->GetWeightedCentroid(centroidBefore);
+  const unsigned int sizeBefore = tree->GetRoot()->Size();
+
+  MeasurementVectorType sumOfInserted;
+  sumOfInserted.Fill(0.0f);
+  for (unsigned int i = 0; i < 500; ++i)
+  {
+    MeasurementVectorType measurement;
+    measurement[0] = static_cast<float>(random->GetUniformVariate(-20.0, 120.0));
+    measurement[1] = static_cast<float>(random->GetUniformVariate(-20.0, 120.0));
+    sample->PushBack(measurement);
+    tree->AddInstance(sample->Size() - 1);
+    sumOfInserted += measurement;
+  }
+  ITK_TEST_EXPECT_EQUAL(sizeBefore + 500, tree->GetRoot()->Size());
+
+  NodeType::CentroidType centroidAfter;
+  tree->GetRoot()->GetWeightedCentroid(centroidAfter);
+  for (unsigned int d = 0; d < Dimension; ++d)
+  {
+    const double difference = centroidAfter[d] - centroidBefore[d] - sumOfInserted[d];
+    if (itk::Math::abs(difference) > 1e-3 * itk::Math::abs(centroidAfter[d]))
+    {
+      std::cerr << "Test failed: the weighted centroid of the root was not updated." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+  }
+
+  tree->BatchSearch(queries, numberOfNeighbors, neighbors, distances);
+  for (size_t i = 0; i < queries.size(); ++i)
+  {
+    TreeType::InstanceIdentifierVectorType result = neighbors[i];
+    std::sort(result.begin(), result.end());
+    if (result != BruteForceSearch(sample.GetPointer(), queries[i], numberOfNeighbors))
+    {
+      std::cerr << "Test failed: the search of query " << i << " after the insertions is wrong." << std::endl;
+      testStatus = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  // The measurement vectors of an ImageToListSampleAdaptor cannot be read
+  // concurrently, so trees are generated and searched with a single work
+  // unit by default.
+  using ImageType = itk::Image<MeasurementVectorType, Dimension>;
+  using AdaptorType = itk::Statistics::ImageToListSampleAdaptor<ImageType>;
+  using AdaptorGeneratorType = itk::Statistics::WeightedCentroidKdTreeGenerator<AdaptorType>;
+
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 48 } });
+  image->Allocate();
+  for (itk::ImageRegionIterator<ImageType> it(image, image->GetLargestPossibleRegion()); !it.IsAtEnd(); ++it)
+  {
+    MeasurementVectorType measurement;
+    measurement[0] = static_cast<float>(random->GetUniformVariate(0.0, 100.0));
+    measurement[1] = static_cast<float>(random->GetUniformVariate(0.0, 100.0));
+    it.Set(measurement);
+  }
+
+  auto adaptor = AdaptorType::New();
+  adaptor->SetImage(image);
+
+  auto adaptorGenerator = AdaptorGeneratorType::New();
+  ITK_TEST_SET_GET_VALUE(1, adaptorGenerator->GetMultiThreader()->GetNumberOfWorkUnits());
+  adaptorGenerator->SetSample(adaptor);
+  adaptorGenerator->SetBucketSize(4);
+  adaptorGenerator->Update();
+  const AdaptorGeneratorType::KdTreeType::Pointer adaptorTree = adaptorGenerator->GetOutput();
+  ITK_TEST_SET_GET_VALUE(1, adaptorTree->GetMultiThreader()->GetNumberOfWorkUnits());
+
+  adaptorTree->BatchSearch(queries, numberOfNeighbors, neighbors, distances);
+  for (size_t i = 0; i < queries.size(); ++i)
+  {
+    TreeType::InstanceIdentifierVectorType adaptorResult = neighbors[i];
+    std::sort(adaptorResult.begin(), adaptorResult.end());
+    if (adaptorResult != BruteForceSearch(adaptor.GetPointer(), queries[i], numberOfNeighbors))
+    {
+      std::cerr << "Test failed: the search of query " << i << " in the image sample is wrong." << std::endl;
+      testStatus = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  // Insertion in an empty tree.
+  auto emptySample = SampleType::New();
+  emptySample->SetMeasurementVectorSize(Dimension);
+  auto emptyTree = TreeType::New();
+  emptyTree->SetSample(emptySample);
+  emptySample->PushBack(queries[0]);
+  emptyTree->AddInstance(0);
+  TreeType::InstanceIdentifierVectorType result;
+  emptyTree->Search(queries[1], 1u, result);
+  ITK_TEST_EXPECT_EQUAL(1, result.size());
+  ITK_TEST_EXPECT_EQUAL(0, result[0]);
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
@@ -20,6 +20,7 @@
 
 #include "itkPointsLocator.h"
 #include "itkMeshToMeshFilter.h"
+#include <vector>
 
 namespace itk
 {
@@ -66,6 +67,11 @@ public:
   using FeatureType = VectorContainer<PointIdentifier, double>;
   using FeatureTypePointer = typename FeatureType::Pointer;
 
+  /** Neighbors of a point within the radius, as pairs of squared distance
+   * and point identifier. */
+  using NeighborhoodType = std::vector<std::pair<double, PointIdentifier>>;
+  using NeighborhoodContainerType = std::vector<NeighborhoodType>;
+
   /** Run-time type information. */
   itkOverrideGetNameOfClassMacro(PointFeature);
 
@@ -96,6 +102,21 @@ protected:
                      double              radius,
                      unsigned int        neighbors);
 
+  /** Compute the SPFH features from neighborhoods already searched, so that
+   * they are shared with the FPFH computation. */
+  FeatureTypePointer
+  ComputeSPFHFeature(InputPointSetType *               input,
+                     InputPointSetType *               input_normals,
+                     const NeighborhoodContainerType & neighborhoods);
+
+  /** Search, in parallel, the neighbors of each point among its closest
+   * points, excluding the points at distance zero and beyond the radius. */
+  void
+  ComputeNeighborhoods(InputPointSetType *         input,
+                       double                      radius,
+                       unsigned int                neighbors,
+                       NeighborhoodContainerType & neighborhoods);
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
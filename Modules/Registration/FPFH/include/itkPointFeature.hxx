@@ -78,29 +78,29 @@ PointFeature<TInputPointSet, TOutputPointSet>::ComputePairFeatures(const Vector3
 }
 
 template <typename TInputPointSet, typename TOutputPointSet>
-typename PointFeature<TInputPointSet, TOutputPointSet>::FeatureTypePointer
-PointFeature<TInputPointSet, TOutputPointSet>::ComputeSPFHFeature(TInputPointSet * input,
-                                                                  TInputPointSet * input_normals,
-                                                                  double           radius,
-                                                                  unsigned int     neighbors)
+void
+PointFeature<TInputPointSet, TOutputPointSet>::ComputeNeighborhoods(TInputPointSet *            input,
+                                                                    double                      radius,
+                                                                    unsigned int                neighbors,
+                                                                    NeighborhoodContainerType & neighborhoods)
 {
   PointsLocatorTypePointer kdtree = PointsLocatorType::New();
   kdtree->SetPoints(input->GetPoints());
   kdtree->Initialize();
 
-  unsigned long int   num_of_points = input->GetNumberOfPoints();
-  std::vector<double> feature1(33 * num_of_points, 0);
+  unsigned long int num_of_points = input->GetNumberOfPoints();
+  neighborhoods.clear();
+  neighborhoods.resize(num_of_points);
 
   auto ProcessPoint = [&](SizeValueType i) {
     auto point = input->GetPoint(i);
-    auto normal = input_normals->GetPoint(i);
 
     typename PointsLocatorType::NeighborsIdentifierType indices;
     kdtree->FindClosestNPoints(point, neighbors, indices);
 
     if (indices.size() > 1)
     {
-      std::vector<std::pair<double, int>> neighbor_vect;
+      auto & neighbor_vect = neighborhoods[i];
       neighbor_vect.reserve(indices.size());
 
       for (size_t k = 0; k < indices.size(); k++)
@@ -118,76 +118,101 @@ PointFeature<TInputPointSet, TOutputPointSet>::ComputeSPFHFeature(TInputPointSet
           neighbor_vect.push_back(std::make_pair(dist, indices[k]));
         }
       }
+    }
+  };
 
-      unsigned int neighbor_count = std::min(neighbors, static_cast<unsigned int>(neighbor_vect.size()));
+  this->GetMultiThreader()->ParallelizeArray(0, num_of_points, ProcessPoint, nullptr);
+}
 
-      // only compute SPFH feature when a point has neighbors
-      double hist_incr = 100.0 / static_cast<double>(neighbor_count);
-      for (size_t k = 0; k < neighbor_count; k++)
-      {
-        auto point2 = input->GetPoint(neighbor_vect[k].second);
-        auto normal2 = input_normals->GetPoint(neighbor_vect[k].second);
+template <typename TInputPointSet, typename TOutputPointSet>
+typename PointFeature<TInputPointSet, TOutputPointSet>::FeatureTypePointer
+PointFeature<TInputPointSet, TOutputPointSet>::ComputeSPFHFeature(TInputPointSet * input,
+                                                                  TInputPointSet * input_normals,
+                                                                  double           radius,
+                                                                  unsigned int     neighbors)
+{
+  NeighborhoodContainerType neighborhoods;
+  this->ComputeNeighborhoods(input, radius, neighbors, neighborhoods);
+  return this->ComputeSPFHFeature(input, input_normals, neighborhoods);
+}
 
-        Vector3d temp_point_vector1, temp_point_vector2;
-        Vector3d temp_normal_vector1, temp_normal_vector2;
+template <typename TInputPointSet, typename TOutputPointSet>
+typename PointFeature<TInputPointSet, TOutputPointSet>::FeatureTypePointer
+PointFeature<TInputPointSet, TOutputPointSet>::ComputeSPFHFeature(TInputPointSet *                  input,
+                                                                  TInputPointSet *                  input_normals,
+                                                                  const NeighborhoodContainerType & neighborhoods)
+{
+  unsigned long int   num_of_points = input->GetNumberOfPoints();
+  std::vector<double> feature1(33 * num_of_points, 0);
 
-        // skip the point itself, compute histogram
-        for (int ik = 0; ik < 3; ++ik)
-        {
-          temp_point_vector1[ik] = point[ik];
-          temp_normal_vector1[ik] = normal[ik];
-          temp_point_vector2[ik] = point2[ik];
-          temp_normal_vector2[ik] = normal2[ik];
-        }
+  // Copy the points and the normals once into contiguous arrays, instead of
+  // converting them for each pair of points.
+  std::vector<Vector3d> point_vectors(num_of_points);
+  std::vector<Vector3d> normal_vectors(num_of_points);
+  auto                  CopyPoint = [&](SizeValueType i) {
+    auto point = input->GetPoint(i);
+    auto normal = input_normals->GetPoint(i);
+    for (int ik = 0; ik < 3; ++ik)
+    {
+      point_vectors[i][ik] = point[ik];
+      normal_vectors[i][ik] = normal[ik];
+    }
+  };
+  this->GetMultiThreader()->ParallelizeArray(0, num_of_points, CopyPoint, nullptr);
 
-        Vector4d pair_feature =
-          ComputePairFeatures(temp_point_vector1, temp_normal_vector1, temp_point_vector2, temp_normal_vector2);
+  auto BinIndex = [](double value) {
+    int h_index = static_cast<int>(std::floor(value));
+    if (h_index < 0)
+    {
+      h_index = 0;
+    }
+    if (h_index >= 11)
+    {
+      h_index = 10;
+    }
+    return h_index;
+  };
 
-        int h_index = static_cast<int>(std::floor(11 * (pair_feature[0] + Math::pi) / (2.0 * Math::pi)));
-        if (h_index < 0)
-        {
-          h_index = 0;
-        }
-        if (h_index >= 11)
-        {
-          h_index = 10;
-        }
-        size_t temp_index = h_index * num_of_points + i;
-        feature1[temp_index] = hist_incr + feature1[temp_index];
+  auto ProcessPoint = [&](SizeValueType i) {
+    const auto & neighbor_vect = neighborhoods[i];
 
-        h_index = static_cast<int>(std::floor(11 * (pair_feature[1] + 1.0) * 0.5));
-        if (h_index < 0)
-        {
-          h_index = 0;
-        }
-        if (h_index >= 11)
-        {
-          h_index = 10;
-        }
-        temp_index = (h_index + 11) * num_of_points + i;
-        feature1[temp_index] = hist_incr + feature1[temp_index];
+    // only compute SPFH feature when a point has neighbors
+    unsigned int neighbor_count = static_cast<unsigned int>(neighbor_vect.size());
+    if (neighbor_count == 0)
+    {
+      return;
+    }
 
-        h_index = static_cast<int>(std::floor(11 * (pair_feature[2] + 1.0) * 0.5));
-        if (h_index < 0)
-        {
-          h_index = 0;
-        }
-        if (h_index >= 11)
-        {
-          h_index = 10;
-        }
-        temp_index = (h_index + 22) * num_of_points + i;
-        feature1[temp_index] = hist_incr + feature1[temp_index];
-      }
+    // The pair features of the neighbors are computed first, then binned in
+    // a histogram local to the point.
+    std::vector<Vector4d> pair_features(neighbor_count);
+    for (size_t k = 0; k < neighbor_count; k++)
+    {
+      const auto id = neighbor_vect[k].second;
+      pair_features[k] =
+        ComputePairFeatures(point_vectors[i], normal_vectors[i], point_vectors[id], normal_vectors[id]);
+    }
+
+    double histogram[33] = {};
+    double hist_incr = 100.0 / static_cast<double>(neighbor_count);
+    for (const auto & pair_feature : pair_features)
+    {
+      histogram[BinIndex(11 * (pair_feature[0] + Math::pi) / (2.0 * Math::pi))] += hist_incr;
+      histogram[BinIndex(11 * (pair_feature[1] + 1.0) * 0.5) + 11] += hist_incr;
+      histogram[BinIndex(11 * (pair_feature[2] + 1.0) * 0.5) + 22] += hist_incr;
+    }
+
+    for (int j = 0; j < 33; j++)
+    {
+      feature1[j * num_of_points + i] = histogram[j];
     }
   };
 
-  MultiThreaderBase::Pointer mt = MultiThreaderBase::New();
-  mt->ParallelizeArray(0, num_of_points, ProcessPoint, nullptr);
+  this->GetMultiThreader()->ParallelizeArray(0, num_of_points, ProcessPoint, nullptr);
 
   // This is done to optimize the code by avoiding GetElement, SetElement overhead.
   auto feature = FeatureType::New();
-  feature->CastToSTLContainer() = feature1;
+  feature->CastToSTLContainer() = std::move(feature1);
   return feature;
 }
 
@@ -201,78 +226,68 @@ PointFeature<TInputPointSet, TOutputPointSet>::ComputeFPFHFeature(TInputPointSet
   unsigned long int   num_of_points = input->GetNumberOfPoints();
   std::vector<double> fpfh2(33 * num_of_points, 0.0);
 
-  PointsLocatorTypePointer kdtree = PointsLocatorType::New();
-  kdtree->SetPoints(input->GetPoints());
-  kdtree->Initialize();
+  // The neighborhoods are searched once, for both the SPFH and FPFH features
+  NeighborhoodContainerType neighborhoods;
+  this->ComputeNeighborhoods(input, radius, neighbors, neighborhoods);
+
+  auto spfh = this->ComputeSPFHFeature(input, input_normals, neighborhoods);
 
-  auto spfh = ComputeSPFHFeature(input, input_normals, radius, neighbors);
+  const auto & spfh1 = spfh->CastToSTLConstContainer();
 
-  auto & spfh1 = spfh->CastToSTLContainer();
+  // The SPFH features of the neighbors are read point by point, so they are
+  // transposed to have the 33 bins of a point contiguous.
+  std::vector<double> spfh_by_point(33 * num_of_points);
+  auto                TransposePoint = [&](SizeValueType i) {
+    for (int j = 0; j < 33; j++)
+    {
+      spfh_by_point[i * 33 + j] = spfh1[j * num_of_points + i];
+    }
+  };
+  this->GetMultiThreader()->ParallelizeArray(0, num_of_points, TransposePoint, nullptr);
 
   // Method to perform processing in parallel
   auto ProcessPoint = [&](SizeValueType i) {
-    auto point = input->GetPoint(i);
-
-    typename PointsLocatorType::NeighborsIdentifierType indices;
-    kdtree->FindClosestNPoints(point, neighbors, indices);
+    const auto & neighbor_vect = neighborhoods[i];
 
-    if (indices.size() > 1)
+    if (neighbor_vect.empty())
     {
-      double sum[3] = { 0.0, 0.0, 0.0 };
-
-      std::vector<std::pair<double, int>> neighbor_vect;
-      neighbor_vect.reserve(indices.size());
-
-      for (size_t k = 0; k < indices.size(); k++)
-      {
-        auto   point_diff = point - input->GetPoint(indices[k]);
-        double dist = point_diff.GetNorm();
-
-        // skip the point itself
-        if (dist == 0.0)
-          continue;
+      return;
+    }
 
-        if (dist < radius)
-        {
-          dist = dist * dist;
-          neighbor_vect.push_back(std::make_pair(dist, indices[k]));
-        }
-      }
+    double sum[3] = { 0.0, 0.0, 0.0 };
+    double histogram[33] = {};
 
-      // Use all neighbors that passed the radius filter; FindClosestNPoints already caps the count.
-      unsigned int neighbor_count = static_cast<unsigned int>(neighbor_vect.size());
-      for (size_t k = 0; k < neighbor_count; k++)
+    // Use all neighbors that passed the radius filter; FindClosestNPoints already caps the count.
+    for (const auto & neighbor : neighbor_vect)
+    {
+      const double * neighbor_spfh = &spfh_by_point[neighbor.second * 33];
+      for (int j = 0; j < 33; j++)
       {
-        for (int j = 0; j < 33; j++)
-        {
-          double val = spfh1[j * num_of_points + neighbor_vect[k].second] / neighbor_vect[k].first;
-          sum[j / 11] += val;
-          fpfh2[j * num_of_points + i] = fpfh2[j * num_of_points + i] + val;
-        }
+        double val = neighbor_spfh[j] / neighbor.first;
+        sum[j / 11] += val;
+        histogram[j] += val;
       }
+    }
 
-      for (int j = 0; j < 3; j++)
+    for (int j = 0; j < 3; j++)
+    {
+      if (sum[j] != 0.0)
       {
-        if (sum[j] != 0.0)
-        {
-          sum[j] = 100.0 / sum[j];
-        }
+        sum[j] = 100.0 / sum[j];
       }
+    }
 
-      for (int j = 0; j < 33; j++)
-      {
-        fpfh2[j * num_of_points + i] = fpfh2[j * num_of_points + i] * sum[j / 11];
-        fpfh2[j * num_of_points + i] = fpfh2[j * num_of_points + i] + spfh1[j * num_of_points + i];
-      }
+    for (int j = 0; j < 33; j++)
+    {
+      fpfh2[j * num_of_points + i] = histogram[j] * sum[j / 11] + spfh_by_point[i * 33 + j];
     }
   };
 
-  MultiThreaderBase::Pointer mt = MultiThreaderBase::New();
-  mt->ParallelizeArray(0, num_of_points, ProcessPoint, nullptr);
+  this->GetMultiThreader()->ParallelizeArray(0, num_of_points, ProcessPoint, nullptr);
 
   // This is done to optimize the code by avoiding GetElement, SetElement overhead.
   this->m_FpfhFeature = FeatureType::New();
-  this->m_FpfhFeature->CastToSTLContainer() = fpfh2;
+  this->m_FpfhFeature->CastToSTLContainer() = std::move(fpfh2);
 }
 
 
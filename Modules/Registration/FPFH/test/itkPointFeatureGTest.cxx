@@ -19,6 +19,7 @@
 #include "itkPointFeature.h"
 #include "itkPointSet.h"
 #include "itkGTest.h"
+#include <cmath>
 
 TEST(PointFeature, BasicObjectMethods)
 {
@@ -31,3 +32,59 @@ TEST(PointFeature, BasicObjectMethods)
 
   ITK_GTEST_EXERCISE_BASIC_OBJECT_METHODS(filter, PointFeature, MeshToMeshFilter);
 }
+
+TEST(PointFeature, SyntheticSphere)
+{
+  constexpr unsigned int Dimension = 3;
+  using PointSetType = itk::PointSet<float, Dimension>;
+  using FilterType = itk::PointFeature<PointSetType, PointSetType>;
+
+  // Points on a sphere of radius 10, with the normals of the sphere
+  auto                   points = PointSetType::New();
+  auto                   normals = PointSetType::New();
+  constexpr unsigned int numberOfPoints = 2000;
+  for (unsigned int i = 0; i < numberOfPoints; ++i)
+  {
+    const double z = 1.0 - 2.0 * (i + 0.5) / numberOfPoints;
+    const double r = std::sqrt(1.0 - z * z);
+    const double phi = 2.399963229728653 * i;
+
+    PointSetType::PointType normal;
+    normal[0] = r * std::cos(phi);
+    normal[1] = r * std::sin(phi);
+    normal[2] = z;
+    PointSetType::PointType point;
+    for (unsigned int d = 0; d < Dimension; ++d)
+    {
+      point[d] = 10.0f * normal[d];
+    }
+    points->SetPoint(i, point);
+    normals->SetPoint(i, normal);
+  }
+
+  auto filter = FilterType::New();
+  filter->GetMultiThreader()->SetNumberOfWorkUnits(1);
+  filter->ComputeFPFHFeature(points, normals, 2.0, 30);
+  const auto sequentialFeature = filter->GetFpfhFeature()->CastToSTLConstContainer();
+  ASSERT_EQ(sequentialFeature.size(), 33 * numberOfPoints);
+
+  filter->GetMultiThreader()->SetNumberOfWorkUnits(4);
+  filter->ComputeFPFHFeature(points, normals, 2.0, 30);
+  const auto & feature = filter->GetFpfhFeature()->CastToSTLConstContainer();
+  EXPECT_EQ(feature, sequentialFeature);
+
+  // Each of the three histograms of a point sums to 100 for its SPFH feature
+  // and 100 for the weighted SPFH features of its neighbors.
+  for (unsigned int i = 0; i < numberOfPoints; ++i)
+  {
+    for (unsigned int h = 0; h < 3; ++h)
+    {
+      double sum = 0.0;
+      for (unsigned int j = 0; j < 11; ++j)
+      {
+        sum += feature[(11 * h + j) * numberOfPoints + i];
+      }
+      EXPECT_NEAR(sum, 200.0, 1e-9);
+    }
+  }
+}
@@ -159,6 +159,13 @@ public:
   void
   Initialize() override;
 
+  /** The clone also copies the radius. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   ANTSNeighborhoodCorrelationImageToImageMetricv4();
   ~ANTSNeighborhoodCorrelationImageToImageMetricv4() override = default;
@@ -182,6 +189,9 @@ protected:
                                                                                  Superclass,
                                                                                  Self>;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
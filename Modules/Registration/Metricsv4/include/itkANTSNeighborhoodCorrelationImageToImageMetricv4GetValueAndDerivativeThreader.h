@@ -86,6 +86,7 @@ public:
   using typename Superclass::MeasureType;
   using typename Superclass::DerivativeType;
   using typename Superclass::DerivativeValueType;
+  using typename Superclass::CompensatedMeasureType;
 
   using NeighborhoodCorrelationMetricType = TNeighborhoodCorrelationMetric;
 
@@ -98,8 +99,10 @@ public:
   using MovingImageType = typename NeighborhoodCorrelationMetricType::MovingImageType;
   using RadiusType = typename NeighborhoodCorrelationMetricType::RadiusType;
 
-  // interested values here updated during scanning
-  using QueueRealType = InternalComputationValueType;
+  // interested values here updated during scanning. The window moments are
+  // differences of large sums, so they are accumulated in at least double
+  // precision even when the metric computes in single precision.
+  using QueueRealType = typename NumericTraits<InternalComputationValueType>::AccumulateType;
   using SumQueueType = std::deque<QueueRealType>;
   using ScanIteratorType = ConstNeighborhoodIterator<VirtualImageType>;
 
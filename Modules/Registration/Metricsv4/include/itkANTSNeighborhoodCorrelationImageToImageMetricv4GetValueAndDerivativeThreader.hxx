@@ -41,13 +41,13 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<TDo
 
   std::call_once(this->m_ANTSAssociateOnceFlag, [this, &associate]() { this->m_ANTSAssociate = associate; });
 
-  VirtualPointType   virtualPoint;
-  MeasureType        metricValueResult{};
-  MeasureType        metricValueSum{};
-  bool               pointIsValid = false;
-  ScanIteratorType   scanIt;
-  ScanParametersType scanParameters;
-  ScanMemType        scanMem;
+  VirtualPointType       virtualPoint;
+  MeasureType            metricValueResult{};
+  CompensatedMeasureType metricValueSum;
+  bool                   pointIsValid = false;
+  ScanIteratorType       scanIt;
+  ScanParametersType     scanParameters;
+  ScanMemType            scanMem;
 
   DerivativeType & localDerivativeResult = this->m_GetValueAndDerivativePerThreadVariables[threadId].LocalDerivatives;
 
@@ -100,7 +100,7 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<TDo
   }
 
   /* Store metric value result for this thread. */
-  this->m_GetValueAndDerivativePerThreadVariables[threadId].Measure = metricValueSum;
+  this->m_GetValueAndDerivativePerThreadVariables[threadId].Measure = metricValueSum.GetSum();
 }
 
 template <typename TDomainPartitioner, typename TImageToImageMetric, typename TNeighborhoodCorrelationMetric>
@@ -139,7 +139,7 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
   const SizeValueType numberOfFillZero = scanParameters.numberOfFillZero;
   const SizeValueType hoodlen = scanParameters.windowLength;
 
-  constexpr InternalComputationValueType zero{};
+  constexpr QueueRealType zero{};
   scanMem.QsumFixed2 = SumQueueType(numberOfFillZero, zero);
   scanMem.QsumMoving2 = SumQueueType(numberOfFillZero, zero);
   scanMem.QsumFixed = SumQueueType(numberOfFillZero, zero);
@@ -147,7 +147,7 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
   scanMem.QsumFixedMoving = SumQueueType(numberOfFillZero, zero);
   scanMem.Qcount = SumQueueType(numberOfFillZero, zero);
 
-  using LocalRealType = InternalComputationValueType;
+  using LocalRealType = QueueRealType;
 
   // Now add the rest of the values from each hyperplane
   const SizeValueType diameter = 2 * scanParameters.radius[0];
@@ -233,7 +233,7 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
 {
   const SizeValueType hoodlen = scanParameters.windowLength;
 
-  using LocalRealType = InternalComputationValueType;
+  using LocalRealType = QueueRealType;
 
   constexpr LocalRealType localZero{};
 
@@ -381,7 +381,7 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
                                                                 const ScanParametersType &,
                                                                 const ThreadIdType) const
 {
-  using LocalRealType = InternalComputationValueType;
+  using LocalRealType = QueueRealType;
 
   constexpr LocalRealType localZero{};
 
@@ -519,7 +519,7 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
   MovingImageGradientType derivWRTImage;
   localCC = NumericTraits<MeasureType>::OneValue();
 
-  using LocalRealType = InternalComputationValueType;
+  using LocalRealType = QueueRealType;
 
   const LocalRealType sFixedFixed = scanMem.sFixedFixed;
   const LocalRealType sMovingMoving = scanMem.sMovingMoving;
@@ -531,7 +531,7 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
 
   if (itk::Math::Absolute(sFixedFixed_sMovingMoving) > NumericTraits<LocalRealType>::epsilon())
   {
-    localCC = sFixedMoving * sFixedMoving / (sFixedFixed_sMovingMoving);
+    localCC = static_cast<MeasureType>(sFixedMoving * sFixedMoving / (sFixedFixed_sMovingMoving));
   }
 
   if (this->m_ANTSAssociate->GetComputeDerivative())
@@ -118,6 +118,13 @@ public:
   /** Get the denominator threshold used in derivative calculation. */
   itkGetConstMacro(DenominatorThreshold, TInternalComputationValueType);
 
+  /** The clone also copies the intensity difference threshold. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   itkGetConstMacro(Normalizer, TInternalComputationValueType);
 
@@ -138,6 +145,9 @@ protected:
   using DemonsSparseGetValueAndDerivativeThreaderType =
     DemonsImageToImageMetricv4GetValueAndDerivativeThreader<ThreadedIndexedContainerPartitioner, Superclass, Self>;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
@@ -32,6 +32,15 @@ namespace itk
  *  We only have to handle the individual point case as the parent
  *  class handles the aggregation.
  *
+ *  Finding the closest moving point of each fixed point dominates the cost
+ *  of an evaluation. With UseCachedCorrespondences, the closest moving
+ *  point found for a fixed point is reused in the following evaluations,
+ *  until the transformed fixed point has moved farther than the
+ *  CorrespondenceDisplacementTolerance from where it was searched. The
+ *  distance to the reused point then exceeds the distance to the closest
+ *  point by at most twice the tolerance. The cache is cleared when the
+ *  moving point set changes.
+ *
  *  For complete details see \cite besl1992.
  *
  * \ingroup ITKMetricsv4
@@ -79,6 +88,26 @@ public:
    */
   itkGetConstMacro(DistanceThreshold, RealType);
 
+  /**
+   * Set/Get whether the closest moving point of each fixed point is reused
+   * across evaluations. Default = false.
+   */
+  /** @ITKStartGrouping */
+  itkSetMacro(UseCachedCorrespondences, bool);
+  itkGetConstMacro(UseCachedCorrespondences, bool);
+  itkBooleanMacro(UseCachedCorrespondences);
+  /** @ITKEndGrouping */
+
+  /**
+   * Set/Get the largest displacement of a transformed fixed point for which
+   * its cached closest moving point is reused. Default = 0, which only
+   * reuses the correspondences of the points that have not moved.
+   */
+  /** @ITKStartGrouping */
+  itkSetMacro(CorrespondenceDisplacementTolerance, RealType);
+  itkGetConstMacro(CorrespondenceDisplacementTolerance, RealType);
+  /** @ITKEndGrouping */
+
   /**
    * Calculates the local metric value for a single point.
    */
@@ -104,12 +133,60 @@ protected:
     return false;
   }
 
+  /** Clears the cached correspondences when the moving point set changed. */
+  void
+  InitializeForIteration() const override;
+
+  /** Calculates the local metric value for the fixed point of the index,
+   * using its cached correspondence when enabled. */
+  MeasureType
+  GetLocalNeighborhoodValueWithIndex(const PointIdentifier &, const PointType &, const PixelType &) const override;
+
+  LocalDerivativeType
+  GetLocalNeighborhoodDerivativeWithIndex(const PointIdentifier &,
+                                          const PointType &,
+                                          const PixelType &) const override;
+
+  void
+  GetLocalNeighborhoodValueAndDerivativeWithIndex(const PointIdentifier &,
+                                                  const PointType &,
+                                                  MeasureType &,
+                                                  LocalDerivativeType &,
+                                                  const PixelType &) const override;
+
   /** PrintSelf function */
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  /** Returns the closest moving point of the fixed point of the index, from
+   * the cache when it is enabled and still valid. */
+  PointType
+  FindClosestMovingPoint(const PointIdentifier & index, const PointType & point) const;
+
+  /** Calculates the local value and derivative from the closest point. */
+  void
+  ComputeLocalValueAndDerivative(const PointType &     point,
+                                 const PointType &     closestPoint,
+                                 MeasureType &         measure,
+                                 LocalDerivativeType & localDerivative) const;
+
+  /** The closest moving point found for a fixed point, and where the fixed
+   * point was when it was searched. */
+  struct CachedCorrespondence
+  {
+    PointType       m_SearchedPoint{};
+    PointIdentifier m_ClosestPointIdentifier{};
+    bool            m_IsValid{ false };
+  };
+
   RealType m_DistanceThreshold = -1.0;
+
+  bool     m_UseCachedCorrespondences{ false };
+  RealType m_CorrespondenceDisplacementTolerance{ 0.0 };
+
+  mutable std::vector<CachedCorrespondence> m_CachedCorrespondences{};
+  mutable ModifiedTimeType                  m_CachedCorrespondencesTime{ 0 };
 };
 } // end namespace itk
 
@@ -28,18 +28,13 @@ typename EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPoin
   EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
     GetLocalNeighborhoodValue(const PointType & point, const PixelType & itkNotUsed(pixel)) const
 {
-  PointType closestPoint{};
-
   const PointIdentifier pointId = this->m_MovingTransformedPointsLocator->FindClosestPoint(point);
-  closestPoint = this->m_MovingTransformedPointSet->GetPoint(pointId);
 
-  const MeasureType distance = point.EuclideanDistanceTo(closestPoint);
-  if (this->m_DistanceThreshold <= 0 || distance < this->m_DistanceThreshold)
-  {
-    return distance;
-  }
-
-  return 0;
+  MeasureType         measure;
+  LocalDerivativeType localDerivative;
+  this->ComputeLocalValueAndDerivative(
+    point, this->m_MovingTransformedPointSet->GetPoint(pointId), measure, localDerivative);
+  return measure;
 }
 
 template <typename TFixedPointSet, typename TMovingPointSet, class TInternalComputationValueType>
@@ -50,12 +45,111 @@ EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TIn
                                          LocalDerivativeType & localDerivative,
                                          const PixelType &     itkNotUsed(pixel)) const
 {
-  PointType closestPoint{};
-
   const PointIdentifier pointId = this->m_MovingTransformedPointsLocator->FindClosestPoint(point);
-  closestPoint = this->m_MovingTransformedPointSet->GetPoint(pointId);
 
-  auto distance = point.EuclideanDistanceTo(closestPoint);
+  this->ComputeLocalValueAndDerivative(
+    point, this->m_MovingTransformedPointSet->GetPoint(pointId), measure, localDerivative);
+}
+
+template <typename TFixedPointSet, typename TMovingPointSet, class TInternalComputationValueType>
+void
+EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
+  InitializeForIteration() const
+{
+  Superclass::InitializeForIteration();
+
+  if (!this->m_UseCachedCorrespondences)
+  {
+    this->m_CachedCorrespondences.clear();
+    return;
+  }
+
+  // The moving transformed point set is created again when it changes, so
+  // that its modified time identifies the points of the cached identifiers.
+  const ModifiedTimeType movingPointSetTime = this->m_MovingTransformedPointSet->GetMTime();
+  const SizeValueType    numberOfFixedPoints = this->m_FixedTransformedPointSet->GetNumberOfPoints();
+  if (movingPointSetTime != this->m_CachedCorrespondencesTime ||
+      this->m_CachedCorrespondences.size() != numberOfFixedPoints)
+  {
+    this->m_CachedCorrespondences.assign(numberOfFixedPoints, CachedCorrespondence());
+    this->m_CachedCorrespondencesTime = movingPointSetTime;
+  }
+}
+
+template <typename TFixedPointSet, typename TMovingPointSet, class TInternalComputationValueType>
+typename EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
+  MeasureType
+  EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
+    GetLocalNeighborhoodValueWithIndex(const PointIdentifier & index,
+                                       const PointType &       point,
+                                       const PixelType &       itkNotUsed(pixel)) const
+{
+  MeasureType         measure;
+  LocalDerivativeType localDerivative;
+  this->ComputeLocalValueAndDerivative(point, this->FindClosestMovingPoint(index, point), measure, localDerivative);
+  return measure;
+}
+
+template <typename TFixedPointSet, typename TMovingPointSet, class TInternalComputationValueType>
+typename EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
+  LocalDerivativeType
+  EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
+    GetLocalNeighborhoodDerivativeWithIndex(const PointIdentifier & index,
+                                            const PointType &       point,
+                                            const PixelType &       itkNotUsed(pixel)) const
+{
+  MeasureType         measure;
+  LocalDerivativeType localDerivative;
+  this->ComputeLocalValueAndDerivative(point, this->FindClosestMovingPoint(index, point), measure, localDerivative);
+  return localDerivative;
+}
+
+template <typename TFixedPointSet, typename TMovingPointSet, class TInternalComputationValueType>
+void
+EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
+  GetLocalNeighborhoodValueAndDerivativeWithIndex(const PointIdentifier & index,
+                                                  const PointType &       point,
+                                                  MeasureType &           measure,
+                                                  LocalDerivativeType &   localDerivative,
+                                                  const PixelType &       itkNotUsed(pixel)) const
+{
+  this->ComputeLocalValueAndDerivative(point, this->FindClosestMovingPoint(index, point), measure, localDerivative);
+}
+
+template <typename TFixedPointSet, typename TMovingPointSet, class TInternalComputationValueType>
+auto
+EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
+  FindClosestMovingPoint(const PointIdentifier & index, const PointType & point) const -> PointType
+{
+  if (index >= this->m_CachedCorrespondences.size())
+  {
+    const PointIdentifier pointId = this->m_MovingTransformedPointsLocator->FindClosestPoint(point);
+    return this->m_MovingTransformedPointSet->GetPoint(pointId);
+  }
+
+  // Each fixed point is evaluated by a single work unit, which is the only
+  // one to access its correspondence.
+  CachedCorrespondence & correspondence = this->m_CachedCorrespondences[index];
+  const RealType         tolerance = this->m_CorrespondenceDisplacementTolerance;
+  if (!correspondence.m_IsValid ||
+      point.SquaredEuclideanDistanceTo(correspondence.m_SearchedPoint) > tolerance * tolerance)
+  {
+    correspondence.m_ClosestPointIdentifier = this->m_MovingTransformedPointsLocator->FindClosestPoint(point);
+    correspondence.m_SearchedPoint = point;
+    correspondence.m_IsValid = true;
+  }
+  return this->m_MovingTransformedPointSet->GetPoint(correspondence.m_ClosestPointIdentifier);
+}
+
+template <typename TFixedPointSet, typename TMovingPointSet, class TInternalComputationValueType>
+void
+EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TInternalComputationValueType>::
+  ComputeLocalValueAndDerivative(const PointType &     point,
+                                 const PointType &     closestPoint,
+                                 MeasureType &         measure,
+                                 LocalDerivativeType & localDerivative) const
+{
+  const MeasureType distance = point.EuclideanDistanceTo(closestPoint);
 
   if (this->m_DistanceThreshold <= 0 || distance < this->m_DistanceThreshold)
   {
@@ -66,8 +160,7 @@ EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TIn
   {
     // Skip the points that are beyond the threshold by making value and derivative as 0.
     measure = 0;
-    closestPoint.Fill(0.0);
-    localDerivative = closestPoint;
+    localDerivative.Fill(0.0);
   }
 }
 
@@ -78,6 +171,10 @@ EuclideanDistancePointSetToPointSetMetricv4<TFixedPointSet, TMovingPointSet, TIn
   Indent         indent) const
 {
   Superclass::PrintSelf(os, indent);
+
+  os << indent << "DistanceThreshold: " << this->m_DistanceThreshold << std::endl;
+  itkPrintSelfBooleanMacro(UseCachedCorrespondences);
+  os << indent << "CorrespondenceDisplacementTolerance: " << this->m_CorrespondenceDisplacementTolerance << std::endl;
 }
 
 } // end namespace itk
@@ -818,6 +818,14 @@ protected:
   ImageToImageMetricv4();
   ~ImageToImageMetricv4() override = default;
 
+  /** The clone shares the images, masks, interpolators, sample point sets
+   * and user-provided gradient filters and calculators of this metric, and
+   * has its own moving transform. It must be initialized before use. Derived
+   * metrics copy their own settings in their InternalClone(), and return
+   * true from SupportsCloning() once it copies all of them. */
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
@@ -632,6 +632,62 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   return region.GetNumberOfPixels();
 }
 
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+LightObject::Pointer
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
+  InternalClone() const
+{
+  LightObject::Pointer loPtr = Superclass::InternalClone();
+
+  const typename Self::Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+  if (rval.IsNull())
+  {
+    itkExceptionMacro("downcast to type " << this->GetNameOfClass() << " failed.");
+  }
+  rval->m_FixedImage = this->m_FixedImage;
+  rval->m_MovingImage = this->m_MovingImage;
+  rval->m_FixedImageMask = this->m_FixedImageMask;
+  rval->m_MovingImageMask = this->m_MovingImageMask;
+
+  /* The interpolators are only evaluated, which is thread safe. */
+  rval->m_FixedInterpolator = this->m_FixedInterpolator;
+  rval->m_MovingInterpolator = this->m_MovingInterpolator;
+
+  /* The gradient filters are shared, so that the gradient images computed
+   * for this metric are not computed again when the clone is initialized.
+   * User-provided gradient calculators are shared. Otherwise the clone keeps
+   * its own defaults, which are configured in Initialize(). */
+  rval->m_UseFixedImageGradientFilter = this->m_UseFixedImageGradientFilter;
+  rval->m_UseMovingImageGradientFilter = this->m_UseMovingImageGradientFilter;
+  rval->m_FixedImageGradientFilter = this->m_FixedImageGradientFilter;
+  rval->m_MovingImageGradientFilter = this->m_MovingImageGradientFilter;
+  if (this->m_FixedImageGradientCalculator != this->m_DefaultFixedImageGradientCalculator)
+  {
+    rval->m_FixedImageGradientCalculator = this->m_FixedImageGradientCalculator;
+  }
+  if (this->m_MovingImageGradientCalculator != this->m_DefaultMovingImageGradientCalculator)
+  {
+    rval->m_MovingImageGradientCalculator = this->m_MovingImageGradientCalculator;
+  }
+
+  rval->m_FixedSampledPointSet = this->m_FixedSampledPointSet;
+  rval->m_UseSampledPointSet = this->m_UseSampledPointSet;
+  rval->m_UseVirtualSampledPointSet = this->m_UseVirtualSampledPointSet;
+  if (this->m_UseVirtualSampledPointSet)
+  {
+    rval->m_VirtualSampledPointSet = this->m_VirtualSampledPointSet;
+  }
+
+  rval->m_UseFloatingPointCorrection = this->m_UseFloatingPointCorrection;
+  rval->m_FloatingPointCorrectionResolution = this->m_FloatingPointCorrectionResolution;
+  rval->SetMaximumNumberOfWorkUnits(this->GetMaximumNumberOfWorkUnits());
+  return loPtr;
+}
+
 template <typename TFixedImage,
           typename TMovingImage,
           typename TVirtualImage,
@@ -92,7 +92,7 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner,
   for (ThreadIdType workUnit = 0; workUnit < numWorkUnitsUsed; ++workUnit)
   {
     this->m_GetValueAndDerivativePerThreadVariables[workUnit].NumberOfValidPoints = SizeValueType{};
-    this->m_GetValueAndDerivativePerThreadVariables[workUnit].Measure = InternalComputationValueType{};
+    this->m_GetValueAndDerivativePerThreadVariables[workUnit].Measure.ResetToZero();
     if (this->m_Associate->GetComputeDerivative())
     {
       if (this->m_Associate->m_MovingTransform->GetTransformCategory() !=
@@ -155,7 +155,7 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner,
     /* Accumulate the metric value from threads and store the average. */
     for (ThreadIdType threadId = 0; threadId < numWorkUnitsUsed; ++threadId)
     {
-      this->m_Associate->m_Value += this->m_GetValueAndDerivativePerThreadVariables[threadId].Measure;
+      this->m_Associate->m_Value += this->m_GetValueAndDerivativePerThreadVariables[threadId].Measure.GetSum();
     }
     this->m_Associate->m_Value /= this->m_Associate->m_NumberOfValidPoints;
 
@@ -18,6 +18,7 @@
 #ifndef itkJensenHavrdaCharvatTsallisPointSetToPointSetMetricv4_hxx
 #define itkJensenHavrdaCharvatTsallisPointSetToPointSetMetricv4_hxx
 
+#include "itkCompensatedSummation.h"
 #include "itkMath.h"
 #include "itkPrintHelper.h"
 
@@ -106,8 +107,32 @@ JensenHavrdaCharvatTsallisPointSetToPointSetMetricv4<TPointSet, TInternalComputa
    */
   const typename PointSetType::PointIdentifier numberOfMovingPoints =
     this->m_MovingDensityFunction->GetInputPointSet()->GetNumberOfPoints();
-  RealType probabilityStar =
-    this->m_MovingDensityFunction->Evaluate(samplePoint) * static_cast<RealType>(numberOfMovingPoints);
+
+  // The derivative needs the Gaussians of the same neighbors as the
+  // probability, so they are found and evaluated once for both.
+  typename DensityFunctionType::NeighborsIdentifierType neighbors;
+  std::vector<RealType>                                 gaussians;
+  RealType                                              probabilityStar;
+  if (calcDerivative)
+  {
+    const unsigned int numberOfNeighbors =
+      std::min(this->m_EvaluationKNeighborhood, static_cast<unsigned int>(numberOfMovingPoints));
+    this->m_MovingDensityFunction->GetPointsLocator()->FindClosestNPoints(samplePoint, numberOfNeighbors, neighbors);
+
+    gaussians.resize(neighbors.size());
+    CompensatedSummation<RealType> sum;
+    for (SizeValueType n = 0; n < neighbors.size(); ++n)
+    {
+      gaussians[n] = this->m_MovingDensityFunction->GetGaussian(neighbors[n])->Evaluate(samplePoint);
+      sum += gaussians[n];
+    }
+    probabilityStar = sum.GetSum();
+  }
+  else
+  {
+    probabilityStar =
+      this->m_MovingDensityFunction->Evaluate(samplePoint) * static_cast<RealType>(numberOfMovingPoints);
+  }
 
   probabilityStar /= this->m_TotalNumberOfPoints;
 
@@ -134,22 +159,19 @@ JensenHavrdaCharvatTsallisPointSetToPointSetMetricv4<TPointSet, TInternalComputa
   {
     const RealType probabilityStarFactor = std::pow(probabilityStar, static_cast<RealType>(2.0 - this->m_Alpha));
 
-    typename DensityFunctionType::NeighborsIdentifierType neighbors;
-    this->m_MovingDensityFunction->GetPointsLocator()->FindClosestNPoints(
-      samplePoint, this->m_EvaluationKNeighborhood, neighbors);
-
+    Array<CoordinateType> diffMean(PointDimension);
     for (SizeValueType n = 0; n < neighbors.size(); ++n)
     {
-      const RealType gaussian = this->m_MovingDensityFunction->GetGaussian(neighbors[n])->Evaluate(samplePoint);
+      const RealType gaussian = gaussians[n];
 
       if (Math::AlmostEquals(gaussian, RealType{}))
       {
         continue;
       }
 
-      typename GaussianType::MeanVectorType mean = this->m_MovingDensityFunction->GetGaussian(neighbors[n])->GetMean();
+      const GaussianType * gaussianFunction = this->m_MovingDensityFunction->GetGaussian(neighbors[n]);
+      const auto &         mean = gaussianFunction->GetMean();
 
-      Array<CoordinateType> diffMean(PointDimension);
       for (unsigned int i = 0; i < PointDimension; ++i)
       {
         diffMean[i] = mean[i] - samplePoint[i];
@@ -157,13 +179,11 @@ JensenHavrdaCharvatTsallisPointSetToPointSetMetricv4<TPointSet, TInternalComputa
 
       if (this->m_UseAnisotropicCovariances)
       {
-        const typename GaussianType::CovarianceMatrixType Ci =
-          this->m_MovingDensityFunction->GetGaussian(neighbors[n])->GetInverseCovariance();
-        diffMean = Ci * diffMean;
+        diffMean = gaussianFunction->GetInverseCovariance() * diffMean;
       }
       else
       {
-        diffMean /= this->m_MovingDensityFunction->GetGaussian(neighbors[n])->GetCovariance()(0, 0);
+        diffMean /= gaussianFunction->GetCovariance()(0, 0);
       }
 
       const DerivativeValueType factor = this->m_Prefactor1 * gaussian / probabilityStarFactor;
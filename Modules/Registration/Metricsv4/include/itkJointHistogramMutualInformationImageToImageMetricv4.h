@@ -148,6 +148,13 @@ public:
   MeasureType
   GetValue() const override;
 
+  /** The clone also copies the number of histogram bins and the variance of the smoothing. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   JointHistogramMutualInformationImageToImageMetricv4();
   ~JointHistogramMutualInformationImageToImageMetricv4() override = default;
@@ -205,6 +212,9 @@ protected:
   using JointHistogramMutualInformationSparseGetValueAndDerivativeThreaderType =
     JointHistogramMutualInformationGetValueAndDerivativeThreader<ThreadedIndexedContainerPartitioner, Superclass, Self>;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   /** Standard PrintSelf method. */
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
@@ -397,6 +397,30 @@ JointHistogramMutualInformationImageToImageMetricv4<
   jointPDFpoint[1] = b;
 }
 
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+LightObject::Pointer
+JointHistogramMutualInformationImageToImageMetricv4<TFixedImage,
+                                                    TMovingImage,
+                                                    TVirtualImage,
+                                                    TInternalComputationValueType,
+                                                    TMetricTraits>::InternalClone() const
+{
+  LightObject::Pointer loPtr = Superclass::InternalClone();
+
+  const typename Self::Pointer rval = dynamic_cast<Self *>(loPtr.GetPointer());
+  if (rval.IsNull())
+  {
+    itkExceptionMacro("downcast to type " << this->GetNameOfClass() << " failed.");
+  }
+  rval->m_NumberOfHistogramBins = this->m_NumberOfHistogramBins;
+  rval->m_VarianceForJointPDFSmoothing = this->m_VarianceForJointPDFSmoothing;
+  return loPtr;
+}
+
 template <typename TFixedImage,
           typename TMovingImage,
           typename TVirtualImage,
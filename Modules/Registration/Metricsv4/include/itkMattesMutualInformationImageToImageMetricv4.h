@@ -188,6 +188,13 @@ public:
   void
   FinalizeThread(const ThreadIdType threadId) override;
 
+  /** The clone also copies the number of histogram bins. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   MattesMutualInformationImageToImageMetricv4();
   ~MattesMutualInformationImageToImageMetricv4() override = default;
@@ -210,6 +217,9 @@ protected:
                                                                              Superclass,
                                                                              Self>;
 
+  LightObject::Pointer
+  InternalClone() const override;
+
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
@@ -84,6 +84,14 @@ public:
   static constexpr typename TFixedImage::ImageDimensionType   FixedImageDimension = TFixedImage::ImageDimension;
   static constexpr typename TMovingImage::ImageDimensionType  MovingImageDimension = TMovingImage::ImageDimension;
 
+  /** The metric has no settings of its own, so the clone made by
+   * ImageToImageMetricv4 copies all of them. */
+  bool
+  SupportsCloning() const override
+  {
+    return true;
+  }
+
 protected:
   MeanSquaresImageToImageMetricv4();
   ~MeanSquaresImageToImageMetricv4() override = default;
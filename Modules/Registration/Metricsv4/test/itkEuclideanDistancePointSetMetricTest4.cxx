@@ -0,0 +1,151 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkEuclideanDistancePointSetToPointSetMetricv4.h"
+#include "itkTranslationTransform.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkTestingMacros.h"
+
+/*
+ * Test the reuse of the correspondences across evaluations
+ */
+
+int
+itkEuclideanDistancePointSetMetricTest4(int, char *[])
+{
+  constexpr unsigned int Dimension = 3;
+
+  using PointSetType = itk::PointSet<float, Dimension>;
+  using PointType = PointSetType::PointType;
+
+  auto random = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+  random->SetSeed(42);
+
+  auto fixedPoints = PointSetType::New();
+  auto movingPoints = PointSetType::New();
+  for (unsigned int n = 0; n < 2000; ++n)
+  {
+    PointType fixedPoint;
+    PointType movingPoint;
+    for (unsigned int d = 0; d < Dimension; ++d)
+    {
+      fixedPoint[d] = static_cast<float>(random->GetUniformVariate(0.0, 50.0));
+      movingPoint[d] = static_cast<float>(random->GetUniformVariate(0.0, 50.0));
+    }
+    fixedPoints->SetPoint(n, fixedPoint);
+    movingPoints->SetPoint(n, movingPoint);
+  }
+
+  using TranslationTransformType = itk::TranslationTransform<double, Dimension>;
+  using PointSetMetricType = itk::EuclideanDistancePointSetToPointSetMetricv4<PointSetType>;
+
+  auto referenceTransform = TranslationTransformType::New();
+  auto referenceMetric = PointSetMetricType::New();
+  referenceMetric->SetFixedPointSet(fixedPoints);
+  referenceMetric->SetMovingPointSet(movingPoints);
+  referenceMetric->SetMovingTransform(referenceTransform);
+  referenceMetric->Initialize();
+
+  auto transform = TranslationTransformType::New();
+  auto metric = PointSetMetricType::New();
+  metric->SetFixedPointSet(fixedPoints);
+  metric->SetMovingPointSet(movingPoints);
+  metric->SetMovingTransform(transform);
+
+  ITK_TEST_SET_GET_BOOLEAN(metric, UseCachedCorrespondences, false);
+  metric->UseCachedCorrespondencesOn();
+
+  constexpr double tolerance = 0.1;
+  metric->SetCorrespondenceDisplacementTolerance(tolerance);
+  ITK_TEST_SET_GET_VALUE(tolerance, metric->GetCorrespondenceDisplacementTolerance());
+
+  metric->Initialize();
+
+  int testStatus = EXIT_SUCCESS;
+
+  // Translate the fixed points by small steps. The cached correspondences
+  // are at most twice the tolerance farther than the closest points.
+  TranslationTransformType::ParametersType parameters(Dimension);
+  parameters.Fill(0.0);
+  for (unsigned int step = 0; step < 10; ++step)
+  {
+    parameters[0] = 0.03 * step;
+    parameters[1] = -0.02 * step;
+    transform->SetParameters(parameters);
+    referenceTransform->SetParameters(parameters);
+
+    PointSetMetricType::MeasureType    value;
+    PointSetMetricType::DerivativeType derivative;
+    metric->GetValueAndDerivative(value, derivative);
+
+    PointSetMetricType::MeasureType    referenceValue;
+    PointSetMetricType::DerivativeType referenceDerivative;
+    referenceMetric->GetValueAndDerivative(referenceValue, referenceDerivative);
+
+    std::cout << "Step " << step << ": value " << value << ", reference " << referenceValue << std::endl;
+    if (step == 0 && (itk::Math::NotExactlyEquals(value, referenceValue) || derivative != referenceDerivative))
+    {
+      std::cerr << "Test failed: the first evaluation differs from the reference." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+    if (value < referenceValue - 1e-6 || value > referenceValue + 2.0 * tolerance)
+    {
+      std::cerr << "Test failed: the value with cached correspondences is out of bounds." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+    if (itk::Math::NotExactlyEquals(metric->GetValue(), value))
+    {
+      std::cerr << "Test failed: GetValue differs from GetValueAndDerivative." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+  }
+
+  // Without tolerance, the correspondences of the points that moved are
+  // searched again, so the results are exact.
+  metric->SetCorrespondenceDisplacementTolerance(0.0);
+  parameters[2] = 1.5;
+  transform->SetParameters(parameters);
+  referenceTransform->SetParameters(parameters);
+  if (itk::Math::NotExactlyEquals(metric->GetValue(), referenceMetric->GetValue()))
+  {
+    std::cerr << "Test failed: the value without tolerance differs from the reference." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // A change of the moving points clears the cache.
+  auto shiftedMovingPoints = PointSetType::New();
+  for (unsigned int n = 0; n < movingPoints->GetNumberOfPoints(); ++n)
+  {
+    PointType movingPoint = movingPoints->GetPoint(n);
+    movingPoint[0] += 5.0f;
+    shiftedMovingPoints->SetPoint(n, movingPoint);
+  }
+  metric->SetCorrespondenceDisplacementTolerance(tolerance);
+  metric->SetMovingPointSet(shiftedMovingPoints);
+  metric->Initialize();
+  referenceMetric->SetMovingPointSet(shiftedMovingPoints);
+  referenceMetric->Initialize();
+  if (itk::Math::NotExactlyEquals(metric->GetValue(), referenceMetric->GetValue()))
+  {
+    std::cerr << "Test failed: the cache was not cleared after the moving points changed." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
@@ -0,0 +1,320 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkANTSNeighborhoodCorrelationImageToImageMetricv4.h"
+#include "itkCorrelationImageToImageMetricv4.h"
+#include "itkDemonsImageToImageMetricv4.h"
+#include "itkJointHistogramMutualInformationImageToImageMetricv4.h"
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkMattesMutualInformationImageToImageMetricv4.h"
+#include "itkMultiStartOptimizerv4.h"
+#include "itkAmoebaOptimizerv4.h"
+#include "itkConjugateGradientLineSearchOptimizerv4.h"
+#include "itkExhaustiveOptimizerv4.h"
+#include "itkGradientDescentLineSearchOptimizerv4.h"
+#include "itkLBFGS2Optimizerv4.h"
+#include "itkMultiGradientOptimizerv4.h"
+#include "itkOnePlusOneEvolutionaryOptimizerv4.h"
+#include "itkPowellOptimizerv4.h"
+#include "itkQuasiNewtonOptimizerv4.h"
+#include "itkRegularStepGradientDescentOptimizerv4.h"
+#include "itkEuler2DTransform.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+/*
+ * Sweep the rotations of a rigid transform with serial and concurrent
+ * multi-start searches and compare them, and check that the parallel
+ * bracketing line search converges as the golden section search does.
+ * Also check that the optimizers and the metrics report whether their clones
+ * copy all their settings, and that the errors of the concurrent evaluations
+ * are passed on.
+ */
+
+namespace
+{
+constexpr unsigned int Dimension = 2;
+using ImageType = itk::Image<float, Dimension>;
+using TransformType = itk::Euler2DTransform<double>;
+using MetricType = itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType>;
+using MultiStartType = itk::MultiStartOptimizerv4;
+
+// A metric which cannot be evaluated.
+class ThrowingMetric : public MetricType
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ThrowingMetric);
+
+  using Self = ThrowingMetric;
+  using Superclass = MetricType;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(ThrowingMetric);
+
+  MeasureType
+  GetValue() const override
+  {
+    itkExceptionMacro("The metric cannot be evaluated.");
+  }
+
+protected:
+  ThrowingMetric() = default;
+  ~ThrowingMetric() override = default;
+};
+
+ImageType::Pointer
+MakeEllipse(double centerX, double centerY, double radiusX, double radiusY, double angle)
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 64 } });
+  image->Allocate();
+
+  const double cosine = std::cos(angle);
+  const double sine = std::sin(angle);
+  for (itk::ImageRegionIteratorWithIndex<ImageType> It(image, image->GetBufferedRegion()); !It.IsAtEnd(); ++It)
+  {
+    const double u = It.GetIndex()[0] - centerX;
+    const double v = It.GetIndex()[1] - centerY;
+    const double x = (cosine * u + sine * v) / radiusX;
+    const double y = (-sine * u + cosine * v) / radiusY;
+    It.Set(static_cast<float>(100.0 * std::exp(-2.0 * (x * x + y * y))));
+  }
+  return image;
+}
+
+template <typename TMetric = MetricType>
+typename TMetric::Pointer
+MakeMetric(const ImageType * fixedImage, const ImageType * movingImage)
+{
+  auto transform = TransformType::New();
+  transform->SetCenter(itk::MakePoint(32.0, 32.0));
+
+  auto metric = TMetric::New();
+  metric->SetFixedImage(fixedImage);
+  metric->SetMovingImage(movingImage);
+  metric->SetMovingTransform(transform);
+  metric->Initialize();
+  return metric;
+}
+
+// The rotation is scaled up to be commensurate with the translations.
+MultiStartType::ScalesType
+MakeScales()
+{
+  MultiStartType::ScalesType scales(3);
+  scales[0] = 1000.0;
+  scales[1] = 1.0;
+  scales[2] = 1.0;
+  return scales;
+}
+
+MultiStartType::Pointer
+SweepRotations(MetricType * metric, itk::SizeValueType numberOfConcurrentStarts)
+{
+  constexpr unsigned int             numberOfRotations = 16;
+  MultiStartType::ParametersListType parametersList;
+  for (unsigned int i = 0; i < numberOfRotations; ++i)
+  {
+    MultiStartType::ParametersType parameters(metric->GetNumberOfParameters());
+    parameters.Fill(0.0);
+    parameters[0] = 2.0 * itk::Math::pi * i / numberOfRotations - itk::Math::pi;
+    parametersList.push_back(parameters);
+  }
+
+  auto localOptimizer = itk::RegularStepGradientDescentOptimizerv4<double>::New();
+  localOptimizer->SetLearningRate(1.0);
+  localOptimizer->SetMinimumStepLength(1e-4);
+  localOptimizer->SetNumberOfIterations(20);
+  localOptimizer->SetScales(MakeScales());
+  localOptimizer->SetDoEstimateLearningRateOnce(false);
+  localOptimizer->SetDoEstimateLearningRateAtEachIteration(false);
+
+  auto optimizer = MultiStartType::New();
+  optimizer->SetMetric(metric);
+  optimizer->SetParametersList(parametersList);
+  optimizer->SetLocalOptimizer(localOptimizer);
+  optimizer->SetNumberOfWorkUnits(4);
+  optimizer->SetNumberOfConcurrentStarts(numberOfConcurrentStarts);
+  optimizer->StartOptimization();
+
+  std::cout << "  " << numberOfConcurrentStarts << " concurrent starts: best start "
+            << optimizer->GetBestParametersIndex() << ", parameters " << optimizer->GetBestParameters()
+            << ", metric value " << metric->GetValue() << std::endl;
+  return optimizer;
+}
+
+double
+SearchLine(MetricType * metric, unsigned int numberOfLineSearchPoints, double & initialValue)
+{
+  // Start near the rotation of the moving ellipse.
+  TransformType::ParametersType parameters(metric->GetNumberOfParameters());
+  parameters.Fill(0.0);
+  parameters[0] = -1.0;
+  metric->SetParameters(parameters);
+  initialValue = metric->GetValue();
+
+  auto optimizer = itk::GradientDescentLineSearchOptimizerv4::New();
+  optimizer->SetMetric(metric);
+  optimizer->SetScales(MakeScales());
+  optimizer->SetLearningRate(1.0);
+  optimizer->SetNumberOfIterations(10);
+  optimizer->SetNumberOfLineSearchPoints(numberOfLineSearchPoints);
+  optimizer->SetMaximumLineSearchIterations(10);
+  optimizer->StartOptimization();
+
+  std::cout << "  " << numberOfLineSearchPoints << " line search points: parameters " << metric->GetParameters()
+            << ", metric value " << optimizer->GetCurrentMetricValue() << std::endl;
+  return optimizer->GetCurrentMetricValue();
+}
+} // namespace
+
+int
+itkMultiStartConcurrentImageToImageMetricv4RegistrationTest(int, char *[])
+{
+  const ImageType::Pointer fixedImage = MakeEllipse(32.0, 32.0, 12.0, 5.0, 0.0);
+  const ImageType::Pointer movingImage = MakeEllipse(33.0, 31.0, 12.0, 5.0, 2.0);
+
+  int testStatus = EXIT_SUCCESS;
+
+  // A clone evaluates the metric as the original does.
+  {
+    const MetricType::Pointer metric = MakeMetric(fixedImage, movingImage);
+    MetricType::ParametersType parameters(metric->GetNumberOfParameters());
+    parameters.Fill(0.0);
+    parameters[0] = 0.5;
+    metric->SetParameters(parameters);
+
+    const MetricType::Pointer clone = metric->Clone();
+    ITK_TEST_EXPECT_TRUE(clone->GetMovingTransform() != metric->GetMovingTransform());
+    clone->Initialize();
+    ITK_TEST_EXPECT_EQUAL(metric->GetValue(), clone->GetValue());
+
+    // The clones move their own transforms.
+    parameters[0] = 1.0;
+    clone->SetParameters(parameters);
+    ITK_TEST_EXPECT_EQUAL(0.5, metric->GetParameters()[0]);
+
+    auto mattesMetric = itk::MattesMutualInformationImageToImageMetricv4<ImageType, ImageType>::New();
+    mattesMetric->SetNumberOfHistogramBins(24);
+    ITK_TEST_EXPECT_EQUAL(24, mattesMetric->Clone()->GetNumberOfHistogramBins());
+
+    // The metrics whose clones copy all their settings report it.
+    ITK_TEST_EXPECT_TRUE(metric->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(mattesMetric->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(
+      (itk::ANTSNeighborhoodCorrelationImageToImageMetricv4<ImageType, ImageType>::New()->SupportsCloning()));
+    ITK_TEST_EXPECT_TRUE((itk::CorrelationImageToImageMetricv4<ImageType, ImageType>::New()->SupportsCloning()));
+    ITK_TEST_EXPECT_TRUE((itk::DemonsImageToImageMetricv4<ImageType, ImageType>::New()->SupportsCloning()));
+    ITK_TEST_EXPECT_TRUE(
+      (itk::JointHistogramMutualInformationImageToImageMetricv4<ImageType, ImageType>::New()->SupportsCloning()));
+
+    // So do the optimizers.
+    ITK_TEST_EXPECT_TRUE(itk::GradientDescentOptimizerv4::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(itk::GradientDescentLineSearchOptimizerv4::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(itk::ConjugateGradientLineSearchOptimizerv4::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(itk::QuasiNewtonOptimizerv4::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(itk::RegularStepGradientDescentOptimizerv4<double>::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(!itk::AmoebaOptimizerv4::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(!itk::ExhaustiveOptimizerv4<double>::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(!itk::LBFGS2Optimizerv4::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(!itk::MultiGradientOptimizerv4::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(!itk::OnePlusOneEvolutionaryOptimizerv4<double>::New()->SupportsCloning());
+    ITK_TEST_EXPECT_TRUE(!itk::PowellOptimizerv4<double>::New()->SupportsCloning());
+
+    auto conjugateGradientOptimizer = itk::ConjugateGradientLineSearchOptimizerv4::New();
+    conjugateGradientOptimizer->SetLearningRate(0.25);
+    ITK_TEST_EXPECT_EQUAL(0.25, conjugateGradientOptimizer->Clone()->GetInitialLearningRate());
+  }
+
+  // The concurrent starts require a local optimizer that supports cloning.
+  {
+    const MetricType::Pointer          metric = MakeMetric(fixedImage, movingImage);
+    MultiStartType::ParametersListType parametersList(4, metric->GetParameters());
+
+    auto optimizer = MultiStartType::New();
+    optimizer->SetMetric(metric);
+    optimizer->SetParametersList(parametersList);
+    optimizer->SetLocalOptimizer(itk::PowellOptimizerv4<double>::New());
+    optimizer->SetNumberOfWorkUnits(4);
+    optimizer->SetNumberOfConcurrentStarts(4);
+    ITK_TRY_EXPECT_EXCEPTION(optimizer->StartOptimization());
+  }
+
+  // The errors of the metric are passed on by the bracketing line search.
+  {
+    const ThrowingMetric::Pointer metric = MakeMetric<ThrowingMetric>(fixedImage, movingImage);
+
+    auto optimizer = itk::GradientDescentLineSearchOptimizerv4::New();
+    optimizer->SetMetric(metric);
+    optimizer->SetScales(MakeScales());
+    optimizer->SetLearningRate(1.0);
+    optimizer->SetNumberOfIterations(10);
+    optimizer->SetNumberOfLineSearchPoints(4);
+    ITK_TRY_EXPECT_EXCEPTION(optimizer->StartOptimization());
+  }
+
+  std::cout << "Multi-start" << std::endl;
+  const MetricType::Pointer serialMetric = MakeMetric(fixedImage, movingImage);
+  const MetricType::Pointer concurrentMetric = MakeMetric(fixedImage, movingImage);
+  const auto                serialOptimizer = SweepRotations(serialMetric, 1);
+  const auto                concurrentOptimizer = SweepRotations(concurrentMetric, 4);
+
+  ITK_TEST_EXPECT_EQUAL(1, serialOptimizer->GetNumberOfConcurrentStarts());
+  ITK_TEST_EXPECT_EQUAL(4, concurrentOptimizer->GetNumberOfConcurrentStarts());
+  ITK_TEST_EXPECT_EQUAL(serialOptimizer->GetBestParametersIndex(), concurrentOptimizer->GetBestParametersIndex());
+
+  const auto & serialValues = serialOptimizer->GetMetricValuesList();
+  const auto & concurrentValues = concurrentOptimizer->GetMetricValuesList();
+  ITK_TEST_EXPECT_EQUAL(serialValues.size(), concurrentValues.size());
+  for (size_t i = 0; i < std::min(serialValues.size(), concurrentValues.size()); ++i)
+  {
+    if (itk::Math::abs(serialValues[i] - concurrentValues[i]) > 1e-10 * itk::Math::abs(serialValues[i]))
+    {
+      std::cerr << "Test failed: start " << i << " has metric value " << concurrentValues[i] << " instead of "
+                << serialValues[i] << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+  }
+
+  // The best start has found the rotation of the moving ellipse.
+  const double angle = concurrentOptimizer->GetBestParameters()[0];
+  if (itk::Math::abs(std::remainder(angle - 2.0, itk::Math::pi)) > 0.05)
+  {
+    std::cerr << "Test failed: the best rotation " << angle << " is not the rotation of the ellipse." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  std::cout << "Line search" << std::endl;
+  const MetricType::Pointer lineSearchMetric = MakeMetric(fixedImage, movingImage);
+  double                    initialValue = 0.0;
+  const double              goldenSectionValue = SearchLine(lineSearchMetric, 1, initialValue);
+  const double              bracketingValue = SearchLine(lineSearchMetric, 4, initialValue);
+  std::cout << "  Initial metric value " << initialValue << std::endl;
+  if (!(bracketingValue < initialValue) ||
+      bracketingValue > goldenSectionValue + 0.1 * (initialValue - goldenSectionValue))
+  {
+    std::cerr << "Test failed: the bracketing line search did not converge as the golden section search did."
+              << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
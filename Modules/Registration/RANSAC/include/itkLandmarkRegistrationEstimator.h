@@ -72,6 +72,11 @@ public:
                 std::vector<Point<double, Dimension>> & data,
                 unsigned int                            currentBest) override;
 
+  virtual bool
+  AgreeSubset(std::vector<double> &                   parameters,
+              std::vector<Point<double, Dimension>> & data,
+              const std::vector<unsigned int> &       indexes) override;
+
   virtual bool
   CheckCorresspondenceDistance(std::vector<double> &                     parameters,
                                std::vector<Point<double, Dimension> *> & data) override;
@@ -95,6 +100,17 @@ protected:
   ~LandmarkRegistrationEstimator() override = default;
 
 private:
+  // Create the transform defined by the parameters, optimizable parameters first
+  typename TTransform::Pointer
+  CreateTransform(const std::vector<double> & parameters) const;
+
+  // Squared distance from the transformed source point of a data object to
+  // the closest destination point of the agree data
+  double
+  ComputeSquaredResidual(const typename TTransform::MatrixType &     matrix,
+                         const typename TTransform::OutputVectorType & offset,
+                         const Point<double, Dimension> &              data) const;
+
   double                     delta;
   PointsLocatorType::Pointer pointsLocator;
   PointsContainer::Pointer   agreePoints;
@@ -378,6 +378,67 @@ std::vector<double>
 LandmarkRegistrationEstimator<Dimension, TTransform>::AgreeMultiple(std::vector<double> &                   parameters,
                                                                     std::vector<Point<double, Dimension>> & data,
                                                                     unsigned int                            currentBest)
+{
+  // The points are transformed with the matrix and offset of the transform
+  // directly, instead of through a virtual call for each of them.
+  auto         transform = this->CreateTransform(parameters);
+  const auto & matrix = transform->GetMatrix();
+  const auto & offset = transform->GetOffset();
+
+  std::vector<double> output(data.size());
+
+  unsigned int localBest = 0;
+  unsigned int dataSize = data.size();
+
+  for (unsigned int i = 0; i < dataSize; ++i)
+  {
+    // For early stopping. No point running if this condition is true
+    if (localBest + dataSize - i < currentBest)
+    {
+      break;
+    }
+
+    const double squaredDistance = this->ComputeSquaredResidual(matrix, offset, data[i]);
+
+    // squaredDistance is squared distance; delta is Euclidean threshold.
+    bool flag = squaredDistance < this->delta * this->delta;
+    if (flag)
+    {
+      localBest++;
+      output[i] = squaredDistance;
+    }
+    else
+    {
+      output[i] = -1;
+    }
+  }
+
+  return output;
+}
+
+template <unsigned int Dimension, typename TTransform>
+bool
+LandmarkRegistrationEstimator<Dimension, TTransform>::AgreeSubset(std::vector<double> &                   parameters,
+                                                                  std::vector<Point<double, Dimension>> & data,
+                                                                  const std::vector<unsigned int> &       indexes)
+{
+  auto         transform = this->CreateTransform(parameters);
+  const auto & matrix = transform->GetMatrix();
+  const auto & offset = transform->GetOffset();
+
+  for (unsigned int index : indexes)
+  {
+    if (this->ComputeSquaredResidual(matrix, offset, data[index]) >= this->delta * this->delta)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <unsigned int Dimension, typename TTransform>
+typename TTransform::Pointer
+LandmarkRegistrationEstimator<Dimension, TTransform>::CreateTransform(const std::vector<double> & parameters) const
 {
   auto transform = TTransform::New();
 
@@ -401,53 +462,34 @@ LandmarkRegistrationEstimator<Dimension, TTransform>::AgreeMultiple(std::vector<
   }
   transform->SetParameters(optParameters);
 
-  std::vector<double> query_pt(3);
-  std::vector<double> output(data.size());
-  // output.reserve(data.size());
-
-  const size_t                    num_results = 1;
-  std::vector<size_t>             ret_indexes(num_results);
-  std::vector<double>             out_dists_sqr(num_results);
-  nanoflann::KNNResultSet<double> resultSet(num_results);
-
-  itk::Point<double, 3> p0;
-
-  unsigned int localBest = 0;
-  unsigned int dataSize = data.size();
+  return transform;
+}
 
-  for (unsigned int i = 0; i < dataSize; ++i)
+template <unsigned int Dimension, typename TTransform>
+double
+LandmarkRegistrationEstimator<Dimension, TTransform>::ComputeSquaredResidual(
+  const typename TTransform::MatrixType &       matrix,
+  const typename TTransform::OutputVectorType & offset,
+  const Point<double, Dimension> &              data) const
+{
+  // Same operations as TransformPoint of the matrix offset transforms
+  double queryPoint[3];
+  for (unsigned int r = 0; r < 3; ++r)
   {
-    // For early stopping. No point running if this condition is true
-    if (localBest + dataSize - i < currentBest)
+    double sum = 0.0;
+    for (unsigned int c = 0; c < 3; ++c)
     {
-      break;
-    }
-    p0[0] = data[i][0];
-    p0[1] = data[i][1];
-    p0[2] = data[i][2];
-
-    auto transformedPoint = transform->TransformPoint(p0);
-
-    query_pt[0] = transformedPoint[0];
-    query_pt[1] = transformedPoint[1];
-    query_pt[2] = transformedPoint[2];
-
-    resultSet.init(&ret_indexes[0], &out_dists_sqr[0]);
-    this->mat_adaptor->index->findNeighbors(resultSet, &query_pt[0], nanoflann::SearchParams(10));
-    // out_dists_sqr is squared distance; delta is Euclidean threshold.
-    bool flag = out_dists_sqr[0] < this->delta * this->delta;
-    if (flag)
-    {
-      localBest++;
-      output[i] = out_dists_sqr[0];
-    }
-    else
-    {
-      output[i] = -1;
+      sum += matrix[r][c] * data[c];
     }
+    queryPoint[r] = sum + offset[r];
   }
 
-  return output;
+  size_t                          index;
+  double                          squaredDistance;
+  nanoflann::KNNResultSet<double> resultSet(1);
+  resultSet.init(&index, &squaredDistance);
+  this->mat_adaptor->index->findNeighbors(resultSet, queryPoint, nanoflann::SearchParams(10));
+  return squaredDistance;
 }
 
 
@@ -89,6 +89,17 @@ public:
   virtual std::vector<double>
   AgreeMultiple(std::vector<SType> & parameters, std::vector<T> & data, unsigned int currentBest) = 0;
 
+  /**
+   * This method tests if all of the selected data agree with the model defined
+   * by the parameters, in the same way as AgreeMultiple. It is used by the
+   * preemptive test of RANSAC to reject a hypothesis before it is scored on
+   * all of the data. The default implementation calls Agree.
+   * @param data The data from which the objects are selected.
+   * @param indexes The indexes of the selected objects.
+   */
+  virtual bool
+  AgreeSubset(std::vector<SType> & parameters, std::vector<T> & data, const std::vector<unsigned int> & indexes);
+
   virtual bool
   CheckCorresspondenceDistance(std::vector<SType> & parameters, std::vector<T *> & data) = 0;
 
@@ -43,6 +43,23 @@ ParametersEstimator<T, SType>::GetMinimalForEstimate()
 }
 
 
+template <typename T, typename SType>
+bool
+ParametersEstimator<T, SType>::AgreeSubset(std::vector<SType> &              parameters,
+                                           std::vector<T> &                  data,
+                                           const std::vector<unsigned int> & indexes)
+{
+  for (unsigned int index : indexes)
+  {
+    if (!this->Agree(parameters, data[index]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+
 } // end namespace itk
 
 #endif //_PARAMETERS_ESTIMATOR_HXX_
@@ -25,6 +25,7 @@
 #include <math.h>
 #include <time.h>
 #include <limits>
+#include <atomic>
 #include "itkParametersEstimator.h"
 #include "itkMultiThreaderBase.h"
 #include <mutex>
@@ -160,6 +161,21 @@ public:
   double
   GetCheckCorrespondenceEdgeLength();
 
+  /**
+   * Set/Get the number of randomly selected agree data objects on which each
+   * hypothesis is first evaluated, the T(d,d) test of Matas and Chum. The
+   * hypothesis is only scored on all the agree data if all of these objects
+   * agree with it. Zero, the default, disables the test.
+   *
+   * Matas J., Chum O., "Randomized RANSAC with T(d,d) test",
+   * Image and Vision Computing, Vol. 22(10), 2004.
+   */
+  void
+  SetPreemptiveTestSize(unsigned int testSize);
+
+  unsigned int
+  GetPreemptiveTestSize();
+
 protected:
   /**
    * Construct an instance of the RANSAC algorithm. The number of threads used
@@ -210,17 +226,20 @@ private:
   unsigned int numberOfThreads;
   unsigned int maxIteration{ std::numeric_limits<unsigned int>::max() };
 
-  bool   checkCorresspondenceDistanceFlag = false;
-  double checkCorrespondenceEdgeLengthTest = 0;
+  bool         checkCorresspondenceDistanceFlag = false;
+  double       checkCorrespondenceEdgeLengthTest = 0;
+  unsigned int preemptiveTestSize = 0;
 
   // the following variables are shared by all threads used in the RANSAC
   // computation
 
   // array corresponding to length of data array, data[i]== true if it
   // agrees with the best model, otherwise false
-  bool *       bestVotes;
-  unsigned int numVotesForBest;
-  double       bestRMSE{ std::numeric_limits<double>::max() };
+  bool * bestVotes;
+  // read without locking by the threads to skip the hypotheses that cannot
+  // be better than the best one, only written while holding resultsMutex
+  std::atomic<unsigned int> numVotesForBest;
+  double                    bestRMSE{ std::numeric_limits<double>::max() };
 
   std::vector<T>      data;
   std::vector<T>      agreeData;
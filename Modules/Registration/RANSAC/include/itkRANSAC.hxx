@@ -86,6 +86,21 @@ RANSAC<T, SType, TTransform>::GetCheckCorrespondenceEdgeLength()
 }
 
 
+template <typename T, typename SType, typename TTransform>
+void
+RANSAC<T, SType, TTransform>::SetPreemptiveTestSize(unsigned int testSize)
+{
+  this->preemptiveTestSize = testSize;
+}
+
+template <typename T, typename SType, typename TTransform>
+unsigned int
+RANSAC<T, SType, TTransform>::GetPreemptiveTestSize()
+{
+  return this->preemptiveTestSize;
+}
+
+
 template <typename T, typename SType, typename TTransform>
 unsigned int
 RANSAC<T, SType, TTransform>::GetNumberOfThreads()
@@ -304,6 +319,10 @@ RANSAC<T, SType, TTransform>::RANSACThreadCallback(void * arg)
     std::random_device rd;
     std::mt19937       randomNumberEngine(rd());
 
+    // indexes of the agree data used by the T(d,d) test
+    std::vector<unsigned int>                   preemptiveIndexes(caller->preemptiveTestSize);
+    std::uniform_int_distribution<unsigned int> agreeIndexDistribution(0, numAgreeObjects - 1);
+
     // true if agreeData[i] agrees with the current model, otherwise false
     bool * curVotes = new bool[numAgreeObjects];
     // true if data[i] is NOT chosen for computing the exact fit, otherwise false
@@ -386,6 +405,20 @@ RANSAC<T, SType, TTransform>::RANSACThreadCallback(void * arg)
           }
         }
 
+        // T(d,d) Test: reject the estimate unless all the randomly selected
+        // agree data objects agree with it
+        if (caller->preemptiveTestSize > 0)
+        {
+          for (auto & index : preemptiveIndexes)
+          {
+            index = agreeIndexDistribution(randomNumberEngine);
+          }
+          if (!caller->paramEstimator->AgreeSubset(exactEstimateParameters, caller->agreeData, preemptiveIndexes))
+          {
+            continue;
+          }
+        }
+
         // see how many agree on this estimate
         numVotesForCur = 0;
         std::fill(curVotes, curVotes + numAgreeObjects, false);
@@ -405,6 +438,11 @@ RANSAC<T, SType, TTransform>::RANSACThreadCallback(void * arg)
           }
         } // found a larger consensus set?
 
+        // the lock is only taken if the estimate may be the best one
+        if (numVotesForCur < caller->numVotesForBest)
+        {
+          continue;
+        }
         caller->resultsMutex.lock();
         if (numVotesForCur > caller->numVotesForBest ||
             (numVotesForCur == caller->numVotesForBest && rmse_value < caller->bestRMSE))
@@ -0,0 +1,199 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkRANSAC.h"
+#include "itkLandmarkRegistrationEstimator.h"
+#include "itkTestingMacros.h"
+#include <random>
+
+/*
+ * Register synthetic correspondences, of which a known fraction are
+ * related by a similarity transform, with and without the T(d,d) test.
+ */
+
+int
+itkRansacTest_PreemptiveScoring(int, char *[])
+{
+  using TransformType = itk::Similarity3DTransform<double>;
+  constexpr unsigned int DimensionPoint = 6;
+  using PointType = itk::Point<double, DimensionPoint>;
+  using RANSACType = itk::RANSAC<PointType, double, TransformType>;
+  using EstimatorType = itk::LandmarkRegistrationEstimator<DimensionPoint, TransformType>;
+
+  auto groundTruth = TransformType::New();
+  TransformType::InputPointType center;
+  center.Fill(50.0);
+  groundTruth->SetCenter(center);
+  TransformType::VersorType rotation;
+  TransformType::AxisType   axis;
+  axis[0] = 0.2;
+  axis[1] = 1.0;
+  axis[2] = 0.3;
+  rotation.Set(axis, 0.4);
+  groundTruth->SetRotation(rotation);
+  TransformType::OutputVectorType translation;
+  translation[0] = 5.0;
+  translation[1] = -3.0;
+  translation[2] = 8.0;
+  groundTruth->SetTranslation(translation);
+  groundTruth->SetScale(1.1);
+
+  // The first numberOfInliers correspondences agree with the ground truth
+  // up to a small noise, the other ones are random.
+  constexpr unsigned int numberOfPoints = 500;
+  constexpr unsigned int numberOfInliers = 200;
+
+  std::mt19937                           randomNumberEngine(1234);
+  std::uniform_real_distribution<double> coordinateDistribution(0.0, 100.0);
+  std::uniform_real_distribution<double> noiseDistribution(-0.05, 0.05);
+
+  std::vector<PointType> data;
+  for (unsigned int i = 0; i < numberOfPoints; ++i)
+  {
+    TransformType::InputPointType fixedPoint;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      fixedPoint[d] = coordinateDistribution(randomNumberEngine);
+    }
+    TransformType::OutputPointType movingPoint;
+    if (i < numberOfInliers)
+    {
+      movingPoint = groundTruth->TransformPoint(fixedPoint);
+      for (unsigned int d = 0; d < 3; ++d)
+      {
+        movingPoint[d] += noiseDistribution(randomNumberEngine);
+      }
+    }
+    else
+    {
+      for (unsigned int d = 0; d < 3; ++d)
+      {
+        movingPoint[d] = coordinateDistribution(randomNumberEngine);
+      }
+    }
+
+    PointType point;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      point[d] = fixedPoint[d];
+      point[d + 3] = movingPoint[d];
+    }
+    data.push_back(point);
+  }
+
+  constexpr double inlierDistance = 0.5;
+  auto             registrationEstimator = EstimatorType::New();
+  registrationEstimator->SetMinimalForEstimate(3);
+  registrationEstimator->SetDelta(inlierDistance);
+  registrationEstimator->SetAgreeData(data);
+
+  // The ground truth agrees with the inliers only.
+  std::vector<double> groundTruthParameters;
+  for (unsigned int i = 0; i < groundTruth->GetNumberOfParameters(); ++i)
+  {
+    groundTruthParameters.push_back(groundTruth->GetParameters()[i]);
+  }
+  for (unsigned int i = 0; i < groundTruth->GetFixedParameters().GetSize(); ++i)
+  {
+    groundTruthParameters.push_back(groundTruth->GetFixedParameters()[i]);
+  }
+  std::vector<unsigned int> inlierIndexes{ 0, 10, 100, 199 };
+  std::vector<unsigned int> mixedIndexes{ 0, 10, 300 };
+  ITK_TEST_EXPECT_TRUE(registrationEstimator->AgreeSubset(groundTruthParameters, data, inlierIndexes));
+  ITK_TEST_EXPECT_TRUE(!registrationEstimator->AgreeSubset(groundTruthParameters, data, mixedIndexes));
+
+  auto agreement = registrationEstimator->AgreeMultiple(groundTruthParameters, data, 0);
+  ITK_TEST_EXPECT_EQUAL(numberOfPoints, agreement.size());
+  for (unsigned int i = 0; i < numberOfInliers; ++i)
+  {
+    if (agreement[i] < 0)
+    {
+      std::cerr << "Test failed: inlier " << i << " does not agree with the ground truth." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  auto ransacEstimator = RANSACType::New();
+  ransacEstimator->SetData(data);
+  ransacEstimator->SetAgreeData(data);
+  ransacEstimator->SetParametersEstimator(registrationEstimator);
+  ransacEstimator->SetMaxIteration(2000);
+  ransacEstimator->SetNumberOfThreads(std::min(2u, itk::MultiThreaderBase::GetGlobalDefaultNumberOfThreads()));
+
+  ITK_TEST_EXPECT_EQUAL(0, ransacEstimator->GetPreemptiveTestSize());
+
+  int testStatus = EXIT_SUCCESS;
+
+  for (unsigned int testSize = 0; testSize <= 2; ++testSize)
+  {
+    ransacEstimator->SetPreemptiveTestSize(testSize);
+    ITK_TEST_EXPECT_EQUAL(testSize, ransacEstimator->GetPreemptiveTestSize());
+
+    std::vector<double> transformParameters;
+    auto                percentageOfDataUsed = ransacEstimator->Compute(transformParameters, 0.99);
+
+    std::cout << "T(" << testSize << ',' << testSize << ") test: percentageOfDataUsed " << percentageOfDataUsed[0]
+              << ", inlier RMSE " << percentageOfDataUsed[1] << std::endl;
+
+    // Some outliers may be close enough to a moving point by chance.
+    const double expectedPercentage = static_cast<double>(numberOfInliers) / numberOfPoints;
+    if (transformParameters.empty() || percentageOfDataUsed[0] < expectedPercentage ||
+        percentageOfDataUsed[0] > expectedPercentage + 0.02)
+    {
+      std::cerr << "Test failed: the consensus set is not the set of inliers." << std::endl;
+      testStatus = EXIT_FAILURE;
+      continue;
+    }
+
+    // The estimate may have another center, so compare the mapped points.
+    auto                               estimate = TransformType::New();
+    TransformType::ParametersType      parameters(estimate->GetNumberOfParameters());
+    TransformType::FixedParametersType fixedParameters(estimate->GetFixedParameters().GetSize());
+    for (unsigned int i = 0; i < parameters.GetSize(); ++i)
+    {
+      parameters[i] = transformParameters[i];
+    }
+    for (unsigned int i = 0; i < fixedParameters.GetSize(); ++i)
+    {
+      fixedParameters[i] = transformParameters[parameters.GetSize() + i];
+    }
+    estimate->SetFixedParameters(fixedParameters);
+    estimate->SetParameters(parameters);
+
+    double maximumError = 0.0;
+    for (unsigned int i = 0; i < numberOfInliers; ++i)
+    {
+      TransformType::InputPointType fixedPoint;
+      for (unsigned int d = 0; d < 3; ++d)
+      {
+        fixedPoint[d] = data[i][d];
+      }
+      const auto expectedPoint = groundTruth->TransformPoint(fixedPoint);
+      maximumError = std::max(maximumError, estimate->TransformPoint(fixedPoint).EuclideanDistanceTo(expectedPoint));
+    }
+    std::cout << "Maximum error of the inliers " << maximumError << std::endl;
+    if (maximumError > 0.1)
+    {
+      std::cerr << "Test failed: the estimate differs from the ground truth." << std::endl;
+      testStatus = EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
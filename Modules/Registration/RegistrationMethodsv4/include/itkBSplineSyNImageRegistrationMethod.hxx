@@ -45,26 +45,26 @@ BSplineSyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform, T
   using BSplineDisplacementFieldTransformAdaptorType =
     BSplineSmoothingOnUpdateDisplacementFieldTransformParametersAdaptor<OutputTransformType>;
 
-  if (level == 0)
+  if (level == this->m_InitialLevel)
   {
     this->m_FixedToMiddleTransform->SetSplineOrder(this->m_OutputTransform->GetSplineOrder());
     this->m_FixedToMiddleTransform->SetNumberOfControlPointsForTheUpdateField(
       dynamic_cast<BSplineDisplacementFieldTransformAdaptorType *>(
-        this->m_TransformParametersAdaptorsPerLevel[0].GetPointer())
+        this->m_TransformParametersAdaptorsPerLevel[level].GetPointer())
         ->GetNumberOfControlPointsForTheUpdateField());
     this->m_FixedToMiddleTransform->SetNumberOfControlPointsForTheTotalField(
       dynamic_cast<BSplineDisplacementFieldTransformAdaptorType *>(
-        this->m_TransformParametersAdaptorsPerLevel[0].GetPointer())
+        this->m_TransformParametersAdaptorsPerLevel[level].GetPointer())
         ->GetNumberOfControlPointsForTheTotalField());
 
     this->m_MovingToMiddleTransform->SetSplineOrder(this->m_OutputTransform->GetSplineOrder());
     this->m_MovingToMiddleTransform->SetNumberOfControlPointsForTheUpdateField(
       dynamic_cast<BSplineDisplacementFieldTransformAdaptorType *>(
-        this->m_TransformParametersAdaptorsPerLevel[0].GetPointer())
+        this->m_TransformParametersAdaptorsPerLevel[level].GetPointer())
         ->GetNumberOfControlPointsForTheUpdateField());
     this->m_MovingToMiddleTransform->SetNumberOfControlPointsForTheTotalField(
       dynamic_cast<BSplineDisplacementFieldTransformAdaptorType *>(
-        this->m_TransformParametersAdaptorsPerLevel[0].GetPointer())
+        this->m_TransformParametersAdaptorsPerLevel[level].GetPointer())
         ->GetNumberOfControlPointsForTheTotalField());
   }
 }
@@ -369,18 +369,16 @@ typename BSplineSyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTra
                                    const WeightedMaskImageType * mask,
                                    const BSplinePointSetType *   gradientPointSet)
 {
-  using DuplicatorType = ImageDuplicator<DisplacementFieldType>;
-  auto duplicator = DuplicatorType::New();
-  duplicator->SetInputImage(field);
-  duplicator->Update();
-
-  DisplacementFieldPointer smoothField = duplicator->GetOutput();
-
   for (unsigned int d = 0; d < numberOfControlPoints.Size(); ++d)
   {
     if (numberOfControlPoints[d] <= 0)
     {
-      return smoothField;
+      using DuplicatorType = ImageDuplicator<DisplacementFieldType>;
+      auto duplicator = DuplicatorType::New();
+      duplicator->SetInputImage(field);
+      duplicator->Update();
+
+      return duplicator->GetOutput();
     }
   }
 
@@ -407,7 +405,7 @@ typename BSplineSyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTra
   bspliner->SetEstimateInverse(false);
   bspliner->Update();
 
-  smoothField = bspliner->GetOutput();
+  DisplacementFieldPointer smoothField = bspliner->GetOutput();
 
   return smoothField;
 }
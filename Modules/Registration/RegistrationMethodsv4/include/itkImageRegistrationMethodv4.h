@@ -341,6 +341,26 @@ public:
   MetricSamplingReinitializeSeed(int seed);
   /** @ITKEndGrouping */
 
+  /** Get the seed that initializes the sampling of the next level.  Together
+   * with the output transform, it is the state to save when the
+   * MultiResolutionIterationEvent is invoked at the beginning of a level in
+   * order to resume the registration from that level later. */
+  itkGetConstMacro(CurrentRandomSeed, int);
+
+  /** Set/Get the level at which the registration starts.  A registration
+   * interrupted at the beginning of a level is resumed from that level by
+   * setting the saved output transform as the initial transform, the saved
+   * seed with MetricSamplingReinitializeSeed(int) and the initial level.
+   * The optimizer and the metric are reinitialized at each level, so the
+   * resumed registration gives the same results as the uninterrupted one,
+   * provided that the settings the optimizer estimates once, such as the
+   * maximum step size of the gradient descent optimizers, are restored too.
+   * Defaults to 0. */
+  /** @ITKStartGrouping */
+  itkSetMacro(InitialLevel, SizeValueType);
+  itkGetConstMacro(InitialLevel, SizeValueType);
+  /** @ITKEndGrouping */
+
   /** Set the metric sampling percentage. Valid values are in (0.0, 1.0] */
   void
   SetMetricSamplingPercentage(const RealType);
@@ -545,6 +565,10 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
+  /** Verify that the initial level is a valid level. */
+  void
+  VerifyPreconditions() const override;
+
   /** Perform the registration. */
   void
   GenerateData() override;
@@ -565,6 +589,7 @@ protected:
   SetMetricSamplePoints();
 
   SizeValueType m_CurrentLevel{};
+  SizeValueType m_InitialLevel{ 0 };
   SizeValueType m_NumberOfLevels{ 0 };
   SizeValueType m_CurrentIteration{};
   RealType      m_CurrentMetricValue{};
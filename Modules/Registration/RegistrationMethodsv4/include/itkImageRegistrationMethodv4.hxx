@@ -269,7 +269,7 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
 
   // Sanity checks and find the virtual domain image
 
-  if (level == 0)
+  if (level == this->m_InitialLevel)
   {
     const SizeValueType numberOfObjectPairs = static_cast<unsigned int>(0.5 * this->GetNumberOfIndexedInputs());
     if (numberOfObjectPairs == 0)
@@ -332,7 +332,7 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
 
   // Set-up the composite transform at initialization
   // Also, find the virtual domain image
-  if (level == 0)
+  if (level == this->m_InitialLevel)
   {
     this->m_CompositeTransform->ClearTransformQueue();
 
@@ -353,7 +353,8 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
     // it into m_CompositeTransform.
     this->m_CompositeTransform->FlattenTransformQueue();
 
-    if (this->m_InitializeCenterOfLinearOutputTransform)
+    // The center of a resumed transform was initialized at the first level.
+    if (this->m_InitializeCenterOfLinearOutputTransform && level == 0)
     {
       this->InitializeCenterOfLinearOutputTransform();
     }
@@ -784,6 +785,19 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
   this->m_OutputTransform = this->GetModifiableTransform();
 }
 
+template <typename TFixedImage, typename TMovingImage, typename TTransform, typename TVirtualImage, typename TPointSet>
+void
+ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage, TPointSet>::VerifyPreconditions() const
+{
+  Superclass::VerifyPreconditions();
+
+  if (this->m_InitialLevel >= this->m_NumberOfLevels)
+  {
+    itkExceptionMacro("The initial level (" << this->m_InitialLevel << ") is not less than the number of levels ("
+                                            << this->m_NumberOfLevels << ").");
+  }
+}
+
 template <typename TFixedImage, typename TMovingImage, typename TTransform, typename TVirtualImage, typename TPointSet>
 void
 ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage, TPointSet>::GenerateData()
@@ -793,7 +807,8 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
   // Ensure the same seed is used for each update
   this->m_CurrentRandomSeed = this->m_RandomSeed;
 
-  for (this->m_CurrentLevel = 0; this->m_CurrentLevel < this->m_NumberOfLevels; this->m_CurrentLevel++)
+  for (this->m_CurrentLevel = this->m_InitialLevel; this->m_CurrentLevel < this->m_NumberOfLevels;
+       this->m_CurrentLevel++)
   {
     this->InitializeRegistrationAtEachLevel(this->m_CurrentLevel);
 
@@ -1116,6 +1131,7 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
   Superclass::PrintSelf(os, indent);
 
   print_helper::PrintNumericTrait(os, indent, "CurrentLevel", m_CurrentLevel);
+  print_helper::PrintNumericTrait(os, indent, "InitialLevel", m_InitialLevel);
   print_helper::PrintNumericTrait(os, indent, "NumberOfLevels", m_NumberOfLevels);
   print_helper::PrintNumericTrait(os, indent, "CurrentIteration", m_CurrentIteration);
   print_helper::PrintNumericTrait(os, indent, "CurrentMetricValue", m_CurrentMetricValue);
@@ -60,7 +60,7 @@ SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform, TVirtual
 {
   Superclass::InitializeRegistrationAtEachLevel(level);
 
-  if (level == 0)
+  if (level == this->m_InitialLevel)
   {
     // If FixedToMiddle and MovingToMiddle transforms are not set already for state restoration
     //
@@ -105,10 +105,10 @@ SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform, TVirtual
           this->m_MovingToMiddleTransform->GetInverseDisplacementField())
       {
         itkDebugMacro("SyN registration is initialized by restoring the state.");
-        this->m_TransformParametersAdaptorsPerLevel[0]->SetTransform(this->m_MovingToMiddleTransform);
-        this->m_TransformParametersAdaptorsPerLevel[0]->AdaptTransformParameters();
-        this->m_TransformParametersAdaptorsPerLevel[0]->SetTransform(this->m_FixedToMiddleTransform);
-        this->m_TransformParametersAdaptorsPerLevel[0]->AdaptTransformParameters();
+        this->m_TransformParametersAdaptorsPerLevel[level]->SetTransform(this->m_MovingToMiddleTransform);
+        this->m_TransformParametersAdaptorsPerLevel[level]->AdaptTransformParameters();
+        this->m_TransformParametersAdaptorsPerLevel[level]->SetTransform(this->m_FixedToMiddleTransform);
+        this->m_TransformParametersAdaptorsPerLevel[level]->AdaptTransformParameters();
       }
       else
       {
@@ -590,10 +590,23 @@ typename SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform,
 
   this->m_Metric->Initialize();
 
+  // The metric derivative of a displacement field transform holds one vector per
+  // voxel, laid out as the pixels of the gradient field, so the metric writes
+  // directly into the buffer of the gradient field instead of a copy of it.
+
+  auto gradientField = DisplacementFieldType::New();
+  gradientField->CopyInformation(virtualDomainImage);
+  gradientField->SetRegions(virtualDomainImage->GetLargestPossibleRegion());
+  gradientField->Allocate();
+
   using MetricDerivativeType = typename ImageMetricType::DerivativeType;
   const typename MetricDerivativeType::SizeValueType metricDerivativeSize =
     virtualDomainImage->GetLargestPossibleRegion().GetNumberOfPixels() * ImageDimension;
-  MetricDerivativeType metricDerivative(metricDerivativeSize);
+  MetricDerivativeType metricDerivative;
+  metricDerivative.SetData(
+    reinterpret_cast<typename MetricDerivativeType::ValueType *>(gradientField->GetBufferPointer()),
+    metricDerivativeSize,
+    false);
 
   metricDerivative.Fill(typename MetricDerivativeType::ValueType{});
   this->m_Metric->GetValueAndDerivative(value, metricDerivative);
@@ -612,26 +625,6 @@ typename SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform,
     }
   }
 
-  // we rescale the update velocity field at each time point.
-  // we first need to convert to a displacement field to look
-  // at the max norm of the field.
-
-  auto gradientField = DisplacementFieldType::New();
-  gradientField->CopyInformation(virtualDomainImage);
-  gradientField->SetRegions(virtualDomainImage->GetRequestedRegion());
-  gradientField->Allocate();
-
-  SizeValueType count = 0;
-  for (ImageRegionIterator ItG(gradientField, gradientField->GetRequestedRegion()); !ItG.IsAtEnd(); ++ItG)
-  {
-    DisplacementVectorType displacement;
-    for (SizeValueType d = 0; d < ImageDimension; ++d)
-    {
-      displacement[d] = metricDerivative[count++];
-    }
-    ItG.Set(displacement);
-  }
-
   return gradientField;
 }
 
@@ -720,18 +713,20 @@ typename SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform,
   SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform, TVirtualImage, TPointSet>::
     GaussianSmoothDisplacementField(const DisplacementFieldType * field, const RealType variance)
 {
-  using DuplicatorType = ImageDuplicator<DisplacementFieldType>;
-  auto duplicator = DuplicatorType::New();
-  duplicator->SetInputImage(field);
-  duplicator->Update();
-
-  DisplacementFieldPointer smoothField = duplicator->GetOutput();
-
   if (variance <= 0.0)
   {
-    return smoothField;
+    using DuplicatorType = ImageDuplicator<DisplacementFieldType>;
+    auto duplicator = DuplicatorType::New();
+    duplicator->SetInputImage(field);
+    duplicator->Update();
+
+    return duplicator->GetOutput();
   }
 
+  // The smoother does not modify its input, so the first pass reads the field
+  // itself rather than a copy of it.
+  DisplacementFieldPointer smoothField = const_cast<DisplacementFieldType *>(field);
+
   using GaussianSmoothingOperatorType = GaussianOperator<RealType, ImageDimension>;
   GaussianSmoothingOperatorType gaussianSmoothingOperator;
 
@@ -817,7 +812,8 @@ SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform, TVirtual
 {
   this->AllocateOutputs();
 
-  for (this->m_CurrentLevel = 0; this->m_CurrentLevel < this->m_NumberOfLevels; this->m_CurrentLevel++)
+  for (this->m_CurrentLevel = this->m_InitialLevel; this->m_CurrentLevel < this->m_NumberOfLevels;
+       this->m_CurrentLevel++)
   {
     this->InitializeRegistrationAtEachLevel(this->m_CurrentLevel);
 
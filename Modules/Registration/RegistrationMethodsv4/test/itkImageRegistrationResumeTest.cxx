@@ -0,0 +1,326 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegistrationMethodv4.h"
+#include "itkSyNImageRegistrationMethod.h"
+#include "itkAffineTransform.h"
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkGradientDescentOptimizerv4.h"
+#include "itkRegistrationParameterScalesFromPhysicalShift.h"
+#include "itkHDF5TransformIOFactory.h"
+#include "itkTransformFileReader.h"
+#include "itkTransformFileWriter.h"
+#include "itkImageDuplicator.h"
+#include "itkDisplacementFieldTransformParametersAdaptor.h"
+#include "itkShrinkImageFilter.h"
+#include "itkTestingMacros.h"
+
+/*
+ * Interrupt multi-level affine and SyN registrations at the beginning of a
+ * level, save their state, and check that the registrations resumed from
+ * the saved states give the same results as the uninterrupted ones.
+ */
+
+namespace
+{
+constexpr unsigned int Dimension = 2;
+using ImageType = itk::Image<float, Dimension>;
+
+ImageType::Pointer
+MakeEllipse(double centerX, double centerY, double radiusX, double radiusY)
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 64 } });
+  image->Allocate();
+
+  for (itk::ImageRegionIteratorWithIndex<ImageType> It(image, image->GetBufferedRegion()); !It.IsAtEnd(); ++It)
+  {
+    const double x = (It.GetIndex()[0] - centerX) / radiusX;
+    const double y = (It.GetIndex()[1] - centerY) / radiusY;
+    It.Set(static_cast<float>(100.0 * std::exp(-2.0 * (x * x + y * y))));
+  }
+  return image;
+}
+
+template <typename TRegistration>
+void
+SetLevels(TRegistration * registration)
+{
+  typename TRegistration::ShrinkFactorsArrayType shrinkFactorsPerLevel;
+  shrinkFactorsPerLevel.SetSize(3);
+  shrinkFactorsPerLevel[0] = 4;
+  shrinkFactorsPerLevel[1] = 2;
+  shrinkFactorsPerLevel[2] = 1;
+  typename TRegistration::SmoothingSigmasArrayType smoothingSigmasPerLevel;
+  smoothingSigmasPerLevel.SetSize(3);
+  smoothingSigmasPerLevel[0] = 2;
+  smoothingSigmasPerLevel[1] = 1;
+  smoothingSigmasPerLevel[2] = 0;
+
+  registration->SetNumberOfLevels(3);
+  registration->SetShrinkFactorsPerLevel(shrinkFactorsPerLevel);
+  registration->SetSmoothingSigmasPerLevel(smoothingSigmasPerLevel);
+}
+
+using AffineTransformType = itk::AffineTransform<double, Dimension>;
+using AffineRegistrationType = itk::ImageRegistrationMethodv4<ImageType, ImageType, AffineTransformType>;
+
+AffineRegistrationType::Pointer
+MakeAffineRegistration(const ImageType * fixedImage, const ImageType * movingImage)
+{
+  using MetricType = itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType>;
+  auto metric = MetricType::New();
+
+  using ScalesEstimatorType = itk::RegistrationParameterScalesFromPhysicalShift<MetricType>;
+  auto scalesEstimator = ScalesEstimatorType::New();
+  scalesEstimator->SetMetric(metric);
+  scalesEstimator->SetTransformForward(true);
+
+  using OptimizerType = itk::GradientDescentOptimizerv4;
+  auto optimizer = OptimizerType::New();
+  optimizer->SetLearningRate(1.0);
+  optimizer->SetNumberOfIterations(30);
+  optimizer->SetScalesEstimator(scalesEstimator);
+  optimizer->SetDoEstimateLearningRateOnce(true);
+
+  auto registration = AffineRegistrationType::New();
+  registration->SetFixedImage(fixedImage);
+  registration->SetMovingImage(movingImage);
+  registration->SetMetric(metric);
+  registration->SetOptimizer(optimizer);
+  SetLevels(registration.GetPointer());
+  registration->SetMetricSamplingStrategy(AffineRegistrationType::MetricSamplingStrategyEnum::RANDOM);
+  registration->SetMetricSamplingPercentage(0.5);
+  registration->MetricSamplingReinitializeSeed(1234);
+  return registration;
+}
+
+using SyNRegistrationType = itk::SyNImageRegistrationMethod<ImageType, ImageType>;
+using DisplacementFieldTransformType = SyNRegistrationType::OutputTransformType;
+
+SyNRegistrationType::Pointer
+MakeSyNRegistration(const ImageType * fixedImage, const ImageType * movingImage)
+{
+  typename SyNRegistrationType::NumberOfIterationsArrayType numberOfIterationsPerLevel;
+  numberOfIterationsPerLevel.SetSize(3);
+  numberOfIterationsPerLevel.Fill(10);
+
+  auto registration = SyNRegistrationType::New();
+  registration->SetFixedImage(fixedImage);
+  registration->SetMovingImage(movingImage);
+  SetLevels(registration.GetPointer());
+  registration->SetNumberOfIterationsPerLevel(numberOfIterationsPerLevel);
+  registration->SetLearningRate(0.25);
+
+  // The displacement fields are resampled on the virtual domain of each level.
+  auto displacementField = SyNRegistrationType::DisplacementFieldType::New();
+  displacementField->CopyInformation(fixedImage);
+  displacementField->SetRegions(fixedImage->GetBufferedRegion());
+  displacementField->AllocateInitialized();
+  auto outputTransform = DisplacementFieldTransformType::New();
+  outputTransform->SetDisplacementField(displacementField);
+  registration->SetInitialTransform(outputTransform);
+  registration->InPlaceOn();
+
+  typename SyNRegistrationType::TransformParametersAdaptorsContainerType adaptors;
+  for (unsigned int level = 0; level < 3; ++level)
+  {
+    using ShrinkFilterType = itk::ShrinkImageFilter<ImageType, ImageType>;
+    auto shrinkFilter = ShrinkFilterType::New();
+    shrinkFilter->SetShrinkFactors(registration->GetShrinkFactorsPerDimension(level));
+    shrinkFilter->SetInput(fixedImage);
+    shrinkFilter->UpdateOutputInformation();
+    const ImageType * shrunkImage = shrinkFilter->GetOutput();
+
+    using AdaptorType = itk::DisplacementFieldTransformParametersAdaptor<DisplacementFieldTransformType>;
+    auto adaptor = AdaptorType::New();
+    adaptor->SetRequiredSpacing(shrunkImage->GetSpacing());
+    adaptor->SetRequiredSize(shrunkImage->GetLargestPossibleRegion().GetSize());
+    adaptor->SetRequiredDirection(shrunkImage->GetDirection());
+    adaptor->SetRequiredOrigin(shrunkImage->GetOrigin());
+    adaptors.push_back(adaptor);
+  }
+  registration->SetTransformParametersAdaptorsPerLevel(adaptors);
+  return registration;
+}
+
+// Deep copy of a displacement field transform and of its inverse field.
+DisplacementFieldTransformType::Pointer
+CopyDisplacementFieldTransform(const DisplacementFieldTransformType * transform)
+{
+  using DuplicatorType = itk::ImageDuplicator<DisplacementFieldTransformType::DisplacementFieldType>;
+  auto copy = DisplacementFieldTransformType::New();
+  auto duplicator = DuplicatorType::New();
+  duplicator->SetInputImage(transform->GetDisplacementField());
+  duplicator->Update();
+  copy->SetDisplacementField(duplicator->GetOutput());
+  if (transform->GetInverseDisplacementField())
+  {
+    auto inverseDuplicator = DuplicatorType::New();
+    inverseDuplicator->SetInputImage(transform->GetInverseDisplacementField());
+    inverseDuplicator->Update();
+    copy->SetInverseDisplacementField(inverseDuplicator->GetOutput());
+  }
+  return copy;
+}
+
+// Saves the state of the registration at the beginning of the checkpoint level.
+template <typename TRegistration>
+class CheckpointCommand : public itk::Command
+{
+public:
+  using Self = CheckpointCommand;
+  using Superclass = itk::Command;
+  using Pointer = itk::SmartPointer<Self>;
+  itkNewMacro(Self);
+
+  void
+  Execute(itk::Object * caller, const itk::EventObject & event) override
+  {
+    Execute((const itk::Object *)caller, event);
+  }
+
+  void
+  Execute(const itk::Object * object, const itk::EventObject &) override
+  {
+    const auto * registration = dynamic_cast<const TRegistration *>(object);
+    if (registration->GetCurrentLevel() != m_CheckpointLevel)
+    {
+      return;
+    }
+    m_RandomSeed = registration->GetCurrentRandomSeed();
+    if constexpr (std::is_same_v<TRegistration, AffineRegistrationType>)
+    {
+      // The maximum step size is estimated at the first level only.
+      const auto * optimizer = dynamic_cast<const itk::GradientDescentOptimizerv4 *>(registration->GetOptimizer());
+      m_MaximumStepSize = optimizer->GetMaximumStepSizeInPhysicalUnits();
+
+      auto writer = itk::TransformFileWriter::New();
+      writer->SetInput(registration->GetTransform());
+      writer->SetFileName(m_FileName);
+      writer->Update();
+    }
+    else
+    {
+      m_OutputTransform = CopyDisplacementFieldTransform(registration->GetTransform());
+      m_FixedToMiddleTransform = CopyDisplacementFieldTransform(registration->GetFixedToMiddleTransform());
+      m_MovingToMiddleTransform = CopyDisplacementFieldTransform(registration->GetMovingToMiddleTransform());
+    }
+  }
+
+  itk::SizeValueType                      m_CheckpointLevel{ 1 };
+  std::string                             m_FileName;
+  int                                     m_RandomSeed{ 0 };
+  double                                  m_MaximumStepSize{ 0.0 };
+  DisplacementFieldTransformType::Pointer m_OutputTransform;
+  DisplacementFieldTransformType::Pointer m_FixedToMiddleTransform;
+  DisplacementFieldTransformType::Pointer m_MovingToMiddleTransform;
+};
+} // namespace
+
+int
+itkImageRegistrationResumeTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing parameters." << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " checkpointTransformFile" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  itk::ObjectFactoryBase::RegisterFactory(itk::HDF5TransformIOFactory::New());
+
+  const ImageType::Pointer fixedImage = MakeEllipse(30.0, 32.0, 12.0, 8.0);
+  const ImageType::Pointer movingImage = MakeEllipse(34.0, 30.0, 10.0, 9.0);
+
+  int testStatus = EXIT_SUCCESS;
+
+  // Affine registration, checkpointed to a transform file.
+  auto affineRegistration = MakeAffineRegistration(fixedImage, movingImage);
+  ITK_TEST_SET_GET_VALUE(0, affineRegistration->GetInitialLevel());
+  auto affineCheckpoint = CheckpointCommand<AffineRegistrationType>::New();
+  affineCheckpoint->m_FileName = argv[1];
+  affineRegistration->AddObserver(itk::MultiResolutionIterationEvent(), affineCheckpoint);
+  ITK_TRY_EXPECT_NO_EXCEPTION(affineRegistration->Update());
+
+  auto reader = itk::TransformFileReader::New();
+  reader->SetFileName(argv[1]);
+  ITK_TRY_EXPECT_NO_EXCEPTION(reader->Update());
+  auto * checkpointTransform = dynamic_cast<AffineTransformType *>(reader->GetTransformList()->front().GetPointer());
+  ITK_TEST_EXPECT_TRUE(checkpointTransform != nullptr);
+
+  auto resumedAffineRegistration = MakeAffineRegistration(fixedImage, movingImage);
+  resumedAffineRegistration->SetInitialTransform(checkpointTransform);
+  resumedAffineRegistration->SetInitialLevel(affineCheckpoint->m_CheckpointLevel);
+  ITK_TEST_SET_GET_VALUE(affineCheckpoint->m_CheckpointLevel, resumedAffineRegistration->GetInitialLevel());
+  resumedAffineRegistration->MetricSamplingReinitializeSeed(affineCheckpoint->m_RandomSeed);
+  dynamic_cast<itk::GradientDescentOptimizerv4 *>(resumedAffineRegistration->GetModifiableOptimizer())
+    ->SetMaximumStepSizeInPhysicalUnits(affineCheckpoint->m_MaximumStepSize);
+  ITK_TRY_EXPECT_NO_EXCEPTION(resumedAffineRegistration->Update());
+
+  std::cout << "Affine parameters: " << affineRegistration->GetTransform()->GetParameters() << std::endl;
+  std::cout << "Resumed affine parameters: " << resumedAffineRegistration->GetTransform()->GetParameters()
+            << std::endl;
+  if (affineRegistration->GetTransform()->GetParameters() !=
+        resumedAffineRegistration->GetTransform()->GetParameters() ||
+      itk::Math::NotExactlyEquals(affineRegistration->GetCurrentMetricValue(),
+                                  resumedAffineRegistration->GetCurrentMetricValue()))
+  {
+    std::cerr << "Test failed: the resumed affine registration differs from the uninterrupted one." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // SyN registration, checkpointed in memory.
+  auto synRegistration = MakeSyNRegistration(fixedImage, movingImage);
+  auto synCheckpoint = CheckpointCommand<SyNRegistrationType>::New();
+  synCheckpoint->m_CheckpointLevel = 2;
+  synRegistration->AddObserver(itk::MultiResolutionIterationEvent(), synCheckpoint);
+  ITK_TRY_EXPECT_NO_EXCEPTION(synRegistration->Update());
+
+  auto resumedSyNRegistration = MakeSyNRegistration(fixedImage, movingImage);
+  resumedSyNRegistration->SetInitialTransform(synCheckpoint->m_OutputTransform);
+  resumedSyNRegistration->SetFixedToMiddleTransform(synCheckpoint->m_FixedToMiddleTransform);
+  resumedSyNRegistration->SetMovingToMiddleTransform(synCheckpoint->m_MovingToMiddleTransform);
+  resumedSyNRegistration->SetInitialLevel(synCheckpoint->m_CheckpointLevel);
+  resumedSyNRegistration->MetricSamplingReinitializeSeed(synCheckpoint->m_RandomSeed);
+  ITK_TRY_EXPECT_NO_EXCEPTION(resumedSyNRegistration->Update());
+
+  const auto * field = synRegistration->GetTransform()->GetDisplacementField();
+  const auto * resumedField = resumedSyNRegistration->GetTransform()->GetDisplacementField();
+  bool         sameFields = field->GetLargestPossibleRegion() == resumedField->GetLargestPossibleRegion();
+  for (itk::ImageRegionConstIteratorWithIndex<SyNRegistrationType::DisplacementFieldType> It(
+         field, field->GetLargestPossibleRegion());
+       sameFields && !It.IsAtEnd();
+       ++It)
+  {
+    sameFields = It.Get() == resumedField->GetPixel(It.GetIndex());
+  }
+  if (!sameFields)
+  {
+    std::cerr << "Test failed: the resumed SyN registration differs from the uninterrupted one." << std::endl;
+    testStatus = EXIT_FAILURE;
+  }
+
+  // A registration cannot start after its last level.
+  auto invalidRegistration = MakeAffineRegistration(fixedImage, movingImage);
+  invalidRegistration->SetInitialLevel(3);
+  ITK_TRY_EXPECT_EXCEPTION(invalidRegistration->Update());
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
@@ -0,0 +1,236 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkSyNImageRegistrationMethod.h"
+#include "itkBSplineSyNImageRegistrationMethod.h"
+#include "itkBSplineSmoothingOnUpdateDisplacementFieldTransformParametersAdaptor.h"
+#include "itkANTSNeighborhoodCorrelationImageToImageMetricv4.h"
+#include "itkMemoryUsageObserver.h"
+#include "itkTestingMacros.h"
+
+/*
+ * Run the same SyN and B-spline SyN registrations with single and double
+ * precision displacement fields, compare the results, and report the memory
+ * used during each run.
+ */
+
+namespace
+{
+constexpr unsigned int Dimension = 2;
+using ImageType = itk::Image<float, Dimension>;
+
+ImageType::Pointer
+MakeEllipse(double centerX, double centerY, double radiusX, double radiusY)
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 64, 64 } });
+  image->Allocate();
+
+  for (itk::ImageRegionIteratorWithIndex<ImageType> It(image, image->GetBufferedRegion()); !It.IsAtEnd(); ++It)
+  {
+    const double x = (It.GetIndex()[0] - centerX) / radiusX;
+    const double y = (It.GetIndex()[1] - centerY) / radiusY;
+    It.Set(static_cast<float>(100.0 * std::exp(-2.0 * (x * x + y * y))));
+  }
+  return image;
+}
+
+// Samples the memory used by the process at each iteration.
+class MemoryUsageCommand : public itk::Command
+{
+public:
+  using Self = MemoryUsageCommand;
+  using Superclass = itk::Command;
+  using Pointer = itk::SmartPointer<Self>;
+  itkNewMacro(Self);
+
+  void
+  Execute(itk::Object * caller, const itk::EventObject & event) override
+  {
+    Execute((const itk::Object *)caller, event);
+  }
+
+  void
+  Execute(const itk::Object *, const itk::EventObject &) override
+  {
+    m_PeakMemoryUsage = std::max(m_PeakMemoryUsage, m_Observer.GetMemoryUsage());
+  }
+
+  itk::MemoryUsageObserver::MemoryLoadType m_PeakMemoryUsage{ 0 };
+
+private:
+  itk::MemoryUsageObserver m_Observer;
+};
+
+template <typename TRegistration>
+typename TRegistration::OutputTransformType::DisplacementFieldType::Pointer
+Register(const ImageType * fixedImage, const ImageType * movingImage, double & metricValue)
+{
+  using RealType = typename TRegistration::RealType;
+
+  itk::MemoryUsageObserver                       observer;
+  const itk::MemoryUsageObserver::MemoryLoadType memoryBefore = observer.GetMemoryUsage();
+
+  using MetricType = itk::ANTSNeighborhoodCorrelationImageToImageMetricv4<ImageType, ImageType, ImageType, RealType>;
+  auto metric = MetricType::New();
+  metric->SetRadius(itk::MakeFilled<typename MetricType::RadiusType>(2));
+  metric->SetUseMovingImageGradientFilter(false);
+  metric->SetUseFixedImageGradientFilter(false);
+
+  typename TRegistration::ShrinkFactorsArrayType shrinkFactorsPerLevel;
+  shrinkFactorsPerLevel.SetSize(1);
+  shrinkFactorsPerLevel[0] = 1;
+  typename TRegistration::SmoothingSigmasArrayType smoothingSigmasPerLevel;
+  smoothingSigmasPerLevel.SetSize(1);
+  smoothingSigmasPerLevel[0] = 0;
+  typename TRegistration::NumberOfIterationsArrayType numberOfIterationsPerLevel;
+  numberOfIterationsPerLevel.SetSize(1);
+  numberOfIterationsPerLevel[0] = 20;
+
+  auto registration = TRegistration::New();
+  registration->SetFixedImage(fixedImage);
+  registration->SetMovingImage(movingImage);
+  registration->SetMetric(metric);
+  registration->SetNumberOfLevels(1);
+  registration->SetShrinkFactorsPerLevel(shrinkFactorsPerLevel);
+  registration->SetSmoothingSigmasPerLevel(smoothingSigmasPerLevel);
+  registration->SetNumberOfIterationsPerLevel(numberOfIterationsPerLevel);
+  registration->SetLearningRate(0.25);
+  // The convergence monitoring of both precisions would not stop at the same
+  // iteration, so all the iterations are run.
+  registration->SetConvergenceWindowSize(numberOfIterationsPerLevel[0] + 1);
+
+  // The B-spline SyN registration reads the mesh sizes from the adaptor of the
+  // first level, which adapts the initial fields.
+  using OutputTransformType = typename TRegistration::OutputTransformType;
+  if constexpr (std::is_same_v<OutputTransformType,
+                               itk::BSplineSmoothingOnUpdateDisplacementFieldTransform<RealType, Dimension>>)
+  {
+    using DisplacementFieldType = typename OutputTransformType::DisplacementFieldType;
+    auto displacementField = DisplacementFieldType::New();
+    displacementField->CopyInformation(fixedImage);
+    displacementField->SetRegions(fixedImage->GetBufferedRegion());
+    displacementField->AllocateInitialized();
+    auto inverseDisplacementField = DisplacementFieldType::New();
+    inverseDisplacementField->CopyInformation(fixedImage);
+    inverseDisplacementField->SetRegions(fixedImage->GetBufferedRegion());
+    inverseDisplacementField->AllocateInitialized();
+
+    auto outputTransform = OutputTransformType::New();
+    outputTransform->SetDisplacementField(displacementField);
+    outputTransform->SetInverseDisplacementField(inverseDisplacementField);
+    registration->SetInitialTransform(outputTransform);
+    registration->InPlaceOn();
+
+    using AdaptorType = itk::BSplineSmoothingOnUpdateDisplacementFieldTransformParametersAdaptor<OutputTransformType>;
+    auto adaptor = AdaptorType::New();
+    adaptor->SetTransform(outputTransform);
+    adaptor->SetRequiredSpacing(fixedImage->GetSpacing());
+    adaptor->SetRequiredSize(fixedImage->GetBufferedRegion().GetSize());
+    adaptor->SetRequiredDirection(fixedImage->GetDirection());
+    adaptor->SetRequiredOrigin(fixedImage->GetOrigin());
+    adaptor->SetMeshSizeForTheUpdateField(itk::MakeFilled<typename OutputTransformType::ArrayType>(8));
+    adaptor->SetMeshSizeForTheTotalField(itk::MakeFilled<typename OutputTransformType::ArrayType>(0));
+
+    typename TRegistration::TransformParametersAdaptorsContainerType adaptors;
+    adaptors.push_back(adaptor);
+    registration->SetTransformParametersAdaptorsPerLevel(adaptors);
+  }
+
+  auto memoryUsageCommand = MemoryUsageCommand::New();
+  registration->AddObserver(itk::IterationEvent(), memoryUsageCommand);
+
+  registration->Update();
+
+  std::cout << "  " << registration->GetNameOfClass() << " with " << sizeof(RealType)
+            << "-byte fields: metric value " << registration->GetCurrentMetricValue() << ", peak memory usage "
+            << memoryUsageCommand->m_PeakMemoryUsage - memoryBefore << " KB" << std::endl;
+
+  metricValue = registration->GetCurrentMetricValue();
+  return registration->GetModifiableTransform()->GetModifiableDisplacementField();
+}
+
+template <typename TDoubleRegistration, typename TFloatRegistration>
+bool
+CompareRegistrations(const ImageType * fixedImage, const ImageType * movingImage)
+{
+  double     doubleMetricValue = 0.0;
+  double     floatMetricValue = 0.0;
+  const auto doubleField = Register<TDoubleRegistration>(fixedImage, movingImage, doubleMetricValue);
+  const auto floatField = Register<TFloatRegistration>(fixedImage, movingImage, floatMetricValue);
+
+  double maximumDisplacement = 0.0;
+  double maximumDifference = 0.0;
+  for (itk::ImageRegionConstIteratorWithIndex<typename TDoubleRegistration::DisplacementFieldType> It(
+         doubleField, doubleField->GetBufferedRegion());
+       !It.IsAtEnd();
+       ++It)
+  {
+    const auto floatDisplacement = floatField->GetPixel(It.GetIndex());
+    for (unsigned int d = 0; d < Dimension; ++d)
+    {
+      maximumDisplacement = std::max(maximumDisplacement, itk::Math::abs(It.Get()[d]));
+      maximumDifference = std::max(maximumDifference, itk::Math::abs(It.Get()[d] - floatDisplacement[d]));
+    }
+  }
+  std::cout << "  Maximum displacement " << maximumDisplacement << ", maximum difference " << maximumDifference
+            << std::endl;
+
+  // The registration must have moved the ellipse, and both precisions must
+  // lead to the same field.
+  if (maximumDisplacement < 1.0 || maximumDifference > 1e-3 * maximumDisplacement ||
+      itk::Math::abs(floatMetricValue - doubleMetricValue) > 1e-4 * itk::Math::abs(doubleMetricValue))
+  {
+    std::cerr << "Test failed: the single and double precision registrations differ." << std::endl;
+    return false;
+  }
+  return true;
+}
+} // namespace
+
+int
+itkSyNImageRegistrationSinglePrecisionTest(int, char *[])
+{
+  const ImageType::Pointer fixedImage = MakeEllipse(30.0, 32.0, 12.0, 8.0);
+  const ImageType::Pointer movingImage = MakeEllipse(34.0, 30.0, 9.0, 10.0);
+
+  int testStatus = EXIT_SUCCESS;
+
+  std::cout << "SyN" << std::endl;
+  using DoubleSyNType = itk::SyNImageRegistrationMethod<ImageType, ImageType>;
+  using FloatSyNType =
+    itk::SyNImageRegistrationMethod<ImageType, ImageType, itk::DisplacementFieldTransform<float, Dimension>>;
+  if (!CompareRegistrations<DoubleSyNType, FloatSyNType>(fixedImage, movingImage))
+  {
+    testStatus = EXIT_FAILURE;
+  }
+
+  std::cout << "B-spline SyN" << std::endl;
+  using DoubleBSplineSyNType = itk::BSplineSyNImageRegistrationMethod<ImageType, ImageType>;
+  using FloatBSplineSyNType = itk::BSplineSyNImageRegistrationMethod<
+    ImageType,
+    ImageType,
+    itk::BSplineSmoothingOnUpdateDisplacementFieldTransform<float, Dimension>>;
+  if (!CompareRegistrations<DoubleBSplineSyNType, FloatBSplineSyNType>(fixedImage, movingImage))
+  {
+    testStatus = EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return testStatus;
+}
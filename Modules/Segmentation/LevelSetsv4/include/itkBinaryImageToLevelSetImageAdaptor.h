@@ -31,6 +31,9 @@
 #include "itkShiSparseLevelSetImage.h"
 #include "itkMalcolmSparseLevelSetImage.h"
 
+#include "itkWhitakerSparseBlockLevelSetImage.h"
+#include "itkShiSparseBlockLevelSetImage.h"
+
 namespace itk
 {
 /**
@@ -430,6 +433,99 @@ protected:
   CreateMinimalInterface();
 };
 
+////////////////////////////////////////////////////////////////////////////////
+/** \brief Partial template specialization for WhitakerSparseBlockLevelSetImage
+ *
+ * The layers are computed as for WhitakerSparseLevelSetImage, and the grids of
+ * the level set are then built from the layers and the label map.
+ */
+template <typename TInput, typename TOutput>
+class ITK_TEMPLATE_EXPORT
+  BinaryImageToLevelSetImageAdaptor<TInput, WhitakerSparseBlockLevelSetImage<TOutput, TInput::ImageDimension>>
+  : public BinaryImageToLevelSetImageAdaptorBase<TInput,
+                                                 WhitakerSparseBlockLevelSetImage<TOutput, TInput::ImageDimension>>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(BinaryImageToLevelSetImageAdaptor);
+
+  using LevelSetType = WhitakerSparseBlockLevelSetImage<TOutput, TInput::ImageDimension>;
+
+  using Self = BinaryImageToLevelSetImageAdaptor;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using Superclass = BinaryImageToLevelSetImageAdaptorBase<TInput, LevelSetType>;
+
+  /** Method for creation through object factory */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(BinaryImageToLevelSetImageAdaptor);
+
+  using typename Superclass::InputImageType;
+  using typename Superclass::LevelSetPointer;
+
+  static constexpr unsigned int ImageDimension = InputImageType::ImageDimension;
+
+  using SparseLevelSetType = WhitakerSparseLevelSetImage<TOutput, ImageDimension>;
+  using SparseAdaptorType = BinaryImageToLevelSetImageAdaptor<InputImageType, SparseLevelSetType>;
+
+  void
+  Initialize() override;
+
+protected:
+  /** Constructor */
+  BinaryImageToLevelSetImageAdaptor() = default;
+
+  /** Destructor */
+  ~BinaryImageToLevelSetImageAdaptor() override = default;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/** \brief Partial template specialization for ShiSparseBlockLevelSetImage
+ *
+ * The layers are computed as for ShiSparseLevelSetImage, and the status grid
+ * of the level set is then built from the label map.
+ */
+template <typename TInput>
+class ITK_TEMPLATE_EXPORT
+  BinaryImageToLevelSetImageAdaptor<TInput, ShiSparseBlockLevelSetImage<TInput::ImageDimension>>
+  : public BinaryImageToLevelSetImageAdaptorBase<TInput, ShiSparseBlockLevelSetImage<TInput::ImageDimension>>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(BinaryImageToLevelSetImageAdaptor);
+
+  using LevelSetType = ShiSparseBlockLevelSetImage<TInput::ImageDimension>;
+
+  using Self = BinaryImageToLevelSetImageAdaptor;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using Superclass = BinaryImageToLevelSetImageAdaptorBase<TInput, LevelSetType>;
+
+  /** Method for creation through object factory */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(BinaryImageToLevelSetImageAdaptor);
+
+  using typename Superclass::InputImageType;
+  using typename Superclass::LevelSetPointer;
+
+  static constexpr unsigned int ImageDimension = InputImageType::ImageDimension;
+
+  using SparseLevelSetType = ShiSparseLevelSetImage<ImageDimension>;
+  using SparseAdaptorType = BinaryImageToLevelSetImageAdaptor<InputImageType, SparseLevelSetType>;
+
+  void
+  Initialize() override;
+
+protected:
+  /** Constructor */
+  BinaryImageToLevelSetImageAdaptor() = default;
+
+  /** Destructor */
+  ~BinaryImageToLevelSetImageAdaptor() override = default;
+};
+
 } // namespace itk
 
 #ifndef ITK_MANUAL_INSTANTIATION
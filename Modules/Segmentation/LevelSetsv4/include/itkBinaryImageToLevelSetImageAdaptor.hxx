@@ -663,6 +663,43 @@ BinaryImageToLevelSetImageAdaptor<TInput, MalcolmSparseLevelSetImage<TInput::Ima
     }
   }
 }
+template <typename TInput, typename TOutput>
+void
+BinaryImageToLevelSetImageAdaptor<TInput,
+                                  WhitakerSparseBlockLevelSetImage<TOutput, TInput::ImageDimension>>::Initialize()
+{
+  const typename SparseAdaptorType::Pointer adaptor = SparseAdaptorType::New();
+  adaptor->SetInputImage(this->m_InputImage);
+  adaptor->Initialize();
+
+  const typename SparseLevelSetType::Pointer sparseLevelSet = adaptor->GetModifiableLevelSet();
+
+  for (auto status = LevelSetType::MinusTwoLayer(); status <= LevelSetType::PlusTwoLayer(); ++status)
+  {
+    std::swap(this->m_LevelSet->GetLayer(status), sparseLevelSet->GetLayer(status));
+  }
+
+  // The grids are built from the layers
+  this->m_LevelSet->SetLabelMap(sparseLevelSet->GetModifiableLabelMap());
+}
+
+template <typename TInput>
+void
+BinaryImageToLevelSetImageAdaptor<TInput, ShiSparseBlockLevelSetImage<TInput::ImageDimension>>::Initialize()
+{
+  const typename SparseAdaptorType::Pointer adaptor = SparseAdaptorType::New();
+  adaptor->SetInputImage(this->m_InputImage);
+  adaptor->Initialize();
+
+  const typename SparseLevelSetType::Pointer sparseLevelSet = adaptor->GetModifiableLevelSet();
+
+  std::swap(this->m_LevelSet->GetLayer(LevelSetType::MinusOneLayer()),
+            sparseLevelSet->GetLayer(LevelSetType::MinusOneLayer()));
+  std::swap(this->m_LevelSet->GetLayer(LevelSetType::PlusOneLayer()),
+            sparseLevelSet->GetLayer(LevelSetType::PlusOneLayer()));
+
+  this->m_LevelSet->SetLabelMap(sparseLevelSet->GetModifiableLabelMap());
+}
 } // namespace itk
 
 #endif // itkBinaryImageToLevelSetImageAdaptor_hxx
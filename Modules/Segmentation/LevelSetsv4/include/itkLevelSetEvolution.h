@@ -30,6 +30,12 @@
 #include "itkMalcolmSparseLevelSetImage.h"
 #include "itkUpdateMalcolmSparseLevelSet.h"
 
+#include "itkWhitakerSparseBlockLevelSetImage.h"
+#include "itkUpdateWhitakerSparseBlockLevelSet.h"
+
+#include "itkShiSparseBlockLevelSetImage.h"
+#include "itkUpdateShiSparseBlockLevelSet.h"
+
 #include "itkLevelSetEvolutionComputeIterationThreader.h"
 #include "itkLevelSetEvolutionUpdateLevelSetsThreader.h"
 
@@ -265,9 +271,11 @@ protected:
   ~LevelSetEvolution() override;
 
   using NodePairType = std::pair<LevelSetInputType, LevelSetOutputType>;
+  using LevelSetUpdateBufferType = typename UpdateLevelSetFilterType::LevelSetUpdateType;
 
-  // For sparse case, the update buffer needs to be the size of the active layer
-  std::map<IdentifierType, LevelSetLayerType *> m_UpdateBuffer{};
+  // For sparse case, the update buffer needs to be the size of the active layer.
+  // It is sorted like the active layer.
+  std::map<IdentifierType, LevelSetUpdateBufferType *> m_UpdateBuffer{};
 
   /** Initialize the update buffers for all level sets to hold the updates of
    *  equations in each iteration */
@@ -376,6 +384,99 @@ protected:
   UpdateEquations() override;
 };
 
+// Whitaker, block-backed
+template <typename TEquationContainer, typename TOutput, unsigned int VDimension>
+class ITK_TEMPLATE_EXPORT LevelSetEvolution<TEquationContainer, WhitakerSparseBlockLevelSetImage<TOutput, VDimension>>
+  : public LevelSetEvolution<TEquationContainer, WhitakerSparseLevelSetImage<TOutput, VDimension>>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(LevelSetEvolution);
+
+  using LevelSetType = WhitakerSparseBlockLevelSetImage<TOutput, VDimension>;
+
+  using Self = LevelSetEvolution;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using Superclass = LevelSetEvolution<TEquationContainer, WhitakerSparseLevelSetImage<TOutput, VDimension>>;
+
+  /** Method for creation through object factory */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(LevelSetEvolution);
+
+  using typename Superclass::EquationContainerType;
+  using typename Superclass::LevelSetContainerType;
+  using typename Superclass::LevelSetOutputType;
+
+  static constexpr unsigned int ImageDimension = Superclass::ImageDimension;
+
+  using UpdateLevelSetFilterType =
+    UpdateWhitakerSparseBlockLevelSet<ImageDimension, LevelSetOutputType, EquationContainerType>;
+  using UpdateLevelSetFilterPointer = typename UpdateLevelSetFilterType::Pointer;
+
+protected:
+  LevelSetEvolution();
+  ~LevelSetEvolution() override = default;
+
+  /** Update the levelset in place by 1 iteration from the computed updates */
+  void
+  UpdateLevelSets() override;
+
+private:
+  UpdateLevelSetFilterPointer m_UpdateLevelSetFilter{};
+};
+
+
+// Shi, block-backed
+template <typename TEquationContainer, unsigned int VDimension>
+class ITK_TEMPLATE_EXPORT LevelSetEvolution<TEquationContainer, ShiSparseBlockLevelSetImage<VDimension>>
+  : public LevelSetEvolution<TEquationContainer, ShiSparseLevelSetImage<VDimension>>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(LevelSetEvolution);
+
+  using LevelSetType = ShiSparseBlockLevelSetImage<VDimension>;
+
+  using Self = LevelSetEvolution;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using Superclass = LevelSetEvolution<TEquationContainer, ShiSparseLevelSetImage<VDimension>>;
+
+  /** Method for creation through object factory */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(LevelSetEvolution);
+
+  using typename Superclass::EquationContainerType;
+  using typename Superclass::LevelSetContainerType;
+
+  static constexpr unsigned int ImageDimension = Superclass::ImageDimension;
+
+  using UpdateLevelSetFilterType = UpdateShiSparseBlockLevelSet<ImageDimension, EquationContainerType>;
+  using UpdateLevelSetFilterPointer = typename UpdateLevelSetFilterType::Pointer;
+
+  /** Set the maximum number of threads to be used to update the layers. */
+  void
+  SetNumberOfWorkUnits(const ThreadIdType numberOfWorkUnits);
+  /** Get the maximum number of threads to be used to update the layers. */
+  [[nodiscard]] ThreadIdType
+  GetNumberOfWorkUnits() const;
+
+  LevelSetEvolution();
+  ~LevelSetEvolution() override = default;
+
+protected:
+  /** Update the levelset in place by 1 iteration */
+  void
+  UpdateLevelSets() override;
+
+private:
+  UpdateLevelSetFilterPointer m_UpdateLevelSetFilter{};
+};
+
+
 // Malcolm
 template <typename TEquationContainer, unsigned int VDimension>
 class ITK_TEMPLATE_EXPORT LevelSetEvolution<TEquationContainer, MalcolmSparseLevelSetImage<VDimension>>
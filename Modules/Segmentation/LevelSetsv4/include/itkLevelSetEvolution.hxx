@@ -247,7 +247,7 @@ LevelSetEvolution<TEquationContainer, WhitakerSparseLevelSetImage<TOutput, VDime
 
     if (this->m_UpdateBuffer.find(identifier) == this->m_UpdateBuffer.end())
     {
-      this->m_UpdateBuffer[identifier] = new LevelSetLayerType;
+      this->m_UpdateBuffer[identifier] = new LevelSetUpdateBufferType;
     }
     else
     {
@@ -257,7 +257,7 @@ LevelSetEvolution<TEquationContainer, WhitakerSparseLevelSetImage<TOutput, VDime
       }
       else
       {
-        this->m_UpdateBuffer[identifier] = new LevelSetLayerType;
+        this->m_UpdateBuffer[identifier] = new LevelSetUpdateBufferType;
       }
     }
     ++it;
@@ -274,10 +274,8 @@ LevelSetEvolution<TEquationContainer, WhitakerSparseLevelSetImage<TOutput, VDime
   {
     const typename LevelSetType::ConstPointer levelSet =
       this->m_LevelSetContainerIteratorToProcessWhenThreading->GetLevelSet();
-    const LevelSetLayerType                                 zeroLayer = levelSet->GetLayer(0);
-    auto                                                    layerBegin = zeroLayer.begin();
-    auto                                                    layerEnd = zeroLayer.end();
-    const typename SplitLevelSetPartitionerType::DomainType completeDomain(layerBegin, layerEnd);
+    const LevelSetLayerType &                               zeroLayer = levelSet->GetLayer(0);
+    const typename SplitLevelSetPartitionerType::DomainType completeDomain(zeroLayer.begin(), zeroLayer.end());
     this->m_SplitLevelSetComputeIterationThreader->Execute(this, completeDomain);
 
     ++(this->m_LevelSetContainerIteratorToProcessWhenThreading);
@@ -385,6 +383,81 @@ LevelSetEvolution<TEquationContainer, ShiSparseLevelSetImage<VDimension>>::Updat
   this->m_EquationContainer->UpdateInternalEquationTerms();
 }
 
+// Whitaker, block-backed -----------------------------------------------------
+template <typename TEquationContainer, typename TOutput, unsigned int VDimension>
+LevelSetEvolution<TEquationContainer, WhitakerSparseBlockLevelSetImage<TOutput, VDimension>>::LevelSetEvolution()
+  : m_UpdateLevelSetFilter(UpdateLevelSetFilterType::New())
+{}
+
+template <typename TEquationContainer, typename TOutput, unsigned int VDimension>
+void
+LevelSetEvolution<TEquationContainer, WhitakerSparseBlockLevelSetImage<TOutput, VDimension>>::UpdateLevelSets()
+{
+  typename LevelSetContainerType::Iterator it = this->m_LevelSetContainer->Begin();
+  while (it != this->m_LevelSetContainer->End())
+  {
+    const typename LevelSetType::Pointer levelSet = it->GetLevelSet();
+
+    this->m_UpdateLevelSetFilter->SetLevelSet(levelSet);
+    this->m_UpdateLevelSetFilter->SetUpdate(*this->m_UpdateBuffer[it->GetIdentifier()]);
+    this->m_UpdateLevelSetFilter->SetEquationContainer(this->m_EquationContainer);
+    this->m_UpdateLevelSetFilter->SetTimeStep(this->m_Dt);
+    this->m_UpdateLevelSetFilter->SetCurrentLevelSetId(it->GetIdentifier());
+    this->m_UpdateLevelSetFilter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+    this->m_UpdateLevelSetFilter->Update();
+
+    this->m_RMSChangeAccumulator = this->m_UpdateLevelSetFilter->GetRMSChangeAccumulator();
+
+    this->m_UpdateBuffer[it->GetIdentifier()]->clear();
+    ++it;
+  }
+  this->m_UpdateLevelSetFilter->SetLevelSet(nullptr);
+}
+
+// Shi, block-backed
+
+template <typename TEquationContainer, unsigned int VDimension>
+LevelSetEvolution<TEquationContainer, ShiSparseBlockLevelSetImage<VDimension>>::LevelSetEvolution()
+  : m_UpdateLevelSetFilter(UpdateLevelSetFilterType::New())
+{}
+
+template <typename TEquationContainer, unsigned int VDimension>
+void
+LevelSetEvolution<TEquationContainer, ShiSparseBlockLevelSetImage<VDimension>>::SetNumberOfWorkUnits(
+  const ThreadIdType numberOfWorkUnits)
+{
+  this->m_UpdateLevelSetFilter->SetNumberOfWorkUnits(numberOfWorkUnits);
+}
+
+template <typename TEquationContainer, unsigned int VDimension>
+ThreadIdType
+LevelSetEvolution<TEquationContainer, ShiSparseBlockLevelSetImage<VDimension>>::GetNumberOfWorkUnits() const
+{
+  return this->m_UpdateLevelSetFilter->GetNumberOfWorkUnits();
+}
+
+template <typename TEquationContainer, unsigned int VDimension>
+void
+LevelSetEvolution<TEquationContainer, ShiSparseBlockLevelSetImage<VDimension>>::UpdateLevelSets()
+{
+  typename LevelSetContainerType::Iterator it = this->m_LevelSetContainer->Begin();
+
+  while (it != this->m_LevelSetContainer->End())
+  {
+    const typename LevelSetType::Pointer levelSet = it->GetLevelSet();
+
+    this->m_UpdateLevelSetFilter->SetLevelSet(levelSet);
+    this->m_UpdateLevelSetFilter->SetCurrentLevelSetId(it->GetIdentifier());
+    this->m_UpdateLevelSetFilter->SetEquationContainer(this->m_EquationContainer);
+    this->m_UpdateLevelSetFilter->Update();
+
+    this->m_RMSChangeAccumulator = this->m_UpdateLevelSetFilter->GetRMSChangeAccumulator();
+
+    ++it;
+  }
+  this->m_UpdateLevelSetFilter->SetLevelSet(nullptr);
+}
+
 // Malcolm
 
 template <typename TEquationContainer, unsigned int VDimension>
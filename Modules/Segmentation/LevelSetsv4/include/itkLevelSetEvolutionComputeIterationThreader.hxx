@@ -207,18 +207,23 @@ LevelSetEvolutionComputeIterationThreader<
 {
   typename LevelSetContainerType::Iterator it = this->m_Associate->m_LevelSetContainerIteratorToProcessWhenThreading;
   const LevelSetIdentifierType             levelSetId = it->GetIdentifier();
-  typename LevelSetEvolutionType::LevelSetLayerType * levelSetLayerUpdateBuffer =
+  typename LevelSetEvolutionType::LevelSetUpdateBufferType * levelSetUpdateBuffer =
     this->m_Associate->m_UpdateBuffer[levelSetId];
 
+  // The work units process consecutive ranges of the zero layer, so
+  // appending their updates in order keeps the buffer sorted like the layer.
   const ThreadIdType numberOfWorkUnits = this->GetNumberOfWorkUnitsUsed();
+  SizeValueType      numberOfNodes = levelSetUpdateBuffer->size();
   for (ThreadIdType ii = 0; ii < numberOfWorkUnits; ++ii)
   {
-    auto pairIt = this->m_NodePairsPerThread[ii].begin();
-    while (pairIt != this->m_NodePairsPerThread[ii].end())
-    {
-      levelSetLayerUpdateBuffer->insert(*pairIt);
-      ++pairIt;
-    }
+    numberOfNodes += this->m_NodePairsPerThread[ii].size();
+  }
+  levelSetUpdateBuffer->reserve(numberOfNodes);
+
+  for (ThreadIdType ii = 0; ii < numberOfWorkUnits; ++ii)
+  {
+    levelSetUpdateBuffer->insert(
+      levelSetUpdateBuffer->end(), this->m_NodePairsPerThread[ii].begin(), this->m_NodePairsPerThread[ii].end());
   }
 }
 
@@ -0,0 +1,196 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkLevelSetSparseBlockGrid_h
+#define itkLevelSetSparseBlockGrid_h
+
+#include "itkImageRegion.h"
+#include "itkMultiThreaderBase.h"
+#include "itkNumericTraits.h"
+
+#include <vector>
+
+namespace itk
+{
+/**
+ *  \class LevelSetSparseBlockGrid
+ *  \brief Image split into blocks that are only stored where they are not uniform.
+ *
+ *  The region is split into blocks of 8 pixels along each dimension. A block
+ *  is either uniform, and then holds a single value, or allocated, and then
+ *  holds all its pixels contiguously in a pool shared by all the blocks.
+ *  Setting a pixel to a value different from the value of its uniform block
+ *  allocates the block; Compact() releases the blocks that became uniform.
+ *
+ *  The sparse level sets keep their statuses and values in such grids, so
+ *  that the pixels of the narrow band are found in constant time, while the
+ *  regions inside and outside of the band take one value per block.
+ *
+ *  GetPixel() may be called concurrently. The methods that modify the grid
+ *  may not, except for the ones that take a multi-threader.
+ *
+ *  \tparam TPixel Type of the pixels
+ *  \tparam VDimension Dimension of the grid
+ *  \ingroup ITKLevelSetsv4
+ */
+template <typename TPixel, unsigned int VDimension>
+class ITK_TEMPLATE_EXPORT LevelSetSparseBlockGrid
+{
+public:
+  using Self = LevelSetSparseBlockGrid;
+
+  static constexpr unsigned int Dimension = VDimension;
+
+  using PixelType = TPixel;
+  using RegionType = ImageRegion<VDimension>;
+  using IndexType = typename RegionType::IndexType;
+  using SizeType = typename RegionType::SizeType;
+
+  /** Number of pixels of a block along each dimension is 2^BlockSideLog2. */
+  static constexpr unsigned int  BlockSideLog2 = 3;
+  static constexpr SizeValueType BlockSide = SizeValueType{ 1 } << BlockSideLog2;
+  static constexpr SizeValueType NumberOfPixelsPerBlock = SizeValueType{ 1 } << (BlockSideLog2 * VDimension);
+
+  /** Set the region of the grid, and all its pixels to value. */
+  void
+  Initialize(const RegionType & region, const PixelType & value);
+
+  /** Release all the blocks, and set an empty region. */
+  void
+  Clear();
+
+  const RegionType &
+  GetRegion() const
+  {
+    return m_Region;
+  }
+
+  bool
+  IsInside(const IndexType & index) const
+  {
+    return m_Region.IsInside(index);
+  }
+
+  /** Return the pixel at index, which must be inside the region. */
+  const PixelType &
+  GetPixel(const IndexType & index) const
+  {
+    SizeValueType block;
+    SizeValueType offset;
+    this->ComputeBlockAndOffset(index, block, offset);
+
+    const SizeValueType slot = m_BlockSlots[block];
+    return (slot == UniformBlock) ? m_BlockValues[block] : m_Pixels[slot * NumberOfPixelsPerBlock + offset];
+  }
+
+  /** Set the pixel at index, which must be inside the region. The block is
+   * allocated unless it is uniform with the same value. */
+  void
+  SetPixel(const IndexType & index, const PixelType & value);
+
+  /** Replace every pixel p by function(p). The blocks are processed in
+   * parallel. */
+  template <typename TFunction>
+  void
+  TransformPixels(TFunction function, MultiThreaderBase * multiThreader);
+
+  /** Release the allocated blocks whose pixels are all equal. */
+  void
+  Compact(MultiThreaderBase * multiThreader);
+
+  SizeValueType
+  GetNumberOfBlocks() const
+  {
+    return m_BlockSlots.size();
+  }
+
+  SizeValueType
+  GetNumberOfAllocatedBlocks() const;
+
+  /** Number of rows of pixels along the first dimension. */
+  SizeValueType
+  GetNumberOfRows() const;
+
+  /** Call visitor(value, index, length) for each run of equal pixels along
+   * the first dimension, in the rows [firstRow, endRow). The rows are
+   * numbered in the order of the pixels in an image. */
+  template <typename TVisitor>
+  void
+  VisitRuns(SizeValueType firstRow, SizeValueType endRow, TVisitor && visitor) const;
+
+  /** Set the region to the largest possible region of the label map, or to
+   * the bounding box of its lines when the label map has no region, and each
+   * pixel to the label of its label object, or to the background value. */
+  template <typename TLabelMap>
+  void
+  CopyFromLabelMap(const TLabelMap * labelMap);
+
+  /** Replace the label objects of the label map by the runs of the pixels
+   * that differ from its background value. The rows are scanned in parallel. */
+  template <typename TLabelMap>
+  void
+  CopyToLabelMap(TLabelMap * labelMap, MultiThreaderBase * multiThreader) const;
+
+private:
+  static constexpr SizeValueType UniformBlock = NumericTraits<SizeValueType>::max();
+
+  void
+  ComputeBlockAndOffset(const IndexType & index, SizeValueType & block, SizeValueType & offset) const
+  {
+    block = 0;
+    offset = 0;
+    for (unsigned int dim = 0; dim < VDimension; ++dim)
+    {
+      const auto position = static_cast<SizeValueType>(index[dim] - m_Region.GetIndex(dim));
+      block += (position >> BlockSideLog2) * m_BlockStrides[dim];
+      offset += (position & (BlockSide - 1)) << (BlockSideLog2 * dim);
+    }
+  }
+
+  /** Number of pixels of the block inside the region. */
+  SizeValueType
+  GetNumberOfPixelsInRegion(SizeValueType block) const;
+
+  /** Whether the pixel at offset of the block is inside the region. */
+  bool
+  IsOffsetInRegion(SizeValueType block, SizeValueType offset) const;
+
+  /** Copy the uniform value of the block into a new slot of the pool. */
+  void
+  AllocateBlock(SizeValueType block);
+
+  /** Call function(block, offset, length) for the part of the line of the
+   * label map in each block. */
+  template <typename TFunction>
+  void
+  VisitLineSegments(const IndexType & lineIndex, SizeValueType lineLength, TFunction && function) const;
+
+  RegionType                 m_Region{};
+  SizeType                   m_NumberOfBlocksPerDimension{};
+  SizeType                   m_BlockStrides{};
+  std::vector<SizeValueType> m_BlockSlots{};
+  std::vector<PixelType>     m_BlockValues{};
+  std::vector<PixelType>     m_Pixels{};
+  std::vector<SizeValueType> m_FreeSlots{};
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkLevelSetSparseBlockGrid.hxx"
+#endif
+
+#endif // itkLevelSetSparseBlockGrid_h
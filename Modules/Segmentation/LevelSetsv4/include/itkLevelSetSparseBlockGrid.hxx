@@ -0,0 +1,517 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkLevelSetSparseBlockGrid_hxx
+#define itkLevelSetSparseBlockGrid_hxx
+
+#include <algorithm>
+#include <map>
+
+namespace itk
+{
+
+template <typename TPixel, unsigned int VDimension>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::Initialize(const RegionType & region, const PixelType & value)
+{
+  m_Region = region;
+
+  SizeValueType numberOfBlocks = 1;
+  for (unsigned int dim = 0; dim < VDimension; ++dim)
+  {
+    m_NumberOfBlocksPerDimension[dim] = (region.GetSize(dim) + BlockSide - 1) >> BlockSideLog2;
+    m_BlockStrides[dim] = numberOfBlocks;
+    numberOfBlocks *= m_NumberOfBlocksPerDimension[dim];
+  }
+  if (region.GetNumberOfPixels() == 0)
+  {
+    numberOfBlocks = 0;
+  }
+
+  m_BlockSlots.assign(numberOfBlocks, UniformBlock);
+  m_BlockValues.assign(numberOfBlocks, value);
+  m_Pixels.clear();
+  m_FreeSlots.clear();
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::Clear()
+{
+  this->Initialize(RegionType(), PixelType{});
+  m_BlockSlots.shrink_to_fit();
+  m_BlockValues.shrink_to_fit();
+  m_Pixels.shrink_to_fit();
+  m_FreeSlots.shrink_to_fit();
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::SetPixel(const IndexType & index, const PixelType & value)
+{
+  SizeValueType block;
+  SizeValueType offset;
+  this->ComputeBlockAndOffset(index, block, offset);
+
+  if (m_BlockSlots[block] == UniformBlock)
+  {
+    if (m_BlockValues[block] == value)
+    {
+      return;
+    }
+    this->AllocateBlock(block);
+  }
+  m_Pixels[m_BlockSlots[block] * NumberOfPixelsPerBlock + offset] = value;
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+template <typename TFunction>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::TransformPixels(TFunction function, MultiThreaderBase * multiThreader)
+{
+  multiThreader->ParallelizeArray(
+    0,
+    this->GetNumberOfBlocks(),
+    [this, &function](SizeValueType block) {
+      const SizeValueType slot = m_BlockSlots[block];
+      if (slot == UniformBlock)
+      {
+        m_BlockValues[block] = function(m_BlockValues[block]);
+        return;
+      }
+      const auto begin = m_Pixels.begin() + slot * NumberOfPixelsPerBlock;
+      std::transform(begin, begin + NumberOfPixelsPerBlock, begin, function);
+    },
+    nullptr);
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::Compact(MultiThreaderBase * multiThreader)
+{
+  // The blocks are checked in parallel, and released afterwards since the
+  // released slots are shared.
+  std::vector<uint8_t> isUniform(this->GetNumberOfBlocks(), 0);
+
+  multiThreader->ParallelizeArray(
+    0,
+    this->GetNumberOfBlocks(),
+    [this, &isUniform](SizeValueType block) {
+      const SizeValueType slot = m_BlockSlots[block];
+      if (slot == UniformBlock)
+      {
+        return;
+      }
+      // The first pixel of a block is always inside the region.
+      const PixelType * pixels = m_Pixels.data() + slot * NumberOfPixelsPerBlock;
+      const bool        isFull = (this->GetNumberOfPixelsInRegion(block) == NumberOfPixelsPerBlock);
+      for (SizeValueType offset = 1; offset < NumberOfPixelsPerBlock; ++offset)
+      {
+        if (!(pixels[offset] == pixels[0]) && (isFull || this->IsOffsetInRegion(block, offset)))
+        {
+          return;
+        }
+      }
+      isUniform[block] = 1;
+    },
+    nullptr);
+
+  for (SizeValueType block = 0; block < this->GetNumberOfBlocks(); ++block)
+  {
+    if (isUniform[block])
+    {
+      const SizeValueType slot = m_BlockSlots[block];
+      m_BlockValues[block] = m_Pixels[slot * NumberOfPixelsPerBlock];
+      m_BlockSlots[block] = UniformBlock;
+      m_FreeSlots.push_back(slot);
+    }
+  }
+
+  // Release the memory of the slots at the end of the pool.
+  if (m_FreeSlots.size() * NumberOfPixelsPerBlock == m_Pixels.size())
+  {
+    m_Pixels.clear();
+    m_FreeSlots.clear();
+  }
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+SizeValueType
+LevelSetSparseBlockGrid<TPixel, VDimension>::GetNumberOfAllocatedBlocks() const
+{
+  return m_Pixels.size() / NumberOfPixelsPerBlock - m_FreeSlots.size();
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+SizeValueType
+LevelSetSparseBlockGrid<TPixel, VDimension>::GetNumberOfRows() const
+{
+  if (m_Region.GetNumberOfPixels() == 0)
+  {
+    return 0;
+  }
+  return m_Region.GetNumberOfPixels() / m_Region.GetSize(0);
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+template <typename TVisitor>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::VisitRuns(SizeValueType firstRow,
+                                                       SizeValueType endRow,
+                                                       TVisitor &&   visitor) const
+{
+  const SizeValueType rowLength = m_Region.GetSize(0);
+
+  for (SizeValueType row = firstRow; row < endRow; ++row)
+  {
+    // Position of the row, and of its blocks.
+    IndexType     rowIndex = m_Region.GetIndex();
+    SizeValueType rowBlock = 0;
+    SizeValueType rowOffset = 0;
+    SizeValueType remainder = row;
+    for (unsigned int dim = 1; dim < VDimension; ++dim)
+    {
+      const SizeValueType position = remainder % m_Region.GetSize(dim);
+      remainder /= m_Region.GetSize(dim);
+
+      rowIndex[dim] += static_cast<IndexValueType>(position);
+      rowBlock += (position >> BlockSideLog2) * m_BlockStrides[dim];
+      rowOffset += (position & (BlockSide - 1)) << (BlockSideLog2 * dim);
+    }
+
+    const PixelType * runValue = nullptr;
+    SizeValueType     runStart = 0;
+    for (SizeValueType blockStart = 0; blockStart < rowLength; blockStart += BlockSide)
+    {
+      const SizeValueType block = rowBlock + (blockStart >> BlockSideLog2);
+      const SizeValueType blockEnd = std::min(blockStart + BlockSide, rowLength);
+      const SizeValueType slot = m_BlockSlots[block];
+
+      for (SizeValueType position = blockStart; position < blockEnd; ++position)
+      {
+        const PixelType * value =
+          (slot == UniformBlock)
+            ? &m_BlockValues[block]
+            : &m_Pixels[slot * NumberOfPixelsPerBlock + rowOffset + (position & (BlockSide - 1))];
+        if (runValue == nullptr)
+        {
+          runValue = value;
+          runStart = position;
+        }
+        else if (!(*value == *runValue))
+        {
+          IndexType runIndex = rowIndex;
+          runIndex[0] += static_cast<IndexValueType>(runStart);
+          visitor(*runValue, runIndex, position - runStart);
+          runValue = value;
+          runStart = position;
+        }
+        if (slot == UniformBlock)
+        {
+          // The rest of the block has the same value.
+          break;
+        }
+      }
+    }
+    if (runValue != nullptr)
+    {
+      IndexType runIndex = rowIndex;
+      runIndex[0] += static_cast<IndexValueType>(runStart);
+      visitor(*runValue, runIndex, rowLength - runStart);
+    }
+  }
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+template <typename TLabelMap>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::CopyFromLabelMap(const TLabelMap * labelMap)
+{
+  RegionType region = labelMap->GetLargestPossibleRegion();
+
+  if (region.GetNumberOfPixels() == 0)
+  {
+    // Without a region, the grid covers the lines of the label objects.
+    bool isEmpty = true;
+    for (typename TLabelMap::ConstIterator it(labelMap); !it.IsAtEnd(); ++it)
+    {
+      const auto * labelObject = it.GetLabelObject();
+      for (SizeValueType i = 0; i < labelObject->GetNumberOfLines(); ++i)
+      {
+        const auto & line = labelObject->GetLine(i);
+        if (line.GetLength() == 0)
+        {
+          continue;
+        }
+        IndexType lineEnd = line.GetIndex();
+        lineEnd[0] += static_cast<IndexValueType>(line.GetLength()) - 1;
+        if (isEmpty)
+        {
+          region.SetIndex(line.GetIndex());
+          region.SetSize(SizeType::Filled(1));
+          isEmpty = false;
+        }
+        for (unsigned int dim = 0; dim < VDimension; ++dim)
+        {
+          const IndexValueType first = std::min(region.GetIndex(dim), line.GetIndex()[dim]);
+          const IndexValueType last = std::max(region.GetUpperIndex()[dim], lineEnd[dim]);
+          region.SetIndex(dim, first);
+          region.SetSize(dim, static_cast<SizeValueType>(last - first + 1));
+        }
+      }
+    }
+  }
+
+  this->Initialize(region, static_cast<PixelType>(labelMap->GetBackgroundValue()));
+
+  // A block covered by a single label object is set to its label without
+  // being allocated, which is the case of most of the blocks inside of the
+  // level set. The other blocks covered by label objects are allocated.
+  const SizeValueType        numberOfBlocks = this->GetNumberOfBlocks();
+  std::vector<SizeValueType> coverage(numberOfBlocks, 0);
+  std::vector<PixelType>     coveringLabel(numberOfBlocks);
+  std::vector<uint8_t>       isMixed(numberOfBlocks, 0);
+
+  for (typename TLabelMap::ConstIterator it(labelMap); !it.IsAtEnd(); ++it)
+  {
+    const auto *    labelObject = it.GetLabelObject();
+    const PixelType label = static_cast<PixelType>(labelObject->GetLabel());
+
+    for (SizeValueType i = 0; i < labelObject->GetNumberOfLines(); ++i)
+    {
+      const auto & line = labelObject->GetLine(i);
+      this->VisitLineSegments(
+        line.GetIndex(), line.GetLength(), [&](SizeValueType block, SizeValueType, SizeValueType length) {
+          if (coverage[block] == 0)
+          {
+            coveringLabel[block] = label;
+          }
+          else if (!(coveringLabel[block] == label))
+          {
+            isMixed[block] = 1;
+          }
+          coverage[block] += length;
+        });
+    }
+  }
+
+  bool hasMixedBlocks = false;
+  for (SizeValueType block = 0; block < numberOfBlocks; ++block)
+  {
+    if (coverage[block] == 0)
+    {
+      continue;
+    }
+    if (!isMixed[block] && coverage[block] == this->GetNumberOfPixelsInRegion(block))
+    {
+      m_BlockValues[block] = coveringLabel[block];
+    }
+    else
+    {
+      this->AllocateBlock(block);
+      hasMixedBlocks = true;
+    }
+  }
+
+  if (!hasMixedBlocks)
+  {
+    return;
+  }
+
+  for (typename TLabelMap::ConstIterator it(labelMap); !it.IsAtEnd(); ++it)
+  {
+    const auto *    labelObject = it.GetLabelObject();
+    const PixelType label = static_cast<PixelType>(labelObject->GetLabel());
+
+    for (SizeValueType i = 0; i < labelObject->GetNumberOfLines(); ++i)
+    {
+      const auto & line = labelObject->GetLine(i);
+      this->VisitLineSegments(
+        line.GetIndex(), line.GetLength(), [&](SizeValueType block, SizeValueType offset, SizeValueType length) {
+          const SizeValueType slot = m_BlockSlots[block];
+          if (slot != UniformBlock)
+          {
+            const auto begin = m_Pixels.begin() + slot * NumberOfPixelsPerBlock + offset;
+            std::fill(begin, begin + length, label);
+          }
+        });
+    }
+  }
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+template <typename TLabelMap>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::CopyToLabelMap(TLabelMap *          labelMap,
+                                                            MultiThreaderBase * multiThreader) const
+{
+  using LabelType = typename TLabelMap::LabelType;
+  using LabelObjectType = typename TLabelMap::LabelObjectType;
+  using LineType = typename LabelObjectType::LineType;
+  using LabeledLineType = std::pair<LabelType, LineType>;
+
+  const LabelType     backgroundValue = labelMap->GetBackgroundValue();
+  const SizeValueType numberOfRows = this->GetNumberOfRows();
+  const SizeValueType numberOfChunks =
+    std::min(numberOfRows, static_cast<SizeValueType>(multiThreader->GetNumberOfWorkUnits()));
+
+  // Each chunk of consecutive rows collects its runs, which are then added in
+  // order, so that the lines of each label object are sorted.
+  std::vector<std::vector<LabeledLineType>> linesPerChunk(numberOfChunks);
+
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [&](SizeValueType chunk) {
+      const SizeValueType firstRow = numberOfRows * chunk / numberOfChunks;
+      const SizeValueType endRow = numberOfRows * (chunk + 1) / numberOfChunks;
+      std::vector<LabeledLineType> & lines = linesPerChunk[chunk];
+
+      this->VisitRuns(firstRow, endRow, [&](const PixelType & value, const IndexType & index, SizeValueType length) {
+        const auto label = static_cast<LabelType>(value);
+        if (label != backgroundValue)
+        {
+          lines.emplace_back(label, LineType(index, length));
+        }
+      });
+    },
+    nullptr);
+
+  labelMap->ClearLabels();
+
+  std::map<LabelType, LabelObjectType *> labelObjects;
+  for (const auto & lines : linesPerChunk)
+  {
+    for (const auto & labeledLine : lines)
+    {
+      auto it = labelObjects.find(labeledLine.first);
+      if (it == labelObjects.end())
+      {
+        auto labelObject = LabelObjectType::New();
+        labelObject->SetLabel(labeledLine.first);
+        labelMap->AddLabelObject(labelObject);
+        it = labelObjects.emplace(labeledLine.first, labelObject.GetPointer()).first;
+      }
+      it->second->AddLine(labeledLine.second);
+    }
+  }
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+SizeValueType
+LevelSetSparseBlockGrid<TPixel, VDimension>::GetNumberOfPixelsInRegion(SizeValueType block) const
+{
+  SizeValueType numberOfPixels = 1;
+  SizeValueType remainder = block;
+  for (unsigned int dim = 0; dim < VDimension; ++dim)
+  {
+    const SizeValueType start = (remainder % m_NumberOfBlocksPerDimension[dim]) << BlockSideLog2;
+    remainder /= m_NumberOfBlocksPerDimension[dim];
+    numberOfPixels *= std::min(BlockSide, m_Region.GetSize(dim) - start);
+  }
+  return numberOfPixels;
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+bool
+LevelSetSparseBlockGrid<TPixel, VDimension>::IsOffsetInRegion(SizeValueType block, SizeValueType offset) const
+{
+  SizeValueType remainder = block;
+  for (unsigned int dim = 0; dim < VDimension; ++dim)
+  {
+    const SizeValueType start = (remainder % m_NumberOfBlocksPerDimension[dim]) << BlockSideLog2;
+    remainder /= m_NumberOfBlocksPerDimension[dim];
+    const SizeValueType position = start + ((offset >> (BlockSideLog2 * dim)) & (BlockSide - 1));
+    if (position >= m_Region.GetSize(dim))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::AllocateBlock(SizeValueType block)
+{
+  SizeValueType slot;
+  if (m_FreeSlots.empty())
+  {
+    slot = m_Pixels.size() / NumberOfPixelsPerBlock;
+    m_Pixels.resize(m_Pixels.size() + NumberOfPixelsPerBlock);
+  }
+  else
+  {
+    slot = m_FreeSlots.back();
+    m_FreeSlots.pop_back();
+  }
+
+  const auto begin = m_Pixels.begin() + slot * NumberOfPixelsPerBlock;
+  std::fill(begin, begin + NumberOfPixelsPerBlock, m_BlockValues[block]);
+  m_BlockSlots[block] = slot;
+}
+
+
+template <typename TPixel, unsigned int VDimension>
+template <typename TFunction>
+void
+LevelSetSparseBlockGrid<TPixel, VDimension>::VisitLineSegments(const IndexType & lineIndex,
+                                                               SizeValueType     lineLength,
+                                                               TFunction &&      function) const
+{
+  SizeValueType rowBlock = 0;
+  SizeValueType rowOffset = 0;
+  for (unsigned int dim = 1; dim < VDimension; ++dim)
+  {
+    const IndexValueType position = lineIndex[dim] - m_Region.GetIndex(dim);
+    if (position < 0 || position >= static_cast<IndexValueType>(m_Region.GetSize(dim)))
+    {
+      return;
+    }
+    rowBlock += (static_cast<SizeValueType>(position) >> BlockSideLog2) * m_BlockStrides[dim];
+    rowOffset += (static_cast<SizeValueType>(position) & (BlockSide - 1)) << (BlockSideLog2 * dim);
+  }
+
+  const IndexValueType begin = std::max(lineIndex[0] - m_Region.GetIndex(0), IndexValueType{ 0 });
+  const IndexValueType end = std::min(lineIndex[0] - m_Region.GetIndex(0) + static_cast<IndexValueType>(lineLength),
+                                      static_cast<IndexValueType>(m_Region.GetSize(0)));
+
+  for (auto position = static_cast<SizeValueType>(begin); position < static_cast<SizeValueType>(std::max(begin, end));)
+  {
+    const SizeValueType offsetInBlock = position & (BlockSide - 1);
+    const SizeValueType length =
+      std::min(BlockSide - offsetInBlock, static_cast<SizeValueType>(end) - position);
+    function(rowBlock + (position >> BlockSideLog2), rowOffset + offsetInBlock, length);
+    position += length;
+  }
+}
+
+} // namespace itk
+
+#endif // itkLevelSetSparseBlockGrid_hxx
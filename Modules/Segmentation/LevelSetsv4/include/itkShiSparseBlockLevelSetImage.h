@@ -0,0 +1,124 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkShiSparseBlockLevelSetImage_h
+#define itkShiSparseBlockLevelSetImage_h
+
+#include "itkShiSparseLevelSetImage.h"
+#include "itkLevelSetSparseBlockGrid.h"
+
+namespace itk
+{
+/**
+ *  \class ShiSparseBlockLevelSetImage
+ *  \brief Shi sparse level set whose statuses are also kept in a block grid
+ *
+ *  The layers and the label map are the ones of ShiSparseLevelSetImage, and
+ *  keep their interface. In addition, the status of every pixel, which is
+ *  also its value, is kept in a LevelSetSparseBlockGrid, so that Evaluate()
+ *  and Status() are answered in constant time instead of searching the
+ *  layers and the label objects.
+ *
+ *  The grid is rebuilt from the label map by SetLabelMap() and Graft(), or
+ *  by InitializeGrid() after modifying the label map directly. The
+ *  LevelSetEvolution specialized for this type maintains the grid and the
+ *  layers together, in parallel.
+ *
+ *  \tparam VDimension Dimension of the input space
+ *  \ingroup ITKLevelSetsv4
+ */
+template <unsigned int VDimension>
+class ITK_TEMPLATE_EXPORT ShiSparseBlockLevelSetImage : public ShiSparseLevelSetImage<VDimension>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ShiSparseBlockLevelSetImage);
+
+  using Self = ShiSparseBlockLevelSetImage;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using Superclass = ShiSparseLevelSetImage<VDimension>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(ShiSparseBlockLevelSetImage);
+
+  static constexpr unsigned int Dimension = VDimension;
+
+  using typename Superclass::InputType;
+  using typename Superclass::OutputType;
+  using typename Superclass::OutputRealType;
+  using typename Superclass::LayerIdType;
+  using typename Superclass::LabelMapType;
+  using typename Superclass::LayerType;
+
+  using StatusGridType = LevelSetSparseBlockGrid<LayerIdType, VDimension>;
+
+  /** Returns the value of the level set function at a given location inputIndex */
+  using Superclass::Evaluate;
+  OutputType
+  Evaluate(const InputType & inputIndex) const override;
+
+  /** Returns the layer affiliation of a given location inputIndex */
+  LayerIdType
+  Status(const InputType & inputIndex) const override;
+
+  /** Set the label map, and rebuild the grid from it */
+  void
+  SetLabelMap(LabelMapType * labelMap) override;
+
+  /** Graft data object as level set object */
+  void
+  Graft(const DataObject * data) override;
+
+  /** Rebuild the grid from the label map */
+  void
+  InitializeGrid();
+
+  /** Get the grid of the statuses, indexed like the label map */
+  /** @ITKStartGrouping */
+  const StatusGridType &
+  GetStatusGrid() const
+  {
+    return m_StatusGrid;
+  }
+  StatusGridType &
+  GetModifiableStatusGrid()
+  {
+    return m_StatusGrid;
+  }
+  /** @ITKEndGrouping */
+
+protected:
+  ShiSparseBlockLevelSetImage() = default;
+  ~ShiSparseBlockLevelSetImage() override = default;
+
+  /** Initialize the label map point, the sparse-field layers and the grid */
+  void
+  Initialize() override;
+
+private:
+  StatusGridType m_StatusGrid{};
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkShiSparseBlockLevelSetImage.hxx"
+#endif
+
+#endif // itkShiSparseBlockLevelSetImage_h
@@ -0,0 +1,106 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkShiSparseBlockLevelSetImage_hxx
+#define itkShiSparseBlockLevelSetImage_hxx
+
+
+namespace itk
+{
+
+template <unsigned int VDimension>
+auto
+ShiSparseBlockLevelSetImage<VDimension>::Evaluate(const InputType & inputIndex) const -> OutputType
+{
+  if (this->m_LabelMap.IsNull())
+  {
+    itkGenericExceptionMacro("Note: m_LabelMap is nullptr");
+  }
+  return static_cast<OutputType>(this->Status(inputIndex));
+}
+
+
+template <unsigned int VDimension>
+auto
+ShiSparseBlockLevelSetImage<VDimension>::Status(const InputType & inputIndex) const -> LayerIdType
+{
+  const InputType mapIndex = inputIndex - this->m_DomainOffset;
+  if (!m_StatusGrid.IsInside(mapIndex))
+  {
+    return this->PlusThreeLayer();
+  }
+  return m_StatusGrid.GetPixel(mapIndex);
+}
+
+
+template <unsigned int VDimension>
+void
+ShiSparseBlockLevelSetImage<VDimension>::SetLabelMap(LabelMapType * labelMap)
+{
+  Superclass::SetLabelMap(labelMap);
+  this->InitializeGrid();
+}
+
+
+template <unsigned int VDimension>
+void
+ShiSparseBlockLevelSetImage<VDimension>::Graft(const DataObject * data)
+{
+  Superclass::Graft(data);
+
+  const auto * levelSet = dynamic_cast<const Self *>(data);
+  if (levelSet == this)
+  {
+    return;
+  }
+  if (levelSet)
+  {
+    m_StatusGrid = levelSet->m_StatusGrid;
+  }
+  else
+  {
+    this->InitializeGrid();
+  }
+}
+
+
+template <unsigned int VDimension>
+void
+ShiSparseBlockLevelSetImage<VDimension>::InitializeGrid()
+{
+  if (this->m_LabelMap.IsNull())
+  {
+    m_StatusGrid.Clear();
+    return;
+  }
+
+  m_StatusGrid.CopyFromLabelMap(this->m_LabelMap.GetPointer());
+}
+
+
+template <unsigned int VDimension>
+void
+ShiSparseBlockLevelSetImage<VDimension>::Initialize()
+{
+  Superclass::Initialize();
+
+  m_StatusGrid.Clear();
+}
+
+} // namespace itk
+
+#endif // itkShiSparseBlockLevelSetImage_hxx
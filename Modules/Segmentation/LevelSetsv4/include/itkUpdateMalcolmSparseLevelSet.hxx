@@ -125,7 +125,7 @@ template <unsigned int VDimension, typename TEquationContainer>
 void
 UpdateMalcolmSparseLevelSet<VDimension, TEquationContainer>::FillUpdateContainer()
 {
-  LevelSetLayerType levelZero = this->m_OutputLevelSet->GetLayer(LevelSetType::ZeroLayer());
+  const LevelSetLayerType & levelZero = this->m_OutputLevelSet->GetLayer(LevelSetType::ZeroLayer());
 
   auto nodeIt = levelZero.begin();
   auto nodeEnd = levelZero.end();
@@ -151,7 +151,8 @@ UpdateMalcolmSparseLevelSet<VDimension, TEquationContainer>::FillUpdateContainer
       value = -NumericTraits<LevelSetOutputType>::OneValue();
     }
 
-    this->m_Update.insert(NodePairType(currentIndex, value));
+    // The zero layer is traversed in order, so the new node goes at the end.
+    this->m_Update.insert(this->m_Update.end(), NodePairType(currentIndex, value));
 
     ++nodeIt;
   }
@@ -0,0 +1,161 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkUpdateShiSparseBlockLevelSet_h
+#define itkUpdateShiSparseBlockLevelSet_h
+
+#include "itkShiSparseBlockLevelSetImage.h"
+#include "itkConnectedImageNeighborhoodShape.h"
+#include "itkMultiThreaderBase.h"
+
+namespace itk
+{
+/**
+ *  \class UpdateShiSparseBlockLevelSet
+ *  \brief Update of the layers of a ShiSparseBlockLevelSetImage
+ *
+ *  Performs the same update as UpdateShiSparseLevelSet, with the same calls
+ *  to the terms in the same order. The level set is updated in place: a copy
+ *  of its status grid replaces the label image, while the level set keeps
+ *  evaluating the terms with the statuses it had before the update. The
+ *  label map is rebuilt from the runs of the status grid instead of from a
+ *  label image covering the whole domain.
+ *
+ *  The terms are evaluated at the nodes of a layer in parallel, and the
+ *  neighbors of the nodes to be removed from a layer are scanned in
+ *  parallel. The nodes are then moved, and the terms updated, in the order
+ *  of the layers.
+ *
+ *  \tparam VDimension Dimension of the input space
+ *  \tparam TEquationContainer Container of the system of levelset equations
+ *  \ingroup ITKLevelSetsv4
+ */
+template <unsigned int VDimension, typename TEquationContainer>
+class ITK_TEMPLATE_EXPORT UpdateShiSparseBlockLevelSet : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(UpdateShiSparseBlockLevelSet);
+
+  using Self = UpdateShiSparseBlockLevelSet;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using Superclass = Object;
+
+  /** Method for creation through object factory */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(UpdateShiSparseBlockLevelSet);
+
+  static constexpr unsigned int ImageDimension = VDimension;
+
+  using LevelSetType = ShiSparseBlockLevelSetImage<ImageDimension>;
+  using LevelSetPointer = typename LevelSetType::Pointer;
+  using LevelSetInputType = typename LevelSetType::InputType;
+  using LevelSetOffsetType = typename LevelSetType::OffsetType;
+  using LevelSetOutputType = typename LevelSetType::OutputType;
+  using LevelSetOutputRealType = typename LevelSetType::OutputRealType;
+
+  using LevelSetLayerIdType = typename LevelSetType::LayerIdType;
+  using LevelSetLayerType = typename LevelSetType::LayerType;
+  using LevelSetLayerIterator = typename LevelSetType::LayerIterator;
+
+  using StatusGridType = typename LevelSetType::StatusGridType;
+
+  using EquationContainerType = TEquationContainer;
+  using EquationContainerPointer = typename EquationContainerType::Pointer;
+  using TermContainerPointer = typename EquationContainerType::TermContainerPointer;
+
+  /** Update the level set in place */
+  void
+  Update();
+
+  /** Set/Get the sparse level set image */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(LevelSet, LevelSetType);
+  itkGetModifiableObjectMacro(LevelSet, LevelSetType);
+  /** @ITKEndGrouping */
+  /** Get the RMS change for the update */
+  itkGetMacro(RMSChangeAccumulator, LevelSetOutputRealType);
+
+  /** Set/Get the Equation container for computing the update */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(EquationContainer, EquationContainerType);
+  itkGetModifiableObjectMacro(EquationContainer, EquationContainerType);
+  /** @ITKEndGrouping */
+  /** Set/Get the current level set id */
+  /** @ITKStartGrouping */
+  itkSetMacro(CurrentLevelSetId, IdentifierType);
+  itkGetMacro(CurrentLevelSetId, IdentifierType);
+  /** @ITKEndGrouping */
+
+  /** Set/Get the number of work units used to update the layers */
+  /** @ITKStartGrouping */
+  void
+  SetNumberOfWorkUnits(ThreadIdType numberOfWorkUnits);
+  [[nodiscard]] ThreadIdType
+  GetNumberOfWorkUnits() const;
+  /** @ITKEndGrouping */
+
+protected:
+  UpdateShiSparseBlockLevelSet();
+  ~UpdateShiSparseBlockLevelSet() override = default;
+
+  /** Move the points of the layer +1 (resp. -1) whose update is negative
+   * (resp. positive) to the opposite layer, and bring their neighbors outside
+   * of the band into the layer */
+  void
+  UpdateLayer(LevelSetLayerIdType status);
+
+  /** Remove from the layer -1 (resp. +1) the points without neighbors of
+   * positive (resp. negative) status */
+  void
+  RemoveRedundantPoints(LevelSetLayerIdType status);
+
+  /** Return true if there is a pixel from the opposite layer (+1 or -1) moving in the same direction */
+  bool
+  Con(const LevelSetInputType &      idx,
+      const LevelSetLayerIdType &    currentStatus,
+      const LevelSetOutputRealType & currentUpdate) const;
+
+private:
+  using NeighborOffsetsType = decltype(GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>());
+
+  IdentifierType           m_CurrentLevelSetId{};
+  LevelSetOutputRealType   m_RMSChangeAccumulator{};
+  EquationContainerPointer m_EquationContainer{};
+  TermContainerPointer     m_TermContainer{};
+
+  LevelSetPointer    m_LevelSet{};
+  LevelSetOffsetType m_Offset{};
+
+  /** Statuses during the update */
+  StatusGridType m_InternalGrid{};
+
+  const NeighborOffsetsType m_NeighborOffsets{
+    GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>()
+  };
+
+  MultiThreaderBase::Pointer m_MultiThreader{};
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkUpdateShiSparseBlockLevelSet.hxx"
+#endif
+
+#endif // itkUpdateShiSparseBlockLevelSet_h
@@ -0,0 +1,260 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkUpdateShiSparseBlockLevelSet_hxx
+#define itkUpdateShiSparseBlockLevelSet_hxx
+
+#include "itkLexicographicCompare.h"
+
+#include <algorithm>
+
+namespace itk
+{
+
+template <unsigned int VDimension, typename TEquationContainer>
+UpdateShiSparseBlockLevelSet<VDimension, TEquationContainer>::UpdateShiSparseBlockLevelSet()
+  : m_CurrentLevelSetId(IdentifierType{})
+  , m_RMSChangeAccumulator(LevelSetOutputRealType{})
+  , m_MultiThreader(MultiThreaderBase::New())
+{
+  this->m_Offset.Fill(0);
+}
+
+template <unsigned int VDimension, typename TEquationContainer>
+void
+UpdateShiSparseBlockLevelSet<VDimension, TEquationContainer>::SetNumberOfWorkUnits(ThreadIdType numberOfWorkUnits)
+{
+  if (numberOfWorkUnits != this->m_MultiThreader->GetNumberOfWorkUnits())
+  {
+    this->m_MultiThreader->SetNumberOfWorkUnits(numberOfWorkUnits);
+    this->Modified();
+  }
+}
+
+template <unsigned int VDimension, typename TEquationContainer>
+ThreadIdType
+UpdateShiSparseBlockLevelSet<VDimension, TEquationContainer>::GetNumberOfWorkUnits() const
+{
+  return this->m_MultiThreader->GetNumberOfWorkUnits();
+}
+
+template <unsigned int VDimension, typename TEquationContainer>
+void
+UpdateShiSparseBlockLevelSet<VDimension, TEquationContainer>::Update()
+{
+  if (this->m_LevelSet.IsNull())
+  {
+    itkGenericExceptionMacro("m_LevelSet is nullptr");
+  }
+  if (this->m_LevelSet->GetLabelMap() == nullptr)
+  {
+    itkGenericExceptionMacro("The label map of m_LevelSet is nullptr");
+  }
+
+  this->m_Offset = this->m_LevelSet->GetDomainOffset();
+  this->m_TermContainer = this->m_EquationContainer->GetEquation(this->m_CurrentLevelSetId);
+
+  // The level set keeps its statuses until the end of the update, so that the
+  // terms are evaluated with the level set before the update.
+  this->m_InternalGrid = this->m_LevelSet->GetStatusGrid();
+
+  // Step 2.1.1
+  this->UpdateLayer(LevelSetType::PlusOneLayer());
+
+  // Step 2.1.2
+  this->RemoveRedundantPoints(LevelSetType::MinusOneLayer());
+
+  // Step 2.1.3
+  this->UpdateLayer(LevelSetType::MinusOneLayer());
+
+  // Step 2.1.4
+  this->RemoveRedundantPoints(LevelSetType::PlusOneLayer());
+
+  this->m_InternalGrid.Compact(this->m_MultiThreader);
+
+  StatusGridType & statusGrid = this->m_LevelSet->GetModifiableStatusGrid();
+  statusGrid = std::move(this->m_InternalGrid);
+  statusGrid.CopyToLabelMap(this->m_LevelSet->GetModifiableLabelMap(), this->m_MultiThreader);
+
+  this->m_InternalGrid.Clear();
+  this->m_LevelSet->Modified();
+  this->m_TermContainer = nullptr;
+}
+
+template <unsigned int VDimension, typename TEquationContainer>
+void
+UpdateShiSparseBlockLevelSet<VDimension, TEquationContainer>::UpdateLayer(LevelSetLayerIdType status)
+{
+  LevelSetLayerType & layer = this->m_LevelSet->GetLayer(status);
+  LevelSetLayerType & oppositeLayer = this->m_LevelSet->GetLayer(-status);
+
+  const LevelSetLayerIdType outerStatus =
+    (status < 0) ? LevelSetType::MinusThreeLayer() : LevelSetType::PlusThreeLayer();
+
+  std::vector<LevelSetLayerIterator> nodes;
+  nodes.reserve(layer.size());
+  for (auto nodeIt = layer.begin(); nodeIt != layer.end(); ++nodeIt)
+  {
+    nodes.push_back(nodeIt);
+  }
+
+  // The terms are evaluated with the statuses before the update, and the
+  // statuses are not modified until all the nodes are visited.
+  std::vector<uint8_t> isMoving(nodes.size(), 0);
+
+  this->m_MultiThreader->ParallelizeArray(
+    0,
+    nodes.size(),
+    [&](SizeValueType i) {
+      const LevelSetInputType currentIndex = nodes[i]->first;
+
+      const LevelSetOutputRealType update = this->m_TermContainer->Evaluate(currentIndex + this->m_Offset);
+
+      if (((status > 0) ? (update < LevelSetOutputRealType{}) : (update > LevelSetOutputRealType{})) &&
+          this->Con(currentIndex, status, update))
+      {
+        isMoving[i] = 1;
+      }
+    },
+    nullptr);
+
+  std::vector<LevelSetInputType> movingIndices;
+  std::vector<LevelSetInputType> insertedIndices;
+
+  for (SizeValueType i = 0; i < nodes.size(); ++i)
+  {
+    if (!isMoving[i])
+    {
+      continue;
+    }
+
+    const LevelSetInputType currentIndex = nodes[i]->first;
+    layer.erase(nodes[i]);
+    movingIndices.push_back(currentIndex);
+
+    for (const auto & offset : this->m_NeighborOffsets)
+    {
+      const LevelSetInputType neighborIndex = currentIndex + offset;
+      if (this->m_InternalGrid.IsInside(neighborIndex) && this->m_InternalGrid.GetPixel(neighborIndex) == outerStatus)
+      {
+        insertedIndices.push_back(neighborIndex);
+      }
+    }
+  }
+
+  // The points are inserted in the order of the layers.
+  const Functor::LexicographicCompare compare;
+  std::sort(insertedIndices.begin(), insertedIndices.end(), compare);
+  insertedIndices.erase(std::unique(insertedIndices.begin(), insertedIndices.end()), insertedIndices.end());
+
+  for (const auto & index : insertedIndices)
+  {
+    layer.insert(std::make_pair(index, static_cast<LevelSetOutputType>(status)));
+    this->m_InternalGrid.SetPixel(index, status);
+    this->m_TermContainer->UpdatePixel(index + this->m_Offset, outerStatus, status);
+  }
+
+  for (const auto & index : movingIndices)
+  {
+    oppositeLayer.insert(std::make_pair(index, static_cast<LevelSetOutputType>(-status)));
+    this->m_InternalGrid.SetPixel(index, -status);
+    this->m_TermContainer->UpdatePixel(index + this->m_Offset, status, -status);
+  }
+}
+
+template <unsigned int VDimension, typename TEquationContainer>
+void
+UpdateShiSparseBlockLevelSet<VDimension, TEquationContainer>::RemoveRedundantPoints(LevelSetLayerIdType status)
+{
+  LevelSetLayerType & layer = this->m_LevelSet->GetLayer(status);
+
+  const LevelSetLayerIdType outerStatus =
+    (status < 0) ? LevelSetType::MinusThreeLayer() : LevelSetType::PlusThreeLayer();
+
+  std::vector<LevelSetLayerIterator> nodes;
+  nodes.reserve(layer.size());
+  for (auto nodeIt = layer.begin(); nodeIt != layer.end(); ++nodeIt)
+  {
+    nodes.push_back(nodeIt);
+  }
+
+  // Moving a point out of the band does not change the sign of its status,
+  // so that the points are independent of each other.
+  std::vector<uint8_t> toBeDeleted(nodes.size(), 1);
+
+  this->m_MultiThreader->ParallelizeArray(
+    0,
+    nodes.size(),
+    [&](SizeValueType i) {
+      const LevelSetInputType currentIndex = nodes[i]->first;
+
+      for (const auto & offset : this->m_NeighborOffsets)
+      {
+        const LevelSetInputType neighborIndex = currentIndex + offset;
+        if (this->m_InternalGrid.IsInside(neighborIndex))
+        {
+          const LevelSetLayerIdType neighborStatus = this->m_InternalGrid.GetPixel(neighborIndex);
+          if ((status < 0) ? (neighborStatus > 0) : (neighborStatus < 0))
+          {
+            toBeDeleted[i] = 0;
+            break;
+          }
+        }
+      }
+    },
+    nullptr);
+
+  for (SizeValueType i = 0; i < nodes.size(); ++i)
+  {
+    if (toBeDeleted[i])
+    {
+      const LevelSetInputType currentIndex = nodes[i]->first;
+      this->m_InternalGrid.SetPixel(currentIndex, outerStatus);
+      layer.erase(nodes[i]);
+      this->m_TermContainer->UpdatePixel(currentIndex + this->m_Offset, status, outerStatus);
+    }
+  }
+}
+
+template <unsigned int VDimension, typename TEquationContainer>
+bool
+UpdateShiSparseBlockLevelSet<VDimension, TEquationContainer>::Con(const LevelSetInputType &      idx,
+                                                                  const LevelSetLayerIdType &    currentStatus,
+                                                                  const LevelSetOutputRealType & currentUpdate) const
+{
+  const LevelSetLayerIdType oppositeStatus = -currentStatus;
+
+  for (const auto & offset : this->m_NeighborOffsets)
+  {
+    const LevelSetInputType neighborIndex = idx + offset;
+
+    if (this->m_InternalGrid.IsInside(neighborIndex) && this->m_InternalGrid.GetPixel(neighborIndex) == oppositeStatus)
+    {
+      const LevelSetOutputRealType neighborUpdate = this->m_TermContainer->Evaluate(neighborIndex + this->m_Offset);
+
+      if (neighborUpdate * currentUpdate > LevelSetOutputType{})
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+} // end namespace itk
+
+#endif // itkUpdateShiSparseBlockLevelSet_hxx
@@ -0,0 +1,191 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkUpdateWhitakerSparseBlockLevelSet_h
+#define itkUpdateWhitakerSparseBlockLevelSet_h
+
+#include "itkWhitakerSparseBlockLevelSetImage.h"
+#include "itkConnectedImageNeighborhoodShape.h"
+#include "itkMultiThreaderBase.h"
+
+#include <array>
+
+namespace itk
+{
+/**
+ *  \class UpdateWhitakerSparseBlockLevelSet
+ *  \brief Update of the layers of a WhitakerSparseBlockLevelSetImage
+ *
+ *  Performs the same update as UpdateWhitakerSparseLevelSet, with the same
+ *  calls to the terms in the same order, and thus the same result. The level
+ *  set is updated in place: its grids replace the label image and the map of
+ *  the temporary values, and the label map is rebuilt from the runs of the
+ *  status grid instead of from a label image covering the whole domain.
+ *
+ *  The neighbors of the nodes of the layers -1, +1, -2 and +2 are scanned in
+ *  parallel, since the new value of a node of these layers only depends on
+ *  the layers closer to the zero level set. The nodes are then moved, and the
+ *  terms updated, in the order of the layers. The update of the zero layer
+ *  is sequential, since each node depends on the nodes before it.
+ *
+ *  \tparam VDimension Dimension of the input space
+ *  \tparam TLevelSetValueType Output type (float or double) of the levelset function
+ *  \tparam TEquationContainer Container of the system of levelset equations
+ *  \ingroup ITKLevelSetsv4
+ */
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+class ITK_TEMPLATE_EXPORT UpdateWhitakerSparseBlockLevelSet : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(UpdateWhitakerSparseBlockLevelSet);
+
+  using Self = UpdateWhitakerSparseBlockLevelSet;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using Superclass = Object;
+
+  /** Method for creation through object factory */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(UpdateWhitakerSparseBlockLevelSet);
+
+  static constexpr unsigned int ImageDimension = VDimension;
+
+  using LevelSetOutputType = TLevelSetValueType;
+
+  static_assert(std::numeric_limits<LevelSetOutputType>::has_quiet_NaN,
+                "The values of the level set must be floating point numbers.");
+
+  using LevelSetType = WhitakerSparseBlockLevelSetImage<LevelSetOutputType, ImageDimension>;
+  using LevelSetPointer = typename LevelSetType::Pointer;
+  using LevelSetInputType = typename LevelSetType::InputType;
+  using LevelSetOffsetType = typename LevelSetType::OffsetType;
+  using LevelSetOutputRealType = typename LevelSetType::OutputRealType;
+
+  using LevelSetLayerIdType = typename LevelSetType::LayerIdType;
+  using LevelSetLayerType = typename LevelSetType::LayerType;
+  using LevelSetLayerIterator = typename LevelSetType::LayerIterator;
+
+  using StatusGridType = typename LevelSetType::StatusGridType;
+  using ValueGridType = typename LevelSetType::ValueGridType;
+
+  using EquationContainerType = TEquationContainer;
+  using EquationContainerPointer = typename EquationContainerType::Pointer;
+
+  using TermContainerType = typename EquationContainerType::TermContainerType;
+  using TermContainerPointer = typename EquationContainerType::TermContainerPointer;
+
+  /** Updates of the zero layer points, sorted like the zero layer */
+  using LevelSetNodePairType = std::pair<LevelSetInputType, LevelSetOutputType>;
+  using LevelSetUpdateType = std::vector<LevelSetNodePairType>;
+
+  /** Update the level set in place */
+  void
+  Update();
+
+  /** Set/Get the sparse level set image */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(LevelSet, LevelSetType);
+  itkGetModifiableObjectMacro(LevelSet, LevelSetType);
+  /** @ITKEndGrouping */
+  /** Set/Get the TimeStep for the update */
+  /** @ITKStartGrouping */
+  itkSetMacro(TimeStep, LevelSetOutputType);
+  itkGetMacro(TimeStep, LevelSetOutputType);
+  /** @ITKEndGrouping */
+  /** Get the RMS change for the update */
+  itkGetMacro(RMSChangeAccumulator, LevelSetOutputType);
+
+  /** Set/Get the Equation container for computing the update */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(EquationContainer, EquationContainerType);
+  itkGetModifiableObjectMacro(EquationContainer, EquationContainerType);
+  /** @ITKEndGrouping */
+  /** Set/Get the current level set id */
+  /** @ITKStartGrouping */
+  itkSetMacro(CurrentLevelSetId, IdentifierType);
+  itkGetMacro(CurrentLevelSetId, IdentifierType);
+  /** @ITKEndGrouping */
+  /** Set the update for all points in the zero layer, in the order of the
+   * zero layer */
+  void
+  SetUpdate(const LevelSetUpdateType & update);
+
+  /** Set/Get the number of work units used to update the layers */
+  /** @ITKStartGrouping */
+  void
+  SetNumberOfWorkUnits(ThreadIdType numberOfWorkUnits);
+  [[nodiscard]] ThreadIdType
+  GetNumberOfWorkUnits() const;
+  /** @ITKEndGrouping */
+
+protected:
+  UpdateWhitakerSparseBlockLevelSet();
+  ~UpdateWhitakerSparseBlockLevelSet() override = default;
+
+  /** Update zero level set layer by moving relevant points to layers -1 or 1 */
+  void
+  UpdateLayerZero();
+
+  /** Update the layer -2, -1, +1 or +2 by moving relevant points to the
+   * adjacent layers, or out of the band */
+  void
+  UpdateLayer(LevelSetLayerIdType status);
+
+  /** Move the points identified for the layer into it. The points moved into
+   * the layer -1 or +1 bring their neighbors outside of the band into the
+   * layer -2 or +2. */
+  void
+  MovePoints(LevelSetLayerIdType status);
+
+private:
+  using NodeListType = std::vector<LevelSetNodePairType>;
+  using NeighborOffsetsType = decltype(GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>());
+
+  /** Points moving into the layers -2 to +2, indexed by the layer plus 2 */
+  NodeListType &
+  GetNodesMovingInto(LevelSetLayerIdType status)
+  {
+    return m_NodesMovingInto[status + 2];
+  }
+
+  LevelSetOutputType m_TimeStep{};
+  LevelSetOutputType m_RMSChangeAccumulator{};
+  IdentifierType     m_CurrentLevelSetId{};
+
+  EquationContainerPointer m_EquationContainer{};
+  TermContainerPointer     m_TermContainer{};
+
+  LevelSetUpdateType m_Update{};
+  LevelSetPointer    m_LevelSet{};
+  LevelSetOffsetType m_Offset{};
+
+  std::array<NodeListType, 5> m_NodesMovingInto{};
+
+  const NeighborOffsetsType m_NeighborOffsets{
+    GenerateConnectedImageNeighborhoodShapeOffsets<ImageDimension, 1, false>()
+  };
+
+  MultiThreaderBase::Pointer m_MultiThreader{};
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkUpdateWhitakerSparseBlockLevelSet.hxx"
+#endif
+#endif // itkUpdateWhitakerSparseBlockLevelSet_h
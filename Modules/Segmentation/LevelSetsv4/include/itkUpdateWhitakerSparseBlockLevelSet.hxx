@@ -0,0 +1,400 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkUpdateWhitakerSparseBlockLevelSet_hxx
+#define itkUpdateWhitakerSparseBlockLevelSet_hxx
+
+#include "itkLexicographicCompare.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace itk
+{
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+UpdateWhitakerSparseBlockLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::
+  UpdateWhitakerSparseBlockLevelSet()
+  : m_TimeStep(NumericTraits<LevelSetOutputType>::OneValue())
+  , m_RMSChangeAccumulator(LevelSetOutputType{})
+  , m_CurrentLevelSetId(IdentifierType{})
+  , m_MultiThreader(MultiThreaderBase::New())
+{
+  this->m_Offset.Fill(0);
+}
+
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+void
+UpdateWhitakerSparseBlockLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::SetUpdate(
+  const LevelSetUpdateType & update)
+{
+  this->m_Update = update;
+}
+
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+void
+UpdateWhitakerSparseBlockLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::SetNumberOfWorkUnits(
+  ThreadIdType numberOfWorkUnits)
+{
+  if (numberOfWorkUnits != this->m_MultiThreader->GetNumberOfWorkUnits())
+  {
+    this->m_MultiThreader->SetNumberOfWorkUnits(numberOfWorkUnits);
+    this->Modified();
+  }
+}
+
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+ThreadIdType
+UpdateWhitakerSparseBlockLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::GetNumberOfWorkUnits() const
+{
+  return this->m_MultiThreader->GetNumberOfWorkUnits();
+}
+
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+void
+UpdateWhitakerSparseBlockLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::Update()
+{
+  if (this->m_LevelSet.IsNull())
+  {
+    itkGenericExceptionMacro("m_LevelSet is nullptr");
+  }
+  if (this->m_Update.empty())
+  {
+    itkGenericExceptionMacro("m_Update is empty");
+  }
+  if (this->m_LevelSet->GetLabelMap() == nullptr)
+  {
+    itkGenericExceptionMacro("The label map of m_LevelSet is nullptr");
+  }
+
+  this->m_Offset = this->m_LevelSet->GetDomainOffset();
+  this->m_TermContainer = this->m_EquationContainer->GetEquation(this->m_CurrentLevelSetId);
+
+  StatusGridType & statusGrid = this->m_LevelSet->GetModifiableStatusGrid();
+  ValueGridType &  valueGrid = this->m_LevelSet->GetModifiableValueGrid();
+
+  // During the update, the value grid holds the temporary values of the
+  // points of the band and of the points just outside of it. The other
+  // points have no temporary value, which is marked by a NaN of the sign of
+  // their status.
+  valueGrid.TransformPixels(
+    [](const LevelSetOutputType & value) {
+      return (Math::ExactlyEquals(value, LevelSetType::MinusThreeLayer()) ||
+              Math::ExactlyEquals(value, LevelSetType::PlusThreeLayer()))
+               ? std::copysign(std::numeric_limits<LevelSetOutputType>::quiet_NaN(), value)
+               : value;
+    },
+    this->m_MultiThreader);
+
+  for (const LevelSetLayerIdType status : { LevelSetType::MinusTwoLayer(), LevelSetType::PlusTwoLayer() })
+  {
+    const LevelSetLayerIdType outerStatus =
+      (status < 0) ? LevelSetType::MinusThreeLayer() : LevelSetType::PlusThreeLayer();
+
+    for (const auto & node : this->m_LevelSet->GetLayer(status))
+    {
+      valueGrid.SetPixel(node.first, status);
+
+      for (const auto & offset : this->m_NeighborOffsets)
+      {
+        const LevelSetInputType neighborIndex = node.first + offset;
+        if (statusGrid.IsInside(neighborIndex) && statusGrid.GetPixel(neighborIndex) == outerStatus)
+        {
+          valueGrid.SetPixel(neighborIndex, outerStatus);
+        }
+      }
+    }
+  }
+
+  this->UpdateLayerZero();
+  this->UpdateLayer(LevelSetType::MinusOneLayer());
+  this->UpdateLayer(LevelSetType::PlusOneLayer());
+  this->UpdateLayer(LevelSetType::MinusTwoLayer());
+  this->UpdateLayer(LevelSetType::PlusTwoLayer());
+
+  this->MovePoints(LevelSetType::ZeroLayer());
+  this->MovePoints(LevelSetType::MinusOneLayer());
+  this->MovePoints(LevelSetType::PlusOneLayer());
+  this->MovePoints(LevelSetType::MinusTwoLayer());
+  this->MovePoints(LevelSetType::PlusTwoLayer());
+
+  // The points left without a temporary value are outside of the band.
+  valueGrid.TransformPixels(
+    [](const LevelSetOutputType & value) {
+      return std::isnan(value) ? std::copysign(static_cast<LevelSetOutputType>(LevelSetType::PlusThreeLayer()), value)
+                               : value;
+    },
+    this->m_MultiThreader);
+
+  statusGrid.Compact(this->m_MultiThreader);
+  valueGrid.Compact(this->m_MultiThreader);
+  statusGrid.CopyToLabelMap(this->m_LevelSet->GetModifiableLabelMap(), this->m_MultiThreader);
+
+  this->m_LevelSet->Modified();
+  this->m_TermContainer = nullptr;
+}
+
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+void
+UpdateWhitakerSparseBlockLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::UpdateLayerZero()
+{
+  const StatusGridType & statusGrid = this->m_LevelSet->GetStatusGrid();
+  ValueGridType &        valueGrid = this->m_LevelSet->GetModifiableValueGrid();
+
+  LevelSetLayerType & layer0 = this->m_LevelSet->GetLayer(LevelSetType::ZeroLayer());
+
+  itkAssertInDebugAndIgnoreInReleaseMacro(this->m_Update.size() == layer0.size());
+
+  auto upIt = this->m_Update.begin();
+  for (auto nodeIt = layer0.begin(); nodeIt != layer0.end(); ++upIt)
+  {
+    itkAssertInDebugAndIgnoreInReleaseMacro(nodeIt->first == upIt->first);
+
+    const LevelSetInputType currentIndex = nodeIt->first;
+    const LevelSetInputType inputIndex = currentIndex + this->m_Offset;
+
+    const LevelSetOutputType currentValue = nodeIt->second;
+    LevelSetOutputType       tempUpdate = this->m_TimeStep * static_cast<LevelSetOutputType>(upIt->second);
+
+    if (tempUpdate > 0.5)
+    {
+      tempUpdate = 0.499;
+    }
+    else if (tempUpdate < -0.5)
+    {
+      tempUpdate = -0.499;
+    }
+
+    const LevelSetOutputType tempValue = currentValue + tempUpdate;
+    this->m_RMSChangeAccumulator += tempUpdate * tempUpdate;
+
+    if (tempValue > 0.5 || tempValue < -0.5)
+    {
+      // is there any point of the zero layer moving in the opposite direction?
+      const bool movesOut = (tempValue > 0.5);
+      bool       samedirection = true;
+
+      for (const auto & offset : this->m_NeighborOffsets)
+      {
+        const LevelSetInputType neighborIndex = currentIndex + offset;
+        if (statusGrid.IsInside(neighborIndex) && statusGrid.GetPixel(neighborIndex) == LevelSetType::ZeroLayer())
+        {
+          const LevelSetOutputType neighborValue = valueGrid.GetPixel(neighborIndex);
+          if (movesOut ? (neighborValue < -0.5) : (neighborValue > 0.5))
+          {
+            samedirection = false;
+          }
+        }
+      }
+
+      if (samedirection)
+      {
+        this->m_TermContainer->UpdatePixel(inputIndex, valueGrid.GetPixel(currentIndex), tempValue);
+        valueGrid.SetPixel(currentIndex, tempValue);
+
+        nodeIt = layer0.erase(nodeIt);
+        this->GetNodesMovingInto(movesOut ? LevelSetType::PlusOneLayer() : LevelSetType::MinusOneLayer())
+          .emplace_back(currentIndex, tempValue);
+      }
+      else
+      {
+        ++nodeIt;
+      }
+    }
+    else
+    {
+      this->m_TermContainer->UpdatePixel(inputIndex, valueGrid.GetPixel(currentIndex), tempValue);
+      valueGrid.SetPixel(currentIndex, tempValue);
+      nodeIt->second = tempValue;
+      ++nodeIt;
+    }
+  }
+}
+
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+void
+UpdateWhitakerSparseBlockLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::UpdateLayer(
+  LevelSetLayerIdType status)
+{
+  StatusGridType & statusGrid = this->m_LevelSet->GetModifiableStatusGrid();
+  ValueGridType &  valueGrid = this->m_LevelSet->GetModifiableValueGrid();
+
+  LevelSetLayerType & layer = this->m_LevelSet->GetLayer(status);
+
+  // The layers -1 and -2 take their values from the largest value of their
+  // neighbors closer to the zero level set, the layers +1 and +2 from the
+  // smallest one.
+  const bool                isInside = (status < 0);
+  const LevelSetLayerIdType innerStatus = isInside ? status + 1 : status - 1;
+  const LevelSetLayerIdType outerStatus = isInside ? status - 1 : status + 1;
+  const auto                distance = static_cast<LevelSetOutputType>(isInside ? -status : status);
+
+  std::vector<LevelSetLayerIterator> nodes;
+  nodes.reserve(layer.size());
+  for (auto nodeIt = layer.begin(); nodeIt != layer.end(); ++nodeIt)
+  {
+    nodes.push_back(nodeIt);
+  }
+
+  // The neighbors closer to the zero level set are not modified by this
+  // pass, so that the nodes are independent of each other.
+  std::vector<LevelSetOutputType> extrema(nodes.size());
+  std::vector<uint8_t>            hasInnerNeighbor(nodes.size(), 0);
+
+  this->m_MultiThreader->ParallelizeArray(
+    0,
+    nodes.size(),
+    [&](SizeValueType i) {
+      const LevelSetInputType currentIndex = nodes[i]->first;
+
+      LevelSetOutputType extremum =
+        isInside ? NumericTraits<LevelSetOutputType>::NonpositiveMin() : NumericTraits<LevelSetOutputType>::max();
+
+      for (const auto & offset : this->m_NeighborOffsets)
+      {
+        const LevelSetInputType neighborIndex = currentIndex + offset;
+        if (!statusGrid.IsInside(neighborIndex))
+        {
+          continue;
+        }
+
+        const LevelSetLayerIdType label = statusGrid.GetPixel(neighborIndex);
+        if (isInside ? (label >= innerStatus) : (label <= innerStatus))
+        {
+          if (label == innerStatus)
+          {
+            hasInnerNeighbor[i] = 1;
+          }
+          // The points without a temporary value are ignored.
+          const LevelSetOutputType neighborValue = valueGrid.GetPixel(neighborIndex);
+          extremum = isInside ? std::max(extremum, neighborValue) : std::min(extremum, neighborValue);
+        }
+      }
+      extrema[i] = extremum;
+    },
+    nullptr);
+
+  // The points leaving the band have no temporary value anymore.
+  const bool               isOuterLayer = (distance > 1);
+  const LevelSetOutputType missingValue =
+    std::copysign(std::numeric_limits<LevelSetOutputType>::quiet_NaN(), static_cast<LevelSetOutputType>(outerStatus));
+
+  for (SizeValueType i = 0; i < nodes.size(); ++i)
+  {
+    const LevelSetLayerIterator nodeIt = nodes[i];
+    const LevelSetInputType     currentIndex = nodeIt->first;
+    const LevelSetInputType     inputIndex = currentIndex + this->m_Offset;
+
+    if (hasInnerNeighbor[i])
+    {
+      const LevelSetOutputType value = isInside ? extrema[i] - 1. : extrema[i] + 1.;
+
+      this->m_TermContainer->UpdatePixel(inputIndex, valueGrid.GetPixel(currentIndex), value);
+      valueGrid.SetPixel(currentIndex, value);
+      nodeIt->second = value;
+
+      const LevelSetOutputType signedValue = isInside ? -value : value;
+      if (signedValue <= distance - 0.5)
+      {
+        layer.erase(nodeIt);
+        this->GetNodesMovingInto(innerStatus).emplace_back(currentIndex, value);
+      }
+      else if (signedValue > distance + 0.5)
+      {
+        layer.erase(nodeIt);
+        if (isOuterLayer)
+        {
+          statusGrid.SetPixel(currentIndex, outerStatus);
+          this->m_TermContainer->UpdatePixel(inputIndex, value, outerStatus);
+          valueGrid.SetPixel(currentIndex, missingValue);
+        }
+        else
+        {
+          this->GetNodesMovingInto(outerStatus).emplace_back(currentIndex, value);
+        }
+      }
+    }
+    else
+    {
+      const LevelSetOutputType value = nodeIt->second;
+      layer.erase(nodeIt);
+      if (isOuterLayer)
+      {
+        statusGrid.SetPixel(currentIndex, outerStatus);
+        this->m_TermContainer->UpdatePixel(inputIndex, value, outerStatus);
+        valueGrid.SetPixel(currentIndex, missingValue);
+      }
+      else
+      {
+        this->GetNodesMovingInto(outerStatus).emplace_back(currentIndex, value);
+      }
+    }
+  }
+}
+
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+void
+UpdateWhitakerSparseBlockLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::MovePoints(
+  LevelSetLayerIdType status)
+{
+  StatusGridType & statusGrid = this->m_LevelSet->GetModifiableStatusGrid();
+  ValueGridType &  valueGrid = this->m_LevelSet->GetModifiableValueGrid();
+
+  LevelSetLayerType & layer = this->m_LevelSet->GetLayer(status);
+  NodeListType &      nodes = this->GetNodesMovingInto(status);
+
+  const bool isAdjacentToZero = (status == LevelSetType::MinusOneLayer() || status == LevelSetType::PlusOneLayer());
+  if (isAdjacentToZero)
+  {
+    // The points are processed in the order of the layer, since the first
+    // one reaching an outer point sets its value.
+    std::sort(nodes.begin(), nodes.end(), [](const LevelSetNodePairType & a, const LevelSetNodePairType & b) {
+      return Functor::LexicographicCompare()(a.first, b.first);
+    });
+  }
+
+  const LevelSetLayerIdType outerStatus =
+    (status < 0) ? LevelSetType::MinusThreeLayer() : LevelSetType::PlusThreeLayer();
+  const LevelSetLayerIdType nextStatus = (status < 0) ? status - 1 : status + 1;
+  const auto                step = static_cast<LevelSetOutputType>((status < 0) ? -1 : 1);
+
+  for (const auto & node : nodes)
+  {
+    layer.insert(node);
+    statusGrid.SetPixel(node.first, status);
+
+    if (!isAdjacentToZero)
+    {
+      continue;
+    }
+
+    for (const auto & offset : this->m_NeighborOffsets)
+    {
+      const LevelSetInputType neighborIndex = node.first + offset;
+      if (statusGrid.IsInside(neighborIndex) && Math::ExactlyEquals(valueGrid.GetPixel(neighborIndex), outerStatus))
+      {
+        const LevelSetOutputType neighborValue = node.second + step;
+        valueGrid.SetPixel(neighborIndex, neighborValue);
+        this->GetNodesMovingInto(nextStatus).emplace_back(neighborIndex, neighborValue);
+
+        this->m_TermContainer->UpdatePixel(neighborIndex + this->m_Offset, outerStatus, neighborValue);
+      }
+    }
+  }
+  nodes.clear();
+}
+} // namespace itk
+#endif // itkUpdateWhitakerSparseBlockLevelSet_hxx
@@ -88,6 +88,11 @@ public:
   using TermContainerType = typename EquationContainerType::TermContainerType;
   using TermContainerPointer = typename EquationContainerType::TermContainerPointer;
 
+  /** Updates of the zero layer points, stored as a vector sorted like the
+   * zero layer rather than as a map to avoid one allocation per point. */
+  using LevelSetNodePairType = std::pair<LevelSetInputType, LevelSetOutputType>;
+  using LevelSetUpdateType = std::vector<LevelSetNodePairType>;
+
   using LabelImageType = Image<LevelSetLayerIdType, ImageDimension>;
   using LabelImagePointer = typename LabelImageType::Pointer;
 
@@ -123,9 +128,14 @@ public:
   itkSetMacro(CurrentLevelSetId, IdentifierType);
   itkGetMacro(CurrentLevelSetId, IdentifierType);
   /** @ITKEndGrouping */
-  /** Set the update map for all points in the zero layer */
+  /** Set the update for all points in the zero layer, in the order of the
+   * zero layer */
+  /** @ITKStartGrouping */
+  void
+  SetUpdate(const LevelSetUpdateType & update);
   void
   SetUpdate(const LevelSetLayerType & update);
+  /** @ITKEndGrouping */
 
 protected:
   UpdateWhitakerSparseLevelSet();
@@ -178,9 +188,9 @@ private:
 
   EquationContainerPointer m_EquationContainer{};
 
-  LevelSetLayerType m_Update{};
-  LevelSetPointer   m_InputLevelSet{};
-  LevelSetPointer   m_OutputLevelSet{};
+  LevelSetUpdateType m_Update{};
+  LevelSetPointer    m_InputLevelSet{};
+  LevelSetPointer    m_OutputLevelSet{};
 
   LevelSetPointer   m_TempLevelSet{};
   LevelSetLayerType m_TempPhi{};
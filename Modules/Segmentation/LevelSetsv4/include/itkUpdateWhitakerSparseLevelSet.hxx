@@ -39,11 +39,19 @@ UpdateWhitakerSparseLevelSet<VDimension, TLevelSetValueType, TEquationContainer>
 template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
 void
 UpdateWhitakerSparseLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::SetUpdate(
-  const LevelSetLayerType & update)
+  const LevelSetUpdateType & update)
 {
   this->m_Update = update;
 }
 
+template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
+void
+UpdateWhitakerSparseLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::SetUpdate(
+  const LevelSetLayerType & update)
+{
+  this->m_Update.assign(update.begin(), update.end());
+}
+
 template <unsigned int VDimension, typename TLevelSetValueType, typename TEquationContainer>
 void
 UpdateWhitakerSparseLevelSet<VDimension, TLevelSetValueType, TEquationContainer>::Update()
@@ -91,7 +99,7 @@ UpdateWhitakerSparseLevelSet<VDimension, TLevelSetValueType, TEquationContainer>
   // Here, we are adding all pairs of indices and levelset values to a map
   for (LevelSetLayerIdType status = LevelSetType::MinusOneLayer(); status < LevelSetType::PlusTwoLayer(); ++status)
   {
-    const LevelSetLayerType layer = this->m_InputLevelSet->GetLayer(status);
+    const LevelSetLayerType & layer = this->m_InputLevelSet->GetLayer(status);
 
     auto it = layer.begin();
     while (it != layer.end())
@@ -132,7 +140,7 @@ UpdateWhitakerSparseLevelSet<VDimension, TLevelSetValueType, TEquationContainer>
     ++it;
   }
 
-  LevelSetLayerType layerPlus2 = this->m_InputLevelSet->GetLayer(LevelSetType::PlusTwoLayer());
+  const LevelSetLayerType & layerPlus2 = this->m_InputLevelSet->GetLayer(LevelSetType::PlusTwoLayer());
 
   it = layerPlus2.begin();
   while (it != layerPlus2.end())
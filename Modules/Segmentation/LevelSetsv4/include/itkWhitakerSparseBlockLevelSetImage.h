@@ -0,0 +1,142 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkWhitakerSparseBlockLevelSetImage_h
+#define itkWhitakerSparseBlockLevelSetImage_h
+
+#include "itkWhitakerSparseLevelSetImage.h"
+#include "itkLevelSetSparseBlockGrid.h"
+
+namespace itk
+{
+/**
+ *  \class WhitakerSparseBlockLevelSetImage
+ *  \brief Whitaker sparse level set whose statuses and values are also kept in block grids
+ *
+ *  The layers and the label map are the ones of WhitakerSparseLevelSetImage,
+ *  and keep their interface. In addition, the status and the value of every
+ *  pixel are kept in a LevelSetSparseBlockGrid, so that Evaluate() and
+ *  Status() are answered in constant time instead of searching the layers
+ *  and the label objects.
+ *
+ *  The grids are rebuilt from the layers and the label map by SetLabelMap()
+ *  and Graft(). The layers must therefore be filled before setting the label
+ *  map, as BinaryImageToLevelSetImageAdaptor does, or InitializeGrids() must
+ *  be called after modifying them. The LevelSetEvolution specialized for this
+ *  type maintains the grids and the layers together, in parallel.
+ *
+ *  \tparam TOutput Output type (float or double) of the level set function
+ *  \tparam VDimension Dimension of the input space
+ *  \ingroup ITKLevelSetsv4
+ */
+template <typename TOutput, unsigned int VDimension>
+class ITK_TEMPLATE_EXPORT WhitakerSparseBlockLevelSetImage : public WhitakerSparseLevelSetImage<TOutput, VDimension>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(WhitakerSparseBlockLevelSetImage);
+
+  using Self = WhitakerSparseBlockLevelSetImage;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using Superclass = WhitakerSparseLevelSetImage<TOutput, VDimension>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(WhitakerSparseBlockLevelSetImage);
+
+  static constexpr unsigned int Dimension = VDimension;
+
+  using typename Superclass::InputType;
+  using typename Superclass::OutputType;
+  using typename Superclass::OutputRealType;
+  using typename Superclass::LayerIdType;
+  using typename Superclass::LabelMapType;
+  using typename Superclass::LayerType;
+
+  using StatusGridType = LevelSetSparseBlockGrid<LayerIdType, VDimension>;
+  using ValueGridType = LevelSetSparseBlockGrid<OutputType, VDimension>;
+
+  /** Returns the value of the level set function at a given location inputIndex */
+  using Superclass::Evaluate;
+  OutputType
+  Evaluate(const InputType & inputIndex) const override;
+
+  /** Returns the layer affiliation of a given location inputIndex */
+  LayerIdType
+  Status(const InputType & inputIndex) const override;
+
+  /** Set the label map, and rebuild the grids from it and from the layers */
+  void
+  SetLabelMap(LabelMapType * labelMap) override;
+
+  /** Graft data object as level set object */
+  void
+  Graft(const DataObject * data) override;
+
+  /** Rebuild the grids from the label map and the layers */
+  void
+  InitializeGrids();
+
+  /** Get the grid of the statuses, indexed like the label map */
+  /** @ITKStartGrouping */
+  const StatusGridType &
+  GetStatusGrid() const
+  {
+    return m_StatusGrid;
+  }
+  StatusGridType &
+  GetModifiableStatusGrid()
+  {
+    return m_StatusGrid;
+  }
+  /** @ITKEndGrouping */
+
+  /** Get the grid of the values, indexed like the label map */
+  /** @ITKStartGrouping */
+  const ValueGridType &
+  GetValueGrid() const
+  {
+    return m_ValueGrid;
+  }
+  ValueGridType &
+  GetModifiableValueGrid()
+  {
+    return m_ValueGrid;
+  }
+  /** @ITKEndGrouping */
+
+protected:
+  WhitakerSparseBlockLevelSetImage() = default;
+  ~WhitakerSparseBlockLevelSetImage() override = default;
+
+  /** Initialize the label map point, the sparse-field layers and the grids */
+  void
+  Initialize() override;
+
+private:
+  StatusGridType m_StatusGrid{};
+  ValueGridType  m_ValueGrid{};
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkWhitakerSparseBlockLevelSetImage.hxx"
+#endif
+
+#endif // itkWhitakerSparseBlockLevelSetImage_h
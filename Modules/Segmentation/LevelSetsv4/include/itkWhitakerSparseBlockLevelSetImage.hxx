@@ -0,0 +1,127 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkWhitakerSparseBlockLevelSetImage_hxx
+#define itkWhitakerSparseBlockLevelSetImage_hxx
+
+
+namespace itk
+{
+
+template <typename TOutput, unsigned int VDimension>
+auto
+WhitakerSparseBlockLevelSetImage<TOutput, VDimension>::Evaluate(const InputType & inputIndex) const -> OutputType
+{
+  if (this->m_LabelMap.IsNull())
+  {
+    itkGenericExceptionMacro("Note: m_LabelMap is nullptr");
+  }
+
+  const InputType mapIndex = inputIndex - this->m_DomainOffset;
+  if (!m_ValueGrid.IsInside(mapIndex))
+  {
+    return static_cast<OutputType>(this->PlusThreeLayer());
+  }
+  return m_ValueGrid.GetPixel(mapIndex);
+}
+
+
+template <typename TOutput, unsigned int VDimension>
+auto
+WhitakerSparseBlockLevelSetImage<TOutput, VDimension>::Status(const InputType & inputIndex) const -> LayerIdType
+{
+  const InputType mapIndex = inputIndex - this->m_DomainOffset;
+  if (!m_StatusGrid.IsInside(mapIndex))
+  {
+    return this->PlusThreeLayer();
+  }
+  return m_StatusGrid.GetPixel(mapIndex);
+}
+
+
+template <typename TOutput, unsigned int VDimension>
+void
+WhitakerSparseBlockLevelSetImage<TOutput, VDimension>::SetLabelMap(LabelMapType * labelMap)
+{
+  Superclass::SetLabelMap(labelMap);
+  this->InitializeGrids();
+}
+
+
+template <typename TOutput, unsigned int VDimension>
+void
+WhitakerSparseBlockLevelSetImage<TOutput, VDimension>::Graft(const DataObject * data)
+{
+  Superclass::Graft(data);
+
+  const auto * levelSet = dynamic_cast<const Self *>(data);
+  if (levelSet == this)
+  {
+    return;
+  }
+  if (levelSet)
+  {
+    m_StatusGrid = levelSet->m_StatusGrid;
+    m_ValueGrid = levelSet->m_ValueGrid;
+  }
+  else
+  {
+    this->InitializeGrids();
+  }
+}
+
+
+template <typename TOutput, unsigned int VDimension>
+void
+WhitakerSparseBlockLevelSetImage<TOutput, VDimension>::InitializeGrids()
+{
+  if (this->m_LabelMap.IsNull())
+  {
+    m_StatusGrid.Clear();
+    m_ValueGrid.Clear();
+    return;
+  }
+
+  m_StatusGrid.CopyFromLabelMap(this->m_LabelMap.GetPointer());
+  m_ValueGrid.CopyFromLabelMap(this->m_LabelMap.GetPointer());
+
+  for (const auto & layer : this->m_Layers)
+  {
+    for (const auto & node : layer.second)
+    {
+      if (m_ValueGrid.IsInside(node.first))
+      {
+        m_ValueGrid.SetPixel(node.first, node.second);
+      }
+    }
+  }
+}
+
+
+template <typename TOutput, unsigned int VDimension>
+void
+WhitakerSparseBlockLevelSetImage<TOutput, VDimension>::Initialize()
+{
+  Superclass::Initialize();
+
+  m_StatusGrid.Clear();
+  m_ValueGrid.Clear();
+}
+
+} // namespace itk
+
+#endif // itkWhitakerSparseBlockLevelSetImage_hxx
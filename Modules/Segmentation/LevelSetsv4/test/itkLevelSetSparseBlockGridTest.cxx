@@ -0,0 +1,121 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkLevelSetSparseBlockGrid.h"
+#include "itkLabelMap.h"
+#include "itkLabelObject.h"
+#include "itkIndexRange.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int Dimension{ 2 };
+
+using LayerIdType = int8_t;
+using GridType = itk::LevelSetSparseBlockGrid<LayerIdType, Dimension>;
+using LabelObjectType = itk::LabelObject<LayerIdType, Dimension>;
+using LabelMapType = itk::LabelMap<LabelObjectType>;
+using RegionType = GridType::RegionType;
+using IndexType = GridType::IndexType;
+
+bool
+IsSameAsLabelMap(const GridType & grid, const LabelMapType * labelMap, const RegionType & region)
+{
+  for (const IndexType & index : itk::ImageRegionIndexRange<Dimension>(region))
+  {
+    if (grid.GetPixel(index) != labelMap->GetPixel(index))
+    {
+      std::cerr << "Pixel " << index << " is " << static_cast<int>(grid.GetPixel(index)) << " instead of "
+                << static_cast<int>(labelMap->GetPixel(index)) << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int
+itkLevelSetSparseBlockGridTest(int, char *[])
+{
+  // A region which is not a multiple of the blocks, and does not start at 0.
+  const RegionType region{ { { -3, 2 } }, { { 21, 13 } } };
+
+  GridType grid;
+  grid.Initialize(region, 3);
+
+  ITK_TEST_EXPECT_EQUAL(grid.GetNumberOfBlocks(), 6);
+  ITK_TEST_EXPECT_EQUAL(grid.GetNumberOfAllocatedBlocks(), 0);
+  ITK_TEST_EXPECT_EQUAL(grid.GetNumberOfRows(), 13);
+  ITK_TEST_EXPECT_TRUE(grid.IsInside(IndexType{ { -3, 2 } }));
+  ITK_TEST_EXPECT_TRUE(!grid.IsInside(IndexType{ { 18, 2 } }));
+
+  // Setting the value of a uniform block does not allocate it.
+  grid.SetPixel(IndexType{ { 0, 5 } }, 3);
+  ITK_TEST_EXPECT_EQUAL(grid.GetNumberOfAllocatedBlocks(), 0);
+
+  grid.SetPixel(IndexType{ { 0, 5 } }, -1);
+  ITK_TEST_EXPECT_EQUAL(grid.GetNumberOfAllocatedBlocks(), 1);
+  ITK_TEST_EXPECT_EQUAL(static_cast<int>(grid.GetPixel(IndexType{ { 0, 5 } })), -1);
+  ITK_TEST_EXPECT_EQUAL(static_cast<int>(grid.GetPixel(IndexType{ { 1, 5 } })), 3);
+
+  // A block whose pixels are equal again is released.
+  auto multiThreader = itk::MultiThreaderBase::New();
+  grid.SetPixel(IndexType{ { 0, 5 } }, 3);
+  grid.Compact(multiThreader);
+  ITK_TEST_EXPECT_EQUAL(grid.GetNumberOfAllocatedBlocks(), 0);
+
+  // A label map with a square inside a band.
+  auto labelMap = LabelMapType::New();
+  labelMap->SetRegions(region);
+  labelMap->SetBackgroundValue(3);
+  for (const IndexType & index : itk::ImageRegionIndexRange<Dimension>(RegionType{ { { 1, 4 } }, { { 12, 9 } } }))
+  {
+    const bool isBorder = index[0] == 1 || index[0] == 12 || index[1] == 4 || index[1] == 12;
+    labelMap->SetPixel(index, isBorder ? -1 : -3);
+  }
+
+  grid.CopyFromLabelMap(labelMap.GetPointer());
+  ITK_TEST_EXPECT_EQUAL(grid.GetRegion(), region);
+  ITK_TEST_EXPECT_TRUE(IsSameAsLabelMap(grid, labelMap, region));
+  ITK_TEST_EXPECT_TRUE(grid.GetNumberOfAllocatedBlocks() < grid.GetNumberOfBlocks());
+
+  auto copy = LabelMapType::New();
+  copy->SetRegions(region);
+  copy->SetBackgroundValue(3);
+  grid.CopyToLabelMap(copy.GetPointer(), multiThreader);
+  ITK_TEST_EXPECT_EQUAL(copy->GetNumberOfLabelObjects(), 2);
+  ITK_TEST_EXPECT_TRUE(IsSameAsLabelMap(grid, copy, region));
+
+  // Without a region, the grid covers the lines of the label objects.
+  auto labelMapWithoutRegion = LabelMapType::New();
+  labelMapWithoutRegion->SetBackgroundValue(3);
+  labelMapWithoutRegion->SetPixel(IndexType{ { 3, 4 } }, -1);
+  labelMapWithoutRegion->SetPixel(IndexType{ { 5, 9 } }, 1);
+
+  grid.CopyFromLabelMap(labelMapWithoutRegion.GetPointer());
+  const RegionType boundingBox{ { { 3, 4 } }, { { 3, 6 } } };
+  ITK_TEST_EXPECT_EQUAL(grid.GetRegion(), boundingBox);
+  ITK_TEST_EXPECT_TRUE(IsSameAsLabelMap(grid, labelMapWithoutRegion, boundingBox));
+
+  grid.Clear();
+  ITK_TEST_EXPECT_EQUAL(grid.GetNumberOfBlocks(), 0);
+  ITK_TEST_EXPECT_TRUE(!grid.IsInside(IndexType{ { 3, 4 } }));
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
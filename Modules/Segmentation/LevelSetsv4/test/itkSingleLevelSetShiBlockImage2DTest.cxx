@@ -0,0 +1,206 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkLevelSetContainer.h"
+#include "itkLevelSetEquationChanAndVeseInternalTerm.h"
+#include "itkLevelSetEquationChanAndVeseExternalTerm.h"
+#include "itkLevelSetEquationTermContainer.h"
+#include "itkLevelSetEquationContainer.h"
+#include "itkSinRegularizedHeavisideStepFunction.h"
+#include "itkLevelSetEvolution.h"
+#include "itkBinaryImageToLevelSetImageAdaptor.h"
+#include "itkLevelSetEvolutionNumberOfIterationsStoppingCriterion.h"
+#include "itkTestingMacros.h"
+
+#include <type_traits>
+
+namespace
+{
+constexpr unsigned int Dimension{ 2 };
+
+using InputPixelType = unsigned short;
+using InputImageType = itk::Image<InputPixelType, Dimension>;
+using InputIteratorType = itk::ImageRegionIteratorWithIndex<InputImageType>;
+
+using SparseLevelSetType = itk::ShiSparseLevelSetImage<Dimension>;
+using BlockLevelSetType = itk::ShiSparseBlockLevelSetImage<Dimension>;
+
+// Evolve a square towards a bright disc with the given number of work units
+// and return the resulting level set.
+template <typename TLevelSet>
+typename TLevelSet::Pointer
+EvolveLevelSet(InputImageType * input, itk::ThreadIdType numberOfWorkUnits)
+{
+  using BinaryToSparseAdaptorType = itk::BinaryImageToLevelSetImageAdaptor<InputImageType, TLevelSet>;
+  using LevelSetContainerType = itk::LevelSetContainer<itk::IdentifierType, TLevelSet>;
+  using ChanAndVeseInternalTermType =
+    itk::LevelSetEquationChanAndVeseInternalTerm<InputImageType, LevelSetContainerType>;
+  using ChanAndVeseExternalTermType =
+    itk::LevelSetEquationChanAndVeseExternalTerm<InputImageType, LevelSetContainerType>;
+  using TermContainerType = itk::LevelSetEquationTermContainer<InputImageType, LevelSetContainerType>;
+  using EquationContainerType = itk::LevelSetEquationContainer<TermContainerType>;
+  using LevelSetEvolutionType = itk::LevelSetEvolution<EquationContainerType, TLevelSet>;
+  using LevelSetOutputRealType = typename TLevelSet::OutputRealType;
+  using HeavisideFunctionBaseType =
+    itk::SinRegularizedHeavisideStepFunction<LevelSetOutputRealType, LevelSetOutputRealType>;
+  using StoppingCriterionType = itk::LevelSetEvolutionNumberOfIterationsStoppingCriterion<LevelSetContainerType>;
+
+  auto binary = InputImageType::New();
+  binary->SetRegions(input->GetLargestPossibleRegion());
+  binary->CopyInformation(input);
+  binary->AllocateInitialized();
+
+  for (InputIteratorType iIt(binary, { { { 20, 20 } }, { { 16, 16 } } }); !iIt.IsAtEnd(); ++iIt)
+  {
+    iIt.Set(itk::NumericTraits<InputPixelType>::OneValue());
+  }
+
+  auto adaptor = BinaryToSparseAdaptorType::New();
+  adaptor->SetInputImage(binary);
+  adaptor->Initialize();
+
+  const typename TLevelSet::Pointer levelSet = adaptor->GetModifiableLevelSet();
+
+  auto heaviside = HeavisideFunctionBaseType::New();
+  heaviside->SetEpsilon(2.0);
+
+  auto lscontainer = LevelSetContainerType::New();
+  lscontainer->SetHeaviside(heaviside);
+  lscontainer->AddLevelSet(0, levelSet, false);
+
+  auto cvInternalTerm = ChanAndVeseInternalTermType::New();
+  cvInternalTerm->SetInput(input);
+  cvInternalTerm->SetCoefficient(1.0);
+
+  auto cvExternalTerm = ChanAndVeseExternalTermType::New();
+  cvExternalTerm->SetInput(input);
+  cvExternalTerm->SetCoefficient(1.0);
+
+  auto termContainer = TermContainerType::New();
+  termContainer->SetInput(input);
+  termContainer->SetCurrentLevelSetId(0);
+  termContainer->SetLevelSetContainer(lscontainer);
+  termContainer->AddTerm(0, cvInternalTerm);
+  termContainer->AddTerm(1, cvExternalTerm);
+
+  auto equationContainer = EquationContainerType::New();
+  equationContainer->AddEquation(0, termContainer);
+  equationContainer->SetLevelSetContainer(lscontainer);
+
+  auto criterion = StoppingCriterionType::New();
+  criterion->SetNumberOfIterations(15);
+
+  auto evolution = LevelSetEvolutionType::New();
+  evolution->SetEquationContainer(equationContainer);
+  evolution->SetStoppingCriterion(criterion);
+  evolution->SetLevelSetContainer(lscontainer);
+  if constexpr (std::is_same_v<TLevelSet, BlockLevelSetType>)
+  {
+    evolution->SetNumberOfWorkUnits(numberOfWorkUnits);
+  }
+  evolution->Update();
+
+  return levelSet;
+}
+
+// Check that the block-backed level set has the same layers and statuses as
+// the map-backed one.
+bool
+IsSameLevelSet(const SparseLevelSetType * expected, const BlockLevelSetType * levelSet, const InputImageType * input)
+{
+  for (const SparseLevelSetType::LayerIdType layerId :
+       { SparseLevelSetType::MinusOneLayer(), SparseLevelSetType::PlusOneLayer() })
+  {
+    if (expected->GetLayer(layerId) != levelSet->GetLayer(layerId))
+    {
+      std::cerr << "Layer " << static_cast<int>(layerId) << " differs: " << levelSet->GetLayer(layerId).size()
+                << " nodes instead of " << expected->GetLayer(layerId).size() << std::endl;
+      return false;
+    }
+  }
+
+  for (itk::ImageRegionConstIteratorWithIndex<InputImageType> it(input, input->GetLargestPossibleRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    const InputImageType::IndexType index = it.GetIndex();
+    if (expected->Status(index) != levelSet->Status(index) || expected->Evaluate(index) != levelSet->Evaluate(index))
+    {
+      std::cerr << "The level sets differ at " << index << ": status " << static_cast<int>(levelSet->Status(index))
+                << " instead of " << static_cast<int>(expected->Status(index)) << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int
+itkSingleLevelSetShiBlockImage2DTest(int, char *[])
+{
+  // A bright disc on a dark background.
+  auto input = InputImageType::New();
+  input->SetRegions(InputImageType::SizeType{ { 64, 64 } });
+  input->Allocate();
+  for (InputIteratorType iIt(input, input->GetLargestPossibleRegion()); !iIt.IsAtEnd(); ++iIt)
+  {
+    const double dx = iIt.GetIndex()[0] - 30.0;
+    const double dy = iIt.GetIndex()[1] - 34.0;
+    iIt.Set((dx * dx + dy * dy < 18.0 * 18.0) ? 200 : 20);
+  }
+
+  SparseLevelSetType::Pointer expected;
+  ITK_TRY_EXPECT_NO_EXCEPTION(expected = EvolveLevelSet<SparseLevelSetType>(input, 1));
+
+  BlockLevelSetType::Pointer singleThreaded;
+  ITK_TRY_EXPECT_NO_EXCEPTION(singleThreaded = EvolveLevelSet<BlockLevelSetType>(input, 1));
+
+  BlockLevelSetType::Pointer multiThreaded;
+  ITK_TRY_EXPECT_NO_EXCEPTION(multiThreaded = EvolveLevelSet<BlockLevelSetType>(input, 4));
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(singleThreaded, ShiSparseBlockLevelSetImage, ShiSparseLevelSetImage);
+
+  // The layers are updated with the same calls to the terms, in the same
+  // order, whatever the number of work units.
+  if (!IsSameLevelSet(expected, singleThreaded, input))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "The block-backed level set differs from the map-backed one." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!IsSameLevelSet(expected, multiThreaded, input))
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "The block-backed level set differs with multiple work units." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (expected->GetLayer(SparseLevelSetType::MinusOneLayer()).empty())
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "The layer -1 is empty." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Inside and outside of the band, most of the blocks take a single value.
+  const BlockLevelSetType::StatusGridType & statusGrid = singleThreaded->GetStatusGrid();
+  ITK_TEST_EXPECT_TRUE(statusGrid.GetNumberOfAllocatedBlocks() < statusGrid.GetNumberOfBlocks());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
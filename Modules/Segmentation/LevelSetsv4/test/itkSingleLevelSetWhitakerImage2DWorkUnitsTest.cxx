@@ -0,0 +1,162 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkLevelSetContainer.h"
+#include "itkLevelSetEquationChanAndVeseInternalTerm.h"
+#include "itkLevelSetEquationChanAndVeseExternalTerm.h"
+#include "itkLevelSetEquationTermContainer.h"
+#include "itkLevelSetEquationContainer.h"
+#include "itkSinRegularizedHeavisideStepFunction.h"
+#include "itkLevelSetEvolution.h"
+#include "itkBinaryImageToLevelSetImageAdaptor.h"
+#include "itkLevelSetEvolutionNumberOfIterationsStoppingCriterion.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int Dimension{ 2 };
+
+using InputPixelType = unsigned short;
+using InputImageType = itk::Image<InputPixelType, Dimension>;
+using InputIteratorType = itk::ImageRegionIteratorWithIndex<InputImageType>;
+
+using PixelType = float;
+using SparseLevelSetType = itk::WhitakerSparseLevelSetImage<PixelType, Dimension>;
+
+// Evolve a square towards a bright disc with the given number of work units
+// and return the resulting level set.
+SparseLevelSetType::Pointer
+EvolveLevelSet(InputImageType * input, itk::ThreadIdType numberOfWorkUnits)
+{
+  using BinaryToSparseAdaptorType = itk::BinaryImageToLevelSetImageAdaptor<InputImageType, SparseLevelSetType>;
+  using LevelSetContainerType = itk::LevelSetContainer<itk::IdentifierType, SparseLevelSetType>;
+  using ChanAndVeseInternalTermType =
+    itk::LevelSetEquationChanAndVeseInternalTerm<InputImageType, LevelSetContainerType>;
+  using ChanAndVeseExternalTermType =
+    itk::LevelSetEquationChanAndVeseExternalTerm<InputImageType, LevelSetContainerType>;
+  using TermContainerType = itk::LevelSetEquationTermContainer<InputImageType, LevelSetContainerType>;
+  using EquationContainerType = itk::LevelSetEquationContainer<TermContainerType>;
+  using LevelSetEvolutionType = itk::LevelSetEvolution<EquationContainerType, SparseLevelSetType>;
+  using LevelSetOutputRealType = SparseLevelSetType::OutputRealType;
+  using HeavisideFunctionBaseType =
+    itk::SinRegularizedHeavisideStepFunction<LevelSetOutputRealType, LevelSetOutputRealType>;
+  using StoppingCriterionType = itk::LevelSetEvolutionNumberOfIterationsStoppingCriterion<LevelSetContainerType>;
+
+  auto binary = InputImageType::New();
+  binary->SetRegions(input->GetLargestPossibleRegion());
+  binary->CopyInformation(input);
+  binary->AllocateInitialized();
+
+  for (InputIteratorType iIt(binary, { { { 20, 20 } }, { { 16, 16 } } }); !iIt.IsAtEnd(); ++iIt)
+  {
+    iIt.Set(itk::NumericTraits<InputPixelType>::OneValue());
+  }
+
+  auto adaptor = BinaryToSparseAdaptorType::New();
+  adaptor->SetInputImage(binary);
+  adaptor->Initialize();
+
+  const SparseLevelSetType::Pointer levelSet = adaptor->GetModifiableLevelSet();
+
+  auto heaviside = HeavisideFunctionBaseType::New();
+  heaviside->SetEpsilon(1.0);
+
+  auto lscontainer = LevelSetContainerType::New();
+  lscontainer->SetHeaviside(heaviside);
+  lscontainer->AddLevelSet(0, levelSet, false);
+
+  auto cvInternalTerm = ChanAndVeseInternalTermType::New();
+  cvInternalTerm->SetInput(input);
+  cvInternalTerm->SetCoefficient(1.0);
+
+  auto cvExternalTerm = ChanAndVeseExternalTermType::New();
+  cvExternalTerm->SetInput(input);
+  cvExternalTerm->SetCoefficient(1.0);
+
+  auto termContainer = TermContainerType::New();
+  termContainer->SetInput(input);
+  termContainer->SetCurrentLevelSetId(0);
+  termContainer->SetLevelSetContainer(lscontainer);
+  termContainer->AddTerm(0, cvInternalTerm);
+  termContainer->AddTerm(1, cvExternalTerm);
+
+  auto equationContainer = EquationContainerType::New();
+  equationContainer->AddEquation(0, termContainer);
+  equationContainer->SetLevelSetContainer(lscontainer);
+
+  auto criterion = StoppingCriterionType::New();
+  criterion->SetNumberOfIterations(15);
+
+  auto evolution = LevelSetEvolutionType::New();
+  evolution->SetEquationContainer(equationContainer);
+  evolution->SetStoppingCriterion(criterion);
+  evolution->SetLevelSetContainer(lscontainer);
+  evolution->SetNumberOfWorkUnits(numberOfWorkUnits);
+  evolution->Update();
+
+  return levelSet;
+}
+} // namespace
+
+int
+itkSingleLevelSetWhitakerImage2DWorkUnitsTest(int, char *[])
+{
+  // A bright disc on a dark background.
+  auto input = InputImageType::New();
+  input->SetRegions(InputImageType::SizeType{ { 64, 64 } });
+  input->Allocate();
+  for (InputIteratorType iIt(input, input->GetLargestPossibleRegion()); !iIt.IsAtEnd(); ++iIt)
+  {
+    const double dx = iIt.GetIndex()[0] - 30.0;
+    const double dy = iIt.GetIndex()[1] - 34.0;
+    iIt.Set((dx * dx + dy * dy < 18.0 * 18.0) ? 200 : 20);
+  }
+
+  SparseLevelSetType::Pointer singleThreaded;
+  ITK_TRY_EXPECT_NO_EXCEPTION(singleThreaded = EvolveLevelSet(input, 1));
+
+  SparseLevelSetType::Pointer multiThreaded;
+  ITK_TRY_EXPECT_NO_EXCEPTION(multiThreaded = EvolveLevelSet(input, 4));
+
+  // The zero layer updates are computed in parallel and merged in layer
+  // order, so the evolution does not depend on the number of work units.
+  for (SparseLevelSetType::LayerIdType layerId = SparseLevelSetType::MinusTwoLayer();
+       layerId <= SparseLevelSetType::PlusTwoLayer();
+       ++layerId)
+  {
+    const SparseLevelSetType::LayerType & expectedLayer = singleThreaded->GetLayer(layerId);
+    const SparseLevelSetType::LayerType & layer = multiThreaded->GetLayer(layerId);
+    if (expectedLayer != layer)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Layer " << static_cast<int>(layerId) << " differs with multiple work units: " << layer.size()
+                << " nodes instead of " << expectedLayer.size() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (singleThreaded->GetLayer(SparseLevelSetType::ZeroLayer()).empty())
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "The zero layer is empty." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}